@@ -70,7 +70,7 @@ $(OUT_DIR)/$(TRG_BASE) : $(INT_DIR)/$(TRG_SRC_BASE).o $(LIB_DIR)/$(UTILITIES_LIB
 	gcc -I../Include -o $(OUT_DIR)/$(TRG_BASE) $(INT_DIR)/$(TRG_SRC_BASE).o \
 											   $(LIB_DIR)/$(UTILITIES_LIB_NAME) \
 											   $(LIB_DIR)/$(CSMAP_LIB_NAME).a \
-											   -lm -lc -lgcc -lstdc++
+											   -lm -lc -lgcc -lstdc++ -lpthread
 
 $(LIB_DIR)/$(UTILITIES_LIB_NAME) :
 	$(MAKE) -e -C ./Source -f ConsolUtilitiesLib.mak
@@ -26,6 +26,8 @@
 */
 
 #include "cs_map.h"
+#include "cs_wkt.h"
+#include "cs_NameMapperSupport.h"
 
 #if _RUN_TIME < _rt_UNIXPCC
 #	include <conio.h>		/* for acknowledgment */
@@ -58,6 +60,7 @@ int main (int argc,char *argv [])
 	extern char cs_Gxname [];
 	extern char cs_OptchrC;
 	extern char cs_DirsepC;
+	extern char cs_NameMapperName [];
 	extern int cs_Sortbs;
 	extern union cs_Bswap_ cs_BswapU;
 
@@ -68,6 +71,9 @@ int main (int argc,char *argv [])
 	int crypt;
 	int demo;
 	int extents;
+	int mappable;
+	int incremental;
+	int bundle;
 	int test;
 	int warn;
 	int flags;
@@ -85,6 +91,7 @@ int main (int argc,char *argv [])
 	char mr_path [MAXPATH];
 	char gp_path [MAXPATH];
 	char gx_path [MAXPATH];
+	char bn_path [MAXPATH];
 
 #if _MEM_MODEL == _mm_VIRTUAL
 	cs_Sortbs = (128 * 1024);
@@ -109,6 +116,9 @@ int main (int argc,char *argv [])
 	extents = TRUE;			/* Extents are normally on, option turns
 							   them off. */
 	warn = FALSE;
+	mappable = FALSE;
+	incremental = FALSE;
+	bundle = FALSE;
 	src_dir [0] = '\0';
 	dst_dir [0] = '\0';
 	for (ii = 1;ii < argc;ii++)
@@ -137,6 +147,21 @@ int main (int argc,char *argv [])
 			{
 				extents = FALSE;
 			}
+			else if (*cp == 'i' || *cp == 'I')
+			{
+				/* Incremental compilation of the Coordsys, Datums,
+				   and Geodetic Transformation dictionaries. */
+
+				incremental = TRUE;
+			}
+			else if (*cp == 'm' || *cp == 'M')
+			{
+				/* Also produce the native byte order mappable
+				   images of the Coordsys, Datums, and Elipsoid
+				   dictionaries, and the compiled Name Mapper. */
+
+				mappable = TRUE;
+			}
 			else if (*cp == 's' || *cp == 'S')
 			{
 				/* Force CS_bswap to think that it is running
@@ -154,6 +179,14 @@ int main (int argc,char *argv [])
 			{
 				test = TRUE;
 			}
+			else if (*cp == 'u' || *cp == 'U')
+			{
+				/* Also bundle the results, and the other files
+				   in the result directory the library reads, into
+				   a single dictionary bundle. */
+
+				bundle = TRUE;
+			}
 			else if (*cp == 'w' || *cp == 'W')
 			{
 				warn = TRUE;
@@ -223,6 +256,8 @@ int main (int argc,char *argv [])
 	if (test)    flags |= cs_CMPLR_TEST;
 	if (warn)    flags |= cs_CMPLR_WARN;
 	if (extents) flags |= cs_CMPLR_EXTENTS;
+	if (mappable) flags |= cs_CMPLR_MAPPABLE;
+	if (incremental) flags |= cs_CMPLR_INCR;
 	strcpy (cs_DirP,cs_Elname);
 	strcpy (el_path,cs_Dir);
 	strcpy (cs_DirP,cs_Dtname);
@@ -237,6 +272,8 @@ int main (int argc,char *argv [])
 	strcpy (gx_path,cs_Dir);
 	strcpy (cs_DirP,cs_Gpname);
 	strcpy (gp_path,cs_Dir);
+	strcpy (cs_DirP,cs_BUNDLE_NAME);
+	strcpy (bn_path,cs_Dir);
 	*cs_DirP = '\0';
 	strcpy (mr_path,cs_Dir);
 
@@ -312,6 +349,34 @@ int main (int argc,char *argv [])
 		return (1);
 	}
 
+	/* Compile the Name Mapper, if there is one in the result directory. */
+	if (mappable)
+	{
+		strcpy (cs_DirP,cs_NameMapperName);
+		if (CS_access (cs_Dir,4) == 0)
+		{
+			printf ("Compiling %s.\n",cs_Dir);
+			if (csCompileNameMapper () != 0)
+			{
+				printf ("Compilation of the Name Mapper failed.\n");
+				if (!batch) acknowledge ();
+				return (1);
+			}
+		}
+		*cs_DirP = '\0';
+	}
+
+	/* Bundle the results. */
+	if (bundle)
+	{
+		printf ("Bundling %s to %s.\n",mr_path,bn_path);
+		if (CS_bundleWrite (bn_path,mr_path,NULL) != 0)
+		{
+			printf ("Bundling of %s failed.\n",mr_path);
+			if (!batch) acknowledge ();
+			return (1);
+		}
+	}
 
 	/* We're done. */
 	printf ("All dictionaries compiled successfully.\n");
@@ -389,6 +454,6 @@ void usage (void)
 {
 	extern char cs_OptchrC;
 
-	(void)printf ("Usage: CS_COMP [%cc] [%cb] [%cd] [%ct] [source_dir [result_dir]]\n",cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC);
+	(void)printf ("Usage: CS_COMP [%cc] [%cb] [%cd] [%ct] [%cm] [%ci] [%cu] [source_dir [result_dir]]\n",cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC,cs_OptchrC);
 	return;
 }
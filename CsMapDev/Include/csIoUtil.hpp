@@ -56,6 +56,7 @@ extern "C"
 	extern char cs_DirsepC;
 	extern short cs_Protect;
 	extern int cs_Error;
+	extern int cs_DefIndex;
 
 	/**********************************************************************
 	Hook function to support the use of temporary coordinate systems.
@@ -438,6 +439,225 @@ int CS_DefinitionRead(csFILE *& strm, TCsMapStruct *& def, char (&keyName)[_KeyN
 	return (1);
 }
 
+/***************************************************************************************
+Resident index of a definition dictionary.  The user and system dictionaries are read
+once, in the same order [DefinitionGet] searches them, and every definition is kept in
+decoded form.  The first definition of any given key name wins, so a user definition
+masks a system definition of the same name just as it does when searching the files.
+Key names are hashed case insensitively with open addressing.
+
+The index records the directories it was built from, and the size and modification
+time of the dictionary file in each; it is rebuilt when any of these changes, e.g.
+when the dictionary is replaced on disk or recompiled.  It must be invalidated
+explicitly when the dictionary is written through the definition functions.
+[fileName] is the name of the dictionary file, e.g. [cs_Csname].
+***************************************************************************************/
+template<class TCsMapStruct>
+class TcsDefinitionIndex
+{
+private:
+	std::vector<TCsMapStruct> m_defs;
+	std::vector<unsigned> m_dirIndices;
+	std::vector<int> m_buckets;
+	std::vector<char const*> m_dirs;
+	size_t m_keyOffset;
+	bool m_isValid;
+	char const* m_fileName;
+	char m_sysDir[MAXPATH];
+	char m_userDir[MAXPATH];
+	cs_Time_ m_modTimes[2];			//user, then system, dictionary file
+	ulong32_t m_sizes[2];
+
+	char const* KeyOf(TCsMapStruct const& def) const
+	{
+		return reinterpret_cast<char const*>(&def) + this->m_keyOffset;
+	}
+
+	//obtains the modification time and size of the user and system dictionary files
+	void GetStamp(char const* sysDir, cs_Time_ (&modTimes)[2], ulong32_t (&sizes)[2]) const
+	{
+		char const* dirs[2] = { cs_UserDir, sysDir };
+		char filePath[MAXPATH + 32];
+
+		for (int i = 0; i < 2; ++i)
+		{
+			modTimes[i] = 0;
+			sizes[i] = 0UL;
+			size_t length = strlen(dirs[i]);
+			if (0 == length || (length + strlen(this->m_fileName) + 2) > sizeof(filePath))
+				continue;
+
+			memcpy(filePath, dirs[i], length);
+			if (filePath[length - 1] != cs_DirsepC)
+				filePath[length++] = cs_DirsepC;
+			strcpy(filePath + length, this->m_fileName);
+			modTimes[i] = CS_fileModTime(filePath);
+			sizes[i] = CS_fileSize(filePath);
+		}
+	}
+
+	bool Build(char const* sysDir,
+		cs_Time_ const (&modTimes)[2], ulong32_t const (&sizes)[2],
+		csFILE* (*TOpen)(const char* mode),
+		int (*TRead)(csFILE*, TCsMapStruct*),
+		int (*TReadCrypt)(csFILE*, TCsMapStruct*, int*))
+	{
+		this->Invalidate();
+
+		try
+		{
+			CsdDictionaryIterator dictionaryIterator(TOpen);
+			while(dictionaryIterator.MoveNext())
+			{
+				csFILE* dictionaryFile = dictionaryIterator.GetCurrentFile();
+
+				this->m_dirs.push_back(strdup(dictionaryIterator.GetCurrentDir()));
+				if (NULL == this->m_dirs.back())
+					throw std::bad_alloc();
+
+				__ALIGNMENT__1			/* For some versions of Sun compiler. */
+				TCsMapStruct def;
+				int readStatus;
+				while ((readStatus = (TRead ? TRead(dictionaryFile, &def) : TReadCrypt(dictionaryFile, &def, NULL))) > 0)
+				{
+					this->m_defs.push_back(def);
+					this->m_dirIndices.push_back((unsigned)(this->m_dirs.size() - 1));
+				}
+				if (readStatus < 0)
+				{
+					this->Invalidate();
+					return false;
+				}
+			}
+
+			size_t bucketCount = 64;
+			while (bucketCount < (this->m_defs.size() * 2))
+				bucketCount <<= 1;
+			this->m_buckets.assign(bucketCount, -1);
+			for (size_t i = 0; i < this->m_defs.size(); ++i)
+			{
+				char const* keyName = this->KeyOf(this->m_defs[i]);
+				size_t slot = CS_strihash(keyName, NULL) & (bucketCount - 1);
+				while (this->m_buckets[slot] >= 0)
+				{
+					if (0 == CS_stricmp(this->KeyOf(this->m_defs[this->m_buckets[slot]]), keyName))
+						break;
+					slot = (slot + 1) & (bucketCount - 1);
+				}
+				if (this->m_buckets[slot] < 0)
+					this->m_buckets[slot] = (int)i;
+			}
+		}
+		catch(std::bad_alloc&)
+		{
+			this->Invalidate();
+			return false;
+		}
+
+		CS_stncp(this->m_sysDir, sysDir, sizeof(this->m_sysDir));
+		CS_stncp(this->m_userDir, cs_UserDir, sizeof(this->m_userDir));
+		for (int i = 0; i < 2; ++i)
+		{
+			this->m_modTimes[i] = modTimes[i];
+			this->m_sizes[i] = sizes[i];
+		}
+		this->m_isValid = true;
+		return true;
+	}
+
+public:
+	TcsDefinitionIndex(char const* fileName) : m_keyOffset(0), m_isValid(false), m_fileName(fileName)
+	{
+		this->m_sysDir[0] = '\0';
+		this->m_userDir[0] = '\0';
+		this->m_modTimes[0] = this->m_modTimes[1] = 0;
+		this->m_sizes[0] = this->m_sizes[1] = 0UL;
+	}
+
+	~TcsDefinitionIndex()
+	{
+		this->Invalidate();
+	}
+
+	void Invalidate()
+	{
+		for (size_t i = 0; i < this->m_dirs.size(); ++i)
+			free((char*)this->m_dirs[i]);
+
+		//swap with empty vectors to actually release the memory
+		std::vector<TCsMapStruct>().swap(this->m_defs);
+		std::vector<unsigned>().swap(this->m_dirIndices);
+		std::vector<int>().swap(this->m_buckets);
+		std::vector<char const*>().swap(this->m_dirs);
+		this->m_isValid = false;
+	}
+
+	/* Returns 1 if the definition was found and copied to [def], 0 if the
+	   dictionaries don't carry it, and -1 if the index is not available;
+	   in which case the caller is to search the files as usual.  [keyOffset]
+	   is the offset of the key name within the definition structure. */
+	int Lookup(char const* keyName, size_t keyOffset, TCsMapStruct& def, char* pszDirPath,
+		csFILE* (*TOpen)(const char* mode),
+		int (*TRead)(csFILE*, TCsMapStruct*),
+		int (*TReadCrypt)(csFILE*, TCsMapStruct*, int*))
+	{
+		if (0 == cs_DefIndex)
+			return -1;
+
+		char sysDir[MAXPATH];
+		if (CS_getdr(sysDir))
+			return -1;
+
+		cs_Time_ modTimes[2];
+		ulong32_t sizes[2];
+		this->GetStamp(sysDir, modTimes, sizes);
+
+		if (!this->m_isValid || this->m_keyOffset != keyOffset ||
+			0 != strcmp(this->m_sysDir, sysDir) || 0 != strcmp(this->m_userDir, cs_UserDir) ||
+			modTimes[0] != this->m_modTimes[0] || modTimes[1] != this->m_modTimes[1] ||
+			sizes[0] != this->m_sizes[0] || sizes[1] != this->m_sizes[1])
+		{
+			this->m_keyOffset = keyOffset;
+			if (!this->Build(sysDir, modTimes, sizes, TOpen, TRead, TReadCrypt))
+				return -1;
+		}
+
+		size_t bucketMask = this->m_buckets.size() - 1;
+		size_t slot = CS_strihash(keyName, NULL) & bucketMask;
+		for (int defIndex; (defIndex = this->m_buckets[slot]) >= 0; slot = (slot + 1) & bucketMask)
+		{
+			if (0 == CS_stricmp(this->KeyOf(this->m_defs[defIndex]), keyName))
+			{
+				def = this->m_defs[defIndex];
+				if (NULL != pszDirPath)
+					CS_stncp(pszDirPath, this->m_dirs[this->m_dirIndices[defIndex]], MAXPATH);
+				return 1;
+			}
+		}
+		return 0;
+	}
+};
+
+//invalidates a resident index when going out of scope, i.e. after the
+//dictionary has been written; the writing itself may well have used the index
+template<class TCsMapStruct>
+class TcsDefinitionIndexReset
+{
+private:
+	TcsDefinitionIndex<TCsMapStruct>& m_index;
+
+public:
+	TcsDefinitionIndexReset(TcsDefinitionIndex<TCsMapStruct>& index) : m_index(index)
+	{
+		this->m_index.Invalidate();
+	}
+
+	~TcsDefinitionIndexReset()
+	{
+		this->m_index.Invalidate();
+	}
+};
+
 template<class TCsMapStruct, int notFoundErrorCode, size_t _KeyNameSize>
 TCsMapStruct* DefinitionGet(
 	TCsMapStruct& keyDef,
@@ -448,7 +668,8 @@ TCsMapStruct* DefinitionGet(
 	int (*TReadCrypt)(csFILE*, TCsMapStruct*, int*),
 	int (*TCompare)(TCsMapStruct const* pp, TCsMapStruct const* qq),
 	int (*TUserDefPtr)(TCsMapStruct*, char const*) = NULL,
-	int* isUsrDef = NULL)
+	int* isUsrDef = NULL,
+	TcsDefinitionIndex<TCsMapStruct>* pIndex = NULL)
 {
 	cs_Error = 0;
 
@@ -491,6 +712,32 @@ TCsMapStruct* DefinitionGet(
 	if (CSnampp(keyName, _KeyNameSize))
 		return NULL;
 
+	/* Use the resident index, if there is one. */
+	if (NULL != pIndex)
+	{
+		__ALIGNMENT__3			/* For some versions of Sun compiler. */
+		TCsMapStruct indexDef;
+		const size_t keyOffset = (size_t)(reinterpret_cast<char*>(keyName) - reinterpret_cast<char*>(&keyDef));
+		int indexStatus = pIndex->Lookup(keyName, keyOffset, indexDef, pszDirPath, TOpen, TRead, TReadCrypt);
+		if (indexStatus > 0)
+		{
+			TCsMapStruct* pDef = (TCsMapStruct*) CS_malc (blockSize);
+			if (NULL == pDef)
+			{
+				CS_erpt (cs_NO_MEM);
+				return NULL;
+			}
+			memmove (pDef, &indexDef, sizeof(*pDef));
+			return pDef;
+		}
+		if (0 == indexStatus)
+		{
+			CS_stncp (csErrnam, keyName, MAXPATH);
+			CS_erpt (notFoundErrorCode);
+			return NULL;
+		}
+	}
+
 	CsdDictionaryIterator dictionaryIterator(TOpen);
 
 	//go through all directories we've
@@ -714,6 +961,69 @@ error:
 	return -1;
 }
 
+/***************************************************************************************
+Get all definitions out of the dictionaries (system and user), in a single allocation.
+The order is the same as that of DefinitionGetAll; duplicates are not checked.
+Parameters:
+    pAllDefs        Set to a malloc'ed array of the definitions themselves. The caller
+                    releases the whole thing with a single CS_free.
+    TOpen           File open function.
+    TRead           Function to read dictionaries non encrypted.
+    TReadCrypt      Optional. Function to read encrypted dictionaries.
+
+Return the total of definitions read.
+	-1 ... failure
+	>=0 ... success
+***************************************************************************************/
+template<class TCsMapStruct>
+int DefinitionGetAllEx(TCsMapStruct* *pAllDefs,
+	csFILE* (*TOpen)(const char* mode),
+	int (*TRead)(csFILE*, TCsMapStruct*),
+	int (*TReadCrypt)(csFILE*, TCsMapStruct*, int*))
+{
+	cs_Error = 0;
+
+	CS_CHECK_NULL_ARG_RETURN(pAllDefs, 1, -1);
+	*pAllDefs = NULL;
+
+	if (NULL == TReadCrypt && NULL == TRead)
+	{
+		CS_erpt(cs_ISER);
+		return -1;
+	}
+
+	CsdDictionaryIterator dictionaryIterator(TOpen);
+	std::vector<TCsMapStruct> allDefs;
+
+	TCsMapStruct def;
+	int readStatus = 0;
+	int wasCrypted = 0;
+
+	while(dictionaryIterator.MoveNext())
+	{
+		csFILE* dictionaryFile = dictionaryIterator.GetCurrentFile();
+		while ((readStatus = (NULL != TReadCrypt) ? TReadCrypt(dictionaryFile, &def, &wasCrypted) :
+													TRead(dictionaryFile, &def)) > 0)
+		{
+			allDefs.push_back(def);
+		}
+		if (readStatus) //the last read status must be 0, i.e. EOF
+			return -1;
+	}
+
+	//always allocate something, so that success never returns NULL
+	(*pAllDefs) = (TCsMapStruct*)CS_malc((allDefs.empty() ? 1 : allDefs.size()) * sizeof(TCsMapStruct));
+	if (NULL == *pAllDefs)
+	{
+		CS_erpt(cs_NO_MEM);
+		return -1;
+	}
+	if (!allDefs.empty())
+		memcpy(*pAllDefs, &allDefs[0], allDefs.size() * sizeof(TCsMapStruct));
+
+	return (int)allDefs.size();
+}
+
 template<class TCsMapStruct>
 int CS_DefinitionWrite (csFILE *& strm, TCsMapStruct *& def, const char* const swapFormat = NULL, unsigned char* encryptKeyAddress = NULL, int (*TSwap)(TCsMapStruct*) = NULL)
 {
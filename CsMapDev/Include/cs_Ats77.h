@@ -90,12 +90,19 @@ struct cs_Ats77_
 	char fileName [32];				/* File name of the data file. */
 };
 
+#ifdef __cplusplus
+extern "C" {
+#endif
 struct cs_Ats77_ *CSnewAts77 (Const char *filePath,ulong32_t flags,double density);
 void CSreleaseAts77 (struct cs_Ats77_ *thisPtr);
 void CSdeleteAts77 (struct cs_Ats77_ *thisPtr);
 enum cs_Ats77Dir_ CSdirectionAts77 (Const struct cs_Ats77_ *thisPtr);
 double CStestAts77 (Const struct cs_Ats77_ *thisPtr,enum cs_Ats77Dir_ direction,Const double point [2]);
 int CScalcAts77 (Const struct cs_Ats77_ *thisPtr,double ll_out [2],Const double ll_in [2]);
+int CScalcAts77N (Const struct cs_Ats77_ *thisPtr,double ll_out [][3],int status [],Const double ll_in [][3],int count);
 Const char *CSsourceAts77 (Const struct cs_Ats77_ *thisPtr);
 double CS_Ats77TestFunction (void);
+#ifdef __cplusplus
+}
+#endif
 
@@ -231,6 +231,154 @@ private:
 };
 //newPage//
 //=============================================================================
+// TcsCsvView Object -- A field of a CSV record as it appears in the buffer of
+//                      the TcsCsvReader object which produced it.
+//
+// A view does not own the characters it refers to and is valid only as long
+// as the buffer of the reader which produced it.  The quotes which enclose a
+// quoted field are not part of the view.  Escape characters, and carriage
+// returns within a quoted field, remain in the buffer; in this case Escape
+// is set to the escape character and the conversion functions remove them.
+// Fields which need no such processing, the vast majority, have a null
+// Escape value and are converted without any intermediate copy.
+//
+// The buffer is expected to be UTF-8.  Byte sequences which are not valid
+// UTF-8 are converted as Latin-1; which is what older CSV files usually are.
+//=============================================================================
+class TcsCsvView
+{
+public:
+	//=========================================================================
+	// Construction, Destruction, Assignment
+	TcsCsvView (void) : Ptr (0),Length (0),Escape ('\0') {};
+	TcsCsvView (const char* ptr,size_t length,char escape = '\0')
+						: Ptr (ptr),Length (length),Escape (escape) {};
+	//=========================================================================
+	// Public Named Member Functions
+	bool Empty (void) const {return (Length == 0); };
+	char FirstChar (void) const {return (Length != 0) ? *Ptr : '\0'; };
+	bool IsEqual (const char* asciiString) const;
+	void AsWide (std::wstring& result) const;
+	unsigned long AsULong (void) const;
+	long AsLong (void) const;
+	double AsDouble (void) const;
+	//=========================================================================
+	// Public Named Data Members
+	const char* Ptr;
+	size_t Length;
+	char Escape;		// non-zero says field must be unescaped.
+};
+//=============================================================================
+// TcsCsvReader Object -- Extracts records and fields from a CSV file without
+//                        copying them.
+//
+// The entire file is memory mapped where the run time library supports it,
+// and read into memory otherwise.  Alternatively, the user may attach the
+// reader to a buffer which the user owns; which must then outlive the reader
+// and any views it produces.
+//
+// NextRecord locates the extent of the next record, allowing for new lines
+// within quoted fields, but does not split the record into fields.  Fields
+// are split upon request, and only as far as the highest numbered field
+// requested so far.  Thus, reading only the first few fields of a long
+// record costs nothing for the fields which are never referenced.
+//
+// Record and field syntax, including the whitespace trimming, the limits,
+// and the status values, are those of csGetCsvRecord and csCsvFieldParse;
+// except that a final record which is not terminated by a new line is
+// accepted, and a UTF-8 byte order mark at the beginning of the buffer is
+// skipped.  The delimiters are specified in the same manner, but must be
+// ASCII characters.
+//
+// Nothing here throws; errors are reported by status value.
+//=============================================================================
+class TcsCsvReader
+{
+	static const short KcsMaxFields = 300;
+	static const size_t KcsMaxFieldLength = 10000;
+	static const size_t KcsMaxRecordLength = 100000;
+public:
+	//=========================================================================
+	// Construction, Destruction, Assignment
+	TcsCsvReader (const wchar_t* delimiters = 0);
+	~TcsCsvReader (void);
+	//=========================================================================
+	// Public Named Member Functions
+	bool Open (const char* filePath);
+	void Attach (const char* buffer,size_t bufferSize);
+	void Close (void);
+	bool IsOpen (void) const {return (Buffer != 0); };
+	void Rewind (void);
+	EcsCsvStatus NextRecord (void);
+	unsigned long GetLineNbr (void) const {return RecordLineNbr; };
+	TcsCsvView GetRecord (void) const;
+	short FieldCount (void);
+	EcsCsvStatus GetField (TcsCsvView& field,short fieldNbr);
+	EcsCsvStatus GetField (std::wstring& field,short fieldNbr);
+	EcsCsvStatus RecordStatus (void) const {return FieldStatus; };
+	const char* GetBuffer (void) const {return Buffer; };
+	size_t GetBufferSize (void) const {return BufferSize; };
+private:
+	//=========================================================================
+	// Private Support Functions
+	TcsCsvReader (const TcsCsvReader& source);				// not implemented
+	TcsCsvReader& operator= (const TcsCsvReader& rhs);		// not implemented
+	bool ParseField (void);
+	//=========================================================================
+	// Private Data Members
+	char Separator;
+	char Quote;
+	char Escape;
+	char Comment;
+	bool Mapped;			// Buffer is mapped, must be unmapped.
+	bool Owned;				// Buffer was allocated, must be freed.
+	const char* Buffer;
+	size_t BufferSize;
+	const char* Next;		// beginning of the record after the current one
+	const char* RecBeg;
+	const char* RecEnd;
+	const char* Cursor;		// beginning of the first field not yet split
+	bool Exhausted;			// all fields of the current record are split
+	unsigned long LineNbr;	// line number of the record after the current one
+	unsigned long RecordLineNbr;
+	EcsCsvStatus FieldStatus;
+	std::vector<TcsCsvView> Fields;
+};
+//=============================================================================
+// TcsCsvTable Object -- Columnar in-memory image of a CSV file.
+//
+// Stores a view of each field of each record, organized by column, so that
+// scanning a column touches only the views of that column.  No field data is
+// copied; the views refer to the buffer of the reader from which the table
+// was loaded, and that reader must remain open as long as the table is used.
+// Records with fewer fields than the widest record have empty views for the
+// missing fields.
+//=============================================================================
+class TcsCsvTable
+{
+public:
+	//=========================================================================
+	// Construction, Destruction, Assignment
+	TcsCsvTable (void);
+	~TcsCsvTable (void);
+	//=========================================================================
+	// Public Named Member Functions
+	bool Load (TcsCsvReader& reader,bool firstIsLabels,TcsCsvStatus& status,bool allowEmptyLines = false);
+	void Clear (void);
+	unsigned RecordCount (void) const {return RecCount; };
+	short FieldCount (void) const {return static_cast<short>(Columns.size ()); };
+	short GetFldNbr (const wchar_t* fieldId) const;
+	const std::vector<TcsCsvView>& GetColumn (short fieldNbr) const;
+	const TcsCsvView& GetView (unsigned recordNbr,short fieldNbr) const;
+	bool GetField (std::wstring& field,unsigned recordNbr,short fieldNbr) const;
+	bool GetFieldLabel (std::wstring& label,short fieldNbr) const;
+private:
+	unsigned RecCount;
+	std::vector<std::wstring> Labels;
+	std::vector<std::vector<TcsCsvView> > Columns;
+};
+//newPage//
+//=============================================================================
 // TcsCsvFileBase Object -- Encapsulates the functionality of a Comma Separated
 //                          Value file.
 //=============================================================================
@@ -293,6 +441,8 @@ public:
 	bool StableSort (const TcsCsvSortFunctor& functor);
 	unsigned LowerBound (const TcsCsvRecord& searchRec,const TcsCsvSortFunctor& functor);
 	bool ReadFromStream (std::wistream& iStrm,bool firstIsLabels,TcsCsvStatus& status);
+	bool ReadFromReader (TcsCsvReader& reader,bool firstIsLabels,TcsCsvStatus& status);
+	bool ReadFromFile (const char* filePath,bool firstIsLabels,TcsCsvStatus& status);
 	bool AppendRecord (const TcsCsvRecord& newRecord,TcsCsvStatus& status);
 	// Frequent use of RemoveRecord will be very painful performance wise.
 	bool RemoveRecord (unsigned recordNbr,TcsCsvStatus& status);
@@ -258,6 +258,13 @@ struct TcsEpsgFldMap
 	short        FieldNbr;
 	wchar_t      FieldName [64];
 };
+// Identifies a field, other than the CodeKeyField, which carries the code of
+// a record in another table and by which the table is frequently searched.
+struct TcsEpsgFKeyMap
+{
+	EcsEpsgTable TableId;
+	EcsEpsgField FieldId;
+};
 
 struct TcsEpsgCsysTypeMap
 {
@@ -306,6 +313,11 @@ EcsEpsgTable GetEpsgTableId (const wchar_t* tableName);
 EcsEpsgField GetEpsgCodeFieldId (EcsEpsgTable tableId);
 short GetEpsgCodeFieldNbr (EcsEpsgTable tableId);
 short GetEpsgFieldNumber (EcsEpsgTable tableId,EcsEpsgField fieldId);
+EcsEpsgField GetEpsgForeignKeyId (EcsEpsgTable tableId,unsigned index);
+
+// The table of EPSG tables; terminated by an entry with a TableId of
+// epsgTblUnknown.
+extern const TcsEpsgTblMap KcsEpsgTblMap [];
 
 EcsCsysType GetEpsgCsysType (const wchar_t* csysTypeName);
 EcsCrsType GetEpsgCrsType (const wchar_t* crsTypeName);
@@ -399,10 +411,10 @@ private:
 // 3> Provides getting field data in the specific forms useful for dealing
 //    with EPSG type data.
 //
-// Currently, there are several tables which are sorted by the EPSG code
-// value.  In this case, generating an Index for the table is superfluous,
-// a simple binary search (i.e. lower_bound) would work just as well.
-// Eliminating this redundancy remains a "TODO" item.
+// The index is a sorted array of (code, record number) pairs which is binary
+// searched.  Fields designated as foreign keys (see KcsEpsgFKeyMap) are
+// indexed in the same manner, so that locating the records which refer to a
+// given code does not require a linear search of the table.
 //
 class TcsEpsgTable : public TcsCsvFileBase
 {
@@ -416,6 +428,7 @@ public:
 	//=========================================================================
 	// Construction  /  Destruction  /  Assignment
 	TcsEpsgTable (const TcsEpsgTblMap& tblMap,const wchar_t* databaseFldr);
+	TcsEpsgTable (const TcsEpsgTblMap& tblMap,const char*& snapshot,const char* snapshotEnd);
 	TcsEpsgTable (const TcsEpsgTable& source);
 	virtual ~TcsEpsgTable (void);
 	TcsEpsgTable& operator= (const TcsEpsgTable& rhs);
@@ -477,11 +490,30 @@ public:
 	// function.
 	TcsCsvStatus& GetCsvStatus (void);
 	const TcsCsvStatus& GetCsvStatus (void) const;
+
+	// Writes the table, sorted and indexed, to a TcsEpsgDataSetV6 snapshot.
+	bool WriteSnapshot (csFILE* outStrm) const;
 private:
+	//=========================================================================
+	// Private Types
+	struct TcsKeyEntry
+	{
+		bool operator< (const TcsKeyEntry& rhs) const
+		{
+			return (Code < rhs.Code) || (Code == rhs.Code && RecNbr < rhs.RecNbr);
+		};
+		ulong32_t Code;
+		ulong32_t RecNbr;
+	};
+	typedef std::vector<TcsKeyEntry> TcsKeyIndex;
 	//=========================================================================
 	// Private Support Functions
+	void InitializeTable (const TcsEpsgTblMap& tblMap);
 	bool PrepareCsvFile (void);
 	bool BuildEpsgIndex (short fldNbr,TcsCsvStatus& csvStatus);
+	bool BuildKeyIndex (TcsKeyIndex& keyIndex,short fldNbr,TcsCsvStatus& csvStatus);
+	const TcsKeyIndex* GetForeignKeyIndex (EcsEpsgField fieldId) const;
+	bool ReadSnapshot (const char*& snapshot,const char* snapshotEnd);
 	//=========================================================================
 	// Private Data Members
 	bool Ok;								// true = construction succeeded
@@ -490,7 +522,8 @@ private:
 	EcsEpsgTable TableId;					// The ID of this table.
 	EcsEpsgField CodeKeyField;				// ID of EPSG unique identifying code
 	TcsCsvSortFunctor SortFunctor;			// Specifies sort order for this table
-	std::map<TcsEpsgCode,unsigned> CodeIndex;
+	TcsKeyIndex CodeIndex;					// Sorted by code, which is unique
+	std::vector<std::pair<EcsEpsgField,TcsKeyIndex> > ForeignKeys;
 	TcsCsvStatus CsvStatus;					// Status of CSV operations
 };
 //newPage//
@@ -514,9 +547,15 @@ public:
 	// Static Constants, Variables, and Member Functions
     static short GetFldNbr (EcsEpsgTable tableId,EcsEpsgField fieldId);
     static short GetFldName (std::wstring& fieldName,EcsEpsgTable tableId,EcsEpsgField fieldId);
+	// The snapshot resides in the snapshot folder given to the constructor;
+	// there is none if no snapshot folder is given.  When the size and the
+	// modification time of each .CSV file are those recorded in the snapshot,
+	// it is loaded instead of the .CSV files.
+	static const wchar_t SnapshotName [32];
     //=========================================================================
 	// Construction  /  Destruction  /  Assignment
-	TcsEpsgDataSetV6 (const wchar_t* databaseFolder,const wchar_t* revLevel = 0);
+	TcsEpsgDataSetV6 (const wchar_t* databaseFolder,const wchar_t* revLevel = 0,
+													const wchar_t* snapshotFolder = 0);
 	TcsEpsgDataSetV6 (const TcsEpsgDataSetV6& source);
 	virtual ~TcsEpsgDataSetV6 (void);
 	TcsEpsgDataSetV6& operator= (const TcsEpsgDataSetV6& rhs);
@@ -536,6 +575,7 @@ public:
 															 TcsEpsgCode srcUomCode) const;
 	const wchar_t* GetRevisionLevel (void) const;
 	std::wstring GetFailMessage (void) const;
+	bool WriteSnapshot (void) const;
 	//=========================================================================
 	// Some general access functions:
 	// Step through an EPSG table one record at a time.
@@ -599,6 +639,9 @@ protected:
 															 const TcsEpsgCode& prmCode) const;
 	bool AddDatumParameterValues (struct cs_Dtdef_& datum,const TcsEpsgCode& operationCode) const;
 	bool DetermineRevisionLevel (void);
+	bool GetSnapshotPath (char* pathBufr,size_t bufrSize) const;
+	bool LoadSnapshot (void);
+	void LoadTables (void);
 private:
 	//=========================================================================
 	// Private Support Functions
@@ -614,6 +657,8 @@ private:
 	bool Ok;
 	std::wstring RevisionLevel;				// The revision level of the EPSG data in this object
 	std::wstring DatabaseFolder;			// The folder in which the .CSV files reside.
+	std::wstring SnapshotFolder;			// The folder in which the snapshot resides,
+											// empty if no snapshot is to be used.
 	std::wstring FailMessage;
 	std::map<EcsEpsgTable,TcsEpsgTable*> EpsgTables;
 											// The individual tables of the EPSG dataset.
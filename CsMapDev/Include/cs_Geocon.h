@@ -441,6 +441,10 @@ void CSreleaseGeoconFile (struct cs_GeoconFile_* thisPtr);
 void CSdeleteGeoconFile (struct cs_GeoconFile_* thisPtr);
 double CStestGeoconFile (struct cs_GeoconFile_* thisPtr,Const double *sourceLL);
 int CScalcGeoconFile (struct cs_GeoconFile_* thisPtr,double* result,Const double* sourceLL);
+int CScalcGeoconFileN (struct cs_GeoconFile_* thisPtr,double results [],int status [],
+																		Const double sourceLL [][3],
+																		int count);
+int CSgatherGeoconFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL);
 int CSextractGeoconGridFile (struct csGeocnGridCell_ *gridCellPtr,struct cs_GeoconFile_* thisPtr,
 																  long32_t eleNbr,
 																  long32_t recNbr);
@@ -452,6 +456,8 @@ int CSedgeGeocnGridCell (struct csGeocnGridCell_ *cellPtr,struct cs_GeoconFile_*
 														  long32_t recNbr,
 														  enum csGeocnEdgeEffects edge);
 void CSinitGeocnGridCell (struct csGeocnGridCell_* thisPtr);
+void CSgatherGeocnGridCell (struct csGeocnGridCell_* thisPtr,double nodes [9],double delta [2],
+																  Const double *sourceLL);
 double CScalcGeocnGridCell (struct csGeocnGridCell_* thisPtr,Const double *sourceLL);
 const char *CSsourceGeocnGridCell (struct csGeocnGridCell_* thisPtr);
 double EXP_LVL9 CSgeocnQterp (struct csGeocnGridCell_* thisPtr,double sourceDelta [2]);
@@ -51,6 +51,10 @@
 #define csGRIDI_ST_FALLBACK  2
 #define csGRIDI_ST_SYSTEM   -1
 
+/* Number of points processed per block by the batch grid interpolation
+   functions.  Bounds the amount of stack used for the gathered cell data. */
+#define csGRIDI_BATCH       64
+
 /*
 	The following define the extensions of the grid interpolation data
 	files.  We used to have different cases for different environments. The
@@ -316,9 +320,45 @@ struct csGridCell_
 										   the grid cell data. */
 };
 void CSinitGridCell (struct csGridCell_* thisPtr);
+void CSgatherGridCell (struct csGridCell_* thisPtr,double coefs [4],double delta [2],Const double *sourceLL);
 double CScalcGridCell (struct csGridCell_* thisPtr,Const double *sourceLL);
 const char *CSsourceGridCell (struct csGridCell_* thisPtr);
 
+/* Shared Grid Interpolation Kernels -->  All grid interpolation, regardless
+   of file format, ends up in one of these two kernels.  The gather function
+   types are used by the batch drivers to obtain, from a format specific
+   object, the cell data and normalized cell offsets for a single point.  A
+   gather function returns csGRIDI_ST_OK, a positive value if the point
+   cannot be interpolated (coverage, no data, etc.), or a negative value
+   in the event of a system error. */
+#ifdef __cplusplus
+extern "C" {
+#endif
+typedef int (*csGatherBilinearFunc)(void* gridFile,double coefs [4],double delta [2],Const double* sourceLL);
+typedef int (*csGatherBiquadFunc)(void* gridFile,double nodes [9],double delta [2],Const double* sourceLL);
+
+void CSbilinearCoefs (double coefs [4],double refNode,double xNode,double yNode,double xyNode);
+void CSbilinearInterp (double results [],Const double deltaX [],Const double deltaY [],
+														 Const double coefs [][4],
+														 int count);
+void CSbiquadInterp (double results [],Const double deltaX [],Const double deltaY [],
+													   Const double nodes [][9],
+													   int count);
+int CSbilinearBatch (void* gridFile,csGatherBilinearFunc gather,double results [],
+																int status [],
+																Const double sourceLL [][3],
+																int count,
+																double noData);
+int CSbiquadBatch (void* gridFile,csGatherBiquadFunc gather,double results [],
+															int status [],
+															Const double sourceLL [][3],
+															int count,
+															double noData);
+int CSlocalityOrder (int order [],Const double ll [][3],int count);
+#ifdef __cplusplus
+}
+#endif
+
 
 
 
@@ -1154,6 +1194,23 @@ struct cs_GxIndex_
 	short methodCode;
 };
 
+/* Node of the hash tables built over the Geodetic Transformation Index; see
+   CS_gxIndex.c.  direction is cs_DTCDIR_INV for the entries added to the
+   datum tables on behalf of a supported inverse. */
+#define cs_GXHASH_NAME     0
+#define cs_GXHASH_FROM     1
+#define cs_GXHASH_TO       2
+#define cs_GXHASH_PAIR     3
+#define cs_GXHASH_COUNT    4
+
+struct cs_GxHashNode_
+{
+	unsigned gxIndex;
+	short direction;
+	short fill01;
+	int next;
+};
+
 struct cs_PivotDatumTbl_
 {
 	char datumName [cs_KEYNM_DEF];
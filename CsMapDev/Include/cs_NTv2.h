@@ -432,6 +432,9 @@ struct cs_NTv2_
 	short maxIterations;
 };
 
+#ifdef __cplusplus
+extern "C" {
+#endif
 struct cs_NTv2_* CSnewNTv2 (Const char *filePath,long32_t bufferSize,ulong32_t flags,
 																	 double density);
 int CSinitNTv2 (struct cs_NTv2_* thisPtr,Const char *filePath,long32_t bufferSize,
@@ -441,8 +444,16 @@ void CSdeleteNTv2 (struct cs_NTv2_* thisPtr);
 void CSreleaseNTv2 (struct cs_NTv2_* thisPtr);
 Const char* CSpathNTv2 (Const struct cs_NTv2_* thisPtr);
 int CScalcNTv2 (struct cs_NTv2_* thisPtr,double deltaLL [2],Const double source [2]);
+int CScalcNTv2N (struct cs_NTv2_* thisPtr,double deltaLL [][2],int status [],
+															   Const double source [][3],
+															   int count);
 struct csNTv2SubGrid_* CSlocateSubNTv2 (struct cs_NTv2_* thisPtr,Const double source [2]);
 double CStestNTv2 (Const struct cs_NTv2_* thisPtr,Const double location [2]);
 Const char *CSsourceNTv2 (struct cs_NTv2_* thisPtr,Const double llSource [2]);
 void CSinitNTv2GridCell (struct csNTv2GridCell_* thisPtr);
+void CSgatherNTv2GridCell (Const struct csNTv2GridCell_* thisPtr,double coefs [4],double delta [2],
+																		 Const double sourceLL [2]);
 double CScalcNTv2GridCell (Const struct csNTv2GridCell_* thisPtr,Const double sourceLL [2]);
+#ifdef __cplusplus
+}
+#endif
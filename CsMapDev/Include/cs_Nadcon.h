@@ -237,3 +237,7 @@ void CSdeleteNadconFile (struct cs_NadconFile_* thisPtr);
 double CStestNadconFile (struct cs_NadconFile_* thisPtr,Const double *sourceLL);
 int CSextractNadconFile (struct cs_NadconFile_* thisPtr,Const double* sourceLL);
 int CScalcNadconFile (struct cs_NadconFile_* thisPtr,double* result,Const double* sourceLL);
+int CSgatherNadconFile (void* gridFile,double coefs [4],double delta [2],Const double* sourceLL);
+int CScalcNadconFileN (struct cs_NadconFile_* thisPtr,double results [],int status [],
+																		Const double sourceLL [][3],
+																		int count);
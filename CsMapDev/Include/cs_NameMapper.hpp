@@ -60,6 +60,12 @@ EcsMapTableFields& operator++ (EcsMapTableFields& flavor);	// preIncrememnt oper
 // "C" linkage.  Maybe that will change.
 TcsNameMapper* cmGetNameMapperPtr (bool release = false);
 
+///////////////////////////////////////////////////////////////////////////////
+// Returns a value which changes whenever the name mapping object is
+// constructed or released.  Tables of names obtained from the name mapper
+// use this to determine that they are to be refreshed.
+unsigned long cmGetNameMapperSerial (void);
+
 ///////////////////////////////////////////////////////////////////////////////
 // The following function is used to map a flavor ID to a string for reporting
 // purposes.  This is separate from that defined below such that it works
@@ -185,6 +191,12 @@ extern const TcsGenericId KcsGenericIdNull;
 //
 // A NumericId value of zero is taken to mean no value is defined or known.
 //
+// The Name, Remarks, and Comments strings are not owned by the object.  They
+// are interned into a string pool shared by all TcsNameMap objects, where
+// each distinct string is stored once and remains valid for the life of the
+// process.  Thus, copying a TcsNameMap object copies three pointers, and the
+// many names which are common to several flavors are stored only once.
+//
 class TcsNameMap
 {
 public:
@@ -219,15 +231,17 @@ public:
 	// Public Named Member Functions
 	EcsCsvStatus ReadFromStream (std::wistream& inStrm);
 	EcsCsvStatus ReadFromStream (std::wistream& inStrm,TcsCsvStatus& csvStatus);
+	EcsCsvStatus ReadFromReader (TcsCsvReader& reader,TcsCsvStatus& csvStatus);
 	bool HasGenericId (void) const {return GenericId.IsKnown (); }
 	bool NeedsGenericId (void) const {return GenericId.IsNotKnown (); }
 	TcsGenericId GetGenericId (void) const {return GenericId; }
 	EcsMapObjType GetMapClass (void) const {return Type; }
 	EcsNameFlavor GetFlavor (void) const {return Flavor; }
 	unsigned long GetNumericId (void) const {return NumericId; }
-	const wchar_t* GetNamePtr (void) const {return Name.c_str (); }
+	const wchar_t* GetNamePtr (void) const {return Name; }
 	short GetDupSort (void) const {return DupSort; }
 	short GetAliasFlag (void) const {return AliasFlag; }
+	unsigned long GetFlags (void) const {return Flags; }
 	void* GetUserValue (void) const;
 	const wchar_t* GetComments (void) const;
 	void GetComments (std::wstring& comments) const;
@@ -240,6 +254,7 @@ public:
 	void SetNumericId (unsigned long newNumericId);
 	void SetDupSort (short dupSort) {DupSort = dupSort; };
 	void SetAliasFlag (short aliasFlag) {AliasFlag = aliasFlag; };
+	void SetFlags (unsigned long flags) {Flags = flags; };
 	void* SetUserValue (void* userValue);
 	void SetDeprecated (const TcsGenericId& deprecatedBy) {Deprecated = deprecatedBy; };
 	void SetRemarks (const wchar_t* remarks);
@@ -252,7 +267,7 @@ private:
 	EcsMapObjType Type;					// Type (namespace) of this definition
 	EcsNameFlavor Flavor;				// Flavor of the Name and/or NumericId
 	unsigned long NumericId;			// Numeric Code or ID (e.g. EPSG Number)
-	std::wstring Name;					// Name of the object
+	const wchar_t* Name;				// Name of the object (interned)
 	short DupSort;						// Used to set priority order on
 										// duplicate names
 	short AliasFlag;					// Set to non-zero if this is an alias
@@ -267,10 +282,10 @@ private:
 										// zero, this name/number entry has
 										// been deprecated and replaced by the
 										// item with the generic ID provided.
-	std::wstring Remarks;				// Permanent remarks concerning name
+	const wchar_t* Remarks;				// Permanent remarks concerning name
 										// mapping as pertains to the actual
 										// definitions being mapped.
-	std::wstring Comments;				// Comments about the processing as
+	const wchar_t* Comments;			// Comments about the processing as
 										// pertains to the mapping algorithms,
 										// matching techniques, etc.  I.e.
 										// programmer type stuff.
@@ -375,6 +390,102 @@ private:
     mutable TcsCsvStatus Status;
 };
 
+//newPage//
+///////////////////////////////////////////////////////////////////////////////
+// TcsNameMapImageHdr, TcsNameMapImageRec  --  Compiled Name Mapper image
+//
+// The compiled image is a binary form of the Name Mapper, produced from the
+// .CSV source by csCompileNameMapper, which can be loaded without any
+// parsing.  The image consists of the header, followed by RecordCount
+// records, followed by a pool of PoolSize null terminated wchar_t strings.
+// The records appear in the collating sequence of the TcsNameMapper
+// DefinitionSet, so the set is rebuilt in a single linear pass.  Names,
+// remarks, and comments are offsets (in characters) into the pool, where
+// each distinct string appears once.  As with the mappable dictionary
+// images, the image is written in the native byte order, and wchar_t size,
+// of the host which produced it; an image which does not match the host is
+// ignored and the .CSV source is used instead.  CsvSize and CsvTime are the
+// size and (the low order 32 bits of) the modification time of the .CSV
+// source the image was produced from; the image is used only while both
+// match exactly.
+struct TcsNameMapImageHdr
+{
+	cs_magic_t Magic;
+	ulong32_t ByteOrder;
+	ulong32_t WcharSize;
+	ulong32_t RecordSize;
+	ulong32_t RecordCount;
+	ulong32_t PoolSize;
+	ulong32_t CsvSize;
+	ulong32_t CsvTime;
+};
+struct TcsNameMapImageRec
+{
+	ulong32_t GenericId;
+	ulong32_t NumericId;
+	ulong32_t Flags;
+	ulong32_t Deprecated;
+	ulong32_t NameOffset;
+	ulong32_t RemarksOffset;
+	ulong32_t CommentsOffset;
+	short Type;
+	short Flavor;
+	short DupSort;
+	short AliasFlag;
+};
+
+//newPage//
+///////////////////////////////////////////////////////////////////////////////
+// TcsNameMapIndex  --  Hashed numeric index into a TcsNameMapper
+//
+// Maps a type, flavor, and key to the first member of the TcsNameMapper
+// DefinitionSet, in its collating sequence, having that type, flavor, and
+// key.  The key is the numeric ID, the generic ID, or the name of the member,
+// as selected at construction.  Names are hashed and compared without regard
+// to case, so the name index locates aliases as well as the real names.  This
+// is exactly what a linear search of the type/flavor range of the set
+// produces, without the linear search.
+// The index is an open addressed (linear probing) hash table of set
+// iterators.  It does not own anything; the TcsNameMapper which owns the
+// set is responsible for keeping the index current as members are inserted
+// and erased, and for rebuilding it when the set is copied.
+class TcsNameMapIndex
+{
+public:
+	typedef std::set<TcsNameMap>::iterator iterator;
+	enum EcsIndexKey { KeyNumericId, KeyGenericId, KeyName };
+	///////////////////////////////////////////////////////////////////////////
+	// Construction  /  Destruction  /  Assignment
+	TcsNameMapIndex (EcsIndexKey keyType);
+	~TcsNameMapIndex (void);
+	///////////////////////////////////////////////////////////////////////////
+	// Named Member functions
+	bool SameKey (const TcsNameMap& lhs,const TcsNameMap& rhs) const;
+	bool Find (iterator& result,const TcsNameMap& nameMap) const;
+	bool Find (iterator& result,EcsMapObjType type,EcsNameFlavor flavor,unsigned long number) const;
+	bool Find (iterator& result,EcsMapObjType type,EcsNameFlavor flavor,const wchar_t* name) const;
+	void Insert (iterator itr);
+	void Remove (iterator itr);
+	void Rebuild (std::set<TcsNameMap>& definitionSet);
+private:
+	///////////////////////////////////////////////////////////////////////////
+	// Private Support Member Functions
+	static unsigned long Hash (EcsMapObjType type,EcsNameFlavor flavor,unsigned long number,
+																	   const wchar_t* name);
+	unsigned long NumberOf (const TcsNameMap& nameMap) const;
+	bool Matches (const TcsNameMap& nameMap,EcsMapObjType type,EcsNameFlavor flavor,unsigned long number,
+																						const wchar_t* name) const;
+	size_t Probe (EcsMapObjType type,EcsNameFlavor flavor,unsigned long number,const wchar_t* name) const;
+	size_t Probe (const TcsNameMap& nameMap) const;
+	void Grow (void);
+	///////////////////////////////////////////////////////////////////////////
+	// Private Data Members
+	EcsIndexKey KeyType;
+	size_t Count;
+	std::vector<iterator> Slots;
+	std::vector<bool> Used;
+};
+
 //newPage//
 ///////////////////////////////////////////////////////////////////////////////
 // TcsNameMapper  --  A collection of TcsNameMap objects.
@@ -438,6 +549,9 @@ public:
 	EcsCsvStatus ReadFromStream (char* pBuffer, size_t const bufferSize);
 	EcsCsvStatus ReadFromStream (std::wistream& inStrm);
 	EcsCsvStatus ReadFromStream (std::wistream& inStrm,TcsCsvStatus& status);
+	EcsCsvStatus ReadFromReader (TcsCsvReader& reader,TcsCsvStatus& status);
+	bool ReadFromImage (const void* image,size_t imageSize);
+	bool WriteImage (csFILE* outStrm,ulong32_t csvSize,ulong32_t csvTime) const;
 	bool Add (TcsNameMap& newItem,bool addDupName = false,const wchar_t* objSrcId = 0);
 	bool Add (const TcsNameMap& newItem);		// can't add a duplicate if the item is const
 	bool Replace (const TcsNameMap& newItem,const TcsNameMap& oldItem);
@@ -498,6 +612,10 @@ private:
 	const TcsNameMap* LocateNameMap (EcsMapObjType type,EcsNameFlavor flavor,const wchar_t* name,short dupSort = 0) const;
 	iterator LocateNameMapItr (EcsMapObjType type,EcsNameFlavor flavor,unsigned long id);
 	const_iterator LocateNameMapItr (EcsMapObjType type,EcsNameFlavor flavor,unsigned long id) const;
+	std::pair<iterator,bool> InsertDefinition (const TcsNameMap& newItem);
+	void EraseDefinition (iterator itr);
+	void UnindexDefinition (TcsNameMapIndex& index,iterator itr);
+	void RebuildIndices (void);
 
 	///////////////////////////////////////////////////////////////////////////
 	// Private Data Members
@@ -505,5 +623,8 @@ private:
 	unsigned long InitialDfltFlvrIds [KcsNameMapFlvrCnt];
 	std::set<TcsNameMap> DefinitionSet;
 	std::vector<TcsNameMap> Duplicates;
+	TcsNameMapIndex NumericIdIndex;
+	TcsNameMapIndex GenericIdIndex;
+	TcsNameMapIndex NameIndex;
 };
 #endif
@@ -184,6 +184,13 @@ extern "C"
 // exist is not a problem.
 void EXP_LVL1 csReleaseNameMapper (void);
 ///////////////////////////////////////////////////////////////////////////////
+// Compiles the Name Mapper .CSV file in the dictionary directory into the
+// compiled image (cs_NameMapperImgName) in the same directory.  The Name
+// Mapper is loaded from the image, much more quickly, whenever the image is
+// at least as recent as the .CSV file.  The .CSV file remains the source;
+// compile again after editing it.  Returns zero on success, -1 on failure.
+int EXP_LVL3 csCompileNameMapper (void);
+///////////////////////////////////////////////////////////////////////////////
 // The Name Mapper considers Projected Coordinate systems and Geographic
 // Systems to be distinct groups of objects.  Since in CS-MAP, and perhaps
 // other libraries, these two groups are considered to be a single name space.
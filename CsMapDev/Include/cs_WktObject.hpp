@@ -209,6 +209,7 @@ struct TrcWktUnitNameMap
 };
 //newPage//
 class TrcWktElement;
+class TrcWktTokens;
 ///////////////////////////////////////////////////////////////////////////////
 // The following are non-member support functions implemented specifically to
 // support processing of WKT data.
@@ -248,6 +249,9 @@ public:
 	TrcWktElements& AddChild (const TrcWktElement& newChild,const TrcWktElement* parent,
 															ErcWktEleType parentType);
 	TrcWktElements& RemoveChild (const TrcWktElement* toBeRemoved);
+	void Reserve (size_t count);
+	TrcWktElement& AppendChild (const TrcWktElement* parent,ErcWktEleType parentType);
+	TrcWktElement& GetChild (size_t index);
 private:
 	std::vector<TrcWktElement> Elements;
 };
@@ -319,7 +323,7 @@ private:
 	static ErcWktEleType ParseWellKnownText (std::string& value,size_t& eleStrt,
 																size_t& eleTerm,
 																const char *wellKnownText);
-	static void RemoveElementFromString (std::string& value,size_t eleStrt,size_t eleTerm);
+	void AddTokenChildren (const TrcWktTokens& tokens,size_t index);
 	std::string ExtractField  (size_t fieldNbr,bool trimQuotes = true) const;
 	void ExtractField  (char *bufr,size_t bufrSize,size_t fieldNbr) const;
 	void DeleteField (size_t fieldNbr);
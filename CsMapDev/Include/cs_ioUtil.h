@@ -56,6 +56,7 @@ int CS_csDelete(struct cs_Csdef_ *cs_def);
 int CS_csUpdate(struct cs_Csdef_ *cs_def, int encrypt);
 struct cs_Csdef_* CS_csDefinition(Const char *csName, char* pszDirPath, int* isUsrDef);
 int CS_csDefinitionAll(struct cs_Csdef_**[]);
+int CS_csDefinitionAllEx(struct cs_Csdef_**);
 
 /*******************************/
 /*    Datum C++ API wrapper    */
@@ -67,6 +68,7 @@ int CS_dtDelete(struct cs_Dtdef_ *dt_def);
 int CS_dtUpdate(struct cs_Dtdef_ *dt_def, int encrypt);
 struct cs_Dtdef_* CS_dtDefinition(Const char *dtName, char* pszDirPath, int* isUsrDef);
 int CS_dtDefinitionAll(struct cs_Dtdef_**[]);
+int CS_dtDefinitionAllEx(struct cs_Dtdef_**);
 
 /***********************************/
 /*    Ellipsoid C++ API wrapper    */
@@ -78,6 +80,7 @@ int CS_elDelete(struct cs_Eldef_ *el_def);
 int CS_elUpdate(struct cs_Eldef_ *el_def, int encrypt);
 struct cs_Eldef_* CS_elDefinition(Const char *elName, char* pszDirPath, int* isUsrDef);
 int CS_elDefinitionAll(struct cs_Eldef_**[]);
+int CS_elDefinitionAllEx(struct cs_Eldef_**);
 
 /***************************************/
 /*    Geodetic Path C++ API wrapper    */
@@ -742,9 +742,6 @@
 #endif
 
 #define csFILE     FILE
-#if _FILE_SYSTEM != _fs_UNIX
-#	define CS_fopen   fopen
-#endif
 #define CS_fread   fread
 #define CS_fwrite  fwrite
 #define CS_fclose  fclose
@@ -1096,6 +1093,8 @@ typedef long32_t cs_magic_t;
 #define cs_CMPLR_TEST     4
 #define cs_CMPLR_WARN     8
 #define cs_CMPLR_EXTENTS 16
+#define cs_CMPLR_MAPPABLE 32
+#define cs_CMPLR_INCR    64
 
 /*
 	The following define specifies the size of the arrays
@@ -1768,8 +1767,10 @@ enum EcsWktParameter {	csWktPrmNone = 0,
 #define cs_GX_NAME           "GeodeticTransform.CSD"
 #define cs_GP_NAME           "GeodeticPath.CSD"
 #define cs_NMP_NAME          "NameMapper.csv"
+#define cs_NMP_IMG_NAME      "NameMapper.NMB"
 #define cs_GEOID_NAME        "GeoidHeight.gdc"
 #define cs_VERTCON_NAME      "Vertcon.gdc"
+#define cs_BUNDLE_NAME       "CsMap.CSB"
 
 #define cs_OSTN97_NAME       "OSTN97.TXT"
 #define cs_OSTN97_NAME_BIN   "OSTN97._nt"
@@ -2085,6 +2086,39 @@ struct cs_Ctdef_
 	ulong32_t userNameIndex; //at which index in [ctName] start the user added CS names; 
 };
 
+/* The hash index of the in-memory category list; see CS_category.c.  There
+   is an entry for each category in the list, in list order.  Entries are
+   chained by category name, and each carries an open addressing table of the
+   indices of the item names in the category.  The reverse index chains, by
+   item name, a node for each category containing the item; in entry order. */
+struct cs_CtIdxEntry_
+{
+	struct cs_Ctdef_ *ctDefPtr;
+	int nextCat;
+	ulong32_t slotCnt;
+	ulong32_t itmCnt;
+	long32_t *itmSlots;
+};
+struct cs_CtRvsNode_
+{
+	unsigned hash;
+	int entryNbr;
+	int next;
+};
+struct cs_CtIndex_
+{
+	int entryCnt;
+	struct cs_CtIdxEntry_ *entries;
+	unsigned catSize;
+	int *catBuckets;
+	unsigned rvsSize;
+	int *rvsBuckets;
+	int rvsCnt;
+	int rvsAlloc;
+	int rvsFree;
+	struct cs_CtRvsNode_ *rvsNodes;
+};
+
 
 /*
 	Turn off whatever packing was used for release 6 stuff, then
@@ -5749,6 +5783,8 @@ struct csCscach_
 	struct csCscach_ *next;
 	struct csCscach_ *prev;
 	struct cs_Csprm_ *cs_ptr;
+	long epsg;						/* EPSG code, if located by code by
+									   CSbccluEpsg, else zero */
 	char cs_nam [24];
 };
 
@@ -5904,6 +5940,132 @@ int CScalcRegnFromMgrs (struct cs_Mgrs_ *_This,double sw [2],double ne [2],Const
 												   Transformation files. */
 #define cs_FIPS_MAGIC    (cs_MAGIC_BASE | 32)	/* FIPS Code data file. */
 
+/* Header of a mappable dictionary image, see CS_dictMap.c.  The header is
+   written in the byte order of the host which produced it, as are the
+   records which follow it; byteOrder is cs_DICTMAP_ORDER as seen by that
+   host.  csdSize and csdTime are the size and (the low order 32 bits of)
+   the modification time of the dictionary the image was produced from;
+   the image is current only while both match exactly.  The header size
+   keeps the records double aligned. */
+#define cs_DICTMAP_ORDER 0x01020304UL
+struct csDictMapHdr_
+{
+	cs_magic_t magic;					/* magic number of the dictionary the
+										   image was produced from. */
+	ulong32_t byteOrder;
+	ulong32_t recordSize;
+	ulong32_t recordCount;
+	ulong32_t csdSize;
+	ulong32_t csdTime;
+	ulong32_t reserved [2];
+};
+
+/* Datum conversion snapshot file, see CS_dtcSnapOpen in CS_datum.c.  As
+   with the mappable dictionary images, this is written in the native byte
+   order of the host.  dictTimes and dictSizes are the modification times
+   and sizes of the Datum, Geodetic Transformation, and Geodetic Path
+   dictionaries, user directory first, at the time the snapshot was
+   written. */
+#define cs_DTCSNAP_MAGIC (cs_MAGIC_BASE | 33)
+struct csDtcSnapHdr_
+{
+	cs_magic_t magic;
+	ulong32_t byteOrder;
+	ulong32_t recordSize;
+	ulong32_t recordCount;
+	cs_Time_ dictTimes [6];
+	ulong32_t dictSizes [6];
+	ulong32_t reserved [2];
+};
+struct csDtcSnapXfrm_
+{
+	char xfrmName [cs_KEYNM_DEF1];
+	short direction;
+	short fill01;
+};
+struct csDtcSnap_
+{
+	char srcKeyName [cs_KEYNM_DEF];		/* source and target datums */
+	char trgKeyName [cs_KEYNM_DEF];
+	ulong32_t srcHash;					/* hashes of the content of the */
+	ulong32_t trgHash;					/* source and target datums */
+	char pathName [64];					/* as in the cs_Dtcprm_ structure */
+	char description [128];
+	char source [64];
+	char group [24];
+	short xfrmCount;
+	short fill01;
+	struct csDtcSnapXfrm_ xfrms [csPATH_MAXXFRM];
+};
+
+/* Compiler output table and the per-definition hashes written for the
+   next incremental compilation, see CS_cmpTbl.c.  The hash file is
+   written in the native byte order of the host.  depHash and outHash are
+   hashes of the content of the dictionaries the compiler validates
+   against and of the output, respectively. */
+#define cs_CMPHASH_MAGIC (cs_MAGIC_BASE | 34)
+struct csCmpHashHdr_
+{
+	cs_magic_t magic;
+	ulong32_t byteOrder;
+	ulong32_t dictMagic;				/* magic number of the output */
+	ulong32_t recordSize;
+	ulong32_t flags;					/* compiler options which affect
+										   the output */
+	ulong32_t hashCount;
+	ulong32_t depHash [2];
+	ulong32_t outHash;
+	ulong32_t reserved [3];
+};
+struct csCmpHash_
+{
+	char keyName [cs_KEYNM_DEF1];
+	ulong32_t hash;
+};
+struct csCmpTbl_
+{
+	cs_magic_t magic;
+	size_t recSize;
+	size_t keyOffset;
+	char *records;						/* validated definitions */
+	long32_t recCount;
+	long32_t recAlloc;
+	struct csCmpHash_ *hashes;			/* hashes for the next compilation */
+	long32_t hashCount;
+	long32_t hashAlloc;
+	char *prevRecords;					/* previous compilation, sorted */
+	long32_t prevCount;
+	long32_t prevAlloc;
+	struct csCmpHash_ *prevHashes;
+	long32_t prevHashCount;
+	int incremental;
+	ulong32_t flags;
+	ulong32_t depHash [2];
+};
+
+/* Dictionary bundle, see CS_bundle.c.  A bundle is a header, followed by
+   memberCount entries sorted by name (case insensitive), followed by the
+   members themselves.  Member offsets are from the start of the bundle.
+   As with the mappable dictionary images, the bundle is written in the
+   native byte order of the host. */
+#define cs_BUNDLE_MAGIC (cs_MAGIC_BASE | 35)
+struct csBundleHdr_
+{
+	cs_magic_t magic;
+	ulong32_t byteOrder;
+	ulong32_t memberCount;
+	ulong32_t reserved [5];
+};
+struct csBundleEntry_
+{
+	char name [64];						/* relative to the bundle directory */
+	ulong32_t offset;
+	ulong32_t size;
+	ulong32_t reserved [2];
+};
+
+/* Compiled Name Mapper image, see TcsNameMapImageHdr in cs_NameMapper.hpp. */
+#define cs_NMMAPIMG_MAGIC (cs_MAGIC_BASE | 36)
 
 
 /*
@@ -6575,10 +6737,14 @@ double		EXP_LVL1	CS_azsphr (Const double ll0 [2],Const double ll1 [2]);
 int			EXP_LVL7	CS_bins (csFILE *strm,long32_t start,long32_t eof,int rs,Const void *rec,int (*comp)(const void *elem1,const void *elem2));
 void*		EXP_LVL9	CS_bsearch (Const void *key,Const void *base,size_t num,size_t width,int (*compare )(const void *elem1,const void *elem2));
 int			EXP_LVL5	CS_bswap (void *rec,Const char *frmt);
+int			EXP_LVL1	CS_bundleOpen (Const char *bundlePath);
+int			EXP_LVL3	CS_bundleWrite (Const char *bundlePath,Const char *dictDir,Const char *fileNames []);
 
 double		EXP_LVL1	CS_cnvrg (Const char *cs_nam,Const double ll [3]);
 int			EXP_LVL1	CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3]);
 int			EXP_LVL1	CS_cnvrt3D (Const char *src_cs,Const char *dst_cs,double coord [3]);
+int			EXP_LVL1	CS_cnvrtEpsg (long srcCode,long dstCode,double coord [3]);
+int			EXP_LVL1	CS_cnvrtEpsg3D (long srcCode,long dstCode,double coord [3]);
 const char*	EXP_LVL3	CS_countyEnum (int stateFips,int index);
 unsigned short EXP_LVL9 CS_crc16 (unsigned short crc16,unsigned char *cp,int count);
 
@@ -6589,13 +6755,17 @@ void		EXP_LVL7	CS_csDictCls (csFILE* stream);
 int			EXP_LVL7	CS_cscmp (Const struct cs_Csdef_ *pp,Const struct cs_Csdef_ *qq);
 double		EXP_LVL3	CS_cscnv (Const struct cs_Csprm_ *csprm,Const double ll [3]);
 struct cs_Csdef_* EXP_LVL3	CS_csdef (Const char *cs_nam);
+Const struct cs_Csdef_* EXP_LVL3 CS_csdefMap (Const char *cs_nam);
+long32_t	EXP_LVL3	CS_csdefMapAll (Const struct cs_Csdef_ **defArray,int userDict);
 struct cs_Csdef_ * EXP_LVL7 CS_csdef2 (Const char *cs_nam, char* pszDirPath);
 int			EXP_LVL3	CS_csdefAll (struct cs_Csdef_ **pDefArray[]);
+int			EXP_LVL3	CS_csdefAllEx (struct cs_Csdef_ **pDefArray);
 int			EXP_LVL3	CS_csDefCmp (Const struct cs_Csdef_ *original,Const struct cs_Csdef_ *revised,char* message,size_t messageSize);
 int			EXP_LVL3	CS_csDefCmpEx (double* qValuePtr,Const struct cs_Csdef_ *original,Const struct cs_Csdef_ *revised,char* message,size_t msgSize);
 int			EXP_LVL3	CS_csdel (struct cs_Csdef_ *csdef);
 int			EXP_LVL5	CS_csDiff (FILE *rptStrm,struct cs_Csdef_ *was,struct cs_Csdef_ *is);
 int			EXP_LVL1	CS_csEnum (int index,char *key_name,int size);
+int			EXP_LVL3	CS_csEnumAll (char **nameArray []);
 int 		EXP_LVL2	CS_csEnumByGroup (int index,Const char *grp_name,struct cs_Csgrplst_ *cs_descr);
 void		EXP_LVL1	CS_csfnm (Const char *new_name);
 int			EXP_LVL1	CS_csGrpEnum (int index,char *grp_name,int name_sz,char *grp_dscr,int dscr_sz);
@@ -6608,6 +6778,8 @@ struct cs_Csprm_* EXP_LVL3	CS_csloc (Const char *cs_nam);
 csFILE *	EXP_LVL5	CS_csopn (Const char *mode);
 int			EXP_LVL1	CS_csRangeEnum (int index,char *key_name,int size);
 int			EXP_LVL1	CS_csRangeEnumSetup (double longitude,double latitude);
+int			EXP_LVL3	CS_csRangeEnumSetupEx (Const double ll_min [2],Const double ll_max [2],Const char *grp_name,Const char *cat_name);
+int			EXP_LVL3	CS_csRangeEnumSetupN (Const double ll [][2],int count,Const char *grp_name,Const char *cat_name);
 int			EXP_LVL5	CS_csrd (csFILE *strm,struct cs_Csdef_ *cs_def,int *crypt);
 int			EXP_LVL5	CS_csrup (Const char *distrb,Const char *bkupnm);
 double		EXP_LVL3	CS_cssch (Const struct cs_Csprm_ *csprm,Const double ll [2]);
@@ -6624,11 +6796,18 @@ double		EXP_LVL3	CS_deltaLongitude (double baseMeridian,double relativeLongitude
 void		EXP_LVL3	CS_dtcls (struct cs_Dtcprm_ *dtc_ptr);
 int			EXP_LVL7	CS_dtcmp (Const struct cs_Dtdef_ *pp,Const struct cs_Dtdef_ *qq);
 struct cs_Dtcprm_* EXP_LVL3	CS_dtcsu (Const struct cs_Csprm_ *src_cs,Const struct cs_Csprm_ *dest_cs,int dat_erf,int blk_erf);
+int			EXP_LVL3	CS_dtcSnapOpen (Const char *snapPath);
+int			EXP_LVL3	CS_dtcSnapSave (void);
 int			EXP_LVL3	CS_dtcvt (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [2],double ll_out [2]);
 int			EXP_LVL3	CS_dtcvt3D (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [3],double ll_out [3]);
+int			EXP_LVL3	CS_dtcvtN (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [][3],double ll_out [][3],int status [],int count);
+int			EXP_LVL3	CS_dtcvt3DN (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [][3],double ll_out [][3],int status [],int count);
 struct cs_Dtdef_* EXP_LVL3	CS_dtdef (Const char *dat_nam);
+Const struct cs_Dtdef_* EXP_LVL3 CS_dtdefMap (Const char *dt_nam);
+long32_t	EXP_LVL3	CS_dtdefMapAll (Const struct cs_Dtdef_ **defArray,int userDict);
 struct cs_Dtdef_ * EXP_LVL5	CS_dtdef2 (Const char *dat_nam, char* pszDirPath);
 int			EXP_LVL3	CS_dtdefAll	(struct cs_Dtdef_ **pDefArray[]);
+int			EXP_LVL3	CS_dtdefAllEx (struct cs_Dtdef_ **pDefArray);
 int			EXP_LVL3	CS_dtDefCmp (Const struct cs_Dtdef_ *original,Const struct cs_Dtdef_ *revised,char* message,size_t messageSize);
 int			EXP_LVL3	CS_dtDefCmpEx (double *qValuePtr,Const struct cs_Dtdef_ *original,Const struct cs_Dtdef_ *revised,char* message,size_t msgSize);
 int			EXP_LVL5	CS_dtdel (struct cs_Dtdef_ *dtdef);
@@ -6636,6 +6815,7 @@ char*		EXP_LVL3	CS_dtdflt (Const char *dflt_dt);
 void		EXP_LVL7	CS_dtDictCls (csFILE* stream);
 int			EXP_LVL5	CS_dtDiff (FILE *rptStrm,struct cs_Dtdef_ *was,struct cs_Dtdef_ *is);
 int			EXP_LVL1	CS_dtEnum (int index,char *key_name,int size);
+int			EXP_LVL3	CS_dtEnumAll (char **nameArray []);
 void		EXP_LVL1	CS_dtfnm (Const char *new_name);
 int			EXP_LVL1	CS_dtIsValid (Const char *key_name);
 struct cs_Datum_* EXP_LVL5	CS_dtloc (Const char *dat_nam);
@@ -6650,8 +6830,11 @@ int			EXP_LVL3	CS_dynutm (struct cs_Csprm_ *csprm,int zone);
 Const char*	EXP_LVL3	CS_ecvt (double value,int count,int *dec,int *sign);
 int			EXP_LVL7	CS_elcmp (Const struct cs_Eldef_ *pp,Const struct cs_Eldef_ *qq);
 struct cs_Eldef_* EXP_LVL3	CS_eldef (Const char *el_nam);
+Const struct cs_Eldef_* EXP_LVL3 CS_eldefMap (Const char *el_nam);
+long32_t	EXP_LVL3	CS_eldefMapAll (Const struct cs_Eldef_ **defArray,int userDict);
 struct cs_Eldef_* EXP_LVL5	CS_eldef2 (Const char *el_nam, char* pszFileDirPath);
 int			EXP_LVL3	CS_eldefAll (struct cs_Eldef_ **pDefArray[]);
+int			EXP_LVL3	CS_eldefAllEx (struct cs_Eldef_ **pDefArray);
 int			EXP_LVL3	CS_elDefCmp (Const struct cs_Eldef_ *original,Const struct cs_Eldef_ *revised,char* message,size_t messageSize);
 int			EXP_LVL3	CS_elDefCmpEx (double* qValuePtr,Const struct cs_Eldef_ *original,Const struct cs_Eldef_ *revised,char* message,size_t msgSize);
 int			EXP_LVL5	CS_eldel (struct cs_Eldef_ *eldef);
@@ -6659,6 +6842,7 @@ char*		EXP_LVL3	CS_eldflt (Const char *dflt_el);
 void		EXP_LVL7	CS_elDictCls (csFILE* stream);
 int			EXP_LVL5	CS_elDiff (FILE *rptStrm,struct cs_Eldef_ *was,struct cs_Eldef_ *is);
 int			EXP_LVL1	CS_elEnum (int index,char *key_name,int size);
+int			EXP_LVL3	CS_elEnumAll (char **nameArray []);
 void		EXP_LVL1	CS_elfnm (Const char *new_name);
 int			EXP_LVL1	CS_elIsValid (Const char *key_name);
 csFILE *	EXP_LVL5	CS_elopn (Const char *mode);
@@ -6674,6 +6858,7 @@ void		EXP_LVL1	CS_errmsg (char *user_bufr,int buf_size);
 void		EXP_LVL1	CS_fast (int fast);
 void		EXP_LVL3	CS_fillIn (struct cs_Csdef_ *cs_def);
 cs_Time_	EXP_LVL7	CS_fileModTime (Const char *filePath);
+ulong32_t	EXP_LVL7	CS_fileSize (Const char *filePath);
 void		EXP_LVL5	CS_free (void *ptr);
 void		EXP_LVL3	CS_dllFree (void *ptr);
 long32_t	EXP_LVL1	CS_ftoa (char *bufr,int size,double value,long32_t frmt);
@@ -6808,6 +6993,8 @@ int			EXP_LVL1	CS_prjEnum (int index,ulong32_t *prj_flags,char *prj_keynm,int ke
 											  char *prj_descr,
 											  int descr_sz);
 int			EXP_LVL3	CS_prjprm (struct cs_Prjprm_ *result,unsigned short prj_code,int parm_nbr);
+struct cs_PrjprmMap_* EXP_LVL7 CS_prjprmMapPtr (unsigned short prj_code);
+struct cs_Prjtab_* EXP_LVL7 CS_prjtabPtr (Const char *prj_knm);
 double		EXP_LVL3	CS_prmValue (Const struct cs_Csdef_ *csDefPtr,int parm_nbr);
 int			EXP_LVL1	CS_putcs (Const struct cs_Csdef_ *csdef,int crypt);
 int			EXP_LVL1	CS_putdt (Const struct cs_Dtdef_ *dtdef,int crypt);
@@ -6820,6 +7007,15 @@ void		EXP_LVL9	CS_quadMM (double min_xy [2],double max_xy [2],double x_off,doubl
 
 void		EXP_LVL5	*CS_ralc (void *ptr,size_t blk_size);
 void		EXP_LVL1	CS_recvr (void);
+void		EXP_LVL7	CS_rlsDefIndex (void);
+void		EXP_LVL7	CS_rlsDictMap (void);
+void		EXP_LVL7	CS_rlsRangeIndex (void);
+void		EXP_LVL7	CS_rlsGpIndex (void);
+void		EXP_LVL7	CS_rlsDtcSnap (void);
+void		EXP_LVL7	CS_rlsGrpIndex (void);
+void		EXP_LVL7	CS_rlsPrjIndex (void);
+void		EXP_LVL7	CS_rlsUnitIndex (void);
+void		EXP_LVL7	CS_rlsWktCache (void);
 int			EXP_LVL9	CS_remove (Const char *path);
 void		EXP_LVL9	CS_removeRedundantWhiteSpace (char *string);
 int			EXP_LVL9	CS_rename (Const char *prev,Const char *current);
@@ -6839,6 +7035,7 @@ char *		EXP_LVL3	CS_stcpy (char *dest,Const char *source);
 char *		EXP_LVL3	CS_stncp (char *dest,Const char *source,int count);
 int			EXP_LVL3	CS_stricmp (Const char *cp1,Const char *cp2);
 Const char*	EXP_LVL3	CS_stristr (Const char *str1,Const char *str2);
+unsigned	EXP_LVL7	CS_strihash (Const char *str1,Const char *str2);
 int			EXP_LVL9	CS_strnicmp (Const char *cp1,Const char *cp2,size_t count);
 char*		EXP_LVL3	CS_strrchr (Const char *cPtr, int chr);
 double		EXP_LVL9	CS_strtod (Const char *nptr,char **endptr);
@@ -6872,6 +7069,7 @@ int			EXP_LVL3	CS_utmzon (double lng);
 int			EXP_LVL1	CS_viaEnum (int index,char *descr,int size,int *ident);
 
 int			EXP_LVL3	CS_wcsicmp (Const wchar_t *cp1,Const wchar_t *cp2);
+unsigned	EXP_LVL7	CS_wcsihash (Const wchar_t *str);
 int			EXP_LVL9	CS_wktCsDefFunc (struct cs_Csdef_* csDefPtr,Const char* wktString);
 int			EXP_LVL9	CS_wktDtDefFunc (struct cs_Dtdef_* dtDefPtr,Const char* dtKeyName);
 int			EXP_LVL9	CS_wktElDefFunc (struct cs_Eldef_* elDefPtr,Const char* elKeyName);
@@ -6925,11 +7123,17 @@ int			EXP_LVL9	CSazmedX (Const struct cs_Azmed_ *azmed,int cnt,Const double pnts
 
 void		EXP_LVL1	CSbccDbg (char *results,int rsltSz);
 struct cs_Csprm_* EXP_LVL9	CSbcclu (Const char *cs_name);
+struct cs_Csprm_* EXP_LVL9	CSbccluEpsg (long epsgCode);
 void		EXP_LVL1	CSbdcDbg (char *results,int rsltSz);
 struct cs_Dtcprm_* EXP_LVL9	CSbdclu (Const struct cs_Csprm_ *src_cs,Const struct cs_Csprm_ *dst_cs,int dat_err,int blk_err);
 
 int			EXP_LVL9	CSbswap (void *rec,Const char *frmt);
 
+csFILE*		EXP_LVL9	CSbundleFopen (Const char *filePath,Const char *mode);
+int			EXP_LVL9	CSbundleHas (Const char *filePath);
+cs_Time_	EXP_LVL9	CSbundleModTime (Const char *filePath);
+ulong32_t	EXP_LVL9	CSbundleFileSize (Const char *filePath);
+
 double		EXP_LVL5	CSbtFcal (Const struct cs_BtcofF_ *btF_ptr,double lat);
 double		EXP_LVL5	CSbtFcalPrec (Const struct cs_BtcofF_ *btF_ptr,double lat);
 void		EXP_LVL5	CSbtFsu  (struct cs_BtcofF_ *btF_ptr,double e_sq);
@@ -6963,6 +7167,15 @@ void		EXP_LVL5	CSchiFsu (struct cs_ChicofF_ *chiF_ptr,double e_sq);
 double		EXP_LVL5	CSchiIcal (Const struct cs_ChicofI_ *chiI_ptr,double chi);
 void		EXP_LVL5	CSchiIsu (struct cs_ChicofI_ *chiI_ptr,double e_sq);
 
+int			EXP_LVL9	CScmpTblAdd (struct csCmpTbl_ *tbl,Const void *record);
+void		EXP_LVL9	CScmpTblFinish (struct csCmpTbl_ *tbl,Const char *outPath,int ok);
+void		EXP_LVL9	CScmpTblFree (struct csCmpTbl_ *tbl);
+void		EXP_LVL9	CScmpTblInit (struct csCmpTbl_ *tbl,cs_magic_t magic,int flags,Const char *outPath,
+																						   Const char *depPath1,
+																						   Const char *depPath2);
+int			EXP_LVL9	CScmpTblReuse (struct csCmpTbl_ *tbl,Const void *record);
+int			EXP_LVL9	CScmpTblWrite (struct csCmpTbl_ *tbl,csFILE *outStrm,int crypt,Const char *dupFmt,int (*err_func)(char *mesg));
+
 int			EXP_LVL9	CScscomp (Const char *inpt,Const char *outp,
 												   int flags,
 												   Const char *elpath,
@@ -6987,8 +7200,11 @@ struct cs_Csprm_* EXP_LVL3	CScsloc2 (struct cs_Csdef_ *cs_ptr,
 
 double		EXP_LVL3	CSdefCmpPrjPrm (struct cs_Prjtab_* pp,int prmNbr,double orgValue,double revValue,char *message,size_t messageSize);
 int			EXP_LVL9	CSdfltpro (int type,char *name,int size);
+void		EXP_LVL9	CSdictMapRemove (Const char *csdPath);
+int			EXP_LVL9	CSdictMapWrite (Const char *csdPath);
 
 int			EXP_LVL3	CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in [3],double ll_out [3]);
+int			EXP_LVL3	CSdtcvtN (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in [][3],double ll_out [][3],int status [],int count);
 int			EXP_LVL9	CSdtcomp (Const char *inpt,Const char *outp,
 												   int flags,
 												   Const char *elpath,
@@ -7057,6 +7273,7 @@ struct cs_Gauss_* EXP_LVL3	CSgaussS (double e_rad,double e_sq,double orgLng,doub
 int			EXP_LVL7	CSgdcGenerate (Const char *directory);
 
 int			EXP_LVL1	CS_geoidHgt (Const double ll_84 [2],double *height);
+int			EXP_LVL1	CS_geoidHgtN (Const double ll_84 [][3],double height [],int status [],int count);
 void		EXP_LVL1	CS_geoidCls (void);
 
 double		EXP_LVL9	CSgnomcC (Const struct cs_Gnomc_ *gnomc,Const double ll [2]);
@@ -7072,6 +7289,7 @@ int			EXP_LVL9	CSgnomcX (Const struct cs_Gnomc_ *gnomc,int cnt,Const double pnts
 int			EXP_LVL9	CSgnricQ (struct cs_Csdef_ *csdef,int err_list [],int list_sz);
 
 int			EXP_LVL9	CSgpcomp (Const char *inpt,Const char *outp,int flags,char *datum,char* xforms,int (*err_func)(char *mesg));
+int			EXP_LVL9	CSgrpEnum (Const char *grp_key,int index,struct cs_Csgrplst_ *cs_descr);
 int			EXP_LVL9	CSgxcomp (Const char *inpt,Const char *outp,int flags,char *datum,int (*err_func)(char *mesg));
 
 double		EXP_LVL9	CShmlsnC (Const struct cs_Hmlsn_ *hmlsn,Const double ll [2]);
@@ -7396,6 +7614,8 @@ int			EXP_LVL1	CS_cs2Wkt (char *bufr,size_t bufrSize,const char *csKeyName,int f
 int			EXP_LVL1	CS_el2WktEx (char *bufr,size_t bufrSize,const char *elKeyName,int flavor,unsigned short flags);
 int			EXP_LVL1	CS_dt2WktEx (char *bufr,size_t bufrSize,const char *dtKeyName,int flavor,unsigned short flags);
 int			EXP_LVL1	CS_cs2WktEx (char *bufr,size_t bufrSize,const char *csKeyName,int flavor,unsigned short flags);
+int			EXP_LVL1	CS_cs2WktSink (int (*sinkFunc)(void *userData,const char *text,size_t length),void *userData,const char *csKeyName,int flavor,unsigned short flags);
+long32_t	EXP_LVL1	CS_cs2WktAll (int (*exportFunc)(void *userData,const char *csKeyName,int flavor,const char *wktText,size_t length),void *userData,Const int *flavors,int flavorCount,unsigned short flags);
 
 int			EXP_LVL1	CS_wktToDict (const char *csKeyName,const char *dtKeyName,const char *elKeyName,const char *wellKnownText,int flavor);
 int			EXP_LVL1	CS_wldCalc (double* AA, double* BB, double* CC, double* DD,double from1 [2],double to1 [2],double from2 [2],double to2 [2]);
@@ -7409,6 +7629,9 @@ int			EXP_LVL1	CS_vldCtNameEx (const char* catName, struct cs_Ctdef_* pCtDef);
 Const char*	EXP_LVL3	CS_getCatName (unsigned idx);
 Const char*	EXP_LVL3	CS_getItmName (const char* catName,unsigned idx);
 int			EXP_LVL1	CS_getItmNameCount (const char* catName);
+int			EXP_LVL1	CS_getItmIdx (const char* catName,const char* itmName);
+int			EXP_LVL1	CS_getItmCatCount (const char* itmName);
+Const char*	EXP_LVL3	CS_getItmCatName (const char* itmName,unsigned idx);
 
 void		EXP_LVL3	CS_ctfnm (const char* new_name);
 int			EXP_LVL3	CSrplItmName (Const char* catName,unsigned idx,Const char* newName);
@@ -7674,6 +7897,8 @@ struct cs_Ostn97_
 	csFILE* strm;						/* file is not opened until required,
 										   may be closed if entire contents
 										   have been buffered. */
+	short inMemory;						/* TRUE says the entire node array is
+										   loaded, see cs_OsGridInMemory. */
 	long32_t bufferSize;
 	long32_t bufferBeginPosition;		/* file position of 1st byte in buffer,
 										   -1 says nothing in buffer */
@@ -7702,6 +7927,8 @@ struct cs_Osgm91_
 	csFILE* strm;						/* file is not opened until required,
 										   may be closed if entire contents
 										   have been buffered. */
+	short inMemory;						/* TRUE says the entire node array is
+										   loaded, see cs_OsGridInMemory. */
 	long32_t bufferSize;
 	long32_t bufferBeginPosition;		/* file position of 1st byte in buffer,
 										   -1 says nothing in buffer */
@@ -7741,6 +7968,8 @@ struct cs_Ostn02_
 	csFILE* strm;					/* file is not opened until required,
 									   may be closed if entire contents
 									   have been buffered. */
+	short inMemory;						/* TRUE says the entire node array is
+										   loaded, see cs_OsGridInMemory. */
 	long32_t bufferSize;
 	long32_t bufferBeginPosition;		/* file position of 1st byte in buffer,
 										   -1 says nothing in buffer */
@@ -7794,6 +8023,17 @@ struct cs_Egm96_
 	char binaryPath [MAXPATH];			/* Full path of binary shadow file. */
 };
 
+/* A tile of a .byn file, a run of whole records decoded to native double
+   values with the data factor applied.  The no data value is decoded as
+   9999.0. */
+struct csBynTile_
+{
+	long32_t firstRecord;				/* first record in the tile, -1 says
+										   the tile is empty. */
+	ulong32_t lastUsed;					/* tile clock value at last access. */
+	double *values;						/* recordCount * elementCount values. */
+};
+
 /* This object represents an implementation of the Byn file
    format.  While used primarily for geoid heights, it is
    also used for things like deflections, elevations, and
@@ -7828,6 +8068,11 @@ struct csBynGridFile_
 										   again, from the header file. */
 	short swapFlag;						/* Non-zero says the data elements, whatever
 										   size they are, need to be swapped. */
+	long32_t tileRecords;				/* records per tile, zero says the file
+										   is accessed through dataBuffer. */
+	int tileCount;						/* number of tiles in the LRU cache. */
+	ulong32_t tileClock;
+	struct csBynTile_ *tiles;			/* not allocated until required. */
 	char filePath [MAXPATH];
 	char fileName [32];
 	char bynFilePath [MAXPATH];
@@ -7948,6 +8193,8 @@ void CSreleaseGeoid96GridFile (struct csGeoid96GridFile_* __This);
 double CStestGeoid96GridFile (struct csGeoid96GridFile_* __This,Const double *sourceLL);
 int CSextractGeoid96GridCell (struct csGeoid96GridFile_* __This,Const double* sourceLL);
 int CScalcGeoid96GridFile (struct csGeoid96GridFile_* __This,double* result,Const double* sourceLL);
+int CScalcGeoid96GridFileN (struct csGeoid96GridFile_* __This,double results [],int status [],Const double sourceLL [][3],int count);
+int CSgatherGeoid96GridFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL);
 
 void CSinitGeoid99 (struct csGeoid99GridFile_ *__This);
 void CSdeleteGeoid99GridFile (struct csGeoid99GridFile_* __This);
@@ -7956,6 +8203,8 @@ void CSreleaseGeoid99GridFile (struct csGeoid99GridFile_* __This);
 double CStestGeoid99GridFile (struct csGeoid99GridFile_* __This,Const double *sourceLL);
 int CSextractGeoid99GridCell (struct csGeoid99GridFile_* __This,Const double* sourceLL);
 int CScalcGeoid99GridFile (struct csGeoid99GridFile_* __This,double* result,Const double* sourceLL);
+int CScalcGeoid99GridFileN (struct csGeoid99GridFile_* __This,double results [],int status [],Const double sourceLL [][3],int count);
+int CSgatherGeoid99GridFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL);
 
 void CSinitBynGridFile (struct csBynGridFile_ *__This);
 struct csBynGridFile_* CSnewBynGridFile (Const char *path,long32_t bufferSize,ulong32_t flags,double density);
@@ -7963,6 +8212,8 @@ void CSdeleteBynGridFile (struct csBynGridFile_* __This);
 void CSreleaseBynGridFile (struct csBynGridFile_* __This);
 double CStestBynGridFile (struct csBynGridFile_* __This,Const double *sourceLL);
 int CScalcBynGridFile (struct csBynGridFile_* __This,double* result,Const double* sourceLL);
+int CScalcBynGridFileN (struct csBynGridFile_* __This,double results [],int status [],Const double sourceLL [][3],int count);
+int CSgatherBynGridFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL);
 
 struct cs_DtcXform_ *CSnewFallback (Const char *dtKeyName,Const char* catalog);
 void CSdeleteFallback (struct cs_DtcXform_ *__This);
@@ -7975,12 +8226,14 @@ void CSdeleteGeoidHeight (struct csGeoidHeight_* __This);
 struct csGeoidHeightEntry_* CSselectGeoidHeight (struct csGeoidHeight_* __This,Const double ll84 [2]);
 void CSfirstGeoidHeight (struct csGeoidHeight_* __This,struct csGeoidHeightEntry_* ghEntryPtr);
 int CScalcGeoidHeight (struct csGeoidHeight_* __This,double *geoidHgt,Const double ll84 [2]);
+int CScalcGeoidHeightN (struct csGeoidHeight_* __This,double geoidHgt [],int status [],Const double ll84 [][3],int count);
 void CSreleaseGeoidHeight (struct csGeoidHeight_* __This);
 struct csGeoidHeightEntry_* CSnewGeoidHeightEntry (struct csDatumCatalogEntry_* catPtr);
 void CSdeleteGeoidHeightEntry (struct csGeoidHeightEntry_* __This);
 void CSreleaseGeoidHeightEntry (struct csGeoidHeightEntry_* __This);
 double CStestGeoidHeightEntry (struct csGeoidHeightEntry_* __This,Const double ll84 [2]);
 int CScalcGeoidHeightEntry (struct csGeoidHeightEntry_* __This,double* geoidHgt,Const double ll84 [2]);
+int CScalcGeoidHeightEntryN (struct csGeoidHeightEntry_* __This,double geoidHgt [],int status [],Const double ll84 [][3],int count);
 
 struct csVertconUS_* CSnewVertconUS (Const char *catalog);
 void CSdeleteVertconUS (struct csVertconUS_* __This);
@@ -8000,6 +8253,10 @@ void CSreleaseOstn97 (struct cs_Ostn97_ *__This);
 int CSprivateOstn97 (struct cs_Ostn97_ *__This,double result [2],const double etrs89 [2]);
 int CSforwardOstn97 (struct cs_Ostn97_ *__This,double osgb36 [2],const double etrs89 [2]);
 int CSinverseOstn97 (struct cs_Ostn97_ *__This,double etrs89 [2],const double osgb36 [2]);
+int CSforwardOstn97N (struct cs_Ostn97_ *__This,double osgb36 [][2],const double etrs89 [][2],int status [],int count);
+int CSinverseOstn97N (struct cs_Ostn97_ *__This,double etrs89 [][2],const double osgb36 [][2],int status [],int count);
+int CSloadOstn97 (struct cs_Ostn97_ *__This);
+float *CSnodeOstn97 (struct cs_Ostn97_ *__This,long32_t recNbr,long32_t eleNbr);
 int CSmkBinaryOstn97 (struct cs_Ostn97_ *__This);
 double CSdebugOstn97 (struct cs_Ostn97_ *__This);
 
@@ -8010,6 +8267,10 @@ void CSreleaseOstn02 (struct cs_Ostn02_ *__This);
 int CSprivateOstn02 (struct cs_Ostn02_ *__This,double result [2],const double etrs89 [2]);
 int CSforwardOstn02 (struct cs_Ostn02_ *__This,double osgb36 [2],const double etrs89 [2]);
 int CSinverseOstn02 (struct cs_Ostn02_ *__This,double etrs89 [2],const double osgb36 [2]);
+int CSforwardOstn02N (struct cs_Ostn02_ *__This,double osgb36 [][2],const double etrs89 [][2],int status [],int count);
+int CSinverseOstn02N (struct cs_Ostn02_ *__This,double etrs89 [][2],const double osgb36 [][2],int status [],int count);
+int CSloadOstn02 (struct cs_Ostn02_ *__This);
+float *CSnodeOstn02 (struct cs_Ostn02_ *__This,long32_t recNbr,long32_t eleNbr);
 int CSmkBinaryOstn02 (struct cs_Ostn02_ *__This);
 double CStestOstn02 (struct cs_Ostn02_ *__This);
 
@@ -8018,6 +8279,9 @@ void CSdeleteOsgm91 (struct cs_Osgm91_ *__This);
 void CSreleaseOsgm91 (struct cs_Osgm91_ *__This);
 double CStestOsgm91 (struct cs_Osgm91_ *__This,const double etrs89 [2]);
 int CScalcOsgm91 (struct cs_Osgm91_ *__This,double *geoidHgt,const double etrs89 [2]);
+int CScalcOsgm91N (struct cs_Osgm91_ *__This,double geoidHgt [],int status [],const double etrs89 [][3],int count);
+int CSloadOsgm91 (struct cs_Osgm91_ *__This);
+float *CSnodeOsgm91 (struct cs_Osgm91_ *__This,long32_t recNbr,long32_t eleNbr);
 int CSmkBinaryOsgm91 (struct cs_Osgm91_ *__This);
 double CSdebugOsgm91 (struct cs_Osgm91_ *__This);
 
@@ -8033,9 +8297,7 @@ double CSdebugEgm96 (struct cs_Egm96_ *__This);
 void EXP_LVL5 CS_llhToXyz (double xyz [3],Const double llh [3],double e_rad,double e_sq);
 int EXP_LVL5 CS_xyzToLlh (double llh [3],Const double xyz [3],double e_rad,double e_sq);
 
-#if _FILE_SYSTEM == _fs_UNIX
 csFILE *CS_fopen (const char *filename,const char *mode);
-#endif
 /* Note: ftw is only used in the CS_swpal function in the CS_rlsUpdt module.
 	 The CS_swpal function is only used in the CStestS.c  function of the CS_Test
 	(console test) module.  Since it is not used in the library portion of the product,
@@ -1436,10 +1436,13 @@ int				EXP_LVL1	CS_altdr (Const char *alt_dir);
 long32_t		EXP_LVL1	CS_atof (double *result,Const char *value);
 int				EXP_LVL1	CS_azddll (double e_rad,double e_sq,double ll_from [3],double azimuth,double *dist,double ll_to [3]);
 double			EXP_LVL1	CS_azsphr (double ll0 [2],double ll1 [2]);
+int				EXP_LVL1	CS_bundleOpen (Const char *bundlePath);
 int				EXP_LVL1	CS_cmpDbls (double first,double second);
 double			EXP_LVL1	CS_cnvrg (Const char *cs_nam,double ll [2]);
 int				EXP_LVL1	CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3]);
 int				EXP_LVL1	CS_cnvrt3D (Const char *src_cs,Const char *dst_cs,double coord [3]);
+int				EXP_LVL1	CS_cnvrtEpsg (long srcCode,long dstCode,double coord [3]);
+int				EXP_LVL1	CS_cnvrtEpsg3D (long srcCode,long dstCode,double coord [3]);
 int				EXP_LVL1	CS_csEnum (int index,char *key_name,int size);
 void			EXP_LVL1	CS_csfnm (Const char *new_name);
 int				EXP_LVL1	CS_csGrpEnum (int index,char *grp_name,int name_sz,char *grp_dscr,int dscr_sz);
@@ -1469,6 +1472,7 @@ int				EXP_LVL1	CS_getSourceOf (Const char *csKeyName,char *source,int size);
 int				EXP_LVL1	CS_getUnitsOf (Const char *csKeyName,char *unitName,int size);
 void			EXP_LVL1	CS_geoidCls (void);
 int				EXP_LVL1	CS_geoidHgt (Const double ll_84 [2],double *height);
+int				EXP_LVL1	CS_geoidHgtN (Const double ll_84 [][3],double height [],int status [],int count);
 int				EXP_LVL1	CS_csGrpEnum (int index,char *grp_name,int name_sz,char *grp_dscr,int dscr_sz);
 int				EXP_LVL1	CS_isgeo (Const char *cs_nam);
 double			EXP_LVL1	CS_llazdd (double e_rad,double e_sq,double ll_from [3],double ll_to [3],double *dist);
@@ -1518,7 +1522,11 @@ int					EXP_LVL3	CS_cs2ll (struct cs_Csprm_ *csprm,double ll [3],double xy [3]);
 int					EXP_LVL3	CS_cs3ll (struct cs_Csprm_ *csprm,double ll [3],double xy [3]);
 double				EXP_LVL3	CS_cscnv (struct cs_Csprm_ *csprm,double ll [3]);
 struct cs_Csdef_*	EXP_LVL3	CS_csdef (Const char *cs_nam);
+Const struct cs_Csdef_*	EXP_LVL3	CS_csdefMap (Const char *cs_nam);
+long32_t			EXP_LVL3	CS_csdefMapAll (Const struct cs_Csdef_ **defArray,int userDict);
 int					EXP_LVL3	CS_csdel (struct cs_Csdef_ *csdef);
+int					EXP_LVL3	CS_csRangeEnumSetupEx (Const double ll_min [2],Const double ll_max [2],Const char *grp_name,Const char *cat_name);
+int					EXP_LVL3	CS_csRangeEnumSetupN (Const double ll [][2],int count,Const char *grp_name,Const char *cat_name);
 struct cs_Csprm_*	EXP_LVL3	CS_csloc (Const char *cs_nam);
 double				EXP_LVL3	CS_cssch (struct cs_Csprm_ *csprm,double ll [3]);
 double				EXP_LVL3	CS_cssck (struct cs_Csprm_ *csprm,double ll [3]);
@@ -1527,10 +1535,16 @@ void				EXP_LVL3	CS_dtcls (struct cs_Dtcprm_ *dtc_ptr);
 struct cs_Dtcprm_*	EXP_LVL3	CS_dtcsu (struct cs_Csprm_ *src_cs,struct cs_Csprm_ *dest_cs,int dat_erf,int blk_erf);
 int					EXP_LVL3	CS_dtcvt (struct cs_Dtcprm_ *dtc_ptr,double ll_in [3],double ll_out [3]);
 int					EXP_LVL3	CS_dtcvt3D (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [3],double ll_out [3]);
+int					EXP_LVL3	CS_dtcvtN (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [][3],double ll_out [][3],int status [],int count);
+int					EXP_LVL3	CS_dtcvt3DN (struct cs_Dtcprm_ *dtc_ptr,Const double ll_in [][3],double ll_out [][3],int status [],int count);
 struct cs_Dtdef_*	EXP_LVL3	CS_dtdef (Const char *dat_nam);
+Const struct cs_Dtdef_*	EXP_LVL3	CS_dtdefMap (Const char *dt_nam);
+long32_t			EXP_LVL3	CS_dtdefMapAll (Const struct cs_Dtdef_ **defArray,int userDict);
 int					EXP_LVL3	CS_dtdel (struct cs_Dtdef_ *dtdef);
 char*				EXP_LVL3	CS_dtdflt (Const char *dtKeyName);
 struct cs_Eldef_*	EXP_LVL3	CS_eldef (Const char *el_nam);
+Const struct cs_Eldef_*	EXP_LVL3	CS_eldefMap (Const char *el_nam);
+long32_t			EXP_LVL3	CS_eldefMapAll (Const struct cs_Eldef_ **defArray,int userDict);
 int					EXP_LVL3	CS_eldel (struct cs_Eldef_ *eldef);
 char*				EXP_LVL3	CS_eldflt (Const char *elKeyName);
 void				EXP_LVL3	CS_free (void *ptr);
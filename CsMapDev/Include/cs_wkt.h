@@ -157,4 +157,97 @@ void CS_wktDtNameFix (char *datumName,size_t rsltSize,const char *srcName);
 void CS_wktCsNameFix (char *csysName,size_t rsltSize,const char *srcName);
 unsigned short CS_wktProjLookUp (ErcWktFlavor flavor,const char *wktName);
 bool EXP_LVL3 CSgetParamNm (char* paramName,size_t paramSize,EcsNameFlavor nmFlavor,int paramCode);
+
+/******************************************************************************
+   TcsWktWriter  --  The destination of the WKT producers.
+
+   The CSel2WktWrite, CSdt2WktWrite, and CScs2WktWrite functions produce WKT
+   directly into one of these, without building intermediate copies of the
+   complete string.  A writer is constructed upon one of:
+	1> a caller supplied fixed size buffer; the result is truncated and null
+	   terminated exactly as CS_stncp would do;
+	2> a caller supplied std::string, which grows as required; or
+	3> a sink function which is handed the text in pieces as it is produced;
+	   the text handed to the sink is not null terminated, and a non-zero
+	   return from the sink terminates the output.
+   Once the output has been truncated or terminated, IsOk returns false and
+   all further output is quietly discarded.  Output to a sink is staged, so
+   Flush must be called (the destructor does so) to deliver the remainder. */
+typedef int (*TcsWktSinkFunc)(void* userData,const char* text,size_t length);
+class TcsWktWriter
+{
+	static const size_t KcsStageSize = 1024;
+public:
+	TcsWktWriter (char* bufr,size_t bufrSize);
+	TcsWktWriter (std::string& text);
+	TcsWktWriter (TcsWktSinkFunc sinkFunc,void* userData);
+	~TcsWktWriter (void);
+	bool IsOk (void) const { return Ok; }
+	size_t GetLength (void) const { return Length; }
+	bool Fits (size_t length) const;
+	void Append (const char* text);
+	void Append (const char* text,size_t length);
+	void Append (char chr);
+	void AppendFixed (double value,int precision,int width = 0);
+	bool Flush (void);
+private:
+	enum EcsTarget { Buffer, String, Sink };
+	TcsWktWriter (const TcsWktWriter& source);			// not implemented
+	TcsWktWriter& operator= (const TcsWktWriter& rhs);	// not implemented
+	EcsTarget Target;
+	bool Ok;
+	size_t Length;
+	char* Bufr;
+	size_t BufrSize;
+	std::string* Text;
+	TcsWktSinkFunc SinkFunc;
+	void* UserData;
+	size_t Staged;
+	char Stage [KcsStageSize];
+};
+
+/******************************************************************************
+   TcsWktLlBaseMap  --  The base geographic system of each datum.
+
+   CScs2WktWrite needs the name of a geographic coordinate system referenced
+   to the datum of each projected system it writes, which CSllCsFromDt obtains
+   by searching the coordinate system dictionary.  When writing many systems,
+   one of these objects, which searches the dictionary once, may be supplied
+   instead.  Locate produces the same result as CSllCsFromDt would. */
+struct TcsWktKeyNmLess
+{
+	bool operator() (const std::string& lhs,const std::string& rhs) const;
+};
+class TcsWktLlBaseMap
+{
+public:
+	TcsWktLlBaseMap (void);
+	bool IsOk (void) const { return Ok; }
+	const char* Locate (const char* dtKeyName) const;
+private:
+	bool Ok;
+	bool Ll84Valid;
+	std::map<std::string,std::string,TcsWktKeyNmLess> BaseNames;
+};
+
+int CSel2WktWrite (TcsWktWriter& elWkt,enum ErcWktFlavor flavor,const struct cs_Eldef_ *el_def,unsigned short flags);
+int CSdt2WktWrite (TcsWktWriter* dtWkt,TcsWktWriter* geoTranWkt,enum ErcWktFlavor flavor,const struct cs_Dtdef_ *dt_def,
+																						  const struct cs_Eldef_ *el_def,
+																						  unsigned short flags);
+int CScs2WktWrite (TcsWktWriter& csWkt,enum ErcWktFlavor flavor,const struct cs_Csdef_ *cs_def,
+																const struct cs_Dtdef_ *dt_def,
+																const struct cs_Eldef_ *el_def,
+																unsigned short flags,
+																const TcsWktLlBaseMap* baseMap = 0);
+
+/******************************************************************************
+   Flavored names used by the WKT producers.  These are obtained from the name
+   mapper once per flavor and retained in tables which are refreshed whenever
+   the name mapper is reconstructed.  CSwktParamName returns a name for any
+   valid parameter code, falling back to the CS-MAP name; a null pointer
+   indicates an invalid code.  CSwktProjName returns a null pointer if the
+   name mapper has no name for the projection in the given flavor. */
+const char* CSwktParamName (EcsNameFlavor nmFlavor,int paramCode);
+const char* CSwktProjName (EcsNameFlavor nmFlavor,const char* prjKeyName);
+const char* CSwktDegreeName (EcsNameFlavor nmFlavor);
 #endif
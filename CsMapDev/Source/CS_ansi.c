@@ -172,7 +172,12 @@ int EXP_LVL9 CS_access (Const char *path,int mode)
 	/* Use this one if your run-time library supports access.  You may
 	   prefer to use _access, as when using the Microsoft compiler, you
 	   will not need to link "oldnames.lib" in order to get a successful
-	   link. */
+	   link.  Files in an open dictionary bundle exist and are read
+	   only. */
+	if (CSbundleHas (path))
+	{
+		return ((mode & 2) != 0) ? -1 : 0;
+	}
 #	if _RUN_TIME == _rt_MSDOTNET || _RUN_TIME == _rt_MSWIN64
 		return _access (path,mode);
 #	else
@@ -333,7 +338,8 @@ cs_Time_ EXP_LVL7 CS_fileModTime (Const char *filePath)
 	cs_Time_ rtnValue;
 	struct _stat statBufr;
 
-	rtnValue = 0;
+	rtnValue = CSbundleModTime (filePath);
+	if (rtnValue != 0) return rtnValue;
 	st = _stat (filePath,&statBufr);
 	if (st == 0)
 	{
@@ -341,6 +347,30 @@ cs_Time_ EXP_LVL7 CS_fileModTime (Const char *filePath)
 	}
 	return rtnValue;
 }
+
+/* Companion to CS_fileModTime: returns the size of a file, zero if the file
+   does not exist.  This is used, with the modification time, to detect a
+   change to a file; the low order 32 bits suffice for that purpose.  The
+   modification time alone does not, as it has a resolution of a second,
+   and a file may be replaced by an older one. */
+ulong32_t EXP_LVL7 CS_fileSize (Const char *filePath)
+{
+	int st;
+	ulong32_t rtnValue;
+	struct _stat statBufr;
+
+	if (CSbundleHas (filePath))
+	{
+		return CSbundleFileSize (filePath);
+	}
+	rtnValue = 0UL;
+	st = _stat (filePath,&statBufr);
+	if (st == 0)
+	{
+		rtnValue = (ulong32_t)statBufr.st_size;
+	}
+	return rtnValue;
+}
 #ifdef CS_strnicmp
 #	undef CS_strnicmp
 #endif
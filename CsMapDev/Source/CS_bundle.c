@@ -0,0 +1,581 @@
+/*
+ * Copyright (c) 2008, Autodesk, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Autodesk, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Autodesk, Inc. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL Autodesk, Inc. OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+	Dictionary bundles.
+
+	A bundle is a single, read only file which carries the compiled
+	dictionaries, the name mapper, and any other data files an
+	application needs, so that a deployment consists of the library and
+	one file.  CS_bundleWrite produces a bundle from the files in a
+	dictionary directory; the CS_Comp utility does so when given the
+	bundle option.  The bundle consists of a csBundleHdr_, a table
+	of csBundleEntry_ sorted by name, and the member files, each of which
+	starts on an eight byte boundary.
+
+	CS_bundleOpen maps the bundle into memory and makes the directory in
+	which it resides the dictionary directory.  From then on, CS_fopen,
+	CS_access, and CS_fileModTime see the members of the bundle as files
+	in that directory; a member opened for reading is served from the
+	mapping, without any access to the file system.  Files which are not
+	in the bundle, grid data files for example, are opened from the disk
+	as before.  A grid file may nonetheless be bundled by naming it; the
+	grid file readers then read it from the member stream, which has no
+	file descriptor.  Members are read only: CS_access reports them as not
+	writable, and an open for writing or update fails.
+
+	The grid file catalogs (GeoidHeight.gdc, for example) locate their
+	grid files relative to the directory in which the catalog resides; a
+	bundle which includes them should reside in the directory which holds
+	the grid files.
+*/
+
+#include "cs_map.h"
+#include <errno.h>
+
+#if _RUN_TIME >= _rt_UNIXPCC
+#	include <sys/mman.h>
+#endif
+
+static void *csBundleImage = NULL;			/* the mapping, or a malloc'ed copy,
+											   of the entire bundle. */
+static size_t csBundleSize = 0;
+static int csBundleMapped = FALSE;
+static Const struct csBundleEntry_ *csBundleEntries = NULL;
+static ulong32_t csBundleCount = 0UL;
+static cs_Time_ csBundleTime = 0;			/* modification time of the bundle */
+static char csBundleDir [MAXPATH];			/* directory containing the bundle,
+											   with a trailing separator. */
+
+/* Compares member names; case insensitive, and either directory separator
+   matches the other. */
+static int CSbundleNameCmp (Const char *name1,Const char *name2)
+{
+	int cc1, cc2;
+
+	do
+	{
+		cc1 = CS_tolower ((unsigned char)*name1++);
+		cc2 = CS_tolower ((unsigned char)*name2++);
+		if (cc1 == '\\') cc1 = '/';
+		if (cc2 == '\\') cc2 = '/';
+	} while (cc1 == cc2 && cc1 != '\0');
+	return cc1 - cc2;
+}
+
+static int CSbundleEntryCmp (Const void *entry1,Const void *entry2)
+{
+	return CSbundleNameCmp (((Const struct csBundleEntry_ *)entry1)->name,
+							((Const struct csBundleEntry_ *)entry2)->name);
+}
+
+static void CSbundleClose (void)
+{
+	if (csBundleImage != NULL)
+	{
+#if _RUN_TIME >= _rt_UNIXPCC
+		if (csBundleMapped)
+		{
+			munmap (csBundleImage,csBundleSize);
+		}
+		else
+		{
+			CS_free (csBundleImage);
+		}
+#else
+		CS_free (csBundleImage);
+#endif
+	}
+	csBundleImage = NULL;
+	csBundleSize = 0;
+	csBundleMapped = FALSE;
+	csBundleEntries = NULL;
+	csBundleCount = 0UL;
+	csBundleTime = 0;
+	csBundleDir [0] = '\0';
+}
+
+/* Returns the entry for the member which the given path refers to, NULL if
+   no bundle is open or the path does not refer to a member. */
+static Const struct csBundleEntry_* CSbundleLocate (Const char *filePath)
+{
+	int cmp;
+	size_t dirLen;
+	ulong32_t lo, hi, mid;
+
+	if (csBundleImage == NULL || filePath == NULL) return NULL;
+	dirLen = strlen (csBundleDir);
+	if (CS_strnicmp (filePath,csBundleDir,dirLen) != 0) return NULL;
+	filePath += dirLen;
+
+	lo = 0UL;
+	hi = csBundleCount;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		cmp = CSbundleNameCmp (filePath,csBundleEntries [mid].name);
+		if (cmp == 0) return &csBundleEntries [mid];
+		if (cmp < 0) hi = mid;
+		else         lo = mid + 1;
+	}
+	return NULL;
+}
+
+int EXP_LVL9 CSbundleHas (Const char *filePath)
+{
+	return (CSbundleLocate (filePath) != NULL);
+}
+
+cs_Time_ EXP_LVL9 CSbundleModTime (Const char *filePath)
+{
+	return (CSbundleLocate (filePath) != NULL) ? csBundleTime : 0;
+}
+
+ulong32_t EXP_LVL9 CSbundleFileSize (Const char *filePath)
+{
+	Const struct csBundleEntry_ *entry;
+
+	entry = CSbundleLocate (filePath);
+	return (entry != NULL) ? entry->size : 0UL;
+}
+
+/* Opens a stream on a member of the bundle.  Returns NULL if the path does
+   not refer to a member, in which case the caller opens the file in the
+   normal manner.  Members are read only; for a mode other than a read only
+   mode, errno is set to EACCES and NULL is returned. */
+csFILE* EXP_LVL9 CSbundleFopen (Const char *filePath,Const char *mode)
+{
+	csFILE *strm;
+	Const char *data;
+	Const struct csBundleEntry_ *entry;
+
+	entry = CSbundleLocate (filePath);
+	if (entry == NULL) return NULL;
+	if (mode == NULL || *mode != 'r' || strchr (mode,'+') != NULL)
+	{
+		errno = EACCES;
+		return NULL;
+	}
+	data = (Const char *)csBundleImage + entry->offset;
+
+	strm = NULL;
+#if _RUN_TIME >= _rt_UNIXPCC
+	/* A read only stream directly on the mapping; the member is never
+	   copied.  Some run time libraries do not accept an empty buffer. */
+	if (entry->size > 0)
+	{
+		strm = fmemopen ((void *)data,(size_t)entry->size,"r");
+	}
+#endif
+	if (strm == NULL)
+	{
+		/* A temporary copy of the member. */
+		strm = tmpfile ();
+		if (strm != NULL)
+		{
+			if (CS_fwrite (data,1,(size_t)entry->size,strm) != (size_t)entry->size)
+			{
+				CS_fclose (strm);
+				return NULL;
+			}
+			CS_fseek (strm,0L,SEEK_SET);
+		}
+	}
+	return strm;
+}
+
+/**********************************************************************
+**	status = CS_bundleOpen (bundlePath);
+**
+**	Const char *bundlePath;		full path to the bundle to be used,
+**								NULL closes the current bundle.
+**	int status;					returns zero on success, -1 on failure.
+**
+**	On success, the directory containing the bundle becomes the
+**	dictionary directory (as if CS_altdr had been called), and the
+**	dictionaries and other members of the bundle are read from it.
+**	Any bundle previously opened is closed.  The bundle must contain a
+**	Coordinate System Dictionary.
+**
+**	After closing a bundle, use CS_altdr to select the dictionary
+**	directory to be used.
+**********************************************************************/
+int EXP_LVL1 CS_bundleOpen (Const char *bundlePath)
+{
+	extern char csErrnam [];
+	extern char cs_Csname [];
+	extern char cs_DirsepC;
+
+	ulong32_t idx;
+	long fileSize;
+	size_t tblEnd;
+
+	char *cp;
+	csFILE *strm;
+	Const struct csBundleHdr_ *hdrPtr;
+	Const struct csBundleEntry_ *entry;
+
+	char ctemp [MAXPATH];
+
+	/* Anything cached may have come from the current bundle. */
+	CS_recvr ();
+	CSbundleClose ();
+	if (bundlePath == NULL || *bundlePath == '\0') return 0;
+
+	strm = NULL;
+	csBundleTime = CS_fileModTime (bundlePath);
+	strm = CS_fopen (bundlePath,_STRM_BINRD);
+	if (strm == NULL || csBundleTime == 0)
+	{
+		CS_stncp (csErrnam,bundlePath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		goto error;
+	}
+	CS_fseek (strm,0L,SEEK_END);
+	fileSize = CS_ftell (strm);
+	if (fileSize < (long)sizeof (struct csBundleHdr_))
+	{
+		CS_stncp (csErrnam,bundlePath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	csBundleSize = (size_t)fileSize;
+
+#if _RUN_TIME >= _rt_UNIXPCC
+	csBundleImage = mmap (NULL,csBundleSize,PROT_READ,MAP_SHARED,_fileno (strm),(off_t)0);
+	if (csBundleImage == MAP_FAILED)
+	{
+		csBundleImage = NULL;
+	}
+	else
+	{
+		csBundleMapped = TRUE;
+	}
+#endif
+	if (csBundleImage == NULL)
+	{
+		/* No mapping available, read the whole thing. */
+		csBundleImage = CS_malc (csBundleSize);
+		if (csBundleImage == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			goto error;
+		}
+		CS_fseek (strm,0L,SEEK_SET);
+		if (CS_fread (csBundleImage,1,csBundleSize,strm) != csBundleSize)
+		{
+			CS_stncp (csErrnam,bundlePath,MAXPATH);
+			CS_erpt (cs_IOERR);
+			goto error;
+		}
+	}
+	CS_fclose (strm);
+	strm = NULL;
+
+	/* Verify the header and every entry before using any of it. */
+	hdrPtr = (Const struct csBundleHdr_ *)csBundleImage;
+	tblEnd = sizeof (struct csBundleHdr_) + (size_t)hdrPtr->memberCount * sizeof (struct csBundleEntry_);
+	if (hdrPtr->magic != cs_BUNDLE_MAGIC ||
+		hdrPtr->byteOrder != cs_DICTMAP_ORDER ||
+		hdrPtr->memberCount > (ulong32_t)(csBundleSize / sizeof (struct csBundleEntry_)) ||
+		tblEnd > csBundleSize)
+	{
+		CS_stncp (csErrnam,bundlePath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	entry = (Const struct csBundleEntry_ *)((Const char *)csBundleImage + sizeof (struct csBundleHdr_));
+	for (idx = 0;idx < hdrPtr->memberCount;idx += 1)
+	{
+		if (entry [idx].name [sizeof (entry [idx].name) - 1] != '\0' ||
+			entry [idx].offset < tblEnd ||
+			entry [idx].offset > csBundleSize ||
+			entry [idx].size > csBundleSize - entry [idx].offset ||
+			(idx > 0 && CSbundleEntryCmp (&entry [idx - 1],&entry [idx]) >= 0))
+		{
+			CS_stncp (csErrnam,bundlePath,MAXPATH);
+			CS_erpt (cs_INV_FILE);
+			goto error;
+		}
+	}
+	csBundleEntries = entry;
+	csBundleCount = hdrPtr->memberCount;
+
+	/* The bundle directory is the directory containing the bundle. */
+	CS_stncp (ctemp,bundlePath,sizeof (ctemp));
+	cp = strrchr (ctemp,cs_DirsepC);
+	if (cp != NULL)
+	{
+		*(cp + 1) = '\0';
+	}
+	else
+	{
+		ctemp [0] = '.';
+		ctemp [1] = cs_DirsepC;
+		ctemp [2] = '\0';
+	}
+	CS_stncp (csBundleDir,ctemp,sizeof (csBundleDir));
+	CS_stncat (ctemp,cs_Csname,sizeof (ctemp));
+	if (!CSbundleHas (ctemp))
+	{
+		CS_stncp (csErrnam,bundlePath,MAXPATH);
+		CS_erpt (cs_CSDICT);
+		goto error;
+	}
+	if (CS_altdr (csBundleDir) != 0)
+	{
+		CS_stncp (csErrnam,bundlePath,MAXPATH);
+		CS_erpt (cs_CSDICT);
+		goto error;
+	}
+	return 0;
+
+error:
+	if (strm != NULL) CS_fclose (strm);
+	CSbundleClose ();
+	return -1;
+}
+
+/**********************************************************************
+**	status = CS_bundleWrite (bundlePath,dictDir,fileNames);
+**
+**	Const char *bundlePath;		full path of the bundle to be written.
+**	Const char *dictDir;		directory containing the files to be
+**								bundled.
+**	Const char *fileNames [];	NULL terminated list of the names of the
+**								files to be bundled, relative to dictDir.
+**								NULL selects the dictionaries, the name
+**								mapper, and the geoid and vertcon
+**								catalogs; of these, only the Coordinate
+**								System Dictionary is required to exist.
+**	int status;					returns zero on success, -1 on failure.
+**
+**	The bundle is written in the byte order of the host, and can only
+**	be used on hosts of the same byte order.
+**********************************************************************/
+int EXP_LVL3 CS_bundleWrite (Const char *bundlePath,Const char *dictDir,Const char *fileNames [])
+{
+	extern char csErrnam [];
+	extern char cs_DirsepC;
+	extern char cs_Csname [];
+	extern char cs_Dtname [];
+	extern char cs_Elname [];
+	extern char cs_Ctname [];
+	extern char cs_Gxname [];
+	extern char cs_Gpname [];
+	extern char cs_NameMapperName [];
+	extern char cs_NameMapperImgName [];
+	extern char cs_GeoidName [];
+	extern char cs_VertconName [];
+
+	Const char *dfltNames [11];
+
+	int optional;
+	ulong32_t idx;
+	ulong32_t count;
+	ulong32_t offset;
+	long fileSize;
+	size_t rdCnt;
+
+	char *dirP;
+	Const char **names;
+	csFILE *inStrm;
+	csFILE *outStrm;
+	struct csBundleEntry_ *entries;
+	struct csBundleHdr_ hdr;
+
+	char ctemp [MAXPATH];
+	char bufr [4096];
+
+	static Const char pad [8] = {0};
+
+	inStrm = NULL;
+	outStrm = NULL;
+	entries = NULL;
+
+	optional = (fileNames == NULL);
+	if (optional)
+	{
+		dfltNames [0] = cs_Csname;
+		dfltNames [1] = cs_Dtname;
+		dfltNames [2] = cs_Elname;
+		dfltNames [3] = cs_Ctname;
+		dfltNames [4] = cs_Gxname;
+		dfltNames [5] = cs_Gpname;
+		dfltNames [6] = cs_NameMapperName;
+		dfltNames [7] = cs_NameMapperImgName;
+		dfltNames [8] = cs_GeoidName;
+		dfltNames [9] = cs_VertconName;
+		dfltNames [10] = NULL;
+		fileNames = dfltNames;
+	}
+
+	dirP = CS_stncp (ctemp,dictDir,sizeof (ctemp) - 1);
+	if (dirP != ctemp && *(dirP - 1) != cs_DirsepC)
+	{
+		*dirP++ = cs_DirsepC;
+		*dirP = '\0';
+	}
+
+	/* Build the entry table; sizes now, offsets once sorted. */
+	for (count = 0;fileNames [count] != NULL;count += 1);
+	entries = (struct csBundleEntry_ *)CS_malc ((count + 1) * sizeof (struct csBundleEntry_));
+	if (entries == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	memset (entries,'\0',(count + 1) * sizeof (struct csBundleEntry_));
+	idx = 0;
+	for (names = fileNames;*names != NULL;names += 1)
+	{
+		CS_stncp (dirP,*names,(int)(sizeof (ctemp) - (size_t)(dirP - ctemp)));
+		if (strlen (*names) >= sizeof (entries [idx].name))
+		{
+			CS_stncp (csErrnam,*names,MAXPATH);
+			CS_erpt (cs_FL_OPEN);
+			goto error;
+		}
+
+		/* Of the default list, only the first, the Coordinate System
+		   Dictionary, is required. */
+		if (optional && names != fileNames && CS_access (ctemp,4) != 0)
+		{
+			continue;
+		}
+		inStrm = CS_fopen (ctemp,_STRM_BINRD);
+		if (inStrm == NULL)
+		{
+			CS_stncp (csErrnam,ctemp,MAXPATH);
+			CS_erpt (cs_FL_OPEN);
+			goto error;
+		}
+		CS_fseek (inStrm,0L,SEEK_END);
+		fileSize = CS_ftell (inStrm);
+		CS_fclose (inStrm);
+		inStrm = NULL;
+		if (fileSize < 0L)
+		{
+			CS_stncp (csErrnam,ctemp,MAXPATH);
+			CS_erpt (cs_IOERR);
+			goto error;
+		}
+		CS_stncp (entries [idx].name,*names,sizeof (entries [idx].name));
+		entries [idx].size = (ulong32_t)fileSize;
+		idx += 1;
+	}
+	count = idx;
+	qsort (entries,(size_t)count,sizeof (struct csBundleEntry_),CSbundleEntryCmp);
+	offset = (ulong32_t)(sizeof (struct csBundleHdr_) + count * sizeof (struct csBundleEntry_));
+	for (idx = 0;idx < count;idx += 1)
+	{
+		if (idx > 0 && CSbundleEntryCmp (&entries [idx - 1],&entries [idx]) == 0)
+		{
+			CS_stncp (csErrnam,entries [idx].name,MAXPATH);
+			CS_erpt (cs_INV_FILE);
+			goto error;
+		}
+		offset = (offset + 7UL) & ~7UL;
+		entries [idx].offset = offset;
+		offset += entries [idx].size;
+	}
+
+	memset (&hdr,'\0',sizeof (hdr));
+	hdr.magic = cs_BUNDLE_MAGIC;
+	hdr.byteOrder = cs_DICTMAP_ORDER;
+	hdr.memberCount = count;
+
+	outStrm = CS_fopen (bundlePath,_STRM_BINWR);
+	if (outStrm == NULL)
+	{
+		CS_stncp (csErrnam,bundlePath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		goto error;
+	}
+	if (CS_fwrite (&hdr,sizeof (hdr),1,outStrm) != 1 ||
+		(count > 0 && CS_fwrite (entries,sizeof (struct csBundleEntry_),(size_t)count,outStrm) != (size_t)count))
+	{
+		goto wrtError;
+	}
+	offset = (ulong32_t)(sizeof (struct csBundleHdr_) + count * sizeof (struct csBundleEntry_));
+	for (idx = 0;idx < count;idx += 1)
+	{
+		if (entries [idx].offset > offset &&
+			CS_fwrite (pad,1,(size_t)(entries [idx].offset - offset),outStrm) != (size_t)(entries [idx].offset - offset))
+		{
+			goto wrtError;
+		}
+		offset = entries [idx].offset;
+
+		CS_stncp (dirP,entries [idx].name,(int)(sizeof (ctemp) - (size_t)(dirP - ctemp)));
+		inStrm = CS_fopen (ctemp,_STRM_BINRD);
+		if (inStrm == NULL)
+		{
+			CS_stncp (csErrnam,ctemp,MAXPATH);
+			CS_erpt (cs_FL_OPEN);
+			goto error;
+		}
+		while ((rdCnt = CS_fread (bufr,1,sizeof (bufr),inStrm)) > 0)
+		{
+			if (offset + rdCnt > entries [idx].offset + entries [idx].size ||
+				CS_fwrite (bufr,1,rdCnt,outStrm) != rdCnt)
+			{
+				goto wrtError;
+			}
+			offset += (ulong32_t)rdCnt;
+		}
+		CS_fclose (inStrm);
+		inStrm = NULL;
+		if (offset != entries [idx].offset + entries [idx].size)
+		{
+			/* File changed while we were bundling it. */
+			CS_stncp (csErrnam,ctemp,MAXPATH);
+			CS_erpt (cs_IOERR);
+			goto error;
+		}
+	}
+	if (CS_fclose (outStrm) != 0)
+	{
+		outStrm = NULL;
+		goto wrtError;
+	}
+	CS_free (entries);
+	return 0;
+
+wrtError:
+	CS_stncp (csErrnam,bundlePath,MAXPATH);
+	CS_erpt (cs_IOERR);
+error:
+	if (inStrm != NULL) CS_fclose (inStrm);
+	if (outStrm != NULL)
+	{
+		CS_fclose (outStrm);
+		CS_remove (bundlePath);									/*lint !e534 */
+	}
+	if (entries != NULL) CS_free (entries);
+	return -1;
+}
@@ -52,6 +52,9 @@ short CSswapShort (short source,int swapEm);
 long32_t  CSswapLong  (long32_t source,int swapEm);
 double EXP_LVL9 CSbynGridFileQterp (double sourceDelta [2],double array [9]);
 double EXP_LVL9 CSbynGridFileQterp1 (double delta,double f0,double f1,double f2);
+static void CSfreeBynTiles (struct csBynGridFile_* thisPtr);
+static int CSreadBynTile (struct csBynGridFile_* thisPtr,struct csBynTile_* tilePtr,long32_t firstRecord);
+static Const double* CSbynTileRecord (struct csBynGridFile_* thisPtr,long32_t recNbr);
 
 /*****************************************************************************
 	'Private' support function
@@ -75,6 +78,10 @@ void CSinitBynGridFile (struct csBynGridFile_ *thisPtr)
 	thisPtr->elementSize = 0;
 	thisPtr->byteOrder = 1;
 	thisPtr->swapFlag = 0;
+	thisPtr->tileRecords = 0L;
+	thisPtr->tileCount = 0;
+	thisPtr->tileClock = 0UL;
+	thisPtr->tiles = NULL;
 	thisPtr->filePath [0] = '\0';
 	thisPtr->fileName [0] = '\0';
 }
@@ -86,6 +93,8 @@ struct csBynGridFile_* CSnewBynGridFile (Const char *path,long32_t bufferSize,ul
 {
 	extern double cs_Sec2Deg;
 	extern double cs_One;
+	extern long32_t cs_BynTileBytes;
+	extern int cs_BynTileCount;
 
 	extern char cs_DirsepC;
 	extern char cs_ExtsepC;
@@ -249,6 +258,23 @@ struct csBynGridFile_* CSnewBynGridFile (Const char *path,long32_t bufferSize,ul
 	thisPtr->byteOrder = bynFileHdr.byteOrder;
 	thisPtr->swapFlag = (short)((thisPtr->byteOrder == 0) ^ CS_isBigEndian ());
 
+	/* Set up the tile cache, unless disabled.  Tiles are whole records, so
+	   each one is a single contiguous read.  The buffer size the caller
+	   gave us becomes the minimum size of the cache. */
+	if (cs_BynTileBytes > 0L && (thisPtr->elementSize == 2 || thisPtr->elementSize == 4))
+	{
+		thisPtr->tileRecords = cs_BynTileBytes / thisPtr->recordSize;
+		if (thisPtr->tileRecords < 1L) thisPtr->tileRecords = 1L;
+		if (thisPtr->tileRecords > thisPtr->recordCount) thisPtr->tileRecords = thisPtr->recordCount;
+		thisPtr->tileCount = (int)(thisPtr->bufferSize / (thisPtr->tileRecords * thisPtr->recordSize));
+		if (thisPtr->tileCount < cs_BynTileCount) thisPtr->tileCount = cs_BynTileCount;
+
+		/* The 3x3 gather may touch three tiles, all of which must
+		   survive until the gather is complete. */
+		if (thisPtr->tileCount < 3) thisPtr->tileCount = 3;
+		thisPtr->bufferSize = thisPtr->tileRecords * thisPtr->recordSize;
+	}
+
 	return (thisPtr);
 
 error:
@@ -264,6 +290,7 @@ void CSdeleteBynGridFile (struct csBynGridFile_* thisPtr)
 	{
 		if (thisPtr->strm != NULL) CS_fclose (thisPtr->strm);
 		if (thisPtr->dataBuffer != NULL)	CS_free (thisPtr->dataBuffer);
+		CSfreeBynTiles (thisPtr);
 		CS_free (thisPtr);
 	}
 }
@@ -287,6 +314,9 @@ void CSreleaseBynGridFile (struct csBynGridFile_* thisPtr)
 		thisPtr->bufferBeginPosition = -1L;
 		thisPtr->bufferEndPosition = -2L;
 
+		/* Free the tile cache, if there is one. */
+		CSfreeBynTiles (thisPtr);
+
 		/* Close the file (if open). */
 		if (thisPtr->strm != NULL)
 		{
@@ -331,17 +361,50 @@ double CStestBynGridFile (struct csBynGridFile_* thisPtr,Const double *sourceLL)
 	coordinate is within the coverage of the object.
 */
 int CScalcBynGridFile (struct csBynGridFile_* thisPtr,double* result,Const double* sourceLL)
+{
+	int rtnVal;
+	double delta [2];
+	double nodes [1][9];
+
+	/* Extract the 3x3 matrix of grid values appropriate for this point, and
+	   then use the shared biquadratic kernel to do the interpolation. */
+	rtnVal = CSgatherBynGridFile (thisPtr,nodes [0],delta,sourceLL);
+	if (rtnVal == 0)
+	{
+		CSbiquadInterp (result,&delta [0],&delta [1],nodes,1);
+	}
+	else if (rtnVal > 0)
+	{
+		*result = 9999.0;
+	}
+	return rtnVal;
+}
+int CScalcBynGridFileN (struct csBynGridFile_* thisPtr,double results [],int status [],
+																   Const double sourceLL [][3],
+																   int count)
+{
+	/* Batch version of CScalcBynGridFile.  Points for which the grid
+	   carries a no data value are returned as 9999.0, as above. */
+	return CSbiquadBatch (thisPtr,CSgatherBynGridFile,results,status,sourceLL,count,9999.0);
+}
+/* This is the csGatherBiquadFunc for .byn files.  Returns zero if the 3x3
+   matrix was extracted successfully, +1 if any of the nine values is the
+   no data value, and -1 in the event of a system error. */
+int CSgatherBynGridFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL)
 {
 	extern double cs_One;
 
 	int idx;
 	int rtnVal;
+	struct csBynGridFile_* thisPtr;
 	int eleNbr;
 	int recNbr;
 	int readCount;
 	int checkCount;
 
 	long32_t lngTmp;
+	long32_t rowNbrs [3];
+	long32_t colNbrs [3];
 	long32_t checkSeek;
 	long32_t fpos;
 	long32_t fposBegin;
@@ -366,6 +429,7 @@ int CScalcBynGridFile (struct csBynGridFile_* thisPtr,double* result,Const doubl
 	short shrtArray [9];
 	long32_t lngArray [9];
 	double dblArray [9];
+	Const double *rowPtrs [3];
 
 	enum edgeEffects {	edgeNone = 0,
 						edgeSouthwest,
@@ -378,6 +442,7 @@ int CScalcBynGridFile (struct csBynGridFile_* thisPtr,double* result,Const doubl
 						edgeWest
 					 } edge;
 	edge = edgeNone;
+	thisPtr = (struct csBynGridFile_*)gridFile;
 
 	/* We are not supposed to get here unless the sourceLL is within the coverage of the
 	   file object.  We make sure of that now.  This makes life much easier below.  Use the
@@ -452,6 +517,88 @@ int CScalcBynGridFile (struct csBynGridFile_* thisPtr,double* result,Const doubl
 		}
 	}
 
+	/* Compute the delta into the grid cell we will contruct below.  Note, we are using adjusted
+	   recNbr and eleNbr variables here.  Center is the southwest corner of the cell in the
+	   center of the minigrid we will deal with. */
+	centerLL [LNG] = thisPtr->coverage.southWest [LNG] + thisPtr->deltaLng * (double)eleNbr;
+	centerLL [LAT] = thisPtr->coverage.northEast [LAT] - thisPtr->deltaLat * (double)recNbr;
+	deltaLL [LNG] = ((sourceLL [LNG] - centerLL [LNG]) / thisPtr->deltaLng) + cs_One;
+	deltaLL [LAT] = ((sourceLL [LAT] - centerLL [LAT]) / thisPtr->deltaLat) + cs_One;
+
+	/* If the file is tiled, pick up the three records and three elements
+	   which make up the 3x3 array, replicating the edge values exactly as
+	   the buffered code below does.  Rows are listed north to south. */
+	if (thisPtr->tileRecords > 0L)
+	{
+		rowNbrs [0] = recNbr - 1;
+		rowNbrs [1] = recNbr;
+		rowNbrs [2] = recNbr + 1;
+		colNbrs [0] = eleNbr - 1;
+		colNbrs [1] = eleNbr;
+		colNbrs [2] = eleNbr + 1;
+		switch (edge) {
+		case edgeNone:
+			break;
+		case edgeSouthwest:
+			rowNbrs [0] = rowNbrs [1] = rowNbrs [2] = thisPtr->recordCount - 1;
+			colNbrs [0] = colNbrs [1] = colNbrs [2] = 0;
+			deltaLL [LNG] = deltaLL [LAT] = cs_One;
+			break;
+		case edgeSouth:
+			rowNbrs [0] = rowNbrs [1] = rowNbrs [2] = thisPtr->recordCount - 1;
+			deltaLL [LAT] = cs_One;
+			break;
+		case edgeSoutheast:
+			rowNbrs [0] = rowNbrs [1] = rowNbrs [2] = thisPtr->recordCount - 1;
+			colNbrs [0] = colNbrs [1] = colNbrs [2] = thisPtr->elementCount - 1;
+			deltaLL [LNG] = deltaLL [LAT] = cs_One;
+			break;
+		case edgeEast:
+			colNbrs [0] = colNbrs [1] = colNbrs [2] = thisPtr->elementCount - 1;
+			deltaLL [LNG] = cs_One;
+			break;
+		case edgeNortheast:
+			rowNbrs [0] = rowNbrs [1] = rowNbrs [2] = 0;
+			colNbrs [0] = colNbrs [1] = colNbrs [2] = thisPtr->elementCount - 1;
+			deltaLL [LNG] = deltaLL [LAT] = cs_One;
+			break;
+		case edgeNorth:
+			rowNbrs [0] = rowNbrs [1] = rowNbrs [2] = 0;
+			deltaLL [LAT] = cs_One;
+			break;
+		case edgeNorthwest:
+			rowNbrs [0] = rowNbrs [1] = rowNbrs [2] = 0;
+			colNbrs [0] = colNbrs [1] = colNbrs [2] = 0;
+			deltaLL [LNG] = deltaLL [LAT] = cs_One;
+			break;
+		case edgeWest:
+			colNbrs [0] = colNbrs [1] = colNbrs [2] = 0;
+			deltaLL [LNG] = cs_One;
+			break;
+		}
+		for (idx = 0;idx < 3;idx += 1)
+		{
+			if (colNbrs [idx] >= thisPtr->elementCount) colNbrs [idx] = thisPtr->elementCount - 1;
+			rowPtrs [idx] = CSbynTileRecord (thisPtr,rowNbrs [idx]);
+			if (rowPtrs [idx] == NULL) goto error;
+		}
+		for (idx = 0;idx < 3;idx += 1)
+		{
+			dblArray [6 + idx] = rowPtrs [0][colNbrs [idx]];
+			dblArray [3 + idx] = rowPtrs [1][colNbrs [idx]];
+			dblArray [    idx] = rowPtrs [2][colNbrs [idx]];
+		}
+		rtnVal = 0;
+		for (idx = 0;idx < 9;idx += 1)
+		{
+			if (dblArray [idx] >= 9999.0) rtnVal = 1;
+			nodes [idx] = dblArray [idx];
+		}
+		delta [LNG] = deltaLL [LNG];
+		delta [LAT] = deltaLL [LAT];
+		return rtnVal;
+	}
+
 	/* Compute the minimal region of the file which we need to read. */
 	fposBegin = sizeof (struct csBynGridFileHdr_) + (recNbr - 1) * thisPtr->recordSize;
 	fposEnd = fposBegin + (thisPtr->recordSize * 3);
@@ -597,14 +744,6 @@ int CScalcBynGridFile (struct csBynGridFile_* thisPtr,double* result,Const doubl
 		}
 	}
 
-	/* Compute the delta into the grid cell we will contruct below.  Note, we are using adjusted
-	   recNbr and eleNbr variables here.  Center is the southwest corner of the cell in the
-	   center of the minigrid we will deal with. */
-	centerLL [LNG] = thisPtr->coverage.southWest [LNG] + thisPtr->deltaLng * (double)eleNbr;
-	centerLL [LAT] = thisPtr->coverage.northEast [LAT] - thisPtr->deltaLat * (double)recNbr;
-	deltaLL [LNG] = ((sourceLL [LNG] - centerLL [LNG]) / thisPtr->deltaLng) + cs_One;
-	deltaLL [LAT] = ((sourceLL [LAT] - centerLL [LAT]) / thisPtr->deltaLat) + cs_One;
-
 	/* OK, the necessary stuff should be in the buffer.  We do what is necessary to
 	   populate the array.  Notice, we populate the array in a way that the edge
 	   effects come out correct using a standard algorithm below.  Actually, I
@@ -911,20 +1050,15 @@ int CScalcBynGridFile (struct csBynGridFile_* thisPtr,double* result,Const doubl
 		goto error;
 	}
 
-	/* Do the calculations. */
+	/* Return the results to the caller. */
 	rtnVal = 0;
 	for (idx = 0;idx < 9;idx += 1)
 	{
 		if (dblArray [idx] >= 9999.0) rtnVal = 1;
+		nodes [idx] = dblArray [idx];
 	}
-	if (rtnVal == 0)
-	{
-		*result = CSbynGridFileQterp (deltaLL,dblArray);
-	}
-	else
-	{
-		*result = 9999.0;
-	}
+	delta [LNG] = deltaLL [LNG];
+	delta [LAT] = deltaLL [LAT];
 	return rtnVal;
 
 error:
@@ -935,15 +1069,184 @@ error:
 	/* Negative return indicates a system error of sorts. */
 	return -1;
 }
+/*****************************************************************************
+	Tile cache support.  The cache is a small array of tiles; the least
+	recently used tile is the one replaced when a record is needed which is
+	not in the cache.  Each tile is read with a single positioned read and
+	decoded to native double values once, rather than every time a value
+	is used.
+*/
+static void CSfreeBynTiles (struct csBynGridFile_* thisPtr)
+{
+	int idx;
+
+	if (thisPtr->tiles != NULL)
+	{
+		for (idx = 0;idx < thisPtr->tileCount;idx += 1)
+		{
+			if (thisPtr->tiles [idx].values != NULL) CS_free (thisPtr->tiles [idx].values);
+		}
+		CS_free (thisPtr->tiles);
+		thisPtr->tiles = NULL;
+	}
+	thisPtr->tileClock = 0UL;
+}
+/* Returns a pointer to the decoded values of the indicated record (zero
+   based, north to south), reading the tile containing it if necessary.
+   Returns NULL after reporting an error. */
+static Const double* CSbynTileRecord (struct csBynGridFile_* thisPtr,long32_t recNbr)
+{
+	int idx;
+	long32_t firstRecord;
+	struct csBynTile_* tilePtr;
+	struct csBynTile_* lruPtr;
+
+	if (recNbr < 0L || recNbr >= thisPtr->recordCount)
+	{
+		CS_stncp (csErrnam,"CSbynGridFile:4",MAXPATH);
+		CS_erpt (cs_ISER);
+		return NULL;
+	}
+	if (thisPtr->tiles == NULL)
+	{
+		thisPtr->tiles = (struct csBynTile_*)CS_malc ((size_t)thisPtr->tileCount * sizeof (struct csBynTile_));
+		if (thisPtr->tiles == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			return NULL;
+		}
+		for (idx = 0;idx < thisPtr->tileCount;idx += 1)
+		{
+			thisPtr->tiles [idx].firstRecord = -1L;
+			thisPtr->tiles [idx].lastUsed = 0UL;
+			thisPtr->tiles [idx].values = NULL;
+		}
+		thisPtr->tileClock = 0UL;
+	}
+
+	firstRecord = (recNbr / thisPtr->tileRecords) * thisPtr->tileRecords;
+	lruPtr = thisPtr->tiles;
+	for (idx = 0;idx < thisPtr->tileCount;idx += 1)
+	{
+		tilePtr = &thisPtr->tiles [idx];
+		if (tilePtr->firstRecord == firstRecord) break;
+		if (tilePtr->lastUsed < lruPtr->lastUsed) lruPtr = tilePtr;
+	}
+	if (idx >= thisPtr->tileCount)
+	{
+		tilePtr = lruPtr;
+		if (CSreadBynTile (thisPtr,tilePtr,firstRecord) != 0) return NULL;
+	}
+	tilePtr->lastUsed = ++thisPtr->tileClock;
+	return tilePtr->values + (recNbr - firstRecord) * thisPtr->elementCount;
+}
+/* Reads the tile which begins with the indicated record into the provided
+   tile structure.  Where the run time library provides it, and the stream
+   has a file descriptor, the read is a positioned read, which leaves the
+   file position untouched. */
+static int CSreadBynTile (struct csBynGridFile_* thisPtr,struct csBynTile_* tilePtr,long32_t firstRecord)
+{
+	long32_t idx;
+	long32_t recCount;
+	long32_t valueCount;
+	long32_t readCount;
+	long32_t filePosition;
+#if _RUN_TIME >= _rt_UNIXPCC
+	int fileDesc;
+#endif
+	short shrtTmp;
+	short *shrtPtr;
+	long32_t *lngPtr;
+
+	tilePtr->firstRecord = -1L;
+	recCount = thisPtr->recordCount - firstRecord;
+	if (recCount > thisPtr->tileRecords) recCount = thisPtr->tileRecords;
+	valueCount = recCount * thisPtr->elementCount;
+	readCount = recCount * thisPtr->recordSize;
+	filePosition = sizeof (struct csBynGridFileHdr_) + firstRecord * thisPtr->recordSize;
+
+	/* The raw data passes through dataBuffer, which is sized to a tile. */
+	if (thisPtr->dataBuffer == NULL)
+	{
+		thisPtr->dataBuffer = CS_malc ((size_t)thisPtr->bufferSize);
+		if (thisPtr->dataBuffer == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			return -1;
+		}
+	}
+	if (tilePtr->values == NULL)
+	{
+		tilePtr->values = (double *)CS_malc ((size_t)(thisPtr->tileRecords * thisPtr->elementCount) * sizeof (double));
+		if (tilePtr->values == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			return -1;
+		}
+	}
+	if (thisPtr->strm == NULL)
+	{
+		thisPtr->strm = CS_fopen (thisPtr->filePath,_STRM_BINRD);
+		if (thisPtr->strm == NULL)
+		{
+			CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
+			CS_erpt (cs_DTC_FILE);
+			return -1;
+		}
+		setvbuf (thisPtr->strm,NULL,_IONBF,0);
+	}
+
+	/* A stream which has no file descriptor, such as a member of a
+	   dictionary bundle, is positioned and read as usual. */
+#if _RUN_TIME >= _rt_UNIXPCC
+	fileDesc = _fileno (thisPtr->strm);
+	if (fileDesc >= 0)
+	{
+		if (pread (fileDesc,thisPtr->dataBuffer,(size_t)readCount,(off_t)filePosition) != (ssize_t)readCount)
+		{
+			CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
+			CS_erpt (cs_IOERR);
+			return -1;
+		}
+	}
+	else
+#endif
+	if (CS_fseek (thisPtr->strm,(long)filePosition,SEEK_SET) != 0 ||
+		CS_fread (thisPtr->dataBuffer,1,(size_t)readCount,thisPtr->strm) != (size_t)readCount)
+	{
+		CS_stncp (csErrnam,thisPtr->filePath,MAXPATH);
+		CS_erpt (cs_IOERR);
+		return -1;
+	}
+
+	/* Decode to native doubles. */
+	if (thisPtr->elementSize == 2)
+	{
+		shrtPtr = (short *)thisPtr->dataBuffer;
+		for (idx = 0;idx < valueCount;idx += 1)
+		{
+			shrtTmp = CSswapShort (shrtPtr [idx],thisPtr->swapFlag);
+			tilePtr->values [idx] = (shrtTmp == 32767) ? 9999.0 : shrtTmp * thisPtr->dataFactor;
+		}
+	}
+	else
+	{
+		lngPtr = (long32_t *)thisPtr->dataBuffer;
+		for (idx = 0;idx < valueCount;idx += 1)
+		{
+			tilePtr->values [idx] = CSswapLong (lngPtr [idx],thisPtr->swapFlag) * thisPtr->dataFactor;
+		}
+	}
+	tilePtr->firstRecord = firstRecord;
+	return 0;
+}
 double EXP_LVL9 CSbynGridFileQterp (double sourceDelta [2],double array [9])
 {
 	double result;
-	double f0, f1, f2;
+	double nodes [1][9];
 
-	f0 = CSgeoidQterp1 (sourceDelta [0],array [0],array [1],array [2]);
-	f1 = CSgeoidQterp1 (sourceDelta [0],array [3],array [4],array [5]);
-	f2 = CSgeoidQterp1 (sourceDelta [0],array [6],array [7],array [8]);
-	result = CSbynGridFileQterp1 (sourceDelta [1],f0,f1,f2);
+	memcpy (nodes [0],array,sizeof (nodes [0]));
+	CSbiquadInterp (&result,&sourceDelta [0],&sourceDelta [1],nodes,1);
 	return result;
 }
 double EXP_LVL9 CSbynGridFileQterp1 (double delta,double f0,double f1,double f2)
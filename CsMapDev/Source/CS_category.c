@@ -59,9 +59,430 @@ int GetIndexOfName(Const struct cs_Ctdef_* pCategory, Const char* name);
 int AddCsName(struct cs_Ctdef_* ctDefPtr, Const char* csName);
 int CanModifyCsName(Const char* catName, unsigned idx, struct cs_Ctdef_** ctDefPtr);
 int ExtendCsNameBlock(struct cs_Ctdef_* pCategoryIn, size_t byCount);
+struct cs_CtIndex_* GetCategoryIndex(void);
+void ReleaseCategoryIndex(void);
+int GetCategoryEntry(Const struct cs_Ctdef_* pCategory);
+void IndexCategoryAppended(struct cs_Ctdef_* pCategory);
+void IndexItemAdded(Const struct cs_Ctdef_* pCategory, ulong32_t itmIdx);
+void IndexItemRemoving(Const struct cs_Ctdef_* pCategory, ulong32_t itmIdx, int shift);
+int GetItemCategory(Const char* itmName, unsigned idx, struct cs_Ctdef_** ppCategory);
 
 /**** <--- Prototypes of internal functions ****/
 
+/*************************************************************************
+* Internal (unexported) functions maintaining the category index.
+*
+* The index (see cs_CtIndex_ in cs_map.h) is built upon first use by
+* GetCategoryIndex and released by ReleaseCategoryIndex whenever the category
+* list itself is restructured; i.e. categories added, replaced, removed or
+* renamed.  Changes to the item names of a category in the list are applied
+* to the index by IndexItemAdded and IndexItemRemoving.  Should the index
+* not be available (e.g. out of memory), the list is searched as before; so
+* failure to allocate the index is not reported as an error.
+*
+* Names are hashed by CS_strihash, and so consistent with CS_stricmp.
+**************************************************************************/
+/* Returns the index of the first occurrence of [name] in the category of
+   [pEntry], or -1 if it is not there. */
+static long32_t CSctItemFind (Const struct cs_CtIdxEntry_* pEntry, Const char* name, unsigned hash)
+{
+	long32_t itmIdx;
+	long32_t result = -1L;
+	ulong32_t mask;
+	ulong32_t slot;
+
+	if (0 == pEntry->slotCnt)
+		return -1L;
+
+	mask = pEntry->slotCnt - 1;
+	for (slot = hash & mask; (itmIdx = pEntry->itmSlots[slot]) >= 0; slot = (slot + 1) & mask)
+	{
+		//duplicates are possible; we want the first
+		if ((result < 0 || itmIdx < result) &&
+			0 == CS_stricmp(pEntry->ctDefPtr->csNames[itmIdx].csName, name))
+		{
+			result = itmIdx;
+		}
+	}
+	return result;
+}
+
+/* Adds item [itmIdx] to the table of [pEntry], which must have room. */
+static void CSctItemInsert (struct cs_CtIdxEntry_* pEntry, long32_t itmIdx)
+{
+	ulong32_t mask;
+	ulong32_t slot;
+
+	mask = pEntry->slotCnt - 1;
+	slot = CS_strihash(pEntry->ctDefPtr->csNames[itmIdx].csName, NULL) & mask;
+	while (pEntry->itmSlots[slot] >= 0)
+		slot = (slot + 1) & mask;
+
+	pEntry->itmSlots[slot] = itmIdx;
+	++pEntry->itmCnt;
+}
+
+/* (Re)builds the item table of [pEntry] from the category's name array. The
+   table is never more than half full. Returns 0, or -1 if out of memory. */
+static int CSctItemBuild (struct cs_CtIdxEntry_* pEntry)
+{
+	ulong32_t itmIdx;
+	ulong32_t slotCnt;
+	long32_t* itmSlots;
+
+	for (slotCnt = 16; slotCnt < (pEntry->ctDefPtr->nameCnt + 1) * 2; slotCnt <<= 1);
+
+	itmSlots = (long32_t*) CS_malc (slotCnt * sizeof(long32_t));
+	if (NULL == itmSlots)
+		return -1;
+
+	CS_free(pEntry->itmSlots);
+	pEntry->itmSlots = itmSlots;
+	pEntry->slotCnt = slotCnt;
+	pEntry->itmCnt = 0;
+	for (itmIdx = 0; itmIdx < slotCnt; ++itmIdx)
+		itmSlots[itmIdx] = -1L;
+
+	for (itmIdx = 0; itmIdx < pEntry->ctDefPtr->nameCnt; ++itmIdx)
+		CSctItemInsert(pEntry, (long32_t)itmIdx);
+
+	return 0;
+}
+
+/* Removes item [itmIdx] from the table of [pEntry]. Uses backward shift
+   deletion so that no probe sequence is broken by the vacated slot. */
+static void CSctItemDelete (struct cs_CtIdxEntry_* pEntry, long32_t itmIdx)
+{
+	ulong32_t mask;
+	ulong32_t slot;
+	ulong32_t next;
+	ulong32_t home;
+	Const struct cs_CtItmName_* csNames = pEntry->ctDefPtr->csNames;
+
+	mask = pEntry->slotCnt - 1;
+	for (slot = CS_strihash(csNames[itmIdx].csName, NULL) & mask; pEntry->itmSlots[slot] != itmIdx; slot = (slot + 1) & mask)
+	{
+		if (pEntry->itmSlots[slot] < 0)
+			return; //not there; can't happen
+	}
+
+	pEntry->itmSlots[slot] = -1L;
+	--pEntry->itmCnt;
+	for (next = (slot + 1) & mask; pEntry->itmSlots[next] >= 0; next = (next + 1) & mask)
+	{
+		home = CS_strihash(csNames[pEntry->itmSlots[next]].csName, NULL) & mask;
+		//the item at [next] may move into the vacated slot unless its home
+		//slot lies cyclically within (slot, next]
+		if ((slot < next) ? (home <= slot || home > next) : (home <= slot && home > next))
+		{
+			pEntry->itmSlots[slot] = pEntry->itmSlots[next];
+			pEntry->itmSlots[next] = -1L;
+			slot = next;
+		}
+	}
+}
+
+/* Adds a reverse index node for the category of entry [entryNbr], keeping
+   the chain in entry order. Returns 0, or -1 if out of memory. */
+static int CSctReverseAdd (struct cs_CtIndex_* pIndex, int entryNbr, unsigned hash)
+{
+	int nodeNbr;
+	int* linkPtr;
+	struct cs_CtRvsNode_* newNodes;
+
+	if (pIndex->rvsFree >= 0)
+	{
+		nodeNbr = pIndex->rvsFree;
+		pIndex->rvsFree = pIndex->rvsNodes[nodeNbr].next;
+	}
+	else
+	{
+		if (pIndex->rvsCnt >= pIndex->rvsAlloc)
+		{
+			newNodes = (struct cs_CtRvsNode_*) CS_ralc (pIndex->rvsNodes, (size_t)(pIndex->rvsAlloc * 2) * sizeof(struct cs_CtRvsNode_));
+			if (NULL == newNodes)
+				return -1;
+			pIndex->rvsNodes = newNodes;
+			pIndex->rvsAlloc *= 2;
+		}
+		nodeNbr = pIndex->rvsCnt++;
+	}
+
+	linkPtr = &pIndex->rvsBuckets[hash & (pIndex->rvsSize - 1)];
+	while (*linkPtr >= 0 && pIndex->rvsNodes[*linkPtr].entryNbr < entryNbr)
+		linkPtr = &pIndex->rvsNodes[*linkPtr].next;
+
+	pIndex->rvsNodes[nodeNbr].hash = hash;
+	pIndex->rvsNodes[nodeNbr].entryNbr = entryNbr;
+	pIndex->rvsNodes[nodeNbr].next = *linkPtr;
+	*linkPtr = nodeNbr;
+	return 0;
+}
+
+/* Removes a reverse index node for the category of entry [entryNbr]. As the
+   nodes carry only the hash, which of several such nodes is immaterial. */
+static void CSctReverseRemove (struct cs_CtIndex_* pIndex, int entryNbr, unsigned hash)
+{
+	int nodeNbr;
+	int* linkPtr;
+
+	for (linkPtr = &pIndex->rvsBuckets[hash & (pIndex->rvsSize - 1)]; (nodeNbr = *linkPtr) >= 0; linkPtr = &pIndex->rvsNodes[nodeNbr].next)
+	{
+		if (pIndex->rvsNodes[nodeNbr].entryNbr == entryNbr && pIndex->rvsNodes[nodeNbr].hash == hash)
+		{
+			*linkPtr = pIndex->rvsNodes[nodeNbr].next;
+			pIndex->rvsNodes[nodeNbr].next = pIndex->rvsFree;
+			pIndex->rvsFree = nodeNbr;
+			return;
+		}
+	}
+}
+
+void ReleaseCategoryIndex (void)
+{
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
+	int entryNbr;
+
+	if (NULL == cs_CtIndexP)
+		return;
+
+	if (NULL != cs_CtIndexP->entries)
+	{
+		for (entryNbr = 0; entryNbr < cs_CtIndexP->entryCnt; ++entryNbr)
+			CS_free(cs_CtIndexP->entries[entryNbr].itmSlots);
+
+		CS_free(cs_CtIndexP->entries);
+	}
+	CS_free(cs_CtIndexP->catBuckets);
+	CS_free(cs_CtIndexP->rvsBuckets);
+	CS_free(cs_CtIndexP->rvsNodes);
+	CS_free(cs_CtIndexP);
+	cs_CtIndexP = NULL;
+}
+
+/* live */ struct cs_CtIndex_* GetCategoryIndex (void)
+{
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
+	int catCount = 0;
+	int entryNbr;
+	int* headPtr;
+	ulong32_t itmIdx;
+	unsigned hash;
+	ulong32_t itmTotal = 0;
+	struct cs_Ctdef_* ctDefPtr;
+	struct cs_CtIdxEntry_* pEntry;
+	struct cs_CtIndex_* pIndex;
+
+	if (NULL != cs_CtIndexP)
+		return cs_CtIndexP;
+
+	if (NULL == CSgetCtDefTailEx(&catCount))
+		return NULL;
+
+	pIndex = (struct cs_CtIndex_*) CS_malc (sizeof(struct cs_CtIndex_));
+	if (NULL == pIndex)
+		goto error;
+
+	memset(pIndex, 0x0, sizeof(struct cs_CtIndex_));
+	cs_CtIndexP = pIndex;
+
+	pIndex->entries = (struct cs_CtIdxEntry_*) CS_malc ((size_t)catCount * sizeof(struct cs_CtIdxEntry_));
+	if (NULL == pIndex->entries)
+		goto error;
+
+	memset(pIndex->entries, 0x0, (size_t)catCount * sizeof(struct cs_CtIdxEntry_));
+	pIndex->entryCnt = catCount;
+	for (entryNbr = 0, ctDefPtr = CSgetCtDefHead(); entryNbr < catCount; ++entryNbr, ctDefPtr = ctDefPtr->next)
+	{
+		pEntry = &pIndex->entries[entryNbr];
+		pEntry->ctDefPtr = ctDefPtr;
+		if (CSctItemBuild(pEntry))
+			goto error;
+
+		itmTotal += ctDefPtr->nameCnt;
+	}
+
+	for (pIndex->catSize = 64; pIndex->catSize < (unsigned)catCount * 2; pIndex->catSize <<= 1);
+	for (pIndex->rvsSize = 1024; pIndex->rvsSize < itmTotal; pIndex->rvsSize <<= 1);
+	pIndex->rvsAlloc = (itmTotal < 256) ? 256 : (int)itmTotal;
+	pIndex->rvsFree = -1;
+
+	pIndex->catBuckets = (int*) CS_malc (pIndex->catSize * sizeof(int));
+	pIndex->rvsBuckets = (int*) CS_malc (pIndex->rvsSize * sizeof(int));
+	pIndex->rvsNodes = (struct cs_CtRvsNode_*) CS_malc ((size_t)pIndex->rvsAlloc * sizeof(struct cs_CtRvsNode_));
+	if (NULL == pIndex->catBuckets || NULL == pIndex->rvsBuckets || NULL == pIndex->rvsNodes)
+		goto error;
+
+	memset(pIndex->catBuckets, 0xFF, pIndex->catSize * sizeof(int));
+	memset(pIndex->rvsBuckets, 0xFF, pIndex->rvsSize * sizeof(int));
+
+	//work backwards, adding to the front of the chains, so that the chains
+	//are in list order; GetCategoryPtr must find the first of any duplicates
+	for (entryNbr = catCount - 1; entryNbr >= 0; --entryNbr)
+	{
+		pEntry = &pIndex->entries[entryNbr];
+		headPtr = &pIndex->catBuckets[CS_strihash(pEntry->ctDefPtr->ctName, NULL) & (pIndex->catSize - 1)];
+		pEntry->nextCat = *headPtr;
+		*headPtr = entryNbr;
+
+		//one reverse index node for each distinct item name
+		for (itmIdx = 0; itmIdx < pEntry->ctDefPtr->nameCnt; ++itmIdx)
+		{
+			hash = CS_strihash(pEntry->ctDefPtr->csNames[itmIdx].csName, NULL);
+			if (CSctItemFind(pEntry, pEntry->ctDefPtr->csNames[itmIdx].csName, hash) == (long32_t)itmIdx)
+			{
+				if (CSctReverseAdd(pIndex, entryNbr, hash))
+					goto error;
+			}
+		}
+	}
+	return pIndex;
+
+error:
+	ReleaseCategoryIndex();
+	return NULL;
+}
+
+/* Returns the index entry number of [pCategory], or -1 if the category is
+   not in the list, or there is no index. */
+int GetCategoryEntry (Const struct cs_Ctdef_* pCategory)
+{
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
+	int entryNbr = -1;
+
+	if (NULL != cs_CtIndexP && NULL != pCategory)
+	{
+		entryNbr = cs_CtIndexP->catBuckets[CS_strihash(pCategory->ctName, NULL) & (cs_CtIndexP->catSize - 1)];
+		while (entryNbr >= 0 && cs_CtIndexP->entries[entryNbr].ctDefPtr != pCategory)
+			entryNbr = cs_CtIndexP->entries[entryNbr].nextCat;
+	}
+	return entryNbr;
+}
+
+/* To be called after the item name at [itmIdx] in [pCategory] has been added
+   or replaced. Should the index not be able to follow, it is released. */
+void IndexItemAdded (Const struct cs_Ctdef_* pCategory, ulong32_t itmIdx)
+{
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
+	int entryNbr;
+	unsigned hash;
+	struct cs_CtIdxEntry_* pEntry;
+
+	entryNbr = GetCategoryEntry(pCategory);
+	if (entryNbr < 0)
+		return;
+
+	pEntry = &cs_CtIndexP->entries[entryNbr];
+	hash = CS_strihash(pCategory->csNames[itmIdx].csName, NULL);
+	if (CSctItemFind(pEntry, pCategory->csNames[itmIdx].csName, hash) < 0)
+	{
+		if (CSctReverseAdd(cs_CtIndexP, entryNbr, hash))
+			goto error;
+	}
+
+	if ((pEntry->itmCnt + 1) * 2 > pEntry->slotCnt)
+	{
+		//the rebuild picks up the new item
+		if (CSctItemBuild(pEntry))
+			goto error;
+	}
+	else
+	{
+		CSctItemInsert(pEntry, (long32_t)itmIdx);
+	}
+	return;
+
+error:
+	ReleaseCategoryIndex();
+}
+
+/* To be called before the item name at [itmIdx] in [pCategory] is removed
+   (with the names following it moving down, [shift] is TRUE) or replaced. */
+void IndexItemRemoving (Const struct cs_Ctdef_* pCategory, ulong32_t itmIdx, int shift)
+{
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
+	int entryNbr;
+	ulong32_t slot;
+	unsigned hash;
+	struct cs_CtIdxEntry_* pEntry;
+
+	entryNbr = GetCategoryEntry(pCategory);
+	if (entryNbr < 0)
+		return;
+
+	pEntry = &cs_CtIndexP->entries[entryNbr];
+	CSctItemDelete(pEntry, (long32_t)itmIdx);
+
+	hash = CS_strihash(pCategory->csNames[itmIdx].csName, NULL);
+	if (CSctItemFind(pEntry, pCategory->csNames[itmIdx].csName, hash) < 0)
+		CSctReverseRemove(cs_CtIndexP, entryNbr, hash);
+
+	if (shift)
+	{
+		for (slot = 0; slot < pEntry->slotCnt; ++slot)
+		{
+			if (pEntry->itmSlots[slot] > (long32_t)itmIdx)
+				--pEntry->itmSlots[slot];
+		}
+	}
+}
+
+/* To be called after [pCategory] has been appended to the list. Should the
+   index not be able to follow, it is released. */
+void IndexCategoryAppended (struct cs_Ctdef_* pCategory)
+{
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
+	int entryNbr;
+	int* linkPtr;
+	ulong32_t itmIdx;
+	unsigned hash;
+	struct cs_CtIdxEntry_* pEntry;
+	struct cs_CtIdxEntry_* newEntries;
+
+	if (NULL == cs_CtIndexP)
+		return;
+
+	entryNbr = cs_CtIndexP->entryCnt;
+	newEntries = (struct cs_CtIdxEntry_*) CS_ralc (cs_CtIndexP->entries, (size_t)(entryNbr + 1) * sizeof(struct cs_CtIdxEntry_));
+	if (NULL == newEntries)
+		goto error;
+
+	cs_CtIndexP->entries = newEntries;
+	pEntry = &newEntries[entryNbr];
+	memset(pEntry, 0x0, sizeof(struct cs_CtIdxEntry_));
+	pEntry->ctDefPtr = pCategory;
+	pEntry->nextCat = -1;
+	++cs_CtIndexP->entryCnt;
+	if (CSctItemBuild(pEntry))
+		goto error;
+
+	//the new category is last in the list, and so last in its chain
+	linkPtr = &cs_CtIndexP->catBuckets[CS_strihash(pCategory->ctName, NULL) & (cs_CtIndexP->catSize - 1)];
+	while (*linkPtr >= 0)
+		linkPtr = &cs_CtIndexP->entries[*linkPtr].nextCat;
+	*linkPtr = entryNbr;
+
+	for (itmIdx = 0; itmIdx < pCategory->nameCnt; ++itmIdx)
+	{
+		hash = CS_strihash(pCategory->csNames[itmIdx].csName, NULL);
+		if (CSctItemFind(pEntry, pCategory->csNames[itmIdx].csName, hash) == (long32_t)itmIdx)
+		{
+			if (CSctReverseAdd(cs_CtIndexP, entryNbr, hash))
+				goto error;
+		}
+	}
+	return;
+
+error:
+	ReleaseCategoryIndex();
+}
+
 /*************************************************************************
 * Internal (unexported) function
 * 
@@ -145,6 +566,9 @@ int ExtendCsNameBlock(struct cs_Ctdef_* pCategoryIn, size_t byCount);
 
 /* live */ int GetCategoryPtrEx(struct cs_Ctdef_* pHead, const char* catName, struct cs_Ctdef_** ppCategory)
 {
+	int entryNbr;
+	struct cs_CtIndex_* pIndex;
+
 	if (NULL == catName || '\0' == catName[0] || NULL == ppCategory)
 	{
 		CS_erpt(cs_INV_ARG2);
@@ -152,7 +576,20 @@ int ExtendCsNameBlock(struct cs_Ctdef_* pCategoryIn, size_t byCount);
 	}
 
 	if (NULL == pHead)
+	{
+		pIndex = GetCategoryIndex();
+		if (NULL != pIndex)
+		{
+			entryNbr = pIndex->catBuckets[CS_strihash(catName, NULL) & (pIndex->catSize - 1)];
+			while (entryNbr >= 0 && CS_stricmp (pIndex->entries[entryNbr].ctDefPtr->ctName,catName) != 0)
+				entryNbr = pIndex->entries[entryNbr].nextCat;
+
+			*ppCategory = (entryNbr >= 0) ? pIndex->entries[entryNbr].ctDefPtr : NULL;
+			return 0;
+		}
+
 		pHead = CSgetCtDefHead();
+	}
 
 	if (NULL == pHead)
 		return -1;
@@ -179,6 +616,7 @@ int ExtendCsNameBlock(struct cs_Ctdef_* pCategoryIn, size_t byCount);
 
 	unsigned currentIndex = 0;
 	struct cs_Ctdef_* pHead = NULL;
+	struct cs_CtIndex_* pIndex;
 
 	cs_Error = 0;
 
@@ -186,6 +624,15 @@ int ExtendCsNameBlock(struct cs_Ctdef_* pCategoryIn, size_t byCount);
 
 	*ppCategory = NULL;
 
+	pIndex = GetCategoryIndex();
+	if (NULL != pIndex)
+	{
+		if (index < (unsigned)pIndex->entryCnt)
+			*ppCategory = pIndex->entries[index].ctDefPtr;
+
+		return 0;
+	}
+
 	pHead = CSgetCtDefHead();
 	if (NULL == pHead)
 		return -1;
@@ -220,6 +667,8 @@ int LinkInCategory(struct cs_Ctdef_* pNewCategory, struct cs_Ctdef_* pToBeReplac
 		return -1;
 	}
 
+	ReleaseCategoryIndex();
+
 	//link in our category...
 	pNewCategory->next = pToBeReplaced->next;
 	pNewCategory->previous = pToBeReplaced->previous;
@@ -264,6 +713,8 @@ int UnlinkCategory(struct cs_Ctdef_* pToBeRemoved, int releaseCategory)
 		return -1;
 	}
 
+	ReleaseCategoryIndex();
+
 	if (NULL != pToBeRemoved->next)
 		pToBeRemoved->next->previous = pToBeRemoved->previous;
 
@@ -319,6 +770,7 @@ int AppendCategory(struct cs_Ctdef_* pToAppend)
 		pToAppend->previous = pTailCategory;
 	}
 
+	IndexCategoryAppended(pToAppend);
 	return 0;
 }
 
@@ -330,7 +782,10 @@ int AppendCategory(struct cs_Ctdef_* pToAppend)
 *******************************************************************************/
 int GetIndexOfName(Const struct cs_Ctdef_* pCategory, Const char* name)
 {
+	extern struct cs_CtIndex_* cs_CtIndexP;
+
 	unsigned nameIdx;
+	int entryNbr;
 	size_t csNameSize = sizeof(((struct cs_CtItmName_*)0)->csName) / sizeof(char);
 
 	if (NULL == pCategory)
@@ -345,6 +800,11 @@ int GetIndexOfName(Const struct cs_Ctdef_* pCategory, Const char* name)
 		return -1;
 	}
 
+	//categories in the list are indexed
+	entryNbr = GetCategoryEntry(pCategory);
+	if (entryNbr >= 0)
+		return (int)CSctItemFind(&cs_CtIndexP->entries[entryNbr], name, CS_strihash(name, NULL));
+
 	for(nameIdx = 0; nameIdx < pCategory->nameCnt; ++nameIdx)
 	{
 		if (0 == CS_strnicmp((pCategory->csNames + nameIdx)->csName, name, csNameSize))
@@ -354,6 +814,74 @@ int GetIndexOfName(Const struct cs_Ctdef_* pCategory, Const char* name)
 	return -1;
 }
 
+/******************************************************************************
+* Internal (unexported) function
+*
+* Returns the number of categories in the list which contain the CS name [itmName],
+* -1 in case of an error. [*ppCategory] is set to the [idx]'th of those, in list order,
+* or NULL if there are not that many.
+*******************************************************************************/
+int GetItemCategory(Const char* itmName, unsigned idx, struct cs_Ctdef_** ppCategory)
+{
+	int catCount = 0;
+	int nodeNbr;
+	int lastEntry = -1;
+	unsigned hash;
+	char itmNameTmp [cs_KEYNM_DEF];
+	struct cs_Ctdef_* ctDefPtr;
+	struct cs_CtRvsNode_* pNode;
+	struct cs_CtIndex_* pIndex;
+
+	CS_CHECK_NULL_ARG(ppCategory, 3);
+	*ppCategory = NULL;
+
+	if (NULL == itmName || '\0' == *itmName)
+	{
+		CS_erpt(cs_INV_ARG1);
+		return -1;
+	}
+
+	CS_stncp (itmNameTmp, itmName, sizeof(itmNameTmp));
+	if (CS_nampp(itmNameTmp))
+	{
+		CS_erpt(cs_INV_ARG1);
+		return -1;
+	}
+
+	pIndex = GetCategoryIndex();
+	if (NULL != pIndex)
+	{
+		//the reverse index nodes only carry the hash; confirm each candidate
+		hash = CS_strihash(itmNameTmp, NULL);
+		for (nodeNbr = pIndex->rvsBuckets[hash & (pIndex->rvsSize - 1)]; nodeNbr >= 0; nodeNbr = pNode->next)
+		{
+			pNode = &pIndex->rvsNodes[nodeNbr];
+			if (pNode->hash != hash || pNode->entryNbr == lastEntry ||
+				CSctItemFind(&pIndex->entries[pNode->entryNbr], itmNameTmp, hash) < 0)
+			{
+				continue;
+			}
+
+			//the chain is in entry order, so the nodes of a category are adjacent
+			lastEntry = pNode->entryNbr;
+
+			if ((unsigned)catCount++ == idx)
+				*ppCategory = pIndex->entries[pNode->entryNbr].ctDefPtr;
+		}
+		return catCount;
+	}
+
+	for (ctDefPtr = CSgetCtDefHead(); NULL != ctDefPtr; ctDefPtr = ctDefPtr->next)
+	{
+		if (GetIndexOfName(ctDefPtr, itmNameTmp) < 0)
+			continue;
+
+		if ((unsigned)catCount++ == idx)
+			*ppCategory = ctDefPtr;
+	}
+	return catCount;
+}
+
 /******************************************************************************
 * Internal (unexported) function
 *
@@ -391,6 +919,7 @@ int AddCsName(struct cs_Ctdef_* ctDefPtr, Const char* csName)
 	destPtr = (ctDefPtr->csNames[ctDefPtr->nameCnt]).csName;
 	CS_stncp (destPtr, csNameTemp, sizeof(((struct cs_CtItmName_ *)0)->csName) / sizeof(char));
 	++ctDefPtr->nameCnt;
+	IndexItemAdded(ctDefPtr, ctDefPtr->nameCnt - 1);
 
 	return 0;
 }
@@ -569,6 +1098,16 @@ Const char* EXP_LVL3 CS_getCatName (unsigned idx)
 	unsigned myIdx = 0;
 	Const char* rtnValue = 0;
 	struct cs_Ctdef_* ctDefPtr;
+	struct cs_CtIndex_* pIndex;
+
+	pIndex = GetCategoryIndex();
+	if (NULL != pIndex)
+	{
+		if (idx < (unsigned)pIndex->entryCnt)
+			rtnValue = pIndex->entries[idx].ctDefPtr->ctName;
+
+		return rtnValue;
+	}
 
 	ctDefPtr = CSgetCtDefHead();
 	while (ctDefPtr != NULL)
@@ -638,6 +1177,68 @@ Const char* EXP_LVL3 CS_getItmName (const char* catName,unsigned idx)
 	return (ctDefPtr->csNames + idx)->csName;
 }
 
+/******************************************************************************
+ * Returns the index of the item name [itmName] within the category indicated
+ * by the catName argument; the first such index should the name appear more
+ * than once.  Returns -1 if the category does not contain the item name, or
+ * in case of an error (e.g. no category with such a name exists).
+ *****************************************************************************/
+int EXP_LVL1 CS_getItmIdx (const char* catName,const char* itmName)
+{
+	char itmNameTmp [cs_KEYNM_DEF];
+	struct cs_Ctdef_* ctDefPtr;
+
+	if (GetCategoryPtr(catName, &ctDefPtr))
+		return -1;
+
+	if (NULL == ctDefPtr)
+	{
+		CS_erpt(cs_CT_NOT_FND);
+		return -1;
+	}
+
+	if (NULL == itmName)
+	{
+		CS_erpt(cs_INV_ARG2);
+		return -1;
+	}
+
+	CS_stncp (itmNameTmp, itmName, sizeof(itmNameTmp));
+	return GetIndexOfName(ctDefPtr, itmNameTmp);
+}
+
+/******************************************************************************
+ * Returns the number of categories which contain the item name indicated by
+ * the itmName argument (including 0).
+ * Returns -1 in case of an error.
+ *****************************************************************************/
+int EXP_LVL1 CS_getItmCatCount (const char* itmName)
+{
+	struct cs_Ctdef_* ctDefPtr;
+
+	return GetItemCategory(itmName, 0, &ctDefPtr);
+}
+
+/******************************************************************************
+ * Returns the name of the idx'th category, in category list order, which
+ * contains the item name indicated by the itmName argument.  Returns null if
+ * no category data available, or if the idx argument is too large.  idx of
+ * zero means the first such category.
+ *
+ * Use this function to enumerate all categories a coordinate system is
+ * referenced in by incrementing the idx value by one after each call, until
+ * such time as a null pointer is returned.
+ *****************************************************************************/
+Const char* EXP_LVL3 CS_getItmCatName (const char* itmName,unsigned idx)
+{
+	struct cs_Ctdef_* ctDefPtr;
+
+	if (GetItemCategory(itmName, idx, &ctDefPtr) < 0 || NULL == ctDefPtr)
+		return NULL;
+
+	return ctDefPtr->ctName;
+}
+
 /******************************************************************************
  * Sets the file name to read the categories from.
  * This will automatically unset the in-memory category list.
@@ -924,7 +1525,9 @@ int EXP_LVL3 CSrplItmName (Const char* catName, unsigned idx, Const char* newNam
 	//[1 == CanModifyCrsName()] tells us, that we can modify the entry at the given index
 
 	//now replace the CRS name
+	IndexItemRemoving(ctDefPtr, idx, FALSE);
 	CS_stncp ((ctDefPtr->csNames + idx)->csName, newCrsName, sizeof(((struct cs_CtItmName_ *)0)->csName) / sizeof(char));
+	IndexItemAdded(ctDefPtr, idx);
 	return 0;
 }
 
@@ -989,6 +1592,7 @@ int EXP_LVL3 CSrmvItmNameEx (struct cs_Ctdef_ *pCategoryIn, Const char* name)
 		return -1;
 	}
 
+	IndexItemRemoving(pCategoryIn, (ulong32_t)csNameIndex, TRUE);
 	if (pCategoryIn->nameCnt != (ulong32_t)(csNameIndex - 1))
 	{
 		//it's not the last item we've to remove; that is, we don't just have to
@@ -1056,6 +1660,10 @@ int EXP_LVL3 CSrmvItmNamesEx (struct cs_Ctdef_ *pCategoryIn)
 		return -1;
 	}
 
+	//the index does not follow wholesale changes
+	if (GetCategoryEntry(pCategoryIn) >= 0)
+		ReleaseCategoryIndex();
+
 	CS_free(pCategoryIn->csNames);
 	pCategoryIn->csNames = NULL;
 	pCategoryIn->allocCnt = pCategoryIn->nameCnt = pCategoryIn->userNameIndex = 0;
@@ -1622,6 +2230,7 @@ int EXP_LVL3 CSrplCatNameEx (Const char* oldCtName, Const char* newCtName)
 		goto error;
 	}
 
+	ReleaseCategoryIndex();
 	CS_stncp (liveCatPtr->ctName, newCtName, cs_CATDEF_CATNMSZ);
 	return 0;
 
@@ -2065,6 +2674,7 @@ void EXP_LVL3 CSrlsCategories(void)
 {
 	extern struct cs_Ctdef_* cs_CtDefHead;
 
+	ReleaseCategoryIndex();
 	CSrlsCategoryList(cs_CtDefHead);
 	cs_CtDefHead = NULL;
 }
@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2008, Autodesk, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Autodesk, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Autodesk, Inc. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL Autodesk, Inc. OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+	Compiler output tables.
+
+	The Coordsys, Datums, and Geodetic Transformation compilers collect the
+	validated definitions in a csCmpTbl_ rather than writing each one to
+	the output file as it is produced.  Once the source has been consumed,
+	the table is sorted in memory, checked for duplicate key names, and
+	written out sequentially.  This replaces the in place sort of the output
+	file (CS_ips), which was the bulk of the compilation time.
+
+	When the cs_CMPLR_INCR option is specified, the table also supports
+	incremental compilation.  A hash of each definition, as parsed and
+	before validation, is written to a file next to the output with the
+	extension replaced by ".CSH".  On the next incremental compilation, a
+	definition whose key name and hash are unchanged is taken, as compiled,
+	from the previous output rather than being validated again.  The hash
+	file also records a hash of the entire previous output and of the
+	dictionaries the compiler validates against; if any of these differ,
+	or the option flags differ, nothing is reused.  Note that the warnings
+	which validation produces are not repeated for reused definitions.
+*/
+
+#include "cs_map.h"
+#include <stddef.h>
+
+union csCmpTblRec_
+{
+	struct cs_Csdef_ cs;
+	struct cs_Dtdef_ dt;
+	struct cs_GeodeticTransform_ gx;
+};
+
+/* Flags which do not affect the content of the output. */
+#define csCMPTBL_IGNFLGS (cs_CMPLR_WARN | cs_CMPLR_MAPPABLE | cs_CMPLR_INCR)
+
+static void CScmpTblHashPath (char *hashPath,Const char *outPath)
+{
+	extern char cs_DirsepC;
+
+	char *cp;
+	char *extPtr;
+
+	CS_stncp (hashPath,outPath,MAXPATH - 4);
+	extPtr = NULL;
+	for (cp = hashPath;*cp != '\0';cp += 1)
+	{
+		if (*cp == '.') extPtr = cp;
+		else if (*cp == cs_DirsepC) extPtr = NULL;
+	}
+	if (extPtr == NULL) extPtr = cp;
+	CS_stcpy (extPtr,".CSH");
+}
+
+static ulong32_t CScmpTblHash (ulong32_t hash,Const void *ptr,size_t size)
+{
+	Const unsigned char *cp;
+
+	cp = (Const unsigned char *)ptr;
+	while (size-- > 0)
+	{
+		hash = ((hash ^ *cp++) * 16777619UL) & 0xFFFFFFFFUL;
+	}
+	return hash;
+}
+
+/* Hashes the entire content of a file; a missing file hashes to zero. */
+static ulong32_t CScmpTblFileHash (Const char *filePath)
+{
+	size_t rdCnt;
+	ulong32_t hash;
+	csFILE *strm;
+	char bufr [4096];
+
+	if (filePath == NULL || *filePath == '\0') return 0UL;
+	strm = CS_fopen (filePath,_STRM_BINRD);
+	if (strm == NULL) return 0UL;
+	hash = 2166136261UL;
+	while ((rdCnt = CS_fread (bufr,1,sizeof (bufr),strm)) > 0)
+	{
+		hash = CScmpTblHash (hash,bufr,rdCnt);
+	}
+	CS_fclose (strm);
+	return hash;
+}
+
+static int CScmpTblHashCmp (Const void *pp,Const void *qq)
+{
+	return CS_stricmp (((Const struct csCmpHash_ *)pp)->keyName,
+					   ((Const struct csCmpHash_ *)qq)->keyName);
+}
+
+static int CScmpTblRecCmp (Const struct csCmpTbl_ *tbl,Const void *pp,Const void *qq)
+{
+	switch (tbl->magic) {
+	case cs_CSDEF_MAGIC: return CS_cscmp ((Const struct cs_Csdef_ *)pp,(Const struct cs_Csdef_ *)qq);
+	case cs_DTDEF_MAGIC: return CS_dtcmp ((Const struct cs_Dtdef_ *)pp,(Const struct cs_Dtdef_ *)qq);
+	case cs_GXDEF_MAGIC:
+	default:             return CS_gxcmp ((Const struct cs_GeodeticTransform_ *)pp,(Const struct cs_GeodeticTransform_ *)qq);
+	}
+}
+
+/* Appends a record to a growable array of records. */
+static int CScmpTblAppend (char **array,long32_t *count,long32_t *alloc,Const void *record,size_t recSize)
+{
+	long32_t newAlloc;
+	char *newArray;
+
+	if (*count >= *alloc)
+	{
+		newAlloc = (*alloc < 64L) ? 64L : (*alloc * 2L);
+		newArray = (char *)CS_ralc (*array,(size_t)newAlloc * recSize);
+		if (newArray == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			return -1;
+		}
+		*array = newArray;
+		*alloc = newAlloc;
+	}
+	memcpy (*array + (size_t)*count * recSize,record,recSize);
+	*count += 1;
+	return 0;
+}
+
+/* Loads the hash file and the previous output, as they were left by the
+   previous incremental compilation.  Returns zero if there is nothing
+   usable, which is not an error. */
+static int CScmpTblLoadPrev (struct csCmpTbl_ *tbl,Const char *outPath)
+{
+	int st;
+	int crypt;
+	size_t rdSize;
+	csFILE *strm;
+	cs_magic_t magic;
+	struct csCmpHashHdr_ header;
+	char hashPath [MAXPATH];
+
+	__ALIGNMENT__1				/* For some versions of Sun compiler. */
+	union csCmpTblRec_ record;
+
+	CScmpTblHashPath (hashPath,outPath);
+	strm = CS_fopen (hashPath,_STRM_BINRD);
+	if (strm == NULL) return 0;
+	if (CS_fread (&header,1,sizeof (header),strm) != sizeof (header) ||
+		header.magic != cs_CMPHASH_MAGIC ||
+		header.byteOrder != cs_DICTMAP_ORDER ||
+		header.dictMagic != (ulong32_t)tbl->magic ||
+		header.recordSize != (ulong32_t)tbl->recSize ||
+		header.flags != tbl->flags ||
+		header.depHash [0] != tbl->depHash [0] ||
+		header.depHash [1] != tbl->depHash [1] ||
+		header.outHash != CScmpTblFileHash (outPath))
+	{
+		CS_fclose (strm);
+		return 0;
+	}
+	if (header.hashCount > 0UL)
+	{
+		rdSize = (size_t)header.hashCount * sizeof (struct csCmpHash_);
+		tbl->prevHashes = (struct csCmpHash_ *)CS_malc (rdSize);
+		if (tbl->prevHashes == NULL ||
+			CS_fread (tbl->prevHashes,1,rdSize,strm) != rdSize)
+		{
+			CS_fclose (strm);
+			return 0;
+		}
+		tbl->prevHashCount = (long32_t)header.hashCount;
+		qsort (tbl->prevHashes,(size_t)tbl->prevHashCount,sizeof (struct csCmpHash_),CScmpTblHashCmp);
+	}
+	CS_fclose (strm);
+
+	/* The previous output is sorted, as we left it; its hash has been
+	   checked above.  The read functions decrypt and swap as necessary. */
+	strm = CS_fopen (outPath,_STRM_BINRD);
+	if (strm == NULL) return 0;
+	if (CS_fread (&magic,1,sizeof (magic),strm) != sizeof (magic))
+	{
+		CS_fclose (strm);
+		return 0;
+	}
+	CS_bswap (&magic,"l");
+	if (magic != tbl->magic)
+	{
+		CS_fclose (strm);
+		return 0;
+	}
+	for (;;)
+	{
+		memset (&record,'\0',sizeof (record));
+		switch (tbl->magic) {
+		case cs_CSDEF_MAGIC: st = CS_csrd (strm,&record.cs,&crypt); break;
+		case cs_DTDEF_MAGIC: st = CS_dtrd (strm,&record.dt,&crypt); break;
+		case cs_GXDEF_MAGIC:
+		default:             st = CS_gxrd (strm,&record.gx); break;
+		}
+		if (st <= 0) break;
+		if (CScmpTblAppend (&tbl->prevRecords,&tbl->prevCount,&tbl->prevAlloc,&record,tbl->recSize) != 0)
+		{
+			st = -1;
+			break;
+		}
+	}
+	CS_fclose (strm);
+	if (st < 0)
+	{
+		tbl->prevCount = 0L;
+		return 0;
+	}
+	return (int)tbl->prevCount;
+}
+
+/**********************************************************************
+**	CScmpTblInit (tbl,magic,flags,outPath,depPath1,depPath2);
+**
+**	struct csCmpTbl_ *tbl;		the table to be initialized.
+**	cs_magic_t magic;			magic number of the dictionary being
+**								compiled: cs_CSDEF_MAGIC, cs_DTDEF_MAGIC,
+**								or cs_GXDEF_MAGIC.
+**	int flags;					the compiler option flags.
+**	char *outPath;				full path to the output file.
+**	char *depPath1;				full paths to the dictionaries which the
+**	char *depPath2;				compiler validates against; either may be
+**								NULL.
+**
+**	Must be called before the output file is created, as with the
+**	cs_CMPLR_INCR option the previous output is loaded here.  The
+**	table must eventually be released with CScmpTblFree.
+**********************************************************************/
+void EXP_LVL9 CScmpTblInit (struct csCmpTbl_ *tbl,cs_magic_t magic,int flags,Const char *outPath,
+														  Const char *depPath1,
+														  Const char *depPath2)
+{
+	memset (tbl,'\0',sizeof (*tbl));
+	tbl->magic = magic;
+	switch (magic) {
+	case cs_CSDEF_MAGIC:
+		tbl->recSize = sizeof (struct cs_Csdef_);
+		tbl->keyOffset = offsetof (struct cs_Csdef_,key_nm);
+		break;
+	case cs_DTDEF_MAGIC:
+		tbl->recSize = sizeof (struct cs_Dtdef_);
+		tbl->keyOffset = offsetof (struct cs_Dtdef_,key_nm);
+		break;
+	case cs_GXDEF_MAGIC:
+	default:
+		tbl->magic = cs_GXDEF_MAGIC;
+		tbl->recSize = sizeof (struct cs_GeodeticTransform_);
+		tbl->keyOffset = offsetof (struct cs_GeodeticTransform_,xfrmName);
+		break;
+	}
+	tbl->flags = (ulong32_t)(flags & ~csCMPTBL_IGNFLGS);
+	tbl->incremental = ((flags & cs_CMPLR_INCR) != 0);
+	if (tbl->incremental)
+	{
+		tbl->depHash [0] = CScmpTblFileHash (depPath1);
+		tbl->depHash [1] = CScmpTblFileHash (depPath2);
+		CScmpTblLoadPrev (tbl,outPath);			/*lint !e534 */
+	}
+}
+
+/**********************************************************************
+**	st = CScmpTblReuse (tbl,record);
+**
+**	struct csCmpTbl_ *tbl;		the output table.
+**	void *record;				definition as parsed, before validation.
+**	int st;						returns one if the compiled definition
+**								was taken from the previous output,
+**								else zero.
+**
+**	In incremental mode, records the hash of the definition for the next
+**	compilation, and if the same definition was compiled previously,
+**	appends the result of that compilation to the table.  A return of
+**	zero says the definition needs to be validated and added with
+**	CScmpTblAdd.
+**********************************************************************/
+int EXP_LVL9 CScmpTblReuse (struct csCmpTbl_ *tbl,Const void *record)
+{
+	int cmp;
+	long32_t lo;
+	long32_t hi;
+	long32_t mid;
+	char *recPtr;
+	struct csCmpHash_ *prevPtr;
+	struct csCmpHash_ hashRec;
+
+	__ALIGNMENT__1				/* For some versions of Sun compiler. */
+	union csCmpTblRec_ probe;
+
+	if (!tbl->incremental) return 0;
+
+	memset (&hashRec,'\0',sizeof (hashRec));
+	CS_stncp (hashRec.keyName,(Const char *)record + tbl->keyOffset,sizeof (hashRec.keyName));
+	hashRec.hash = CScmpTblHash (2166136261UL,record,tbl->recSize);
+	if (CScmpTblAppend ((char **)&tbl->hashes,&tbl->hashCount,&tbl->hashAlloc,&hashRec,sizeof (hashRec)) != 0)
+	{
+		/* Without a complete set of hashes, the next compilation is
+		   a full one. */
+		tbl->incremental = FALSE;
+		return 0;
+	}
+	if (tbl->prevCount <= 0L) return 0;
+
+	prevPtr = (struct csCmpHash_ *)CS_bsearch (&hashRec,tbl->prevHashes,(size_t)tbl->prevHashCount,
+																		sizeof (struct csCmpHash_),
+																		CScmpTblHashCmp);
+	if (prevPtr == NULL || prevPtr->hash != hashRec.hash) return 0;
+
+	/* The previous output is sorted by key name; a linear search would
+	   make an incremental compilation slower than a full one. */
+	memset (&probe,'\0',sizeof (probe));
+	CS_stncp ((char *)&probe + tbl->keyOffset,hashRec.keyName,sizeof (hashRec.keyName));
+	recPtr = NULL;
+	lo = 0L;
+	hi = tbl->prevCount - 1L;
+	while (lo <= hi)
+	{
+		mid = (lo + hi) / 2L;
+		cmp = CScmpTblRecCmp (tbl,&probe,tbl->prevRecords + (size_t)mid * tbl->recSize);
+		if (cmp == 0)
+		{
+			recPtr = tbl->prevRecords + (size_t)mid * tbl->recSize;
+			break;
+		}
+		if (cmp < 0) hi = mid - 1L;
+		else         lo = mid + 1L;
+	}
+	if (recPtr == NULL) return 0;
+	if (CScmpTblAppend (&tbl->records,&tbl->recCount,&tbl->recAlloc,recPtr,tbl->recSize) != 0)
+	{
+		return 0;
+	}
+	return 1;
+}
+
+/**********************************************************************
+**	st = CScmpTblAdd (tbl,record);
+**
+**	struct csCmpTbl_ *tbl;		the output table.
+**	void *record;				a validated definition.
+**	int st;						returns zero on success, -1 if memory
+**								could not be allocated, in which case
+**								the error has been reported.
+**********************************************************************/
+int EXP_LVL9 CScmpTblAdd (struct csCmpTbl_ *tbl,Const void *record)
+{
+	return CScmpTblAppend (&tbl->records,&tbl->recCount,&tbl->recAlloc,record,tbl->recSize);
+}
+
+/**********************************************************************
+**	err_cnt = CScmpTblWrite (tbl,outStrm,crypt,dupFmt,err_func);
+**
+**	struct csCmpTbl_ *tbl;		the output table.
+**	csFILE *outStrm;			the output file, positioned after the
+**								magic number.
+**	int crypt;					non-zero requests encrypted output,
+**								ignored for Geodetic Transformations.
+**	char *dupFmt;				sprintf format, with a single %s for the
+**								key name, of the duplicate name error.
+**	int (*err_func)(char *mesg);the compiler's error function.
+**	int err_cnt;				returns the number of errors reported.
+**
+**	Sorts the table, reports duplicate key names, and writes the
+**	definitions to the output file.  Nothing is written if duplicates
+**	are found.
+**********************************************************************/
+int EXP_LVL9 CScmpTblWrite (struct csCmpTbl_ *tbl,csFILE *outStrm,int crypt,Const char *dupFmt,int (*err_func)(char *mesg))
+{
+	int st;
+	int cancel;
+	int err_cnt;
+	long32_t idx;
+	char *recPtr;
+	char *lastPtr;
+	char err_msg [256];
+
+	err_cnt = 0;
+	cancel = FALSE;
+	if (tbl->recCount <= 0L) return 0;
+
+	switch (tbl->magic) {
+	case cs_CSDEF_MAGIC: qsort (tbl->records,(size_t)tbl->recCount,tbl->recSize,(CMPFUNC_CAST)CS_cscmp); break;
+	case cs_DTDEF_MAGIC: qsort (tbl->records,(size_t)tbl->recCount,tbl->recSize,(CMPFUNC_CAST)CS_dtcmp); break;
+	case cs_GXDEF_MAGIC:
+	default:             qsort (tbl->records,(size_t)tbl->recCount,tbl->recSize,(CMPFUNC_CAST)CS_gxcmp); break;
+	}
+
+	/* Verify that there are no duplicates. */
+	lastPtr = tbl->records;
+	for (idx = 1L;!cancel && idx < tbl->recCount;idx += 1L)
+	{
+		recPtr = tbl->records + (size_t)idx * tbl->recSize;
+		if (CScmpTblRecCmp (tbl,lastPtr,recPtr) == 0)
+		{
+			sprintf (err_msg,dupFmt,lastPtr + tbl->keyOffset);
+			cancel = (*err_func)(err_msg);
+			err_cnt += 1;
+		}
+		lastPtr = recPtr;
+	}
+	if (err_cnt != 0) return err_cnt;
+
+	for (idx = 0L;idx < tbl->recCount;idx += 1L)
+	{
+		recPtr = tbl->records + (size_t)idx * tbl->recSize;
+		switch (tbl->magic) {
+		case cs_CSDEF_MAGIC: st = CS_cswr (outStrm,(Const struct cs_Csdef_ *)recPtr,crypt); break;
+		case cs_DTDEF_MAGIC: st = CS_dtwr (outStrm,(Const struct cs_Dtdef_ *)recPtr,crypt); break;
+		case cs_GXDEF_MAGIC:
+		default:             st = CS_gxwr (outStrm,(Const struct cs_GeodeticTransform_ *)recPtr); break;
+		}
+		if (st != 0)
+		{
+			CS_errmsg (err_msg,sizeof (err_msg));
+			(void)(*err_func)(err_msg);
+			err_cnt += 1;
+			break;
+		}
+	}
+	return err_cnt;
+}
+
+/**********************************************************************
+**	CScmpTblFinish (tbl,outPath,ok);
+**
+**	struct csCmpTbl_ *tbl;		the output table.
+**	char *outPath;				full path to the output file, which must
+**								have been closed.
+**	int ok;						non-zero if the compilation succeeded.
+**
+**	In incremental mode, writes the hash file for the next compilation;
+**	otherwise, and if the compilation failed, removes any hash file of a
+**	previous compilation.  A hash file which cannot be written is simply
+**	removed, the next compilation will be a full one.  The table is
+**	released in any case.
+**********************************************************************/
+void EXP_LVL9 CScmpTblFinish (struct csCmpTbl_ *tbl,Const char *outPath,int ok)
+{
+	size_t wrSize;
+	csFILE *strm;
+	struct csCmpHashHdr_ header;
+	char hashPath [MAXPATH];
+
+	CScmpTblHashPath (hashPath,outPath);
+	if (ok && tbl->incremental)
+	{
+		memset (&header,'\0',sizeof (header));
+		header.magic = cs_CMPHASH_MAGIC;
+		header.byteOrder = cs_DICTMAP_ORDER;
+		header.dictMagic = (ulong32_t)tbl->magic;
+		header.recordSize = (ulong32_t)tbl->recSize;
+		header.flags = tbl->flags;
+		header.hashCount = (ulong32_t)tbl->hashCount;
+		header.depHash [0] = tbl->depHash [0];
+		header.depHash [1] = tbl->depHash [1];
+		header.outHash = CScmpTblFileHash (outPath);
+		wrSize = (size_t)tbl->hashCount * sizeof (struct csCmpHash_);
+		strm = CS_fopen (hashPath,_STRM_BINWR);
+		if (strm != NULL)
+		{
+			ok = (CS_fwrite (&header,1,sizeof (header),strm) == sizeof (header));
+			if (ok && wrSize > 0)
+			{
+				ok = (CS_fwrite (tbl->hashes,1,wrSize,strm) == wrSize);
+			}
+			if (CS_fclose (strm) != 0) ok = FALSE;
+			if (!ok) CS_remove (hashPath);				/*lint !e534 */
+		}
+	}
+	else if (CS_fileModTime (hashPath) != 0)
+	{
+		CS_remove (hashPath);							/*lint !e534 */
+	}
+	CScmpTblFree (tbl);
+}
+
+/**********************************************************************
+**	CScmpTblFree (tbl);
+**
+**	Releases the memory held by a compiler output table.  May be called
+**	more than once.
+**********************************************************************/
+void EXP_LVL9 CScmpTblFree (struct csCmpTbl_ *tbl)
+{
+	if (tbl->records != NULL) CS_free (tbl->records);
+	if (tbl->hashes != NULL) CS_free (tbl->hashes);
+	if (tbl->prevRecords != NULL) CS_free (tbl->prevRecords);
+	if (tbl->prevHashes != NULL) CS_free (tbl->prevHashes);
+	tbl->records = NULL;
+	tbl->recCount = tbl->recAlloc = 0L;
+	tbl->hashes = NULL;
+	tbl->hashCount = tbl->hashAlloc = 0L;
+	tbl->prevRecords = NULL;
+	tbl->prevCount = tbl->prevAlloc = 0L;
+	tbl->prevHashes = NULL;
+	tbl->prevHashCount = 0L;
+}
@@ -162,7 +162,6 @@ int EXP_LVL3 CS_csdel (struct cs_Csdef_ *csdef)
 int EXP_LVL5 CS_csupd (struct cs_Csdef_ *csdef,int crypt)
 {
 	extern char *cs_CsKeyNames;
-	extern struct cs_Prjtab_ cs_Prjtab [];	/* Projection Table */
 	struct cs_Prjtab_ *pp;
 	extern char csErrnam [];
 	extern double cs_Two_pi;				/* 6.28..... */
@@ -186,13 +185,7 @@ int EXP_LVL5 CS_csupd (struct cs_Csdef_ *csdef,int crypt)
 	   things up in release 8, we'll need to do some stuff with the
 	   unit ourselves, and we need a pointer to the projection table
 	   entry in order to do that. */
-	for (pp = cs_Prjtab;pp->setup != NULL;pp += 1)
-	{
-		if (!CS_stricmp (csdef->prj_knm,pp->key_nm))
-		{
-			break;
-		}
-	}
+	pp = CS_prjtabPtr (csdef->prj_knm);
 	if (pp->setup == NULL)
 	{
 		/* This should never happen any more. */
@@ -404,6 +397,23 @@ int EXP_LVL3 CS_csdefAll (struct cs_Csdef_ **pDefArray[])
 	return CS_csDefinitionAll(pDefArray);
 }
 
+/**********************************************************************
+**	count = CS_csdefAllEx (pDefArray);
+**
+**	cs_Csdef_ **pDefArray;		receives a pointer to a malloc'ed array of
+**								cs_Csdef_ instances.
+**
+**	Same as CS_csdefAll, except that the definitions are returned in a
+**	single allocation: [pDefArray] will be set to an array of the
+**	definitions themselves, which is released with a single CS_free.
+**	The number of definitions in the array is returned by [count],
+**	a negative value indicates failure.
+**********************************************************************/
+int EXP_LVL3 CS_csdefAllEx (struct cs_Csdef_ **pDefArray)
+{
+	return CS_csDefinitionAllEx(pDefArray);
+}
+
 /**********************************************************************
 **	CS_csfnm (new_name);
 **
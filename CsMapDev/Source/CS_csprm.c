@@ -48,7 +48,6 @@ extern int (*cs_CsHook)(struct cs_Csdef_ *csdef,unsigned short prj_code,ulong32_
 struct cs_Csprm_ * EXP_LVL3 CS_csloc (Const char *cs_nam)
 {
 	extern char csErrnam [];
-	extern struct cs_Prjtab_ cs_Prjtab [];
 
 	int status;
 
@@ -71,10 +70,7 @@ struct cs_Csprm_ * EXP_LVL3 CS_csloc (Const char *cs_nam)
 	   as CS_cschk will do the same thing, but it isn't that
 	   expensive. */
 
-	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-	{
-		if (!CS_stricmp (pp->key_nm,cs_ptr->prj_knm)) break;
-	}
+	pp = CS_prjtabPtr (cs_ptr->prj_knm);
 	if (*pp->key_nm == '\0' || pp->setup == NULL)
 	{
 		CS_stncp (csErrnam,cs_ptr->prj_knm,MAXPATH);
@@ -120,7 +116,6 @@ error:
 struct cs_Csprm_ * EXP_LVL3 CScsloc1 (struct cs_Csdef_ *cs_ptr)
 {
 	extern char csErrnam [];
-	extern struct cs_Prjtab_ cs_Prjtab [];
 
 	struct cs_Csprm_ *csprm;
 	struct cs_Datum_ *dt_ptr;
@@ -137,10 +132,7 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc1 (struct cs_Csdef_ *cs_ptr)
 	   as CS_cschk (called from CScsloc) will do the same thing,
 	   but if we don't have a valid projection, things get ugly. */
 
-	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-	{
-		if (!CS_stricmp (pp->key_nm,cs_ptr->prj_knm)) break;
-	}
+	pp = CS_prjtabPtr (cs_ptr->prj_knm);
 	if (*pp->key_nm == '\0' || pp->setup == NULL)
 	{
 		CS_stncp (csErrnam,cs_ptr->prj_knm,MAXPATH);
@@ -257,7 +249,6 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc (	struct cs_Csdef_ *cs_ptr,
 										struct cs_Datum_ *dt_ptr)
 {
 	extern char csErrnam [];
-	extern struct cs_Prjtab_ cs_Prjtab [];
 
 	extern double cs_One;					/* 1.0 */
 	extern double cs_Two_pi;				/* 6.28..... */
@@ -278,10 +269,7 @@ struct cs_Csprm_ * EXP_LVL3 CScsloc (	struct cs_Csdef_ *cs_ptr,
 	   as CS_cschk (below) will do the same thing, but if we
 	   don't have a valid projection, things get ugly. */
 
-	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-	{
-		if (!CS_stricmp (pp->key_nm,cs_ptr->prj_knm)) break;
-	}
+	pp = CS_prjtabPtr (cs_ptr->prj_knm);
 	if (*pp->key_nm == '\0' || pp->setup == NULL)
 	{
 		CS_stncp (csErrnam,cs_ptr->prj_knm,MAXPATH);
@@ -594,7 +582,6 @@ error:
 
 int EXP_LVL9 CSllCsFromDt (char* csKeyName,int csKeySize,Const char* dtKeyName)
 {
-	extern struct cs_Prjtab_ cs_Prjtab [];
 	extern struct cs_Datum_ cs_Wgs84Def;
 
 	int st;
@@ -641,10 +628,7 @@ int EXP_LVL9 CSllCsFromDt (char* csKeyName,int csKeySize,Const char* dtKeyName)
 				continue;
 			}
 			/* Determine the projection code. */
-			for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-			{
-				if (!CS_stricmp (pp->key_nm,cs_def.prj_knm)) break;
-			}
+			pp = CS_prjtabPtr (cs_def.prj_knm);
 			if (*pp->key_nm == '\0' || pp->setup == NULL)
 			{
 				/* Couldn't find a projection code, shouldn't happen. */
@@ -139,6 +139,321 @@
 **	ignored.
 **********************************************************************/
 
+/**********************************************************************
+**	count = CS_dtcSnapOpen (snapPath);
+**
+**	Const char *snapPath;		full path to the snapshot file, or NULL to
+**								stop using a snapshot.
+**	int count;					returns the number of datum conversions
+**								obtained from the snapshot file, or -1 if
+**								snapPath is not a usable path.
+**
+**	st = CS_dtcSnapSave ();
+**
+**	int st;						returns zero on success, else -1.
+**
+**	Resolving the set of geodetic transformations which convert from one
+**	datum to another (the bridge search in CSdtcsu below) requires the
+**	Geodetic Transformation Index and, frequently, several passes over it.
+**	A process which always converts between the same datums can avoid this
+**	by recording the resolved transformations in a snapshot file, and
+**	loading the snapshot the next time it starts.
+**
+**	Each entry of the snapshot is keyed by the source and target datum key
+**	names and a hash of the content of each datum definition.  The snapshot
+**	as a whole is valid only for the Datum, Geodetic Transformation, and
+**	Geodetic Path dictionaries, both user and system, which existed when
+**	it was written; should the size or modification time of any of these
+**	change, the snapshot is ignored and rebuilt as CSdtcsu resolves conversions
+**	anew.  Only the resolved transformation names and directions are
+**	recorded; the transformations themselves, including any grid files
+**	they use, are set up by CS_gxloc as usual.  Conversions produced from
+**	the datum definitions themselves (i.e. no Geodetic Transformation
+**	Dictionary entry) are not recorded.
+**
+**	CS_dtcSnapSave writes all conversions resolved so far, whether loaded
+**	from the snapshot or resolved by this process, to the snapshot file.
+**	Note that CS_recvr discards conversions which have not been saved.
+**********************************************************************/
+static char csDtcSnapPath [MAXPATH] = "";
+static int csDtcSnapLoaded = FALSE;
+static cs_Time_ csDtcSnapTimes [6];
+static ulong32_t csDtcSnapSizes [6];
+static struct csDtcSnap_* csDtcSnapTbl = NULL;
+static int* csDtcSnapNext = NULL;
+static int csDtcSnapCount = 0;
+static int csDtcSnapAlloc = 0;
+static int csDtcSnapBuckets [256];
+
+static void CSdtcSnapStamps (cs_Time_ dictTimes [6],ulong32_t dictSizes [6])
+{
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern char cs_UserDir [];
+	extern char cs_Dtname [];
+	extern char cs_Gxname [];
+	extern char cs_Gpname [];
+
+	int idx;
+	Const char* dictName;
+	char dictPath [MAXPATH];
+
+	for (idx = 0;idx < 6;idx += 1)
+	{
+		dictName = (idx % 3 == 0) ? cs_Dtname : ((idx % 3 == 1) ? cs_Gxname : cs_Gpname);
+		dictTimes [idx] = 0;
+		dictSizes [idx] = 0UL;
+		if (idx < 3)
+		{
+			if (cs_UserDir [0] == '\0') continue;
+			CS_stncp (dictPath,cs_UserDir,sizeof (dictPath));
+			CS_stncat (dictPath,dictName,sizeof (dictPath));
+		}
+		else
+		{
+			CS_stcpy (cs_DirP,dictName);
+			CS_stncp (dictPath,cs_Dir,sizeof (dictPath));
+		}
+		dictTimes [idx] = CS_fileModTime (dictPath);
+		dictSizes [idx] = CS_fileSize (dictPath);
+	}
+}
+
+static ulong32_t CSdtcSnapHash (Const struct cs_Datum_ *datum)
+{
+	size_t idx;
+	ulong32_t hash;
+	Const unsigned char* cp;
+	double values [12];
+
+	values [0] = datum->e_rad;
+	values [1] = datum->p_rad;
+	values [2] = datum->flat;
+	values [3] = datum->ecent;
+	values [4] = datum->delta_X;
+	values [5] = datum->delta_Y;
+	values [6] = datum->delta_Z;
+	values [7] = datum->rot_X;
+	values [8] = datum->rot_Y;
+	values [9] = datum->rot_Z;
+	values [10] = datum->bwscale;
+	values [11] = (double)datum->to84_via;
+	hash = (ulong32_t)CS_strihash (datum->key_nm,datum->ell_knm);
+	cp = (Const unsigned char *)values;
+	for (idx = 0;idx < sizeof (values);idx += 1)
+	{
+		hash = (hash ^ cp [idx]) * 16777619UL;
+	}
+	return hash & 0xFFFFFFFFUL;
+}
+
+/* Locates the entry for the given datums, returns -1 if there is none. */
+static int CSdtcSnapFind (Const char *srcKeyName,Const char *trgKeyName)
+{
+	int entry;
+
+	entry = csDtcSnapBuckets [CS_strihash (srcKeyName,trgKeyName) & 255U];
+	for (;entry >= 0;entry = csDtcSnapNext [entry])
+	{
+		if (!CS_stricmp (csDtcSnapTbl [entry].srcKeyName,srcKeyName) &&
+			!CS_stricmp (csDtcSnapTbl [entry].trgKeyName,trgKeyName))
+		{
+			break;
+		}
+	}
+	return entry;
+}
+
+/* Adds an empty entry for the given datums, or returns the existing one.
+   Returns -1 if memory is not available. */
+static int CSdtcSnapAdd (Const char *srcKeyName,Const char *trgKeyName)
+{
+	int entry;
+	int newAlloc;
+	unsigned bucket;
+	int* newNext;
+	struct csDtcSnap_* newTbl;
+
+	entry = CSdtcSnapFind (srcKeyName,trgKeyName);
+	if (entry >= 0)
+	{
+		return entry;
+	}
+	if (csDtcSnapCount >= csDtcSnapAlloc)
+	{
+		newAlloc = (csDtcSnapAlloc == 0) ? 64 : csDtcSnapAlloc * 2;
+		newTbl = (struct csDtcSnap_ *)CS_ralc (csDtcSnapTbl,sizeof (struct csDtcSnap_) * (size_t)newAlloc);
+		if (newTbl == NULL) return -1;
+		csDtcSnapTbl = newTbl;
+		newNext = (int *)CS_ralc (csDtcSnapNext,sizeof (int) * (size_t)newAlloc);
+		if (newNext == NULL) return -1;
+		csDtcSnapNext = newNext;
+		csDtcSnapAlloc = newAlloc;
+	}
+	entry = csDtcSnapCount++;
+	memset (&csDtcSnapTbl [entry],0,sizeof (struct csDtcSnap_));
+	CS_stncp (csDtcSnapTbl [entry].srcKeyName,srcKeyName,sizeof (csDtcSnapTbl [entry].srcKeyName));
+	CS_stncp (csDtcSnapTbl [entry].trgKeyName,trgKeyName,sizeof (csDtcSnapTbl [entry].trgKeyName));
+	bucket = CS_strihash (srcKeyName,trgKeyName) & 255U;
+	csDtcSnapNext [entry] = csDtcSnapBuckets [bucket];
+	csDtcSnapBuckets [bucket] = entry;
+	return entry;
+}
+
+void EXP_LVL7 CS_rlsDtcSnap (void)
+{
+	int idx;
+
+	CS_free (csDtcSnapTbl);
+	csDtcSnapTbl = NULL;
+	CS_free (csDtcSnapNext);
+	csDtcSnapNext = NULL;
+	csDtcSnapCount = 0;
+	csDtcSnapAlloc = 0;
+	for (idx = 0;idx < 256;idx += 1)
+	{
+		csDtcSnapBuckets [idx] = -1;
+	}
+	csDtcSnapLoaded = FALSE;
+}
+
+/* Makes sure the snapshot in memory reflects the current dictionaries,
+   loading it from the snapshot file if need be.  Returns FALSE if no
+   snapshot is in use. */
+static int CSdtcSnapReady (void)
+{
+	int idx;
+	int entry;
+	ulong32_t recIdx;
+	csFILE* strm;
+	struct csDtcSnapHdr_ snapHdr;
+	struct csDtcSnap_ snapRec;
+	cs_Time_ dictTimes [6];
+	ulong32_t dictSizes [6];
+
+	if (csDtcSnapPath [0] == '\0')
+	{
+		return FALSE;
+	}
+	CSdtcSnapStamps (dictTimes,dictSizes);
+	if (csDtcSnapLoaded && !memcmp (dictTimes,csDtcSnapTimes,sizeof (dictTimes)) &&
+		!memcmp (dictSizes,csDtcSnapSizes,sizeof (dictSizes)))
+	{
+		return TRUE;
+	}
+	CS_rlsDtcSnap ();
+	memcpy (csDtcSnapTimes,dictTimes,sizeof (csDtcSnapTimes));
+	memcpy (csDtcSnapSizes,dictSizes,sizeof (csDtcSnapSizes));
+	csDtcSnapLoaded = TRUE;
+
+	/* Any problem with the file simply results in an empty snapshot; the
+	   file is rewritten by CS_dtcSnapSave. */
+	strm = CS_fopen (csDtcSnapPath,_STRM_BINRD);
+	if (strm == NULL)
+	{
+		return TRUE;
+	}
+	if (CS_fread (&snapHdr,1,sizeof (snapHdr),strm) == sizeof (snapHdr) &&
+		snapHdr.magic == cs_DTCSNAP_MAGIC &&
+		snapHdr.byteOrder == cs_DICTMAP_ORDER &&
+		snapHdr.recordSize == sizeof (struct csDtcSnap_))
+	{
+		for (idx = 0;idx < 6;idx += 1)
+		{
+			if (snapHdr.dictTimes [idx] != dictTimes [idx] ||
+				snapHdr.dictSizes [idx] != dictSizes [idx])
+			{
+				break;
+			}
+		}
+		for (recIdx = 0;idx == 6 && recIdx < snapHdr.recordCount;recIdx += 1)
+		{
+			if (CS_fread (&snapRec,1,sizeof (snapRec),strm) != sizeof (snapRec)) break;
+			entry = CSdtcSnapAdd (snapRec.srcKeyName,snapRec.trgKeyName);
+			if (entry < 0) break;
+			memcpy (&csDtcSnapTbl [entry],&snapRec,sizeof (snapRec));
+		}
+	}
+	CS_fclose (strm);
+	return TRUE;
+}
+
+int EXP_LVL3 CS_dtcSnapOpen (Const char *snapPath)
+{
+	extern char csErrnam [];
+
+	CS_rlsDtcSnap ();
+	csDtcSnapPath [0] = '\0';
+	if (snapPath == NULL || *snapPath == '\0')
+	{
+		return 0;
+	}
+	if (strlen (snapPath) >= sizeof (csDtcSnapPath))
+	{
+		CS_stncp (csErrnam,snapPath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		return -1;
+	}
+	CS_stncp (csDtcSnapPath,snapPath,sizeof (csDtcSnapPath));
+	CSdtcSnapReady ();
+	return csDtcSnapCount;
+}
+
+int EXP_LVL3 CS_dtcSnapSave (void)
+{
+	extern char csErrnam [];
+
+	csFILE* strm;
+	struct csDtcSnapHdr_ snapHdr;
+
+	if (!CSdtcSnapReady ())
+	{
+		return 0;
+	}
+	strm = CS_fopen (csDtcSnapPath,_STRM_BINWR);
+	if (strm == NULL)
+	{
+		CS_stncp (csErrnam,csDtcSnapPath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		return -1;
+	}
+	memset (&snapHdr,0,sizeof (snapHdr));
+	snapHdr.magic = cs_DTCSNAP_MAGIC;
+	snapHdr.byteOrder = cs_DICTMAP_ORDER;
+	snapHdr.recordSize = sizeof (struct csDtcSnap_);
+	snapHdr.recordCount = (ulong32_t)csDtcSnapCount;
+	memcpy (snapHdr.dictTimes,csDtcSnapTimes,sizeof (snapHdr.dictTimes));
+	memcpy (snapHdr.dictSizes,csDtcSnapSizes,sizeof (snapHdr.dictSizes));
+	if (CS_fwrite (&snapHdr,1,sizeof (snapHdr),strm) != sizeof (snapHdr) ||
+		(csDtcSnapCount > 0 &&
+		 CS_fwrite (csDtcSnapTbl,sizeof (struct csDtcSnap_),(size_t)csDtcSnapCount,strm) != (size_t)csDtcSnapCount))
+	{
+		CS_fclose (strm);
+		CS_stncp (csErrnam,csDtcSnapPath,MAXPATH);
+		CS_erpt (cs_IOERR);
+		return -1;
+	}
+	CS_fclose (strm);
+	return 0;
+}
+
+/* Marks the null transformations of a datum conversion as disabled; see
+   the discussion near the end of CSdtcsu. */
+static void CSdtcsuDisableNull (struct cs_Dtcprm_ *dtcPtr)
+{
+	int idx;
+	struct cs_GxXform_ *xfrmPtr;
+
+	for (idx = 0;idx < dtcPtr->xfrmCount;idx++)
+	{
+		xfrmPtr = dtcPtr->xforms [idx];
+		if (xfrmPtr != NULL && CS_gxIsNull (xfrmPtr))
+		{
+			CS_gxDisable (xfrmPtr);
+		}
+	}
+}
+
 /**********************************************************************
 	Original calling sequence. This now acts as a hook to the more generally
 	useful function defined immediately below.
@@ -173,6 +488,8 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 
 	int idx;
 	int gxIndex;
+	int snapIdx;
+	int snapInUse;
 	int bridgeStatus;
 	int idxDirection;
 
@@ -186,6 +503,7 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 	struct cs_Dtcprm_ *dtcPtr;
 	struct cs_GxIndex_* gxIdxPtr;
 	struct cs_GxXform_ *xfrmPtr;
+	struct csDtcSnap_* snapPtr;
 
 	bridgePtr = NULL;
 	dtcPtr = CS_malc (sizeof (struct cs_Dtcprm_));
@@ -235,6 +553,32 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 		return (dtcPtr);
 	}
 
+	/* If a datum conversion snapshot is in use, and it has the conversion
+	   between these two datums, there is no need to search for it.  See
+	   CS_dtcSnapOpen above. */
+	snapInUse = CSdtcSnapReady ();
+	snapIdx = snapInUse ? CSdtcSnapFind (src_dt->key_nm,dst_dt->key_nm) : -1;
+	if (snapIdx >= 0 && csDtcSnapTbl [snapIdx].srcHash == CSdtcSnapHash (src_dt)
+					 && csDtcSnapTbl [snapIdx].trgHash == CSdtcSnapHash (dst_dt))
+	{
+		snapPtr = &csDtcSnapTbl [snapIdx];
+		CS_stncp (dtcPtr->pathName,snapPtr->pathName,sizeof (dtcPtr->pathName));
+		CS_stncp (dtcPtr->description,snapPtr->description,sizeof (dtcPtr->description));
+		CS_stncp (dtcPtr->source,snapPtr->source,sizeof (dtcPtr->source));
+		CS_stncp (dtcPtr->group,snapPtr->group,sizeof (dtcPtr->group));
+		for (idx = 0;idx < snapPtr->xfrmCount && idx < csPATH_MAXXFRM;idx++)
+		{
+			xfrmPtr = CS_gxloc (snapPtr->xfrms [idx].xfrmName,snapPtr->xfrms [idx].direction);
+			if (xfrmPtr == NULL)
+			{
+				goto error;
+			}
+			dtcPtr->xforms [dtcPtr->xfrmCount++] = xfrmPtr;
+		}
+		CSdtcsuDisableNull (dtcPtr);
+		return dtcPtr;
+	}
+
 	/* We need to see if this is a special case.  This is largely related to
 	   installation process where a custom datum may exist in the end user's
 	   datum dictionary and (of course) there is no equivalent entry in the
@@ -411,6 +755,32 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 		}
 	}
 
+	/* Record the result in the snapshot, if one is in use.  Failure to do
+	   so is not an error; the conversion is simply resolved again next
+	   time. */
+	snapIdx = snapInUse ? CSdtcSnapAdd (src_dt->key_nm,dst_dt->key_nm) : -1;
+	if (snapIdx >= 0)
+	{
+		snapPtr = &csDtcSnapTbl [snapIdx];
+		snapPtr->srcHash = CSdtcSnapHash (src_dt);
+		snapPtr->trgHash = CSdtcSnapHash (dst_dt);
+		CS_stncp (snapPtr->pathName,dtcPtr->pathName,sizeof (snapPtr->pathName));
+		CS_stncp (snapPtr->description,dtcPtr->description,sizeof (snapPtr->description));
+		CS_stncp (snapPtr->source,dtcPtr->source,sizeof (snapPtr->source));
+		CS_stncp (snapPtr->group,dtcPtr->group,sizeof (snapPtr->group));
+		snapPtr->xfrmCount = 0;
+		for (idx = 0;idx < csPATH_MAXXFRM;idx++)
+		{
+			gxIdxPtr = bridgePtr->bridgeXfrms [idx].xfrmPtr;
+			if (gxIdxPtr != NULL)
+			{
+				CS_stncp (snapPtr->xfrms [snapPtr->xfrmCount].xfrmName,gxIdxPtr->xfrmName,sizeof (snapPtr->xfrms [0].xfrmName));
+				snapPtr->xfrms [snapPtr->xfrmCount].direction = bridgePtr->bridgeXfrms [idx].direction;
+				snapPtr->xfrmCount += 1;
+			}
+		}
+	}
+
 	/* We now turn our attention to optimizing the complete transformation.
 	   What we do here is:
 	   1> Remove NULL transformations from the bridge.
@@ -435,15 +805,7 @@ struct cs_Dtcprm_ * EXP_LVL3 CSdtcsu (	Const struct cs_Datum_ *src_dt,
 	   Note, the difference referred to in the last paragraph ot on the
 	   order of a millimeter or so, so its not really a big deal.
 	*/
-	for (idx = 0;idx < dtcPtr->xfrmCount;idx++)
-	{
-		xfrmPtr = dtcPtr->xforms [idx];
-		if (xfrmPtr != NULL && CS_gxIsNull (xfrmPtr))
-		{
-			CS_gxDisable (xfrmPtr);
-			xfrmPtr = NULL;
-		}
-	}
+	CSdtcsuDisableNull (dtcPtr);
 
 #ifdef __TODO__
 	/* TODO:  Evaluate if the following is necessary, and if not
@@ -1214,6 +1576,62 @@ int EXP_LVL3 CS_dtcvt3D (struct cs_Dtcprm_ *dtcPrm,Const double ll_in [3],double
 {
 	return CSdtcvt (dtcPrm,TRUE,ll_in,ll_out);
 }
+/* Batch versions of the above.  The status of each individual point is
+   returned in the status array (if not NULL); the return value is the most
+   severe of these.  Every point is converted, regardless of the status of
+   any other point.  The ll_in and ll_out arguments may point to the same
+   array.  For large batches, the points are processed in an order which
+   follows the geography of the points (see CSlocalityOrder) so as to make
+   the best use of the cell caches in the grid file objects.  The results
+   are, of course, returned in the original order. */
+int EXP_LVL3 CS_dtcvtN (struct cs_Dtcprm_ *dtcPrm,Const double ll_in [][3],double ll_out [][3],int status [],int count)
+{
+	return CSdtcvtN (dtcPrm,FALSE,ll_in,ll_out,status,count);
+}
+int EXP_LVL3 CS_dtcvt3DN (struct cs_Dtcprm_ *dtcPrm,Const double ll_in [][3],double ll_out [][3],int status [],int count)
+{
+	return CSdtcvtN (dtcPrm,TRUE,ll_in,ll_out,status,count);
+}
+int EXP_LVL3 CSdtcvtN (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in [][3],double ll_out [][3],int status [],int count)
+{
+	int idx;
+	int ptIdx;
+	int ordered;
+	int ptStatus;
+	int rtnStatus;
+	int *order;
+
+	/* The ordering is simply an optimization.  If the memory for it is not
+	   available, the points are processed in the order given. */
+	order = NULL;
+	ordered = 0;
+	if (count > 1)
+	{
+		order = (int *)CS_malc (sizeof (int) * (size_t)count);
+		if (order != NULL)
+		{
+			ordered = CSlocalityOrder (order,ll_in,count);
+		}
+	}
+
+	rtnStatus = 0;
+	for (idx = 0;idx < count;idx += 1)
+	{
+		ptIdx = (ordered > 0) ? order [idx] : idx;
+		ptStatus = CSdtcvt (dtcPrm,flag3D,ll_in [ptIdx],ll_out [ptIdx]);
+		if (status != NULL) status [ptIdx] = ptStatus;
+		if (ptStatus < 0)
+		{
+			rtnStatus = ptStatus;
+		}
+		else if (rtnStatus >= 0 && ptStatus > rtnStatus)
+		{
+			rtnStatus = ptStatus;
+		}
+	}
+	if (order != NULL) CS_free (order);
+	return rtnStatus;
+}
 int EXP_LVL3 CSdtcvt (struct cs_Dtcprm_ *dtcPrm,short flag3D,Const double ll_in [3],double ll_out [3])
 {
 	extern char csErrnam [MAXPATH];
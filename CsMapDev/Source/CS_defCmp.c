@@ -294,7 +294,6 @@ int EXP_LVL3 CS_csDefCmp (Const struct cs_Csdef_ *original,Const struct cs_Csdef
 }
 int EXP_LVL3 CS_defCmpPrjPrm (struct cs_Prjtab_* pp,int prmNbr,double orgValue,double revValue,char *message,size_t messageSize)
 {
-	extern struct cs_PrjprmMap_ cs_PrjprmMap [];
 	extern struct cs_Prjprm_ csPrjprm [];
 
 	int errCnt;
@@ -309,10 +308,7 @@ int EXP_LVL3 CS_defCmpPrjPrm (struct cs_Prjtab_* pp,int prmNbr,double orgValue,d
 	errMsg [0] = '\0';			/* Defensive programming, also keeps lint happy */
 
 	/* Get the type of parameter. */
-	for (mapPtr = cs_PrjprmMap;mapPtr->prj_code != cs_PRJCOD_END;mapPtr += 1)
-	{
-		if (mapPtr->prj_code == pp->code) break;
-	}
+	mapPtr = CS_prjprmMapPtr (pp->code);
 	if (mapPtr->prj_code == cs_PRJCOD_END)
 	{
 		sprintf (errMsg,"Projection code did not map.");
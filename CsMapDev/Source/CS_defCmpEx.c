@@ -936,7 +936,6 @@ int EXP_LVL3 CSprjPrmCmp (double* qValuePtr,short prmNbr,Const struct cs_Csdef_*
 	extern double cs_Huge;
 	extern struct cs_Prjtab_ cs_Prjtab [];
 	extern struct cs_Prjprm_ csPrjprm [];
-	extern struct cs_PrjprmMap_ cs_PrjprmMap [];
 
 	int errCnt;
 	unsigned char parmType;
@@ -983,18 +982,15 @@ int EXP_LVL3 CSprjPrmCmp (double* qValuePtr,short prmNbr,Const struct cs_Csdef_*
 	    prjCodeOrg == prjCodeRev)
 	{
 		/* Get the type of parameter. */
-		for (mapPtr = cs_PrjprmMap;mapPtr->prj_code != cs_PRJCOD_END;mapPtr += 1)
-		{
-			if (mapPtr->prj_code == prjCodeOrg)
-			{
-				parmType = mapPtr->prm_types [prmNbr - 1];
-				break;
-			}
-		}
+		mapPtr = CS_prjprmMapPtr (prjCodeOrg);
 		if (mapPtr->prj_code == cs_PRJCOD_END)
 		{
 			CS_stncp (errMsg,"Projection code did not map.",sizeof (errMsg));
 		}
+		else
+		{
+			parmType = mapPtr->prm_types [prmNbr - 1];
+		}
 	}
 
 	if (parmType != cs_PRMCOD_INVLD)
@@ -0,0 +1,741 @@
+/*
+ * Copyright (c) 2008, Autodesk, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Autodesk, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Autodesk, Inc. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL Autodesk, Inc. OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*
+	Mappable dictionary images.
+
+	A mappable image is a copy of a compiled Coordsys, Datums, or Elipsoid
+	dictionary in which the records are stored decrypted, in the byte order
+	of the host which produced it, and in the same (sorted) order as the
+	dictionary.  The image is written next to the dictionary it was made
+	from, with the extension replaced by ".CSM", and consists of a
+	csDictMapHdr_ followed by the records.  Since the records are stored
+	exactly as they appear in memory, the image can be mapped into memory
+	and the definitions used in place: no reading, decrypting, swapping,
+	or copying.  The standard dictionary is not affected in any way.
+
+	The compiler produces the images when the cs_CMPLR_MAPPABLE option is
+	specified.  The image records the size and modification time of the
+	dictionary it was made from, and is only used while both still match
+	exactly; a modification time alone, with its resolution of a second,
+	does not reliably detect a dictionary which has been replaced.  A
+	dictionary which has been changed since the image was produced must be
+	recompiled before the image can be used again.  A user dictionary, which is usually maintained by the
+	application rather than compiled, need not have an image: when it has
+	no current image, the dictionary is read into memory in the same form.
+
+	The pointers returned by the functions in this module point into the
+	mapped image.  They are read only, and remain valid until CS_rlsDictMap
+	is called, which CS_recvr and the dictionary update functions do.
+	Note that the mapped lookups do not call the CS_csDefinition hook
+	functions.
+*/
+
+#include "cs_map.h"
+#include <stddef.h>
+
+#if _RUN_TIME >= _rt_UNIXPCC
+#	include <sys/mman.h>
+#endif
+
+#define csDICTMAP_CS 0
+#define csDICTMAP_DT 1
+#define csDICTMAP_EL 2
+
+struct csDictMap_
+{
+	char csdPath [MAXPATH];			/* dictionary the image was opened for,
+									   null string says not open. */
+	void *image;					/* the mapping, or a malloc'ed copy,
+									   of the entire image file. */
+	size_t imageSize;
+	int mapped;						/* non-zero says image was mmap'ed. */
+	long32_t recordCount;
+	Const char *records;			/* first record in the image. */
+};
+
+union csDictMapRec_
+{
+	struct cs_Csdef_ cs;
+	struct cs_Dtdef_ dt;
+	struct cs_Eldef_ el;
+};
+
+/* Indexed by the csDICTMAP_?? type, and then 0 for the system
+   dictionary, 1 for the user dictionary. */
+static struct csDictMap_ csDictMaps [3][2];
+
+static void CSdictMapImagePath (char *imgPath,Const char *csdPath)
+{
+	extern char cs_DirsepC;
+
+	char *cp;
+	char *extPtr;
+
+	CS_stncp (imgPath,csdPath,MAXPATH - 4);
+	extPtr = NULL;
+	for (cp = imgPath;*cp != '\0';cp += 1)
+	{
+		if (*cp == '.') extPtr = cp;
+		else if (*cp == cs_DirsepC) extPtr = NULL;
+	}
+	if (extPtr == NULL) extPtr = cp;
+	CS_stcpy (extPtr,".CSM");
+}
+
+static void CSdictMapTypeInfo (int type,cs_magic_t *magic,size_t *recSize,size_t *keyOffset)
+{
+	switch (type) {
+	case csDICTMAP_CS:
+		*magic = cs_CSDEF_MAGIC;
+		*recSize = sizeof (struct cs_Csdef_);
+		*keyOffset = offsetof (struct cs_Csdef_,key_nm);
+		break;
+	case csDICTMAP_DT:
+		*magic = cs_DTDEF_MAGIC;
+		*recSize = sizeof (struct cs_Dtdef_);
+		*keyOffset = offsetof (struct cs_Dtdef_,key_nm);
+		break;
+	case csDICTMAP_EL:
+	default:
+		*magic = cs_ELDEF_MAGIC;
+		*recSize = sizeof (struct cs_Eldef_);
+		*keyOffset = offsetof (struct cs_Eldef_,key_nm);
+		break;
+	}
+}
+
+static void CSdictMapClose (struct csDictMap_ *map)
+{
+	if (map->image != NULL)
+	{
+#if _RUN_TIME >= _rt_UNIXPCC
+		if (map->mapped)
+		{
+			munmap (map->image,map->imageSize);
+		}
+		else
+		{
+			CS_free (map->image);
+		}
+#else
+		CS_free (map->image);
+#endif
+	}
+	map->csdPath [0] = '\0';
+	map->image = NULL;
+	map->imageSize = 0;
+	map->mapped = FALSE;
+	map->recordCount = 0L;
+	map->records = NULL;
+}
+
+/**********************************************************************
+**	st = CSdictMapWrite (csdPath);
+**
+**	char *csdPath;				full path to a compiled Coordsys, Datums, or
+**								Elipsoid dictionary.
+**	int st;						returns zero on success, else -1.
+**
+**	Writes the mappable image of the indicated dictionary.  The type of
+**	dictionary is determined by its magic number.  The dictionary is
+**	expected to be sorted, as the compiler leaves it.  On failure, the
+**	image file is removed and the error has been reported.
+**********************************************************************/
+int EXP_LVL9 CSdictMapWrite (Const char *csdPath)
+{
+	extern char csErrnam [];
+
+	int st;
+	int crypt;
+	int type;
+
+	size_t recSize;
+	size_t keyOffset;
+	long32_t recordCount;
+
+	csFILE *inStrm;
+	csFILE *outStrm;
+
+	cs_magic_t magic;
+	cs_magic_t typeMagic;
+
+	char imgPath [MAXPATH];
+
+	__ALIGNMENT__1				/* For some versions of Sun compiler. */
+	union csDictMapRec_ record;
+	struct csDictMapHdr_ header;
+
+	inStrm = NULL;
+	outStrm = NULL;
+	imgPath [0] = '\0';
+
+	inStrm = CS_fopen (csdPath,_STRM_BINRD);
+	if (inStrm == NULL)
+	{
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		goto error;
+	}
+	if (CS_fread (&magic,1,sizeof (magic),inStrm) != sizeof (magic))
+	{
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	CS_bswap (&magic,"l");
+	if (magic == cs_CSDEF_MAGIC) type = csDICTMAP_CS;
+	else if (magic == cs_DTDEF_MAGIC) type = csDICTMAP_DT;
+	else if (magic == cs_ELDEF_MAGIC) type = csDICTMAP_EL;
+	else
+	{
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	CSdictMapTypeInfo (type,&typeMagic,&recSize,&keyOffset);
+
+	CSdictMapImagePath (imgPath,csdPath);
+	outStrm = CS_fopen (imgPath,_STRM_BINWR);
+	if (outStrm == NULL)
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		goto error;
+	}
+
+	/* The header is rewritten with the actual count once all the
+	   records have been written. */
+	memset (&header,'\0',sizeof (header));
+	header.magic = typeMagic;
+	header.byteOrder = cs_DICTMAP_ORDER;
+	header.recordSize = (ulong32_t)recSize;
+	header.recordCount = 0UL;
+	header.csdSize = CS_fileSize (csdPath);
+	header.csdTime = (ulong32_t)CS_fileModTime (csdPath);
+	if (CS_fwrite (&header,1,sizeof (header),outStrm) != sizeof (header))
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (cs_DISK_FULL);
+		goto error;
+	}
+
+	/* The read functions decrypt and swap; the records are written
+	   exactly as they now appear in memory. */
+	recordCount = 0L;
+	for (;;)
+	{
+		memset (&record,'\0',sizeof (record));
+		switch (type) {
+		case csDICTMAP_CS: st = CS_csrd (inStrm,&record.cs,&crypt); break;
+		case csDICTMAP_DT: st = CS_dtrd (inStrm,&record.dt,&crypt); break;
+		case csDICTMAP_EL:
+		default:           st = CS_elrd (inStrm,&record.el,&crypt); break;
+		}
+		if (st == 0) break;
+		if (st < 0) goto error;
+		if (CS_fwrite (&record,1,recSize,outStrm) != recSize)
+		{
+			CS_stncp (csErrnam,imgPath,MAXPATH);
+			CS_erpt (cs_DISK_FULL);
+			goto error;
+		}
+		recordCount += 1;
+	}
+
+	header.recordCount = (ulong32_t)recordCount;
+	if (CS_fseek (outStrm,0L,SEEK_SET) != 0 ||
+		CS_fwrite (&header,1,sizeof (header),outStrm) != sizeof (header))
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (cs_IOERR);
+		goto error;
+	}
+	st = CS_fclose (outStrm);
+	outStrm = NULL;
+	if (st != 0)
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (cs_DISK_FULL);
+		goto error;
+	}
+	CS_fclose (inStrm);
+	return 0;
+
+error:
+	if (inStrm != NULL) CS_fclose (inStrm);
+	if (outStrm != NULL) CS_fclose (outStrm);
+	if (imgPath [0] != '\0') CS_remove (imgPath);
+	return -1;
+}
+
+/**********************************************************************
+**	CSdictMapRemove (csdPath);
+**
+**	char *csdPath;				full path to a compiled dictionary.
+**
+**	Removes the mappable image of the indicated dictionary, if there
+**	is one.
+**********************************************************************/
+void EXP_LVL9 CSdictMapRemove (Const char *csdPath)
+{
+	char imgPath [MAXPATH];
+
+	CSdictMapImagePath (imgPath,csdPath);
+	if (CS_fileModTime (imgPath) != 0)
+	{
+		CS_remove (imgPath);
+	}
+}
+
+/* Reads the indicated dictionary, by way of the normal read functions, into
+   a malloc'ed image of the same form as a mappable image file. */
+static int CSdictMapLoad (struct csDictMap_ *map,int type,Const char *csdPath)
+{
+	extern char csErrnam [];
+
+	int st;
+	int crypt;
+
+	long fileSize;
+	size_t recSize;
+	size_t keyOffset;
+	long32_t capacity;
+	long32_t recordCount;
+
+	csFILE *strm;
+	char *recPtr;
+	struct csDictMapHdr_ *hdrPtr;
+
+	cs_magic_t magic;
+	cs_magic_t typeMagic;
+
+	CSdictMapClose (map);
+	CSdictMapTypeInfo (type,&typeMagic,&recSize,&keyOffset);
+
+	strm = CS_fopen (csdPath,_STRM_BINRD);
+	if (strm == NULL)
+	{
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (cs_FL_OPEN);
+		goto error;
+	}
+	if (CS_fread (&magic,1,sizeof (magic),strm) != sizeof (magic))
+	{
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	CS_bswap (&magic,"l");
+	if (magic != typeMagic)
+	{
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	CS_fseek (strm,0L,SEEK_END);
+	fileSize = CS_ftell (strm);
+	CS_fseek (strm,(long)sizeof (magic),SEEK_SET);
+	capacity = (long32_t)((size_t)(fileSize - (long)sizeof (magic)) / recSize);
+
+	map->imageSize = sizeof (struct csDictMapHdr_) + (size_t)capacity * recSize;
+	map->image = CS_malc (map->imageSize);
+	if (map->image == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	recPtr = (char *)map->image + sizeof (struct csDictMapHdr_);
+	for (recordCount = 0L;recordCount < capacity;recordCount += 1)
+	{
+		memset (recPtr,'\0',recSize);
+		switch (type) {
+		case csDICTMAP_CS: st = CS_csrd (strm,(struct cs_Csdef_ *)recPtr,&crypt); break;
+		case csDICTMAP_DT: st = CS_dtrd (strm,(struct cs_Dtdef_ *)recPtr,&crypt); break;
+		case csDICTMAP_EL:
+		default:           st = CS_elrd (strm,(struct cs_Eldef_ *)recPtr,&crypt); break;
+		}
+		if (st == 0) break;
+		if (st < 0) goto error;
+		recPtr += recSize;
+	}
+	CS_fclose (strm);
+	strm = NULL;
+
+	hdrPtr = (struct csDictMapHdr_ *)map->image;
+	memset (hdrPtr,'\0',sizeof (*hdrPtr));
+	hdrPtr->magic = typeMagic;
+	hdrPtr->byteOrder = cs_DICTMAP_ORDER;
+	hdrPtr->recordSize = (ulong32_t)recSize;
+	hdrPtr->recordCount = (ulong32_t)recordCount;
+	map->recordCount = recordCount;
+	map->records = (Const char *)map->image + sizeof (struct csDictMapHdr_);
+	CS_stncp (map->csdPath,csdPath,sizeof (map->csdPath));
+	return 0;
+
+error:
+	if (strm != NULL) CS_fclose (strm);
+	CSdictMapClose (map);
+	return -1;
+}
+
+/* Opens the image of the indicated dictionary.  A user dictionary which
+   does not exist is treated as an empty image; one which has no current
+   image is read into memory. */
+static int CSdictMapOpen (struct csDictMap_ *map,int type,Const char *csdPath,int userDict)
+{
+	extern char csErrnam [];
+
+	static int dictErr [3] = {cs_CSDICT, cs_DTDICT, cs_ELDICT};
+
+	long fileSize;
+	size_t recSize;
+	size_t keyOffset;
+
+	ulong32_t csdSize;
+	cs_Time_ csdTime;
+	cs_magic_t typeMagic;
+
+	csFILE *strm;
+	Const struct csDictMapHdr_ *hdrPtr;
+
+	char imgPath [MAXPATH];
+
+	CSdictMapClose (map);
+	strm = NULL;
+
+	CSdictMapTypeInfo (type,&typeMagic,&recSize,&keyOffset);
+	csdTime = CS_fileModTime (csdPath);
+	if (csdTime == 0)
+	{
+		if (userDict)
+		{
+			CS_stncp (map->csdPath,csdPath,sizeof (map->csdPath));
+			return 0;
+		}
+		CS_stncp (csErrnam,csdPath,MAXPATH);
+		CS_erpt (dictErr [type]);
+		goto error;
+	}
+
+	csdSize = CS_fileSize (csdPath);
+
+	CSdictMapImagePath (imgPath,csdPath);
+	if (CS_fileModTime (imgPath) == 0)
+	{
+		if (userDict)
+		{
+			return CSdictMapLoad (map,type,csdPath);
+		}
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (dictErr [type]);
+		goto error;
+	}
+
+	strm = CS_fopen (imgPath,_STRM_BINRD);
+	if (strm == NULL)
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (dictErr [type]);
+		goto error;
+	}
+	CS_fseek (strm,0L,SEEK_END);
+	fileSize = CS_ftell (strm);
+	if (fileSize < (long)sizeof (struct csDictMapHdr_))
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	map->imageSize = (size_t)fileSize;
+
+#if _RUN_TIME >= _rt_UNIXPCC
+	map->image = mmap (NULL,map->imageSize,PROT_READ,MAP_SHARED,_fileno (strm),(off_t)0);
+	if (map->image == MAP_FAILED)
+	{
+		map->image = NULL;
+	}
+	else
+	{
+		map->mapped = TRUE;
+	}
+#endif
+	if (map->image == NULL)
+	{
+		/* No mapping available, read the whole thing. */
+		map->image = CS_malc (map->imageSize);
+		if (map->image == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			goto error;
+		}
+		CS_fseek (strm,0L,SEEK_SET);
+		if (CS_fread (map->image,1,map->imageSize,strm) != map->imageSize)
+		{
+			CS_stncp (csErrnam,imgPath,MAXPATH);
+			CS_erpt (cs_IOERR);
+			goto error;
+		}
+	}
+	CS_fclose (strm);
+	strm = NULL;
+
+	hdrPtr = (Const struct csDictMapHdr_ *)map->image;
+	if (hdrPtr->magic != typeMagic ||
+		hdrPtr->byteOrder != cs_DICTMAP_ORDER ||
+		hdrPtr->recordSize != (ulong32_t)recSize ||
+		map->imageSize != sizeof (struct csDictMapHdr_) + (size_t)hdrPtr->recordCount * recSize)
+	{
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+
+	/* An image of a dictionary which has since been changed is stale. */
+	if (hdrPtr->csdSize != csdSize || hdrPtr->csdTime != (ulong32_t)csdTime)
+	{
+		CSdictMapClose (map);
+		if (userDict)
+		{
+			return CSdictMapLoad (map,type,csdPath);
+		}
+		CS_stncp (csErrnam,imgPath,MAXPATH);
+		CS_erpt (dictErr [type]);
+		return -1;
+	}
+	map->recordCount = (long32_t)hdrPtr->recordCount;
+	map->records = (Const char *)map->image + sizeof (struct csDictMapHdr_);
+	CS_stncp (map->csdPath,csdPath,sizeof (map->csdPath));
+	return 0;
+
+error:
+	if (strm != NULL) CS_fclose (strm);
+	CSdictMapClose (map);
+	return -1;
+}
+
+/* Returns the image of the indicated dictionary for the current
+   dictionary directories, opening it if necessary. */
+static struct csDictMap_* CSdictMapGet (int type,int userDict)
+{
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern char cs_UserDir [];
+	extern char cs_Csname [];
+	extern char cs_Dtname [];
+	extern char cs_Elname [];
+
+	Const char *dictName;
+	struct csDictMap_ *map;
+
+	char csdPath [MAXPATH];
+
+	switch (type) {
+	case csDICTMAP_CS: dictName = cs_Csname; break;
+	case csDICTMAP_DT: dictName = cs_Dtname; break;
+	case csDICTMAP_EL:
+	default:           dictName = cs_Elname; break;
+	}
+
+	if (userDict)
+	{
+		if (cs_UserDir [0] == '\0')
+		{
+			csdPath [0] = '\0';
+		}
+		else
+		{
+			CS_stncp (csdPath,cs_UserDir,sizeof (csdPath));
+			CS_stncat (csdPath,dictName,sizeof (csdPath));
+		}
+	}
+	else
+	{
+		CS_stcpy (cs_DirP,dictName);
+		CS_stncp (csdPath,cs_Dir,sizeof (csdPath));
+	}
+
+	map = &csDictMaps [type][userDict ? 1 : 0];
+	if (csdPath [0] == '\0')
+	{
+		CSdictMapClose (map);
+		return map;
+	}
+	if (map->csdPath [0] == '\0' || CS_stricmp (map->csdPath,csdPath))
+	{
+		if (CSdictMapOpen (map,type,csdPath,userDict) != 0)
+		{
+			return NULL;
+		}
+	}
+	return map;
+}
+
+static Const void* CSdictMapFind (int type,Const char *keyName)
+{
+	extern char csErrnam [];
+
+	static int notFndErr [3] = {cs_CS_NOT_FND, cs_DT_NOT_FND, cs_EL_NOT_FND};
+
+	int ii;
+	int cmp;
+	long32_t lo;
+	long32_t hi;
+	long32_t mid;
+	size_t recSize;
+	size_t keyOffset;
+
+	Const char *recPtr;
+	struct csDictMap_ *map;
+
+	cs_magic_t typeMagic;
+
+	char myKeyName [cs_KEYNM_DEF];
+
+	CS_stncp (myKeyName,keyName,sizeof (myKeyName));
+	if (CSnampp (myKeyName,sizeof (myKeyName)) != 0)
+	{
+		return NULL;
+	}
+	CSdictMapTypeInfo (type,&typeMagic,&recSize,&keyOffset);
+
+	/* As elsewhere, a definition in the user dictionary overrides
+	   the distribution definition of the same name. */
+	for (ii = 1;ii >= 0;ii -= 1)
+	{
+		map = CSdictMapGet (type,ii);
+		if (map == NULL)
+		{
+			return NULL;
+		}
+		lo = 0L;
+		hi = map->recordCount - 1;
+		while (lo <= hi)
+		{
+			mid = lo + ((hi - lo) >> 1);
+			recPtr = map->records + (size_t)mid * recSize;
+			cmp = CS_stricmp (myKeyName,recPtr + keyOffset);
+			if (cmp == 0)
+			{
+				return recPtr;
+			}
+			if (cmp < 0) hi = mid - 1;
+			else         lo = mid + 1;
+		}
+	}
+	CS_stncp (csErrnam,myKeyName,MAXPATH);
+	CS_erpt (notFndErr [type]);
+	return NULL;
+}
+
+static long32_t CSdictMapAll (int type,Const void **defArray,int userDict)
+{
+	struct csDictMap_ *map;
+
+	*defArray = NULL;
+	map = CSdictMapGet (type,userDict);
+	if (map == NULL)
+	{
+		return -1L;
+	}
+	*defArray = map->records;
+	return map->recordCount;
+}
+
+/**********************************************************************
+**	csDef = CS_csdefMap (cs_nam);
+**	dtDef = CS_dtdefMap (dt_nam);
+**	elDef = CS_eldefMap (el_nam);
+**
+**	char *??_nam;				key name of the definition to be located.
+**	struct cs_??def_ *??Def;	returns a pointer to the definition within the
+**								mapped image of the dictionary, else NULL.
+**
+**	Same as CS_csdef, CS_dtdef, and CS_eldef, except that the result
+**	points into the mapped image and must not be modified or CS_free'd.
+**	The user dictionary, if any, is searched first.  The pointer remains
+**	valid until CS_rlsDictMap is called.
+**********************************************************************/
+Const struct cs_Csdef_ * EXP_LVL3 CS_csdefMap (Const char *cs_nam)
+{
+	return (Const struct cs_Csdef_ *)CSdictMapFind (csDICTMAP_CS,cs_nam);
+}
+Const struct cs_Dtdef_ * EXP_LVL3 CS_dtdefMap (Const char *dt_nam)
+{
+	return (Const struct cs_Dtdef_ *)CSdictMapFind (csDICTMAP_DT,dt_nam);
+}
+Const struct cs_Eldef_ * EXP_LVL3 CS_eldefMap (Const char *el_nam)
+{
+	return (Const struct cs_Eldef_ *)CSdictMapFind (csDICTMAP_EL,el_nam);
+}
+
+/**********************************************************************
+**	count = CS_csdefMapAll (&defArray,userDict);
+**	count = CS_dtdefMapAll (&defArray,userDict);
+**	count = CS_eldefMapAll (&defArray,userDict);
+**
+**	struct cs_??def_ *defArray;	receives a pointer to the first definition in
+**								the mapped image of the dictionary.
+**	int userDict;				non-zero selects the user dictionary, zero the
+**								distribution dictionary.
+**	long32_t count;				returns the number of definitions in the array,
+**								-1 on error.
+**
+**	Enumerates an entire dictionary without reading or allocating
+**	anything.  The array is sorted by key name, as is the dictionary,
+**	and remains valid until CS_rlsDictMap is called.  A user dictionary
+**	which has not been specified, or does not exist, has no definitions.
+**********************************************************************/
+long32_t EXP_LVL3 CS_csdefMapAll (Const struct cs_Csdef_ **defArray,int userDict)
+{
+	return CSdictMapAll (csDICTMAP_CS,(Const void **)defArray,userDict);
+}
+long32_t EXP_LVL3 CS_dtdefMapAll (Const struct cs_Dtdef_ **defArray,int userDict)
+{
+	return CSdictMapAll (csDICTMAP_DT,(Const void **)defArray,userDict);
+}
+long32_t EXP_LVL3 CS_eldefMapAll (Const struct cs_Eldef_ **defArray,int userDict)
+{
+	return CSdictMapAll (csDICTMAP_EL,(Const void **)defArray,userDict);
+}
+
+/**********************************************************************
+**	CS_rlsDictMap ();
+**
+**	Unmaps all mapped dictionary images.  All pointers previously
+**	returned by the CS_??defMap functions become invalid.
+**********************************************************************/
+void EXP_LVL7 CS_rlsDictMap (void)
+{
+	int type;
+
+	for (type = 0;type < 3;type += 1)
+	{
+		CSdictMapClose (&csDictMaps [type][0]);
+		CSdictMapClose (&csDictMaps [type][1]);
+	}
+}
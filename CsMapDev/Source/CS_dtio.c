@@ -303,6 +303,23 @@ int EXP_LVL3 CS_dtdefAll (struct cs_Dtdef_ **pDefArray[])
 	return CS_dtDefinitionAll(pDefArray);
 }
 
+/**********************************************************************
+**	count = CS_dtdefAllEx (pDefArray);
+**
+**	cs_Dtdef_ **pDefArray;		receives a pointer to a malloc'ed array of
+**								cs_Dtdef_ instances.
+**
+**	Same as CS_dtdefAll, except that the definitions are returned in a
+**	single allocation: [pDefArray] will be set to an array of the
+**	definitions themselves, which is released with a single CS_free.
+**	The number of definitions in the array is returned by [count],
+**	a negative value indicates failure.
+**********************************************************************/
+int EXP_LVL3 CS_dtdefAllEx (struct cs_Dtdef_ **pDefArray)
+{
+	return CS_dtDefinitionAllEx(pDefArray);
+}
+
 /**********************************************************************
 **	CS_dtfnm (new_name);
 **
@@ -313,6 +313,23 @@ int EXP_LVL3 CS_eldefAll (struct cs_Eldef_ **pDefArray[])
 	return CS_elDefinitionAll(pDefArray);
 }
 
+/**********************************************************************
+**	count = CS_eldefAllEx (pDefArray);
+**
+**	cs_Eldef_ **pDefArray;		receives a pointer to a malloc'ed array of
+**								cs_Eldef_ instances.
+**
+**	Same as CS_eldefAll, except that the definitions are returned in a
+**	single allocation: [pDefArray] will be set to an array of the
+**	definitions themselves, which is released with a single CS_free.
+**	The number of definitions in the array is returned by [count],
+**	a negative value indicates failure.
+**********************************************************************/
+int EXP_LVL3 CS_eldefAllEx (struct cs_Eldef_ **pDefArray)
+{
+	return CS_elDefinitionAllEx(pDefArray);
+}
+
 struct cs_Eldef_ * EXP_LVL5 CS_eldef2 (Const char *el_nam, char* pszDirPath)
 {
 	extern char csErrnam [];
@@ -41,6 +41,11 @@
 #include "cs_Legacy.h"
 #include "cs_EpsgStuff.h"
 
+#include <exception>
+#if _RUN_TIME >= _rt_UNIXPCC
+#	include <pthread.h>
+#endif
+
 extern "C" const double cs_Zero;
 extern "C" const double cs_One;
 extern "C" const double cs_Mone;
@@ -91,6 +96,19 @@ const TcsEpsgTblMap KcsEpsgTblMap [] =
 	{         epsgTblVersionHistory,  6,  epsgFldVersionHistoryCode,   L"Version History",                      epsgFldVersionHistoryCode,  epsgFldNone,              epsgFldNone,             epsgFldNone },
 	{                epsgTblUnknown,  0,  epsgFldNone,                 L"",                                     epsgFldNone,                epsgFldNone,              epsgFldNone,             epsgFldNone },
 };
+// The following identifies the fields, other than the CodeKeyField, which
+// carry the code of a record in another table and by which the table is
+// searched in the course of the normal conversion of EPSG definitions.  Each
+// of these fields is indexed so that such searches are not linear.
+const TcsEpsgFKeyMap KcsEpsgFKeyMap [] =
+{
+	{                   epsgTblAxis,  epsgFldCoordSysCode          },
+	{        epsgTblReferenceSystem,  epsgFldDatumCode             },
+	{         epsgTblParameterValue,  epsgFldCoordOpCode           },
+	{          epsgTblOperationPath,  epsgFldConcatOperationCode   },
+	{    epsgTblCoordinateOperation,  epsgFldSourceCrsCode         },
+	{                epsgTblUnknown,  epsgFldNone                  },
+};
 const TcsEpsgFldMap KcsEpsgFldMap [] =
 {
 //                                                                 Field
@@ -1404,6 +1422,28 @@ short GetEpsgFieldNumber (EcsEpsgTable tableId,EcsEpsgField fieldId)
 	return rtnValue;
 }
 
+// Returns the field ID of the index'th foreign key field of the indicated
+// table; epsgFldNone if there is no such field.
+EcsEpsgField GetEpsgForeignKeyId (EcsEpsgTable tableId,unsigned index)
+{
+	EcsEpsgField fieldId (epsgFldNone);
+	const TcsEpsgFKeyMap* tblPtr;
+
+	for (tblPtr = KcsEpsgFKeyMap;tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	{
+		if (tblPtr->TableId == tableId)
+		{
+			if (index == 0)
+			{
+				fieldId = tblPtr->FieldId;
+				break;
+			}
+			index -= 1;
+		}
+	}
+	return fieldId;
+}
+
 EcsCsysType GetEpsgCsysType (const wchar_t* csysTypeName)
 {
 	EcsCsysType rtnValue;
@@ -1556,33 +1596,77 @@ short TcsEpsgDataSetV6::GetFldName (std::wstring& fieldName,EcsEpsgTable tableId
 	}
 	return rtnValue;
 }
+// Snapshots are specific to the host which writes them; the header makes sure
+// that a snapshot written by a different build is not used.
+const wchar_t TcsEpsgDataSetV6::SnapshotName [32] = L"EpsgDataSet.snapshot";
+static const ulong32_t KcsEpsgSnapshotMagic   = 0x45505347UL;
+static const ulong32_t KcsEpsgSnapshotVersion = 2UL;
+
+// Obtains the size and the modification time of the .CSV file of an EPSG
+// table.  The snapshot records these for each table; it is current only if
+// all of them are unchanged.  The modification time alone does not suffice,
+// as its resolution is coarse, and a file may be replaced by an older one.
+static bool CSgetEpsgCsvStamp (ulong32_t stamp [2],const std::wstring& databaseFolder,
+															const wchar_t* tableName)
+{
+	long fileSize;
+	cs_Time_ modTime;
+	csFILE* strm;
+	char csvPath [1024];
+
+	std::wstring filePath (databaseFolder);
+	filePath += L"/";
+	filePath += tableName;
+	filePath += L".csv";
+	wcstombs (csvPath,filePath.c_str (),sizeof (csvPath));
+	modTime = CS_fileModTime (csvPath);
+	if (modTime == 0)
+	{
+		return false;
+	}
+	strm = CS_fopen (csvPath,_STRM_BINRD);
+	if (strm == NULL)
+	{
+		return false;
+	}
+	fileSize = -1L;
+	if (CS_fseek (strm,0L,SEEK_END) == 0)
+	{
+		fileSize = CS_ftell (strm);
+	}
+	CS_fclose (strm);
+	stamp [0] = static_cast<ulong32_t>(fileSize);
+	stamp [1] = static_cast<ulong32_t>(modTime);
+	return (fileSize >= 0L);
+}
 //=============================================================================
 // Construction, Destruction, & Assignment
-TcsEpsgDataSetV6::TcsEpsgDataSetV6 (const wchar_t* databaseFolder,const wchar_t* revLevel)
+TcsEpsgDataSetV6::TcsEpsgDataSetV6 (const wchar_t* databaseFolder,const wchar_t* revLevel,
+																  const wchar_t* snapshotFolder)
 																	:
 																  Ok             (true),
 																  DatabaseFolder (databaseFolder),
+																  SnapshotFolder (),
 																  FailMessage    (),
 																  EpsgTables     ()
 {
-	const TcsEpsgTblMap* tblPtr = KcsEpsgTblMap;
-
-	for (tblPtr = KcsEpsgTblMap;tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	// A current snapshot of the data set is much faster to load than the
+	// .CSV files.  Failing that, the .CSV files are loaded and, when the
+	// caller has chosen a snapshot folder, a snapshot is written for the
+	// benefit of the next run.  Inability to write the snapshot is of no
+	// consequence.
+	if (snapshotFolder != 0)
 	{
-		TcsEpsgTable* nextTable = new TcsEpsgTable (*tblPtr,DatabaseFolder.c_str ());
-		if (nextTable->IsOk ())
-		{
-			EpsgTables.insert (std::make_pair(tblPtr->TableId,nextTable));	//lint !e534 (ignoring return value)
-		}
-		else
+		SnapshotFolder = snapshotFolder;
+	}
+	if (!LoadSnapshot ())
+	{
+		LoadTables ();
+		if (Ok && !SnapshotFolder.empty ())
 		{
-			std::wstring csvStMesg;
-			TcsCsvStatus& csvStatus = nextTable->GetCsvStatus ();
-			csvStMesg = csvStatus.GetMessage ();
-			FailMessage += csvStMesg + L"\n";
-			Ok = false;
+			WriteSnapshot ();				//lint !e534
 		}
-	}							//lint !e593    cutodial pointer (newTable) not free'ed
+	}
 	if (Ok)
 	{
 		if (revLevel == 0)
@@ -1598,6 +1682,7 @@ TcsEpsgDataSetV6::TcsEpsgDataSetV6 (const wchar_t* databaseFolder,const wchar_t*
 TcsEpsgDataSetV6::TcsEpsgDataSetV6 (const TcsEpsgDataSetV6& source) : Ok             (source.Ok),
 																	  RevisionLevel  (source.RevisionLevel),
 																	  DatabaseFolder (source.DatabaseFolder),
+																	  SnapshotFolder (source.SnapshotFolder),
 																	  FailMessage    (source.FailMessage),
 																	  EpsgTables     (source.EpsgTables)
 {
@@ -1619,6 +1704,7 @@ TcsEpsgDataSetV6& TcsEpsgDataSetV6::operator= (const TcsEpsgDataSetV6& rhs)
 		Ok             = rhs.Ok;
 		RevisionLevel  = rhs.RevisionLevel;
 		DatabaseFolder = rhs.DatabaseFolder;
+		SnapshotFolder = rhs.SnapshotFolder;
 		FailMessage    = rhs.FailMessage;
 		EpsgTables     = rhs.EpsgTables;		// ouch!!!
 	}
@@ -2440,6 +2526,255 @@ bool TcsEpsgDataSetV6::DetermineRevisionLevel (void)
 	}
 	return ok;
 }
+//=============================================================================
+// Loading  --  The tables are independent of each other, so they are loaded
+// concurrently where threads are available.  Each table is parsed, sorted,
+// and indexed by its own thread.
+struct TcsEpsgTableLoad
+{
+	const TcsEpsgTblMap* TblMap;
+	const wchar_t* DatabaseFolder;
+	TcsEpsgTable* Table;
+};
+static void* CSepsgLoadTable (void* loadPtr)
+{
+	TcsEpsgTableLoad* load = static_cast<TcsEpsgTableLoad*>(loadPtr);
+	try
+	{
+		load->Table = new TcsEpsgTable (*load->TblMap,load->DatabaseFolder);
+	}
+	catch (std::exception&)
+	{
+		load->Table = 0;
+	}
+	return 0;
+}
+void TcsEpsgDataSetV6::LoadTables (void)
+{
+	unsigned idx;
+	const TcsEpsgTblMap* tblPtr;
+	std::vector<TcsEpsgTableLoad> loads;
+
+	for (tblPtr = KcsEpsgTblMap;tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	{
+		TcsEpsgTableLoad load;
+		load.TblMap = tblPtr;
+		load.DatabaseFolder = DatabaseFolder.c_str ();
+		load.Table = 0;
+		loads.push_back (load);
+	}
+
+#if _RUN_TIME >= _rt_UNIXPCC
+	std::vector<pthread_t> threads (loads.size ());
+	std::vector<bool> started (loads.size (),false);
+	for (idx = 0;idx < loads.size ();idx += 1)
+	{
+		started [idx] = (pthread_create (&threads [idx],0,CSepsgLoadTable,&loads [idx]) == 0);
+		if (!started [idx])
+		{
+			// Out of threads, do this one ourselves.
+			CSepsgLoadTable (&loads [idx]);			//lint !e534
+		}
+	}
+	for (idx = 0;idx < loads.size ();idx += 1)
+	{
+		if (started [idx])
+		{
+			pthread_join (threads [idx],0);			//lint !e534
+		}
+	}
+#else
+	for (idx = 0;idx < loads.size ();idx += 1)
+	{
+		CSepsgLoadTable (&loads [idx]);				//lint !e534
+	}
+#endif
+
+	// Collect the results in table order so that FailMessage is the same
+	// regardless of the order in which the loads completed.
+	for (idx = 0;idx < loads.size ();idx += 1)
+	{
+		TcsEpsgTable* nextTable = loads [idx].Table;
+		if (nextTable != 0 && nextTable->IsOk ())
+		{
+			EpsgTables.insert (std::make_pair(loads [idx].TblMap->TableId,nextTable));	//lint !e534 (ignoring return value)
+		}
+		else
+		{
+			if (nextTable != 0)
+			{
+				std::wstring csvStMesg;
+				TcsCsvStatus& csvStatus = nextTable->GetCsvStatus ();
+				csvStMesg = csvStatus.GetMessage ();
+				FailMessage += csvStMesg + L"\n";
+				delete nextTable;
+			}
+			else
+			{
+				FailMessage += std::wstring (loads [idx].TblMap->TableName) + L" Table: insufficient memory\n";
+			}
+			Ok = false;
+		}
+	}
+}
+//=============================================================================
+// Snapshot  --  The snapshot is a single file, in the snapshot folder, which
+// carries all tables sorted and indexed.  It is mapped rather than read, and
+// is used only if the size and modification time of every .CSV file are those
+// recorded in it.
+bool TcsEpsgDataSetV6::GetSnapshotPath (char* pathBufr,size_t bufrSize) const
+{
+	size_t length;
+
+	if (SnapshotFolder.empty ())
+	{
+		return false;
+	}
+	std::wstring filePath (SnapshotFolder);
+	filePath += L"/";
+	filePath += SnapshotName;
+	length = wcstombs (pathBufr,filePath.c_str (),bufrSize);
+	return (length != static_cast<size_t>(-1) && length < bufrSize);
+}
+bool TcsEpsgDataSetV6::LoadSnapshot (void)
+{
+	bool ok;
+	ulong32_t value;
+	ulong32_t tblCount;
+	ulong32_t stamp [2];
+	const char* snapshot;
+	const char* snapshotEnd;
+	const TcsEpsgTblMap* tblPtr;
+	char pathBufr [1024];
+
+	ok = GetSnapshotPath (pathBufr,sizeof (pathBufr));
+	if (ok)
+	{
+		ok = (CS_fileModTime (pathBufr) != 0);
+	}
+	if (!ok)
+	{
+		return false;
+	}
+
+	// TcsCsvReader is used here simply for its ability to map a file.
+	TcsCsvReader snapReader;
+	ok = snapReader.Open (pathBufr);
+	if (ok)
+	{
+		snapshot = snapReader.GetBuffer ();
+		snapshotEnd = snapshot + snapReader.GetBufferSize ();
+		for (tblCount = 0,tblPtr = KcsEpsgTblMap;tblPtr->TableId != epsgTblUnknown;++tblPtr)
+		{
+			tblCount += 1;
+		}
+		ok  = (static_cast<size_t>(snapshotEnd - snapshot) >= 4 * sizeof (ulong32_t));
+		if (ok)
+		{
+			memcpy (&value,snapshot,sizeof (value));
+			ok = (value == KcsEpsgSnapshotMagic);
+			memcpy (&value,snapshot + sizeof (value),sizeof (value));
+			ok &= (value == KcsEpsgSnapshotVersion);
+			memcpy (&value,snapshot + 2 * sizeof (value),sizeof (value));
+			ok &= (value == sizeof (wchar_t));
+			memcpy (&value,snapshot + 3 * sizeof (value),sizeof (value));
+			ok &= (value == tblCount);
+			snapshot += 4 * sizeof (value);
+		}
+
+		// The size and modification time of each .CSV file.
+		ok &= (static_cast<size_t>(snapshotEnd - snapshot) >= tblCount * sizeof (stamp));
+		for (tblPtr = KcsEpsgTblMap;ok && tblPtr->TableId != epsgTblUnknown;++tblPtr)
+		{
+			ok = CSgetEpsgCsvStamp (stamp,DatabaseFolder,tblPtr->TableName) &&
+				 !memcmp (stamp,snapshot,sizeof (stamp));
+			snapshot += sizeof (stamp);
+		}
+	}
+	for (tblPtr = KcsEpsgTblMap;ok && tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	{
+		TcsEpsgTable* nextTable = new TcsEpsgTable (*tblPtr,snapshot,snapshotEnd);
+		ok = nextTable->IsOk ();
+		if (ok)
+		{
+			EpsgTables.insert (std::make_pair(tblPtr->TableId,nextTable));	//lint !e534 (ignoring return value)
+		}
+		else
+		{
+			delete nextTable;
+		}
+	}
+	if (!ok || snapshot != snapshotEnd)
+	{
+		// Whatever the problem, we simply forget about the snapshot and
+		// load the .CSV files.
+		std::map<EcsEpsgTable,TcsEpsgTable*>::iterator itr;
+		for (itr = EpsgTables.begin ();itr != EpsgTables.end ();++itr)
+		{
+			delete itr->second;
+		}
+		EpsgTables.clear ();
+		ok = false;
+	}
+	return ok;
+}
+// Writes a snapshot of the data set.  The snapshot is written to a temporary
+// file which is renamed upon success, so that a partial snapshot is never
+// seen by another process.
+bool TcsEpsgDataSetV6::WriteSnapshot (void) const
+{
+	bool ok;
+	ulong32_t tblCount;
+	ulong32_t stamp [2];
+	csFILE* outStrm;
+	const TcsEpsgTable* epsgTblPtr;
+	const TcsEpsgTblMap* tblPtr;
+	char pathBufr [1024];
+	char tempPath [1040];
+
+	ok = Ok && GetSnapshotPath (pathBufr,sizeof (pathBufr));
+	if (!ok)
+	{
+		return false;
+	}
+	sprintf (tempPath,"%s.tmp",pathBufr);
+	outStrm = CS_fopen (tempPath,_STRM_BINWR);
+	if (outStrm == NULL)
+	{
+		return false;
+	}
+	for (tblCount = 0,tblPtr = KcsEpsgTblMap;tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	{
+		tblCount += 1;
+	}
+	const ulong32_t header [4] = { KcsEpsgSnapshotMagic,
+								   KcsEpsgSnapshotVersion,
+								   static_cast<ulong32_t>(sizeof (wchar_t)),
+								   tblCount
+								 };
+	ok = (CS_fwrite (header,sizeof (header),1,outStrm) == 1);
+	for (tblPtr = KcsEpsgTblMap;ok && tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	{
+		ok = CSgetEpsgCsvStamp (stamp,DatabaseFolder,tblPtr->TableName) &&
+			 (CS_fwrite (stamp,sizeof (stamp),1,outStrm) == 1);
+	}
+	for (tblPtr = KcsEpsgTblMap;ok && tblPtr->TableId != epsgTblUnknown;++tblPtr)
+	{
+		epsgTblPtr = GetTablePtr (tblPtr->TableId);
+		ok = (epsgTblPtr != 0) && epsgTblPtr->WriteSnapshot (outStrm);
+	}
+	ok &= (CS_fclose (outStrm) == 0);
+	if (ok)
+	{
+		CS_remove (pathBufr);									//lint !e534
+		ok = (CS_rename (tempPath,pathBufr) == 0);
+	}
+	if (!ok)
+	{
+		CS_remove (tempPath);									//lint !e534
+	}
+	return ok;
+}
 // Note that the following table is used to map the source datums.
 // That is, the file name is simply used to determine what EPSG
 // is converting from.  The conversion method may be converting
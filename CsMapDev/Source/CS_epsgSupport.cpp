@@ -347,49 +347,45 @@ TcsEpsgTable::TcsEpsgTable (const TcsEpsgTblMap& tblMap,const wchar_t* databaseF
 														CodeKeyField     (epsgFldNone),
 														SortFunctor      (-1),
 														CodeIndex        (),
+														ForeignKeys      (),
 														CsvStatus        ()
 {
-	// Seems gcc 3.2.2 wifstream::open requires an 8 bit character path.  NOT NICE!!!
 	char pathBufr [1024];
-	// Set the min and max fild counts.
-	TableId = tblMap.TableId;
-	CodeKeyField = tblMap.CodeKeyFieldId;
-	SetMinFldCnt (tblMap.FieldCount);
-	SetMaxFldCnt (tblMap.FieldCount);
 
-	SortFunctor.FirstField  = GetEpsgFieldNumber (TableId,tblMap.Sort1);
-	SortFunctor.SecondField = GetEpsgFieldNumber (TableId,tblMap.Sort2);
-	SortFunctor.ThirdField  = GetEpsgFieldNumber (TableId,tblMap.Sort3);
-	SortFunctor.FourthField = GetEpsgFieldNumber (TableId,tblMap.Sort4);
-	std::wstring objName (tblMap.TableName);
-	objName += L" Table";
-	SetObjectName (objName);
-	
+	InitializeTable (tblMap);
 	std::wstring filePath (databaseFldr);
 	filePath += L"/";
 	filePath += tblMap.TableName;
 	filePath += L".csv";
 	wcstombs (pathBufr,filePath.c_str (),sizeof (pathBufr));
-	std::wifstream iStrm (pathBufr,std::ios_base::in);
-	if (iStrm.is_open ())
-	{
-		// My Linux box (CentOS 6.3) requires a locale specification in order
-		// to read the EPSG .csv files.  Windows needs two parameters to this
-		// function call; best I can tell, the C++ standard says one should
-		// be sufficient.  Anyway, the following seems to work on my systems.
-#if (_RUN_TIME < _rt_UNIXPCC)
-		std::locale epsgLocale("en_US",LC_ALL);
-#else
-		std::locale epsgLocale("en_US");
-#endif
-		iStrm.imbue(epsgLocale);		//lint !e534  ignoring return value
-		Ok = ReadFromStream (iStrm,true,CsvStatus);
-	}
+	// The tables are read through a memory mapped TcsCsvReader, which
+	// decodes UTF-8 itself (taking anything else as Latin-1), so the
+	// en_US locale previously imbued upon a wifstream is not required.
+	Ok = ReadFromFile (pathBufr,true,CsvStatus);
 	if (Ok)
 	{
 		Ok = PrepareCsvFile ();
 	}
 }
+// Constructs the table from a TcsEpsgDataSetV6 snapshot.  The snapshot
+// argument is advanced past the table.  The table in the snapshot is already
+// sorted and indexed, so there is nothing to prepare.
+TcsEpsgTable::TcsEpsgTable (const TcsEpsgTblMap& tblMap,const char*& snapshot,const char* snapshotEnd)
+															:
+														TcsCsvFileBase   (true,2,35),
+														Ok               (false),
+														Sorted           (false),
+														Indexed          (false),
+														TableId          (epsgTblNone),
+														CodeKeyField     (epsgFldNone),
+														SortFunctor      (-1),
+														CodeIndex        (),
+														ForeignKeys      (),
+														CsvStatus        ()
+{
+	InitializeTable (tblMap);
+	Ok = ReadSnapshot (snapshot,snapshotEnd);
+}
 TcsEpsgTable::TcsEpsgTable (const TcsEpsgTable& source) : TcsCsvFileBase   (source),
 														  Ok               (source.Ok),
 														  Sorted           (source.Sorted),
@@ -398,6 +394,7 @@ TcsEpsgTable::TcsEpsgTable (const TcsEpsgTable& source) : TcsCsvFileBase   (sour
 														  CodeKeyField     (source.CodeKeyField),
 														  SortFunctor      (source.SortFunctor),
 														  CodeIndex        (source.CodeIndex),
+														  ForeignKeys      (source.ForeignKeys),
 														  CsvStatus        (source.CsvStatus)
 {
 }
@@ -417,6 +414,7 @@ TcsEpsgTable& TcsEpsgTable::operator= (const TcsEpsgTable& rhs)
 		CodeKeyField     = rhs.CodeKeyField;
 		SortFunctor      = rhs.SortFunctor;
 		CodeIndex        = rhs.CodeIndex;
+		ForeignKeys      = rhs.ForeignKeys;
 		CsvStatus        = rhs.CsvStatus;
 	}
 	return *this;
@@ -434,11 +432,15 @@ unsigned TcsEpsgTable::LocateRecordByEpsgCode (const TcsEpsgCode& epsgCode) cons
 		bool found (false);
 		if (Indexed)
 		{
-		    std::map<TcsEpsgCode,unsigned>::const_iterator findItr;
-	        findItr = CodeIndex.find (epsgCode);
-			if (findItr != CodeIndex.end ())
+			TcsKeyEntry srchEntry;
+			TcsKeyIndex::const_iterator findItr;
+
+			srchEntry.Code = static_cast<ulong32_t>(static_cast<unsigned long>(epsgCode));
+			srchEntry.RecNbr = 0UL;
+			findItr = std::lower_bound (CodeIndex.begin (),CodeIndex.end (),srchEntry);
+			if (findItr != CodeIndex.end () && findItr->Code == srchEntry.Code)
 			{
-				recordNumber = findItr->second;
+				recordNumber = static_cast<unsigned>(findItr->RecNbr);
 				found = true;
 			}
 		}
@@ -516,7 +518,8 @@ bool TcsEpsgTable::EpsgLocateCode (TcsEpsgCode& epsgCode,EcsEpsgField fieldId,co
 }
 // LocateFirst functions presume the field ID is not the index field and not
 // the primary sort key.  That is, these 'LocateFirst' functions do a linear
-// search of the whole table.
+// search of the whole table; unless the field is a foreign key and the value
+// sought is an EPSG code, in which case the foreign key index is used.
 unsigned TcsEpsgTable::EpsgLocateFirst (EcsEpsgField fieldId,const wchar_t* fldValue,bool honorCase) const
 {
 	unsigned recordNumber (InvalidRecordNbr);
@@ -531,8 +534,30 @@ unsigned TcsEpsgTable::EpsgLocateFirst (EcsEpsgField fieldId,const wchar_t* fldV
 }
 unsigned TcsEpsgTable::EpsgLocateFirst (EcsEpsgField fieldId,const TcsEpsgCode& epsgCode) const
 {
-	std::wstring epsgCodeStr (epsgCode.AsWstring ());
-	unsigned recordNumber = EpsgLocateFirst (fieldId,epsgCodeStr.c_str (),false);
+	unsigned recordNumber;
+
+	// A foreign key field is indexed; the first entry for the code is the
+	// first record, in table order, which carries the code.
+	const TcsKeyIndex* keyIndex = GetForeignKeyIndex (fieldId);
+	if (keyIndex != 0 && epsgCode.IsValid ())
+	{
+		TcsKeyEntry srchEntry;
+		TcsKeyIndex::const_iterator findItr;
+
+		recordNumber = InvalidRecordNbr;
+		srchEntry.Code = static_cast<ulong32_t>(static_cast<unsigned long>(epsgCode));
+		srchEntry.RecNbr = 0UL;
+		findItr = std::lower_bound (keyIndex->begin (),keyIndex->end (),srchEntry);
+		if (findItr != keyIndex->end () && findItr->Code == srchEntry.Code)
+		{
+			recordNumber = static_cast<unsigned>(findItr->RecNbr);
+		}
+	}
+	else
+	{
+		std::wstring epsgCodeStr (epsgCode.AsWstring ());
+		recordNumber = EpsgLocateFirst (fieldId,epsgCodeStr.c_str (),false);
+	}
 	return recordNumber;
 }
 unsigned TcsEpsgTable::EpsgLocateNext (unsigned startAfter,EcsEpsgField fieldId,const wchar_t* fldValue,bool honorCase) const
@@ -554,8 +579,28 @@ unsigned TcsEpsgTable::EpsgLocateNext (unsigned startAfter,EcsEpsgField fieldId,
 }
 unsigned TcsEpsgTable::EpsgLocateNext (unsigned startAfter,EcsEpsgField fieldId,const TcsEpsgCode& epsgCode) const
 {
-	std::wstring epsgCodeStr (epsgCode.AsWstring ());
-	unsigned recordNumber = EpsgLocateNext (startAfter,fieldId,epsgCodeStr.c_str (),false);
+	unsigned recordNumber;
+
+	const TcsKeyIndex* keyIndex = GetForeignKeyIndex (fieldId);
+	if (keyIndex != 0 && epsgCode.IsValid ())
+	{
+		TcsKeyEntry srchEntry;
+		TcsKeyIndex::const_iterator findItr;
+
+		recordNumber = InvalidRecordNbr;
+		srchEntry.Code = static_cast<ulong32_t>(static_cast<unsigned long>(epsgCode));
+		srchEntry.RecNbr = static_cast<ulong32_t>(startAfter) + 1UL;
+		findItr = std::lower_bound (keyIndex->begin (),keyIndex->end (),srchEntry);
+		if (startAfter != InvalidRecordNbr && findItr != keyIndex->end () && findItr->Code == srchEntry.Code)
+		{
+			recordNumber = static_cast<unsigned>(findItr->RecNbr);
+		}
+	}
+	else
+	{
+		std::wstring epsgCodeStr (epsgCode.AsWstring ());
+		recordNumber = EpsgLocateNext (startAfter,fieldId,epsgCodeStr.c_str (),false);
+	}
 	return recordNumber;
 }
 bool TcsEpsgTable::IsDeprecated (const TcsEpsgCode& epsgCode) const
@@ -824,9 +869,27 @@ const TcsCsvStatus& TcsEpsgTable::GetCsvStatus () const
 
 //=============================================================================
 // Private Support Functions
+void TcsEpsgTable::InitializeTable (const TcsEpsgTblMap& tblMap)
+{
+	// Set the min and max fild counts.
+	TableId = tblMap.TableId;
+	CodeKeyField = tblMap.CodeKeyFieldId;
+	SetMinFldCnt (tblMap.FieldCount);
+	SetMaxFldCnt (tblMap.FieldCount);
+
+	SortFunctor.FirstField  = GetEpsgFieldNumber (TableId,tblMap.Sort1);
+	SortFunctor.SecondField = GetEpsgFieldNumber (TableId,tblMap.Sort2);
+	SortFunctor.ThirdField  = GetEpsgFieldNumber (TableId,tblMap.Sort3);
+	SortFunctor.FourthField = GetEpsgFieldNumber (TableId,tblMap.Sort4);
+	std::wstring objName (tblMap.TableName);
+	objName += L" Table";
+	SetObjectName (objName);
+}
 bool TcsEpsgTable::PrepareCsvFile ()
 {
 	bool ok (true);
+	unsigned idx;
+	EcsEpsgField fkFieldId;
 
 	if (SortFunctor.FirstField >= 0)
 	{
@@ -849,41 +912,85 @@ bool TcsEpsgTable::PrepareCsvFile ()
 		ok = BuildEpsgIndex (fieldNbr,CsvStatus);
 		Indexed = ok;
 	}
+	// Index the foreign key fields of this table.  Failure to index a foreign
+	// key is not fatal; the EpsgLocate functions simply revert to a linear
+	// search of the table.
+	ForeignKeys.clear ();
+	for (idx = 0;ok && (fkFieldId = GetEpsgForeignKeyId (TableId,idx)) != epsgFldNone;idx += 1)
+	{
+		TcsCsvStatus fkStatus;
+		ForeignKeys.push_back (std::make_pair (fkFieldId,TcsKeyIndex ()));
+		short fieldNbr = GetEpsgFieldNumber (TableId,fkFieldId);
+		if (!BuildKeyIndex (ForeignKeys.back ().second,fieldNbr,fkStatus))
+		{
+			ForeignKeys.pop_back ();
+		}
+	}
 	return ok;
 }
 bool TcsEpsgTable::BuildEpsgIndex (short fldNbr,TcsCsvStatus& csvStatus)
 {
-    bool ok = true;
-    unsigned recNbr = 0;
-    unsigned recCnt;
+	bool ok;
+	TcsKeyIndex::const_iterator itr;
 
-    std::wstring keyValue;
-    std::pair<std::map<TcsEpsgCode,unsigned>::iterator,bool> idxStatus; 
+	ok = BuildKeyIndex (CodeIndex,fldNbr,csvStatus);
+	if (ok)
+	{
+		// The index is sorted, so duplicates of the supposedly unique code
+		// are adjacent.
+		for (itr = CodeIndex.begin ();itr != CodeIndex.end ();++itr)
+		{
+			if ((itr + 1) != CodeIndex.end () && (itr + 1)->Code == itr->Code)
+			{
+				std::wstring fieldLbl;
+				TcsCsvFileBase::GetFieldLabel (fieldLbl,fldNbr);	//lint !e534  (ignoring return value)
 
-    CodeIndex.clear ();
-    recCnt = RecordCount ();
-    for (recNbr = 0;recNbr < recCnt;++recNbr)
-    {
+				csvStatus.SetStatus (csvDupIndex);
+				csvStatus.SetFieldNbr (fldNbr);
+				csvStatus.SetFieldId (fieldLbl);
+				csvStatus.SetLineNbr ((itr + 1)->RecNbr + FirstIsLabels);
+				ok = false;
+				break;
+			}
+		}
+	}
+	if (!ok)
+	{
+		// If the index didn't get created successfully, we clear it to
+		// release any resources it may have consumed.
+		CodeIndex.clear ();
+	}
+	return ok;
+}
+// Builds a sorted array of (code, record number) pairs for the indicated
+// field.  Records for which the field does not carry a valid code are not
+// indexed; an invalid code is never sought by way of an index.
+bool TcsEpsgTable::BuildKeyIndex (TcsKeyIndex& keyIndex,short fldNbr,TcsCsvStatus& csvStatus)
+{
+	bool ok = true;
+	unsigned recNbr = 0;
+	unsigned recCnt;
+	TcsKeyEntry keyEntry;
+	std::wstring keyValue;
+
+	keyIndex.clear ();
+	recCnt = RecordCount ();
+	keyIndex.reserve (recCnt);
+	for (recNbr = 0;ok && recNbr < recCnt;++recNbr)
+	{
 		ok = TcsCsvFileBase::GetField (keyValue,recNbr,fldNbr,csvStatus);
 		if (ok)
 		{
 			TcsEpsgCode recCode (keyValue);
-            idxStatus = CodeIndex.insert (std::make_pair (recCode,recNbr));
-            ok = idxStatus.second;
-            if (!ok)
-            {
-                std::wstring fieldLbl;
-                TcsCsvFileBase::GetFieldLabel (fieldLbl,fldNbr);	//lint !e534  (ignoring return value)
-
-                csvStatus.SetStatus (csvDupIndex);
-                csvStatus.SetFieldNbr (fldNbr);
-                csvStatus.SetFieldId (fieldLbl);
-                csvStatus.SetLineNbr (recNbr + FirstIsLabels);
-                break;
-            }
-        }
-        else
-        {
+			if (recCode.IsValid ())
+			{
+				keyEntry.Code = static_cast<ulong32_t>(static_cast<unsigned long>(recCode));
+				keyEntry.RecNbr = static_cast<ulong32_t>(recNbr);
+				keyIndex.push_back (keyEntry);
+			}
+		}
+		else
+		{
 			std::wstring fieldLbl;
 			TcsCsvFileBase::GetFieldLabel (fieldLbl,fldNbr);	//lint !e534  (ignoring return value)
 
@@ -891,15 +998,239 @@ bool TcsEpsgTable::BuildEpsgIndex (short fldNbr,TcsCsvStatus& csvStatus)
 			csvStatus.SetFieldNbr (fldNbr);
 			csvStatus.SetFieldId (fieldLbl);
 			csvStatus.SetLineNbr (recNbr + FirstIsLabels);
-        }
-    }
-    if (!ok)
-    {
-		// If the index didn't get created successfully, we clear it to
-		// release any resources it may have consumed.
-		CodeIndex.clear ();
-    }
-    return ok;
+		}
+	}
+	if (ok)
+	{
+		// Usually, the table is already sorted by this field, in which case
+		// this costs very little.
+		std::sort (keyIndex.begin (),keyIndex.end ());
+	}
+	else
+	{
+		keyIndex.clear ();
+	}
+	return ok;
+}
+const TcsEpsgTable::TcsKeyIndex* TcsEpsgTable::GetForeignKeyIndex (EcsEpsgField fieldId) const
+{
+	const TcsKeyIndex* keyIndex (0);
+	std::vector<std::pair<EcsEpsgField,TcsKeyIndex> >::const_iterator itr;
+
+	for (itr = ForeignKeys.begin ();itr != ForeignKeys.end ();++itr)
+	{
+		if (itr->first == fieldId)
+		{
+			keyIndex = &itr->second;
+			break;
+		}
+	}
+	return keyIndex;
+}
+//=============================================================================
+// Snapshot Support
+//
+// A snapshot is written in the native form of the host which writes it; it is
+// a cache, not an interchange format.  All values are 32 bit unsigned
+// integers.  Strings are written as a length (in wchar_t's) followed by the
+// characters, padded to a multiple of four bytes.  The reading functions
+// check every value against the end of the snapshot, so that a truncated or
+// otherwise corrupted snapshot is simply rejected.
+static bool CSepsgPutULong (csFILE* outStrm,ulong32_t value)
+{
+	return (CS_fwrite (&value,sizeof (value),1,outStrm) == 1);
+}
+static bool CSepsgPutString (csFILE* outStrm,const std::wstring& value)
+{
+	static const char padding [4] = { '\0', '\0', '\0', '\0' };
+
+	bool ok;
+	size_t byteCount;
+
+	byteCount = value.length () * sizeof (wchar_t);
+	ok = CSepsgPutULong (outStrm,static_cast<ulong32_t>(value.length ()));
+	if (ok && byteCount > 0)
+	{
+		ok = (CS_fwrite (value.data (),1,byteCount,outStrm) == byteCount);
+	}
+	if (ok && (byteCount & 3) != 0)
+	{
+		ok = (CS_fwrite (padding,1,4 - (byteCount & 3),outStrm) == 4 - (byteCount & 3));
+	}
+	return ok;
+}
+static bool CSepsgGetULong (ulong32_t& value,const char*& snapshot,const char* snapshotEnd)
+{
+	bool ok;
+
+	ok = (static_cast<size_t>(snapshotEnd - snapshot) >= sizeof (value));
+	if (ok)
+	{
+		memcpy (&value,snapshot,sizeof (value));
+		snapshot += sizeof (value);
+	}
+	return ok;
+}
+static bool CSepsgGetString (std::wstring& value,const char*& snapshot,const char* snapshotEnd)
+{
+	bool ok;
+	size_t byteCount;
+	ulong32_t length;
+
+	ok = CSepsgGetULong (length,snapshot,snapshotEnd);
+	if (ok)
+	{
+		byteCount = static_cast<size_t>(length) * sizeof (wchar_t);
+		byteCount = (byteCount + 3) & ~static_cast<size_t>(3);
+		ok = (static_cast<size_t>(snapshotEnd - snapshot) >= byteCount);
+	}
+	if (ok)
+	{
+		value.resize (length);
+		if (length > 0)
+		{
+			memcpy (&value [0],snapshot,static_cast<size_t>(length) * sizeof (wchar_t));
+		}
+		snapshot += byteCount;
+	}
+	return ok;
+}
+bool TcsEpsgTable::WriteSnapshot (csFILE* outStrm) const
+{
+	bool ok;
+	short fldNbr;
+	short fldCnt;
+	unsigned recNbr;
+	unsigned recCnt;
+	std::wstring field;
+	TcsCsvStatus status;
+	TcsKeyIndex::const_iterator keyItr;
+	std::vector<std::pair<EcsEpsgField,TcsKeyIndex> >::const_iterator fkItr;
+
+	const TcsCsvRecord& labels = GetAllLabels ();
+	fldCnt = labels.FieldCount ();
+	recCnt = RecordCount ();
+	ok  = CSepsgPutULong (outStrm,static_cast<ulong32_t>(TableId));
+	ok &= CSepsgPutULong (outStrm,static_cast<ulong32_t>(fldCnt));
+	ok &= CSepsgPutULong (outStrm,static_cast<ulong32_t>(recCnt));
+	for (fldNbr = 0;ok && fldNbr < fldCnt;fldNbr += 1)
+	{
+		ok = labels.GetField (field,fldNbr,status);
+		ok = ok && CSepsgPutString (outStrm,field);
+	}
+	for (recNbr = 0;ok && recNbr < recCnt;recNbr += 1)
+	{
+		const TcsCsvRecord& record = GetRecord (recNbr);
+		fldCnt = record.FieldCount ();
+		ok = CSepsgPutULong (outStrm,static_cast<ulong32_t>(fldCnt));
+		for (fldNbr = 0;ok && fldNbr < fldCnt;fldNbr += 1)
+		{
+			ok = record.GetField (field,fldNbr,status);
+			ok = ok && CSepsgPutString (outStrm,field);
+		}
+	}
+
+	// The indices follow, so that they need not be rebuilt when the snapshot
+	// is loaded.  An empty code index indicates an unindexed table.
+	ok = ok && CSepsgPutULong (outStrm,static_cast<ulong32_t>(Indexed ? CodeIndex.size () : 0));
+	for (keyItr = CodeIndex.begin ();ok && Indexed && keyItr != CodeIndex.end ();++keyItr)
+	{
+		ok  = CSepsgPutULong (outStrm,keyItr->Code);
+		ok &= CSepsgPutULong (outStrm,keyItr->RecNbr);
+	}
+	ok = ok && CSepsgPutULong (outStrm,static_cast<ulong32_t>(ForeignKeys.size ()));
+	for (fkItr = ForeignKeys.begin ();ok && fkItr != ForeignKeys.end ();++fkItr)
+	{
+		ok  = CSepsgPutULong (outStrm,static_cast<ulong32_t>(fkItr->first));
+		ok &= CSepsgPutULong (outStrm,static_cast<ulong32_t>(fkItr->second.size ()));
+		for (keyItr = fkItr->second.begin ();ok && keyItr != fkItr->second.end ();++keyItr)
+		{
+			ok  = CSepsgPutULong (outStrm,keyItr->Code);
+			ok &= CSepsgPutULong (outStrm,keyItr->RecNbr);
+		}
+	}
+	return ok;
+}
+bool TcsEpsgTable::ReadSnapshot (const char*& snapshot,const char* snapshotEnd)
+{
+	bool ok;
+	ulong32_t idx;
+	ulong32_t fldIdx;
+	ulong32_t value;
+	ulong32_t fldCnt;
+	ulong32_t recCnt;
+	ulong32_t keyCnt;
+	ulong32_t fkCnt;
+	TcsKeyEntry keyEntry;
+	std::wstring field;
+	TcsCsvRecord record;
+
+	ok  = CSepsgGetULong (value,snapshot,snapshotEnd) && (value == static_cast<ulong32_t>(TableId));
+	ok = ok && CSepsgGetULong (fldCnt,snapshot,snapshotEnd);
+	ok = ok && CSepsgGetULong (recCnt,snapshot,snapshotEnd);
+	if (ok)
+	{
+		ok = (fldCnt <= 300UL) && (recCnt <= static_cast<ulong32_t>(snapshotEnd - snapshot) / 4);
+	}
+	for (fldIdx = 0;ok && fldIdx < fldCnt;fldIdx += 1)
+	{
+		ok  = CSepsgGetString (field,snapshot,snapshotEnd);
+		ok = ok && record.AppendField (field,CsvStatus);
+	}
+	if (ok)
+	{
+		SetAllLabels (record);
+	}
+	for (idx = 0;ok && idx < recCnt;idx += 1)
+	{
+		record.Clear ();
+		ok = CSepsgGetULong (fldCnt,snapshot,snapshotEnd) && (fldCnt <= 300UL);
+		for (fldIdx = 0;ok && fldIdx < fldCnt;fldIdx += 1)
+		{
+			ok  = CSepsgGetString (field,snapshot,snapshotEnd);
+			ok = ok && record.AppendField (field,CsvStatus);
+		}
+		ok = ok && AppendRecord (record,CsvStatus);
+	}
+
+	ok = ok && CSepsgGetULong (keyCnt,snapshot,snapshotEnd);
+	ok = ok && (keyCnt <= recCnt);
+	for (idx = 0;ok && idx < keyCnt;idx += 1)
+	{
+		ok  = CSepsgGetULong (keyEntry.Code,snapshot,snapshotEnd);
+		ok = ok && CSepsgGetULong (keyEntry.RecNbr,snapshot,snapshotEnd);
+		ok = ok && (keyEntry.RecNbr < recCnt);
+		if (ok)
+		{
+			CodeIndex.push_back (keyEntry);
+		}
+	}
+	Indexed = ok && (keyCnt > 0);
+	Sorted = ok && (SortFunctor.FirstField >= 0);
+
+	ok = ok && CSepsgGetULong (fkCnt,snapshot,snapshotEnd);
+	for (idx = 0;ok && idx < fkCnt;idx += 1)
+	{
+		ok  = CSepsgGetULong (value,snapshot,snapshotEnd);
+		ok = ok && CSepsgGetULong (keyCnt,snapshot,snapshotEnd);
+		ok = ok && (keyCnt <= recCnt);
+		if (ok)
+		{
+			ForeignKeys.push_back (std::make_pair (static_cast<EcsEpsgField>(value),TcsKeyIndex ()));
+			ForeignKeys.back ().second.reserve (keyCnt);
+		}
+		for (fldIdx = 0;ok && fldIdx < keyCnt;fldIdx += 1)
+		{
+			ok  = CSepsgGetULong (keyEntry.Code,snapshot,snapshotEnd);
+			ok = ok && CSepsgGetULong (keyEntry.RecNbr,snapshot,snapshotEnd);
+			ok = ok && (keyEntry.RecNbr < recCnt);
+			if (ok)
+			{
+				ForeignKeys.back ().second.push_back (keyEntry);
+			}
+		}
+	}
+	return ok;
 }
 //newPage//
 //=============================================================================
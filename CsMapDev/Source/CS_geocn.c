@@ -1255,12 +1255,48 @@ double CStestGeoconFile (struct cs_GeoconFile_* thisPtr,Const double *sourceLL)
 	return density;
 }
 int CScalcGeoconFile (struct cs_GeoconFile_* thisPtr,double *result,Const double* sourceLL)
+{
+	extern double cs_Huge;
+
+	int status;
+	double delta [2];
+	double nodes [1][9];
+
+	/* Prepare for an error.  In the case of an error, we return an obnoxious
+	   value which will clearly indicate something is wrong.  We do this in
+	   case the calling module fails to properly detect or handle the error
+	   condition which we may have to return. */
+	*result = cs_Huge;
+
+	/* Extract the 3x3 matrix of grid values appropriate for this point, and
+	   then use the shared biquadratic kernel to do the interpolation. */
+	status = CSgatherGeoconFile (thisPtr,nodes [0],delta,sourceLL);
+	if (status == csGRIDI_ST_OK)
+	{
+		CSbiquadInterp (result,&delta [0],&delta [1],nodes,1);
+	}
+	return status;
+}
+int CScalcGeoconFileN (struct cs_GeoconFile_* thisPtr,double results [],int status [],
+																		Const double sourceLL [][3],
+																		int count)
+{
+	extern double cs_Huge;
+
+	/* Batch version of CScalcGeoconFile. */
+	return CSbiquadBatch (thisPtr,CSgatherGeoconFile,results,status,sourceLL,count,cs_Huge);
+}
+/* This is the csGatherBiquadFunc for GEOCON files.  It locates the 3x3 grid
+   cell appropriate for the given point (fetching it from the grid file only
+   if necessary) and returns the nine grid values and the position of the
+   point relative to the southwest value of the nine. */
+int CSgatherGeoconFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL)
 {
 	extern double cs_Half;
 	extern double cs_LlNoise;			/* 1.0E-12 */
-	extern double cs_Huge;
 
 	int status;
+	struct cs_GeoconFile_* thisPtr;
 
 	long32_t eleNbr;
 	long32_t recNbr;
@@ -1272,11 +1308,7 @@ int CScalcGeoconFile (struct cs_GeoconFile_* thisPtr,double *result,Const double
 
 	struct csGeocnGridCell_ myEdgeGridCell;
 
-	/* Prepare for an error.  In the case of an error, we return an obnoxious
-	   value which will clearly indicate something is wrong.  We do this in
-	   case the calling module fails to properly detect or handle the error
-	   condition which we may have to return. */
-	*result = cs_Huge;
+	thisPtr = (struct cs_GeoconFile_*)gridFile;
 
 	/* Until we know differently, we assume the normal case of the data point
 	   being in the middle of the grid somewhere. */
@@ -1492,7 +1524,7 @@ int CScalcGeoconFile (struct cs_GeoconFile_* thisPtr,double *result,Const double
 				thisPtr->gridCell.lngIdx == eleNbr &&
 				thisPtr->gridCell.latIdx == recNbr)
 			{
-				*result = CScalcGeocnGridCell (&thisPtr->gridCell,sourceLL);
+				CSgatherGeocnGridCell (&thisPtr->gridCell,nodes,delta,sourceLL);
 			}
 			else
 			{
@@ -1501,7 +1533,7 @@ int CScalcGeoconFile (struct cs_GeoconFile_* thisPtr,double *result,Const double
 				status = CSextractGeoconGridFile (&thisPtr->gridCell,thisPtr,eleNbr,recNbr);
 				if (status == csGRIDI_ST_OK && thisPtr->gridCell.isValid)	/* redundant */
 				{
-					*result = CScalcGeocnGridCell (&thisPtr->gridCell,sourceLL);
+					CSgatherGeocnGridCell (&thisPtr->gridCell,nodes,delta,sourceLL);
 				}
 			}
 		}
@@ -1513,7 +1545,7 @@ int CScalcGeoconFile (struct cs_GeoconFile_* thisPtr,double *result,Const double
 			status = CSedgeGeocnGridCell (&myEdgeGridCell,thisPtr,eleNbr,recNbr,edge);
 			if (status == csGRIDI_ST_OK)
 			{
-				*result = CScalcGeocnGridCell (&myEdgeGridCell,sourceLL);
+				CSgatherGeocnGridCell (&myEdgeGridCell,nodes,delta,sourceLL);
 			}
 		}
 	}
@@ -2099,16 +2131,15 @@ void CSinitGeocnGridCell (struct csGeocnGridCell_* thisPtr)
 /* The following function assumes that the provided longitude has already
    been adjusted to the range convention of GEOCON data files. */
 /*lint -esym(752,cs_Half,cs_Huge)   used only on debug builds */
-double CScalcGeocnGridCell (struct csGeocnGridCell_* thisPtr,Const double *sourceLL)
+void CSgatherGeocnGridCell (struct csGeocnGridCell_* thisPtr,double nodes [9],double delta [2],
+																  Const double *sourceLL)
 {
 	extern double cs_Half;
 	extern double cs_Huge;
 	extern char csErrnam [MAXPATH];
 
-	double rtnValue;
-
-	double sourceDelta [2];
-	double rowData [3];
+	int row;
+	int col;
 
 	/* source Delta is actually the distance of the query point from the the
 	   implied location of the center point of the grid cell, normalized for
@@ -2120,83 +2151,116 @@ double CScalcGeocnGridCell (struct csGeocnGridCell_* thisPtr,Const double *sourc
 	   point to the query point in units of the grid cell width,  Grid cell
 	   width in this case (i.e. geocon data files o 2012) is always minutes
 	   of arc. */
-	sourceDelta [LNG] = (sourceLL [LNG] - thisPtr->swLng) / thisPtr->deltaLng;
-	sourceDelta [LAT] = (sourceLL [LAT] - thisPtr->swLat) / thisPtr->deltaLat;
+	delta [LNG] = (sourceLL [LNG] - thisPtr->swLng) / thisPtr->deltaLng;
+	delta [LAT] = (sourceLL [LAT] - thisPtr->swLat) / thisPtr->deltaLat;
 
 #ifdef _DEBUG
 	/* The absolute value of these values should be greater or equal to 0.5
 	   and less than 1.5 as the grid cell selection algorithm attempts to
 	   enhance the effectivness of this algorithm by "moving" the grid.
 	   See lines 690 thru 698 in the geocon.f code (circa August 2012). */
-	if ((sourceDelta [LNG] <= cs_Half || sourceDelta [LNG] > 1.5) ||
-		(sourceDelta [LAT] <= cs_Half || sourceDelta [LAT] > 1.5))
+	if ((delta [LNG] <= cs_Half || delta [LNG] > 1.5) ||
+		(delta [LAT] <= cs_Half || delta [LAT] > 1.5))
 	{
 		CS_stncp (csErrnam,"CS_geocn.c:8",sizeof (csErrnam));
 		CS_erpt (cs_ISER);
-		rtnValue = cs_Huge;
-		return rtnValue;
+		for (col = 0;col < 9;col += 1) nodes [col] = cs_Huge;
+		return;
 	}
 #endif
 
+	/* The edge cases are expressed as a 3x3 matrix in which the values
+	   which are not available are replicated from those that are.  The
+	   biquadratic interpolation of such a matrix reduces, exactly, to the
+	   linear/constant calculation appropriate for the edge condition.  Thus,
+	   all cases are handled by the same kernel. */
 	switch (thisPtr->edge) {
 	
 	default:
 	case geocnEdgeUnknown:
 		CS_stncp (csErrnam,"CS_geocn:9",sizeof (csErrnam));
 		CS_erpt (cs_ISER);
-		rtnValue = csGEOCON_SHIFT_ERROR;
+		for (col = 0;col < 9;col += 1) nodes [col] = csGEOCON_SHIFT_ERROR;
 		break;
 
 	case geocnEdgeNone:
 		/* This is the normal case.  Our design has (hopefully) made this case
 		   perform very well. */
-		rowData [0] = CSgeocnQterpOne (sourceDelta [0],thisPtr->cellData [0]);
-		rowData [1] = CSgeocnQterpOne (sourceDelta [0],thisPtr->cellData [1]);
-		rowData [2] = CSgeocnQterpOne (sourceDelta [0],thisPtr->cellData [2]);
-		rtnValue = CSgeocnQterpOne (sourceDelta [1],rowData);
+		for (row = 0;row < 3;row += 1)
+		{
+			for (col = 0;col < 3;col += 1)
+			{
+				nodes [row * 3 + col] = thisPtr->cellData [row][col];
+			}
+		}
 		break;
 	
 	case geocnEdgeSouthwest:
 		/* The corners are easy due to the way edge cells are setup. */
-		rtnValue = thisPtr->cellData [0][0];
+		for (col = 0;col < 9;col += 1) nodes [col] = thisPtr->cellData [0][0];
 		break;
 	case geocnEdgeSoutheast:
-		/* The corners are easy due to the way edge cells are setup. */
-		rtnValue = thisPtr->cellData [0][2];
+		for (col = 0;col < 9;col += 1) nodes [col] = thisPtr->cellData [0][2];
 		break;
 	case geocnEdgeNortheast:
-		/* The corners are easy due to the way edge cells are setup. */
-		rtnValue = thisPtr->cellData [2][2];
+		for (col = 0;col < 9;col += 1) nodes [col] = thisPtr->cellData [2][2];
 		break;
 	case geocnEdgeNorthwest:
-		/* The corners are easy due to the way edge cells are setup. */
-		rtnValue = thisPtr->cellData [2][0];
+		for (col = 0;col < 9;col += 1) nodes [col] = thisPtr->cellData [2][0];
 		break;
 
 	case geocnEdgeSouth:
-		/* Interpolate bwetween the three values in center row. */
-		rtnValue = CSgeocnQterpOne (sourceDelta [0],thisPtr->cellData [0]);
+		/* Interpolate between the three values in the southern row. */
+		for (row = 0;row < 3;row += 1)
+		{
+			for (col = 0;col < 3;col += 1)
+			{
+				nodes [row * 3 + col] = thisPtr->cellData [0][col];
+			}
+		}
 		break;
 	case geocnEdgeNorth:
-		/* Interpolate bwetween the three values in center row. */
-		rtnValue = CSgeocnQterpOne (sourceDelta [0],thisPtr->cellData [2]);
+		/* Interpolate between the three values in the northern row. */
+		for (row = 0;row < 3;row += 1)
+		{
+			for (col = 0;col < 3;col += 1)
+			{
+				nodes [row * 3 + col] = thisPtr->cellData [2][col];
+			}
+		}
 		break;
 		
 	case geocnEdgeEast:
-		/* Interpolate between the values in the center column. */
-		rowData [0] = thisPtr->cellData [0][2];
-		rowData [1] = thisPtr->cellData [1][2];
-		rowData [2] = thisPtr->cellData [2][2];
-		rtnValue = CSgeocnQterpOne (sourceDelta [1],rowData);
+		/* Interpolate between the values in the eastern column. */
+		for (row = 0;row < 3;row += 1)
+		{
+			for (col = 0;col < 3;col += 1)
+			{
+				nodes [row * 3 + col] = thisPtr->cellData [row][2];
+			}
+		}
 		break;
 	case geocnEdgeWest:
-		/* Interpolate between the values in the center column. */
-		rowData [0] = thisPtr->cellData [0][0];
-		rowData [1] = thisPtr->cellData [1][0];
-		rowData [2] = thisPtr->cellData [2][0];
-		rtnValue = CSgeocnQterpOne (sourceDelta [1],rowData);
+		/* Interpolate between the values in the western column. */
+		for (row = 0;row < 3;row += 1)
+		{
+			for (col = 0;col < 3;col += 1)
+			{
+				nodes [row * 3 + col] = thisPtr->cellData [row][0];
+			}
+		}
 		break;
 	}
+	return;
+}
+double CScalcGeocnGridCell (struct csGeocnGridCell_* thisPtr,Const double *sourceLL)
+{
+	double rtnValue;
+	double delta [2];
+	double nodes [1][9];
+
+	CSgatherGeocnGridCell (thisPtr,nodes [0],delta,sourceLL);
+	CSbiquadInterp (&rtnValue,&delta [0],&delta [1],nodes,1);
 	return rtnValue;
 }
 /*lint +esym(752,cs_Half,cs_Huge) */
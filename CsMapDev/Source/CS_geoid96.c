@@ -292,9 +292,38 @@ double CStestGeoid96GridFile (struct csGeoid96GridFile_* __This,Const double *so
 */
 /*lint -e826  disable message on fltPtr = (float *)(chrPtr) used extensively here */
 int CScalcGeoid96GridFile (struct csGeoid96GridFile_* __This,double* result,Const double* sourceLL)
+{
+	int status;
+	double delta [2];
+	double nodes [1][9];
+
+	/* Extract the 3x3 matrix of grid values appropriate for this point, and
+	   then use the shared biquadratic kernel to do the interpolation. */
+	status = CSgatherGeoid96GridFile (__This,nodes [0],delta,sourceLL);
+	if (status == 0)
+	{
+		CSbiquadInterp (result,&delta [0],&delta [1],nodes,1);
+	}
+	return status;
+}
+int CScalcGeoid96GridFileN (struct csGeoid96GridFile_* __This,double results [],int status [],
+																		  Const double sourceLL [][3],
+																		  int count)
+{
+	extern double cs_Mhuge;
+
+	/* Batch version of CScalcGeoid96GridFile. */
+	return CSbiquadBatch (__This,CSgatherGeoid96GridFile,results,status,sourceLL,count,cs_Mhuge);
+}
+/* This is the csGatherBiquadFunc for Geoid96 files.  Returns zero if the
+   3x3 matrix was extracted successfully, -1 in the event of a system error. */
+int CSgatherGeoid96GridFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL)
 {
 	extern double cs_One;
 
+	int idx;
+	struct csGeoid96GridFile_* __This;
+
 	int eleNbr;
 	int recNbr;
 	int readCount;
@@ -333,6 +362,7 @@ int CScalcGeoid96GridFile (struct csGeoid96GridFile_* __This,double* result,Cons
 						edgeWest
 					 } edge;
 	edge = edgeNone;
+	__This = (struct csGeoid96GridFile_*)gridFile;
 
 	/* We are not supposed to get here unless the sourceLL is within the coverage of the
 	   file object.  We make sure of that now.  This makes life much easier below.  Use the
@@ -701,8 +731,13 @@ int CScalcGeoid96GridFile (struct csGeoid96GridFile_* __This,double* result,Cons
 	/* Swap bytes as appropriate. */
 	CS_bswap (array,"fffffffff");
 
-	/* Do the calculations. */
-	*result = CSgeoidQterp (deltaLL,array);
+	/* Return the results to the caller. */
+	for (idx = 0;idx < 9;idx += 1)
+	{
+		nodes [idx] = (double)array [idx];
+	}
+	delta [LNG] = deltaLL [LNG];
+	delta [LAT] = deltaLL [LAT];
 	return 0;
 
 error:
@@ -322,9 +322,38 @@ double CStestGeoid99GridFile (struct csGeoid99GridFile_* __This,Const double *so
 */
 /*lint -e826  disable message on fltPtr = (float *)(chrPtr) used extensively here */
 int CScalcGeoid99GridFile (struct csGeoid99GridFile_* __This,double* result,Const double* sourceLL)
+{
+	int status;
+	double delta [2];
+	double nodes [1][9];
+
+	/* Extract the 3x3 matrix of grid values appropriate for this point, and
+	   then use the shared biquadratic kernel to do the interpolation. */
+	status = CSgatherGeoid99GridFile (__This,nodes [0],delta,sourceLL);
+	if (status == 0)
+	{
+		CSbiquadInterp (result,&delta [0],&delta [1],nodes,1);
+	}
+	return status;
+}
+int CScalcGeoid99GridFileN (struct csGeoid99GridFile_* __This,double results [],int status [],
+																		  Const double sourceLL [][3],
+																		  int count)
+{
+	extern double cs_Mhuge;
+
+	/* Batch version of CScalcGeoid99GridFile. */
+	return CSbiquadBatch (__This,CSgatherGeoid99GridFile,results,status,sourceLL,count,cs_Mhuge);
+}
+/* This is the csGatherBiquadFunc for Geoid99 files.  Returns zero if the
+   3x3 matrix was extracted successfully, -1 in the event of a system error. */
+int CSgatherGeoid99GridFile (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL)
 {
 	extern double cs_One;
 
+	int idx;
+	struct csGeoid99GridFile_* __This;
+
 	int eleNbr;
 	int recNbr;
 	int readCount;
@@ -366,6 +395,7 @@ int CScalcGeoid99GridFile (struct csGeoid99GridFile_* __This,double* result,Cons
 						edgeWest
 					 } edge;
 	edge = edgeNone;
+	__This = (struct csGeoid99GridFile_*)gridFile;
 
 	/* We are not supposed to get here unless the sourceLL is within the coverage of the
 	   file object.  We make sure of that now.  This makes life much easier below.  Use the
@@ -755,8 +785,13 @@ int CScalcGeoid99GridFile (struct csGeoid99GridFile_* __This,double* result,Cons
 		break;
 	}
 
-	/* Do the calculations. */
-	*result = CSgeoidQterp (deltaLL,array);
+	/* Return the results to the caller. */
+	for (idx = 0;idx < 9;idx += 1)
+	{
+		nodes [idx] = (double)array [idx];
+	}
+	delta [LNG] = deltaLL [LNG];
+	delta [LAT] = deltaLL [LAT];
 	return 0;
 
 error:
@@ -770,13 +805,15 @@ error:
 
 double EXP_LVL9 CSgeoidQterp (double sourceDelta [2],float array [9])
 {
+	int idx;
 	double result;
-	double f0, f1, f2;
+	double nodes [1][9];
 
-	f0 = CSgeoidQterp1 (sourceDelta [0],(double)array [0],(double)array [1],(double)array [2]);
-	f1 = CSgeoidQterp1 (sourceDelta [0],(double)array [3],(double)array [4],(double)array [5]);
-	f2 = CSgeoidQterp1 (sourceDelta [0],(double)array [6],(double)array [7],(double)array [8]);
-	result = CSgeoidQterp1 (sourceDelta [1],f0,f1,f2);
+	for (idx = 0;idx < 9;idx += 1)
+	{
+		nodes [0][idx] = (double)array [idx];
+	}
+	CSbiquadInterp (&result,&sourceDelta [0],&sourceDelta [1],nodes,1);
 	return result;
 }
 double EXP_LVL9 CSgeoidQterp1 (double delta,double f0,double f1,double f2)
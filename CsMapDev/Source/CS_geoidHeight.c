@@ -67,6 +67,94 @@ int EXP_LVL1 CS_geoidHgt (Const double ll84 [2],double *height)
 	}
 	return status;
 }
+/* Batch version of CS_geoidHgt.  Computes the geoid height for count
+   points, placing the results in the height array.  If not NULL, the status
+   array receives the status of each individual point, using the same
+   convention as CS_geoidHgt.  The return value is the most severe of the
+   individual status values.  Large batches which are not already in some
+   sort of geographic order are processed in locality order (see
+   CSlocalityOrder), the results being returned in the original order. */
+int EXP_LVL1 CS_geoidHgtN (Const double ll84 [][3],double height [],int status [],int count)
+{
+	extern double cs_Mhuge;				/* -1.0E+32  */
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern struct csGeoidHeight_ *csGeoidHeight;
+
+	int idx;
+	int ordered;
+	int rtnStatus = -1;
+	int *order;
+	int *srtStatus;
+	double *srtHeight;
+	double (*srtLL)[3];
+
+	for (idx = 0;idx < count;idx += 1)
+	{
+		height [idx] = cs_Mhuge;
+		if (status != NULL) status [idx] = -1;
+	}
+	if (csGeoidHeight == NULL)
+	{
+		CS_stcpy (cs_DirP,cs_GEOID_NAME);
+		csGeoidHeight = CSnewGeoidHeight (cs_Dir);
+	}
+	if (csGeoidHeight == NULL)
+	{
+		return rtnStatus;
+	}
+
+	order = NULL;
+	ordered = 0;
+	if (count > 1)
+	{
+		order = (int *)CS_malc (sizeof (int) * (size_t)count);
+		if (order == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			return rtnStatus;
+		}
+		ordered = CSlocalityOrder (order,ll84,count);
+	}
+	if (ordered > 0)
+	{
+		/* Process a sorted copy of the batch, then scatter the results back
+		   to the original order. */
+		srtLL = (double (*)[3])CS_malc (sizeof (double [3]) * (size_t)count);
+		srtHeight = (double *)CS_malc (sizeof (double) * (size_t)count);
+		srtStatus = (int *)CS_malc (sizeof (int) * (size_t)count);
+		if (srtLL == NULL || srtHeight == NULL || srtStatus == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+		}
+		else
+		{
+			for (idx = 0;idx < count;idx += 1)
+			{
+				srtLL [idx][LNG] = ll84 [order [idx]][LNG];
+				srtLL [idx][LAT] = ll84 [order [idx]][LAT];
+				srtLL [idx][HGT] = ll84 [order [idx]][HGT];
+				srtHeight [idx] = cs_Mhuge;
+				srtStatus [idx] = -1;
+			}
+			rtnStatus = CScalcGeoidHeightN (csGeoidHeight,srtHeight,srtStatus,(Const double (*)[3])srtLL,count);
+			for (idx = 0;idx < count;idx += 1)
+			{
+				height [order [idx]] = srtHeight [idx];
+				if (status != NULL) status [order [idx]] = srtStatus [idx];
+			}
+		}
+		if (srtLL != NULL) CS_free (srtLL);
+		if (srtHeight != NULL) CS_free (srtHeight);
+		if (srtStatus != NULL) CS_free (srtStatus);
+	}
+	else if (ordered == 0)
+	{
+		rtnStatus = CScalcGeoidHeightN (csGeoidHeight,height,status,ll84,count);
+	}
+	if (order != NULL) CS_free (order);
+	return rtnStatus;
+}
 void EXP_LVL1 CS_geoidCls (void)
 {
 	extern struct csGeoidHeight_ *csGeoidHeight;
@@ -249,6 +337,77 @@ int CScalcGeoidHeight (struct csGeoidHeight_* __This,double* geoidHgt,Const doub
 	return status;
 }
 
+/******************************************************************************
+	Calculate the Geoid height of an array of points.  Consecutive points which
+	select the same entry are passed to that entry as a single batch, so that
+	the grid interpolation kernels see as many points as possible at a time.
+	A negative status terminates the batch; the failed point and all remaining
+	points receive that status.
+*/
+int CScalcGeoidHeightN (struct csGeoidHeight_* __This,double geoidHgt [],int status [],
+																		Const double ll84 [][3],
+																		int count)
+{
+	int idx;
+	int runEnd;
+	int runStatus;
+	int rtnStatus;
+	struct csGeoidHeightEntry_* ghEntryPtr;
+	struct csGeoidHeightEntry_* nextEntryPtr;
+
+	if (__This == NULL)
+	{
+		CS_erpt (cs_GEOID_INIT);
+		if (status != NULL)
+		{
+			for (idx = 0;idx < count;idx += 1) status [idx] = -1;
+		}
+		return -1;
+	}
+
+	rtnStatus = 0;
+	nextEntryPtr = (count > 0) ? CSselectGeoidHeight (__This,ll84 [0]) : NULL;
+	for (idx = 0;idx < count;idx = runEnd)
+	{
+		/* Determine the extent of the run of points which use the same
+		   entry as the first point of the run. */
+		ghEntryPtr = nextEntryPtr;
+		nextEntryPtr = NULL;
+		for (runEnd = idx + 1;runEnd < count;runEnd += 1)
+		{
+			nextEntryPtr = CSselectGeoidHeight (__This,ll84 [runEnd]);
+			if (nextEntryPtr != ghEntryPtr) break;
+		}
+
+		if (ghEntryPtr != NULL)
+		{
+			runStatus = CScalcGeoidHeightEntryN (ghEntryPtr,&geoidHgt [idx],
+												 (status != NULL) ? &status [idx] : NULL,
+												 &ll84 [idx],runEnd - idx);
+			if (runStatus < 0)
+			{
+				if (status != NULL)
+				{
+					for (idx = runEnd;idx < count;idx += 1) status [idx] = runStatus;
+				}
+				return runStatus;
+			}
+		}
+		else
+		{
+			/* We didn't find any coverage.  Use the fall back position.
+			   Return a +1 to indicate an approximation. */
+			runStatus = 1;
+			if (status != NULL)
+			{
+				for (;idx < runEnd;idx += 1) status [idx] = 1;
+			}
+		}
+		if (runStatus > rtnStatus) rtnStatus = runStatus;
+	}
+	return rtnStatus;
+}
+
 /******************************************************************************
 	Release -- Release resources, but maintain the directory status.
 */
@@ -521,3 +680,64 @@ int CScalcGeoidHeightEntry (struct csGeoidHeightEntry_* __This,double* geoidHgt,
 	}
 	return status;
 }
+int CScalcGeoidHeightEntryN (struct csGeoidHeightEntry_* __This,double geoidHgt [],int status [],
+																			   Const double ll84 [][3],
+																			   int count)
+{
+	extern char csErrnam [];
+
+	int idx;
+	int ptStatus;
+	int rtnStatus;
+
+	rtnStatus = -1;
+	if (status != NULL)
+	{
+		for (idx = 0;idx < count;idx += 1) status [idx] = -1;
+	}
+	if (__This != NULL)
+	{
+		switch (__This->type) {
+		case csGeoidHgtTypeGeoid96:
+			rtnStatus = CScalcGeoid96GridFileN (__This->pointers.geoid96Ptr,geoidHgt,status,ll84,count);
+			break;
+		case csGeoidHgtTypeGeoid99:
+			rtnStatus = CScalcGeoid99GridFileN (__This->pointers.geoid99Ptr,geoidHgt,status,ll84,count);
+			break;
+		case csGeoidHgtTypeBynGridFile:
+			rtnStatus = CScalcBynGridFileN (__This->pointers.bynGridFilePtr,geoidHgt,status,ll84,count);
+			break;
+		case csGeoidHgtTypeOsgm91:
+			rtnStatus = CScalcOsgm91N (__This->pointers.osgm91Ptr,geoidHgt,status,ll84,count);
+			break;
+		case csGeoidHgtTypeEgm96:
+			/* This is not a grid interpolation of the sort the batch kernels
+			   handle, so we simply do the points one at a time. */
+			rtnStatus = 0;
+			for (idx = 0;idx < count;idx += 1)
+			{
+				ptStatus = CScalcGeoidHeightEntry (__This,&geoidHgt [idx],ll84 [idx]);
+				if (status != NULL) status [idx] = ptStatus;
+				if (ptStatus < 0)
+				{
+					rtnStatus = ptStatus;
+					break;
+				}
+				if (ptStatus > rtnStatus) rtnStatus = ptStatus;
+			}
+			if (status != NULL)
+			{
+				for (idx += 1;idx < count;idx += 1) status [idx] = rtnStatus;
+			}
+			break;
+		case csGeoidHgtTypeWorld:
+		case csGeoidHgtTypeAustralia:
+		case csGeoidHgtTypeNone:
+		default:
+			CS_stncp (csErrnam,"CS_usGridFile:4",MAXPATH);
+			CS_erpt (cs_ISER);
+			break;
+		}
+	}
+	return rtnStatus;
+}
@@ -123,6 +123,7 @@ int EXP_LVL5 CS_gpwr (csFILE *strm,Const struct cs_GeodeticPath_ *gp_def)
 **********************************************************************/
 int EXP_LVL3 CS_gpdel (struct cs_GeodeticPath_ *gp_def)
 {
+	CS_rlsGpIndex ();
 	return CS_gpDelete(gp_def);
 }
 
@@ -144,6 +145,7 @@ int EXP_LVL3 CS_gpdel (struct cs_GeodeticPath_ *gp_def)
 *******************************************************************************/
 int EXP_LVL5 CS_gpupd (struct cs_GeodeticPath_ *gp_def)
 {
+	CS_rlsGpIndex ();
 	return CS_gpUpdate(gp_def);
 }
 
@@ -199,6 +201,156 @@ struct cs_GeodeticPath_ * EXP_LVL5 CS_gpdef2 (Const char *pathName, char* pszDir
 }
 
 
+/* The geodetic path index.  Rather than scan the geodetic path dictionaries
+   on each call, CS_gpdefEx looks up paths in an in memory copy of both the
+   user and the system dictionaries, built the first time a path is
+   requested.  The records are held in dictionary order, user dictionary
+   first, and are chained by (source datum, target datum) in a hash table,
+   each chain in record order.  Thus, the first matching record in a chain is
+   the one which would be found by searching the dictionaries in the order in
+   which CS_gpdefEx has always searched them.  The index is released by
+   CS_gpupd and CS_gpdel, and rebuilt should the dictionary directories or
+   file name change. */
+static struct cs_GeodeticPath_* csGpIdxDefs = NULL;
+static int* csGpIdxNext = NULL;
+static int* csGpIdxBuckets = NULL;
+static unsigned csGpIdxSize = 0;
+static char csGpIdxUserDir [MAXPATH] = "";
+static char csGpIdxSysDir [MAXPATH] = "";
+static char csGpIdxName [cs_FNM_MAXLEN] = "";
+
+void EXP_LVL7 CS_rlsGpIndex (void)
+{
+	CS_free (csGpIdxDefs);
+	csGpIdxDefs = NULL;
+	CS_free (csGpIdxNext);
+	csGpIdxNext = NULL;
+	CS_free (csGpIdxBuckets);
+	csGpIdxBuckets = NULL;
+	csGpIdxSize = 0;
+	csGpIdxUserDir [0] = '\0';
+	csGpIdxSysDir [0] = '\0';
+	csGpIdxName [0] = '\0';
+}
+
+/* Builds the index, if it does not exist or was built from some other
+   pair of dictionaries.  Returns zero on success. */
+static int CSgpIndexSetup (Const char* sysDir)
+{
+	extern char cs_UserDir [];
+	extern char cs_Gpname [];
+	extern int cs_Error;
+
+	int st;
+	int count;
+	int allocCount;
+	int dirIdx;
+	int recIdx;
+	unsigned bucket;
+
+	Const char* dirPath;
+	csFILE *strm;
+	struct cs_GeodeticPath_* newDefs;
+
+	if (csGpIdxBuckets != NULL && !strcmp (csGpIdxUserDir,cs_UserDir) &&
+								  !strcmp (csGpIdxSysDir,sysDir) &&
+								  !strcmp (csGpIdxName,cs_Gpname))
+	{
+		return 0;
+	}
+	CS_rlsGpIndex ();
+
+	strm = NULL;
+	count = 0;
+	allocCount = 0;
+	for (dirIdx = 0;dirIdx < 2;dirIdx += 1)
+	{
+		dirPath = (dirIdx == 0) ? cs_UserDir : sysDir;
+		if (*dirPath == '\0') continue;
+		if (CS_setdr (dirPath,NULL)) goto error;
+		strm = CS_gpopn (_STRM_BINRD);
+		if (strm == NULL)
+		{
+			cs_Error = 0;
+			continue;
+		}
+		for (;;)
+		{
+			if (count >= allocCount)
+			{
+				allocCount = (allocCount == 0) ? 128 : allocCount * 2;
+				newDefs = (struct cs_GeodeticPath_ *)CS_ralc (csGpIdxDefs,sizeof (struct cs_GeodeticPath_) * (size_t)allocCount);
+				if (newDefs == NULL)
+				{
+					CS_erpt (cs_NO_MEM);
+					goto error;
+				}
+				csGpIdxDefs = newDefs;
+			}
+			st = CS_gprd (strm,&csGpIdxDefs [count]);
+			if (st < 0) goto error;
+			if (st == 0) break;
+			count += 1;
+		}
+		CS_fclose (strm);
+		strm = NULL;
+	}
+
+	csGpIdxSize = 64;
+	while (csGpIdxSize < (unsigned)count * 2U)
+	{
+		csGpIdxSize <<= 1;
+	}
+	csGpIdxBuckets = (int *)CS_malc (sizeof (int) * csGpIdxSize);
+	csGpIdxNext = (int *)CS_malc (sizeof (int) * (size_t)(count + 1));
+	if (csGpIdxBuckets == NULL || csGpIdxNext == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	for (bucket = 0;bucket < csGpIdxSize;bucket += 1)
+	{
+		csGpIdxBuckets [bucket] = -1;
+	}
+	for (recIdx = count - 1;recIdx >= 0;recIdx -= 1)
+	{
+		bucket = CS_strihash (csGpIdxDefs [recIdx].srcDatum,csGpIdxDefs [recIdx].trgDatum) & (csGpIdxSize - 1);
+		csGpIdxNext [recIdx] = csGpIdxBuckets [bucket];
+		csGpIdxBuckets [bucket] = recIdx;
+	}
+	CS_stncp (csGpIdxUserDir,cs_UserDir,sizeof (csGpIdxUserDir));
+	CS_stncp (csGpIdxSysDir,sysDir,sizeof (csGpIdxSysDir));
+	CS_stncp (csGpIdxName,cs_Gpname,sizeof (csGpIdxName));
+	return CS_setdr (sysDir,NULL);
+
+error:
+	if (strm != NULL) CS_fclose (strm);
+	CS_rlsGpIndex ();
+	CS_setdr (sysDir,NULL);		/*lint !e534  ignoring return value, not much we can do about it here */
+	return -1;
+}
+
+/* Returns the index of the first record which converts from srcDatum to
+   trgDatum, considering only reversible records if so requested. */
+static int CSgpIndexFind (Const char* srcDatum,Const char* trgDatum,int reversible)
+{
+	int recIdx;
+	struct cs_GeodeticPath_* gpPtr;
+
+	recIdx = csGpIdxBuckets [CS_strihash (srcDatum,trgDatum) & (csGpIdxSize - 1)];
+	for (;recIdx >= 0;recIdx = csGpIdxNext [recIdx])
+	{
+		gpPtr = &csGpIdxDefs [recIdx];
+		if ((!reversible || gpPtr->reversible != 0) &&
+			!CS_stricmp (gpPtr->srcDatum,srcDatum) &&
+			!CS_stricmp (gpPtr->trgDatum,trgDatum))
+		{
+			break;
+		}
+	}
+	return recIdx;
+}
+
 /**********************************************************************
 **	gp_ptr = CS_gpdefEx (Const char* srcDatum,Const char* trgDatum);
 **
@@ -209,48 +361,31 @@ struct cs_GeodeticPath_ * EXP_LVL5 CS_gpdef2 (Const char *pathName, char* pszDir
 **	struct cs_GeodeticPath_ *gp_ptr;
 **								returns a pointer to a malloc'ed
 **								geodetic path definition structure.
+**
+**	A forward path is always preferred over an inverse one, and the
+**	user dictionary over the system dictionary.  Paths are located
+**	using the geodetic path index, see above.
 **********************************************************************/
-/*lint -esym(550,globalFoundForward)  Variable set, but not used. */
 struct cs_GeodeticPath_ * EXP_LVL3 CS_gpdefEx (int* direction,
 											   Const char *srcDatum,
 											   Const char *trgDatum)
 {
 	extern char csErrnam [];
-	extern char cs_UserDir[];
-
-	extern int cs_Error;
 
 	char currentDir[MAXPATH] = { '\0' };
-	char targetPaths[2][MAXPATH] = { { '\0'}, {'\0'} };
-	char const* pTargetPath;
-	
-	int st;
-	size_t i;
 
-	long curFpos;
-	long fwdFpos;
-	long invFpos;
-
-	int globalFoundForward;
-	int globalFoundBackward;
+	int st;
+	int recIdx;
 
-	csFILE *strm;
 	struct cs_GeodeticPath_ *gp_def;
 
 	char tmpKeyName [64];
 	char errMsg [256];
-	
-	__ALIGNMENT__1				/* For some versions of Sun compiler. */
-	struct cs_GeodeticPath_ gp_rec;
 
 	/* Prepare for the potential error condition. */
-	strm = NULL;
 	gp_def = NULL;
 	*direction = cs_DTCDIR_NONE;
 
-	globalFoundForward = 0;
-	globalFoundBackward = 0;
-
 	/* Make sure the provided names are OK. */
 	CS_stncp (tmpKeyName,srcDatum,sizeof (tmpKeyName));
 	st = CS_nampp (tmpKeyName);
@@ -262,151 +397,27 @@ struct cs_GeodeticPath_ * EXP_LVL3 CS_gpdefEx (int* direction,
 	st = CS_getdr(currentDir);
 	if (st != 0) goto error;
 
-	CS_stncp(targetPaths[0], cs_UserDir, sizeof(targetPaths[0]));
-	CS_stncp(targetPaths[1], currentDir, sizeof(targetPaths[1]));
+	st = CSgpIndexSetup (currentDir);
+	if (st != 0) goto error;
 
-	/* go through all directories we possibly have.  Search the user
-	   dictionary first, than the distribution directory. */
-	for (i = 0; i < (sizeof(targetPaths) / sizeof(targetPaths[0])); ++i)
+	/* We always return the forward definition if we found one. */
+	recIdx = CSgpIndexFind (srcDatum,trgDatum,FALSE);
+	if (recIdx >= 0)
 	{
-		if (NULL != strm)
-		{
-			CS_fclose (strm);
-			strm = NULL;
-		}
-
-		/* Search the file for the requested coordinate system definition. */
-		pTargetPath = targetPaths[i];
-		if ('\0' == *pTargetPath)
-			continue;
-
-		//switch [cs_dir] and [cs_DirP] to whatever the current target directory is
-		if (CS_setdr(pTargetPath, NULL))
-			goto error;
-
-		/* Open up the geodetic path dictionary file. */
-		strm = CS_gpopn (_STRM_BINRD);
-		if (strm == NULL)
-		{
-			cs_Error = 0;
-			continue;
-		}
-
-		/* Search the file for the requested path definition. */
-		fwdFpos = 0L;
-		invFpos = 0L;
-		for (;;)
-		{
-			curFpos = CS_ftell (strm);
-			st = CS_gprd (strm,&gp_rec);
-			if (st < 0)
-			{
-				goto error;	
-			} 
-			if (st == 0)
-			{
-				break;
-			}
-
-			/* See if we have a match in the forward direction. */
-			if (!CS_stricmp (gp_rec.srcDatum,srcDatum) &&
-				!CS_stricmp (gp_rec.trgDatum,trgDatum))
-			{
-				//we must not have yet hit a "forward path"
-				fwdFpos = curFpos;
-				globalFoundForward = 1;
-                // Optimization, stop search when a forward path is found. 
-                // The forward paths are preferred over the backward ones.
-                break;
-			}
-			/* See if we have a match in the inverse direction, but only if the path
-			   is marked as reversible. */
-			else if (gp_rec.reversible != 0)
-			{
-				if (!CS_stricmp (gp_rec.srcDatum,trgDatum) &&
-					!CS_stricmp (gp_rec.trgDatum,srcDatum))
-				{
-					if (invFpos == 0L && 0 == globalFoundBackward) // When double inverse entry. Be tolerant and continue.
-					{
-						invFpos = curFpos;
-						globalFoundBackward = 1;
-					}
-				}
-				// Continue search, the forward paths are preferred over the backward ones.
-			}
-		} //for (;;)
-
-		/* We always return the forward definition if we found one. */
-		if (fwdFpos != 0L)
-		{
-			if (!gp_def) //we might have allocated that in the first round (inverse)
-				gp_def = (struct cs_GeodeticPath_ *)CS_malc (sizeof (struct cs_GeodeticPath_));
-
-			if (gp_def == NULL)
-			{
-				CS_erpt (cs_NO_MEM);
-				goto error;
-			}
-
-			memset ((void*)gp_def,0,sizeof (*gp_def));
-			st = CS_fseek (strm,fwdFpos,SEEK_SET);
-			if (st != 0)
-			{
-				CS_erpt (cs_IOERR);
-				goto error;
-			}
-			if (!CS_gprd (strm,gp_def))
-			{
-				goto error;
-			}
-			else
-			{
-				*direction = cs_DTCDIR_FWD;
-			}
-		}
-		else if (invFpos != 0L && !gp_def) //we prefer the forward paths over the backward ones
-		{
-			gp_def = (struct cs_GeodeticPath_ *)CS_malc (sizeof (struct cs_GeodeticPath_));
-			if (gp_def == NULL)
-			{
-				CS_erpt (cs_NO_MEM);
-				goto error;
-			}
-
-			memset ((void*)gp_def,0,sizeof (*gp_def));
-			st = CS_fseek (strm,invFpos,SEEK_SET);
-			if (st != 0)
-			{
-				CS_erpt (cs_IOERR);
-				goto error;
-			}
-			if (!CS_gprd (strm,gp_def))
-			{
-				goto error;
-			}
-			else
-			{
-				*direction = cs_DTCDIR_INV;
-			}
-		}
-		
-		if (strm != NULL)			/*lint !e774  always evaluates to true */
+		*direction = cs_DTCDIR_FWD;
+	}
+	else
+	{
+		recIdx = CSgpIndexFind (trgDatum,srcDatum,TRUE);
+		if (recIdx >= 0)
 		{
-			CS_fclose (strm);
-			strm = NULL;
+			*direction = cs_DTCDIR_INV;
 		}
-        if (fwdFpos != 0L && NULL != gp_def) 
-        {
-            // Optimization, stop search when a forward path is found. 
-            // The forward paths are preferred over the backward ones.
-            // Continue searching when no or only a backward path is found.
-            break;
-        }
 	}
 
 	/* report a failure after we've gone through the 2 directories and we still haven't found
 	   any good entry */
-	if (NULL == gp_def)
+	if (recIdx < 0)
 	{
 		sprintf (errMsg,"'%s' to '%s'",srcDatum,trgDatum);
 		CS_stncp (csErrnam,errMsg,MAXPATH);
@@ -415,26 +426,20 @@ struct cs_GeodeticPath_ * EXP_LVL3 CS_gpdefEx (int* direction,
 		goto error;
 	}
 
-	st = CS_setdr(currentDir, NULL);
-	if (st != 0)
+	gp_def = (struct cs_GeodeticPath_ *)CS_malc (sizeof (struct cs_GeodeticPath_));
+	if (gp_def == NULL)
 	{
+		CS_erpt (cs_NO_MEM);
 		goto error;
 	}
+	memcpy ((void*)gp_def,&csGpIdxDefs [recIdx],sizeof (*gp_def));
 
 	/* Return a pointer to the malloc'ed geodetic path definition to the
 	   user. */
 	return (gp_def);
 
 error:
-	if (strm != NULL) CS_fclose (strm);
-	if (gp_def != NULL)
-	{
-		CS_free (gp_def);
-		gp_def = NULL;
-	}
-
-	CS_setdr(currentDir, NULL);		/*lint !e534  ignoring return value, not much we can do about it here */
-
+	*direction = cs_DTCDIR_NONE;
 	return NULL;
 }
 
@@ -27,123 +27,314 @@
 
 #include "cs_map.h"
 
-/**********************************************************************
-**	count = CS_csgrp (grp_key,grp_list);
-**
-**	char *grp_key;				the specific group key for which a list is to be
-**								returned.
-**	struct cs_Csgrplst_ *grp_list;
-**								a pointer to a linked list of malloc'ed cs_Csgrplst_
-**								structures is returned here.
-**	int count;					the number of coordinate systems in the returned list
-**								is returned.  -1 is returned for an invalid group key.
-**********************************************************************/
+/*
+	The group listings are produced from a resident index of the coordinate
+	system dictionary.  The index holds, for each group in cs_CsGrptbl, a
+	contiguous run of the definitions in that group, in dictionary order,
+	with the description, source and reference fields already extracted and
+	the projection already looked up.  Defaults are applied as each listing
+	is produced, as the default settings may change at any time.  The index
+	is built on first use and is rebuilt when the size or modification
+	time of the coordinate system dictionary changes.  The dictionary is checked once per listing; that is,
+	by each CS_csgrp call, and by CSgrpEnum when it is asked for the first
+	entry of a group or for a group other than the previous one.  It is
+	released by CS_rlsGrpIndex, which CS_recvr, CS_csDelete, and CS_csUpdate
+	call.
+*/
 
-int EXP_LVL3 CS_csgrp (Const char *grp_key,struct cs_Csgrplst_ **grp_list)
+#define csGRPITM_GEOGR  0x01		/* projection is geographic */
+#define csGRPITM_NOPRJ  0x02		/* projection is unknown */
+
+struct csGrpItem_
+{
+	struct cs_Csgrplst_ item;		/* defaults not yet applied, next unused */
+	short flags;
+	short grpIdx;					/* index of the group in cs_CsGrptbl */
+	char prj_knm [24];
+};
+
+static char csGrpDictPath [MAXPATH] = "";
+static cs_Time_ csGrpDictTime = 0;
+static ulong32_t csGrpDictSize = 0UL;
+static struct csGrpItem_ *csGrpItems = NULL;
+static long32_t *csGrpFirst = NULL;		/* per group: first item, the count, then
+										   the index within the group of the first
+										   item whose projection is unknown, -1 if
+										   there is none */
+static int csGrpCount = 0;
+static int csGrpEnumIdx = -1;			/* group of the previous CSgrpEnum call */
+
+void EXP_LVL7 CS_rlsGrpIndex (void)
+{
+	CS_free (csGrpItems);
+	CS_free (csGrpFirst);
+	csGrpItems = NULL;
+	csGrpFirst = NULL;
+	csGrpCount = 0;
+	csGrpEnumIdx = -1;
+	csGrpDictPath [0] = '\0';
+	csGrpDictTime = 0;
+	csGrpDictSize = 0UL;
+}
+
+/* Returns the index of grp_key in cs_CsGrptbl, or -1 after reporting an
+   invalid group key. */
+static int CSgrpTblIndex (Const char *grp_key)
 {
-	extern struct cs_Prjtab_ cs_Prjtab [];
 	extern struct cs_Grptbl_ cs_CsGrptbl [];
 	extern char csErrnam [];
 
+	int tblIdx;
+
+	for (tblIdx = 0;cs_CsGrptbl [tblIdx].group [0] != '\0';tblIdx += 1)
+	{
+		if (!CS_stricmp (cs_CsGrptbl [tblIdx].group,grp_key)) return tblIdx;
+	}
+	CS_stncp (csErrnam,grp_key,MAXPATH);
+	CS_erpt (cs_CSGRP_INVKEY);
+	return -1;
+}
+
+/* Makes sure the index exists; when revalidate is TRUE, also that it reflects
+   the current coordinate system dictionary. */
+static int CSgrpIndexSetup (int revalidate)
+{
+	extern struct cs_Grptbl_ cs_CsGrptbl [];
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern char cs_Csname [];
+
 	int st;
-	int count;
 	int crypt;
+	int tblIdx;
+	int grpCount;
+
+	long32_t ii;
+	long32_t itemCount;
+	long32_t itemAlloc;
 
+	cs_Time_ dictTime;
+	ulong32_t dictSize;
 	csFILE *strm;
-	struct cs_Csgrplst_ *lp;
-	struct cs_Grptbl_ *tp;
+	struct csGrpItem_ *ip;
+	struct csGrpItem_ *rawItems;
 	struct cs_Prjtab_ *pp;
 
+	__ALIGNMENT__1				/* Required by some Sun compilers. */
 	struct cs_Csdef_ cs_def;
 
-	strm = NULL;
-	lp = NULL;					/* initialization to keep gcc happy */
-	*grp_list = NULL;
-	count = 0;
+	if (csGrpItems != NULL && !revalidate)
+	{
+		return 0;
+	}
+	CS_stcpy (cs_DirP,cs_Csname);
+	dictTime = CS_fileModTime (cs_Dir);
+	dictSize = CS_fileSize (cs_Dir);
+	if (csGrpItems != NULL && dictTime == csGrpDictTime && dictSize == csGrpDictSize &&
+		!CS_stricmp (cs_Dir,csGrpDictPath))
+	{
+		return 0;
+	}
+	CS_rlsGrpIndex ();
 
-	/* Verify that the group name is one that we know about. */
-	for (tp = cs_CsGrptbl;tp->group [0] != '\0';tp += 1)
+	for (grpCount = 0;cs_CsGrptbl [grpCount].group [0] != '\0';grpCount += 1);
+	csGrpFirst = (long32_t *)CS_malc ((size_t)grpCount * 3 * sizeof (long32_t));
+	if (csGrpFirst == NULL)
 	{
-		if (!CS_stricmp (tp->group,grp_key)) break;
+		CS_erpt (cs_NO_MEM);
+		return -1;
 	}
-	if (tp->group [0] == '\0')
+	for (tblIdx = 0;tblIdx < grpCount;tblIdx += 1)
 	{
-		CS_stncp (csErrnam,grp_key,MAXPATH);
-		CS_erpt (cs_CSGRP_INVKEY);
-		goto error;
+		csGrpFirst [tblIdx * 3]     = 0L;
+		csGrpFirst [tblIdx * 3 + 1] = 0L;
+		csGrpFirst [tblIdx * 3 + 2] = -1L;
 	}
 
-	/* Generate the list. */
+	/* Collect the definitions of every known group, in dictionary order. */
+	rawItems = NULL;
+	itemCount = 0L;
+	itemAlloc = 0L;
 	strm = CS_csopn (_STRM_BINRD);
 	if (strm == NULL) goto error;
-	while ((st = CS_csrd (strm,&cs_def,&crypt)) == 1)
+	while ((st = CS_csrd (strm,&cs_def,&crypt)) > 0)
 	{
-		if (CS_stricmp (cs_def.group,grp_key)) continue;
-
-		/* Add the new coodinate system to the list. */
-		if (*grp_list == NULL)
-		{
-			*grp_list = CS_malc (sizeof (struct cs_Csgrplst_));
-			lp = *grp_list;
-		}
-		else
+		for (tblIdx = 0;tblIdx < grpCount;tblIdx += 1)
 		{
-			lp->next = CS_malc (sizeof (struct cs_Csgrplst_));		/*lint !e613   possible use of null pointer (incorrect diagnostic) */
-			lp = lp->next;											/*lint !e613   possible use of null pointer (incorrect diagnostic) */
+			if (!CS_stricmp (cs_CsGrptbl [tblIdx].group,cs_def.group)) break;
 		}
-		if (lp == NULL)
+		if (tblIdx >= grpCount) continue;
+
+		if (itemCount >= itemAlloc)
 		{
-			CS_erpt (cs_NO_MEM);
-			goto error;
+			itemAlloc += 1024L;
+			ip = (struct csGrpItem_ *)CS_ralc (rawItems,(size_t)itemAlloc * sizeof (struct csGrpItem_));
+			if (ip == NULL)
+			{
+				CS_erpt (cs_NO_MEM);
+				st = -1;
+				break;
+			}
+			rawItems = ip;
 		}
-		lp->next = NULL;
+		ip = &rawItems [itemCount++];
+		memset (ip,'\0',sizeof (*ip));
+		ip->grpIdx = (short)tblIdx;
 
 		/* Locate in the projection table. */
-		for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
-		{
-			if (!CS_stricmp (pp->key_nm,cs_def.prj_knm)) break;
-		}
+		pp = CS_prjtabPtr (cs_def.prj_knm);
 		if (*pp->key_nm == '\0' || pp->setup == NULL)
 		{
-			CS_stncp (csErrnam,cs_def.prj_knm,MAXPATH);
-			CS_erpt (cs_UNKWN_PROJ);
-			goto error;
+			ip->flags |= csGRPITM_NOPRJ;
+			if (csGrpFirst [tblIdx * 3 + 2] < 0L)
+			{
+				csGrpFirst [tblIdx * 3 + 2] = csGrpFirst [tblIdx * 3 + 1];
+			}
 		}
-
-		CS_stncp (lp->key_nm,cs_def.key_nm,sizeof (lp->key_nm));
-		CS_stncp (lp->descr,cs_def.desc_nm,sizeof (lp->descr));
-		CS_stncp (lp->source,cs_def.source,sizeof (lp->source));
-		CS_stncp (lp->unit,cs_def.unit,sizeof (lp->unit));
-
-		/* Units are defaultable. This is why we needed the projection
-		   table look up. */
-		if ((pp->flags & cs_PRJFLG_GEOGR) != 0)
+		else if ((pp->flags & cs_PRJFLG_GEOGR) != 0)
 		{
-			CSdfltpro (cs_DFLTSW_AU,lp->unit,sizeof (lp->unit));
-		}
-		else
-		{
-			CSdfltpro (cs_DFLTSW_LU,lp->unit,sizeof (lp->unit));
+			ip->flags |= csGRPITM_GEOGR;
 		}
+		CS_stncp (ip->prj_knm,cs_def.prj_knm,sizeof (ip->prj_knm));
+		csGrpFirst [tblIdx * 3 + 1] += 1L;
 
-		/* Datums and ellipsoids are defaultable as well. */
+		CS_stncp (ip->item.key_nm,cs_def.key_nm,sizeof (ip->item.key_nm));
+		CS_stncp (ip->item.descr,cs_def.desc_nm,sizeof (ip->item.descr));
+		CS_stncp (ip->item.source,cs_def.source,sizeof (ip->item.source));
+		CS_stncp (ip->item.unit,cs_def.unit,sizeof (ip->item.unit));
 		if (cs_def.dat_knm [0] != '\0')
 		{
-			CS_stcpy (lp->ref_typ,"Datum");
-			CS_stncp (lp->ref_to,cs_def.dat_knm,sizeof (lp->ref_to));
-			CSdfltpro (cs_DFLTSW_DT,lp->ref_to,sizeof (lp->ref_to));
-		} 
+			CS_stcpy (ip->item.ref_typ,"Datum");
+			CS_stncp (ip->item.ref_to,cs_def.dat_knm,sizeof (ip->item.ref_to));
+		}
 		else
 		{
-			CS_stcpy (lp->ref_typ,"Ellipsoid");
-			CS_stncp (lp->ref_to,cs_def.elp_knm,sizeof (lp->ref_to));
-			CSdfltpro (cs_DFLTSW_EL,lp->ref_to,sizeof (lp->ref_to));
+			CS_stcpy (ip->item.ref_typ,"Ellipsoid");
+			CS_stncp (ip->item.ref_to,cs_def.elp_knm,sizeof (ip->item.ref_to));
 		}
-		count += 1;
 	}
-	if (st != 0) goto error;
 	CS_csDictCls (strm);
-	return (count);
+	if (st < 0) goto error;
+
+	/* Arrange the items into a contiguous run for each group; the order
+	   within each group remains that of the dictionary. */
+	csGrpItems = (struct csGrpItem_ *)CS_malc ((size_t)((itemCount > 0L) ? itemCount : 1L) * sizeof (struct csGrpItem_));
+	if (csGrpItems == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	ii = 0L;
+	for (tblIdx = 0;tblIdx < grpCount;tblIdx += 1)
+	{
+		csGrpFirst [tblIdx * 3] = ii;
+		ii += csGrpFirst [tblIdx * 3 + 1];
+		csGrpFirst [tblIdx * 3 + 1] = 0L;
+	}
+	for (ii = 0L;ii < itemCount;ii += 1L)
+	{
+		tblIdx = rawItems [ii].grpIdx;
+		csGrpItems [csGrpFirst [tblIdx * 3] + csGrpFirst [tblIdx * 3 + 1]] = rawItems [ii];
+		csGrpFirst [tblIdx * 3 + 1] += 1L;
+	}
+	CS_free (rawItems);
+	csGrpCount = grpCount;
+	CS_stncp (csGrpDictPath,cs_Dir,sizeof (csGrpDictPath));
+	csGrpDictTime = dictTime;
+	csGrpDictSize = dictSize;
+	return 0;
+
+error:
+	CS_free (rawItems);
+	CS_rlsGrpIndex ();
+	return -1;
+}
+
+/* Produces the listing of the given index item, applying the defaults. */
+static int CSgrpItemGet (struct cs_Csgrplst_ *lp,Const struct csGrpItem_ *ip)
+{
+	extern char csErrnam [];
+
+	if ((ip->flags & csGRPITM_NOPRJ) != 0)
+	{
+		CS_stncp (csErrnam,ip->prj_knm,MAXPATH);
+		CS_erpt (cs_UNKWN_PROJ);
+		return -1;
+	}
+	*lp = ip->item;
+	lp->next = NULL;
+
+	/* Units are defaultable. This is why we needed the projection
+	   table look up. */
+	if ((ip->flags & csGRPITM_GEOGR) != 0)
+	{
+		CSdfltpro (cs_DFLTSW_AU,lp->unit,sizeof (lp->unit));
+	}
+	else
+	{
+		CSdfltpro (cs_DFLTSW_LU,lp->unit,sizeof (lp->unit));
+	}
+
+	/* Datums and ellipsoids are defaultable as well. */
+	if (lp->ref_typ [0] == 'D')
+	{
+		CSdfltpro (cs_DFLTSW_DT,lp->ref_to,sizeof (lp->ref_to));
+	}
+	else
+	{
+		CSdfltpro (cs_DFLTSW_EL,lp->ref_to,sizeof (lp->ref_to));
+	}
+	return 0;
+}
+
+/**********************************************************************
+**	count = CS_csgrp (grp_key,grp_list);
+**
+**	char *grp_key;				the specific group key for which a list is to be
+**								returned.
+**	struct cs_Csgrplst_ *grp_list;
+**								a pointer to a linked list of cs_Csgrplst_
+**								structures is returned here.  The list is a
+**								single malloc'ed array, linked in order.
+**	int count;					the number of coordinate systems in the returned list
+**								is returned.  -1 is returned for an invalid group key.
+**
+**	The list must be released by CS_csgrpf.
+**********************************************************************/
+
+int EXP_LVL3 CS_csgrp (Const char *grp_key,struct cs_Csgrplst_ **grp_list)
+{
+	int tblIdx;
+	long32_t ii;
+	long32_t count;
+
+	struct cs_Csgrplst_ *lp;
+	Const struct csGrpItem_ *ip;
+
+	*grp_list = NULL;
+
+	/* Verify that the group name is one that we know about. */
+	tblIdx = CSgrpTblIndex (grp_key);
+	if (tblIdx < 0) goto error;
+	if (CSgrpIndexSetup (TRUE) != 0) goto error;
+
+	/* Generate the list. */
+	count = csGrpFirst [tblIdx * 3 + 1];
+	if (count == 0L) return 0;
+	lp = (struct cs_Csgrplst_ *)CS_malc ((size_t)count * sizeof (struct cs_Csgrplst_));
+	if (lp == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	*grp_list = lp;
+	ip = &csGrpItems [csGrpFirst [tblIdx * 3]];
+	for (ii = 0L;ii < count;ii += 1L)
+	{
+		if (CSgrpItemGet (&lp [ii],&ip [ii]) != 0) goto error;
+		if (ii > 0L) lp [ii - 1].next = &lp [ii];
+	}
+	return ((int)count);
 
 error:
 	if (*grp_list != NULL)
@@ -151,19 +342,54 @@ error:
 		CS_csgrpf (*grp_list);
 		*grp_list = NULL;
 	}
-	if (strm != NULL) CS_csDictCls (strm);
 	return (-1);
 }
 
-void EXP_LVL3 CS_csgrpf (struct cs_Csgrplst_ *grp_list)
+/**********************************************************************
+**	found = CSgrpEnum (grp_key,index,cs_descr);
+**
+**	char *grp_key;				the group key of the group to be enumerated.
+**	int index;					index of the coordinate system in the group,
+**								zero being the first.
+**	struct cs_Csgrplst_ *cs_descr;
+**								the listing of the selected coordinate system
+**								is returned here, with its next member NULL.
+**	int found;					returns +1 if the index'th coordinate system
+**								was returned, zero if the group has fewer
+**								coordinate systems, or -1 for an error.
+**
+**	Provides the index'th element of the list which CS_csgrp would
+**	return, without producing the list.  As CS_csgrp fails for a group
+**	which includes a coordinate system whose projection is unknown, so
+**	does this function, whatever the index.  The dictionary is checked
+**	for changes only when index is zero, or grp_key differs from that of
+**	the previous call.
+**********************************************************************/
+
+int EXP_LVL9 CSgrpEnum (Const char *grp_key,int index,struct cs_Csgrplst_ *cs_descr)
 {
-	struct cs_Csgrplst_ *lp;
+	int tblIdx;
+	long32_t first;
 
-	while (grp_list != NULL)
+	tblIdx = CSgrpTblIndex (grp_key);
+	if (tblIdx < 0) return (-1);
+	if (CSgrpIndexSetup (index == 0 || tblIdx != csGrpEnumIdx) != 0) return (-1);
+	csGrpEnumIdx = tblIdx;
+	if (index < 0 || (long32_t)index >= csGrpFirst [tblIdx * 3 + 1]) return (0);
+	first = csGrpFirst [tblIdx * 3];
+	if (csGrpFirst [tblIdx * 3 + 2] >= 0L)
 	{
-		lp = grp_list;
-		grp_list = lp->next;
-		CS_free (lp);
+		/* Reports the unknown projection. */
+		CSgrpItemGet (cs_descr,&csGrpItems [first + csGrpFirst [tblIdx * 3 + 2]]);	/*lint !e534 */
+		return (-1);
 	}
+	if (CSgrpItemGet (cs_descr,&csGrpItems [first + index]) != 0) return (-1);
+	return (1);
+}
+
+void EXP_LVL3 CS_csgrpf (struct cs_Csgrplst_ *grp_list)
+{
+	/* The list is a single array; see CS_csgrp. */
+	CS_free (grp_list);
 	return;
 }
@@ -178,14 +178,100 @@ int EXP_LVL1 CS_putel (	Const struct cs_Eldef_ *el_def,int crypt)
 	return (status);
 }
 
+/* The key name lists produced by CS??KeyNames are accompanied by an index,
+   an array of pointers to each name in the list plus one to the null string
+   which terminates the list, so that the enumerators need not walk the list
+   from the beginning on every call.  The index is rebuilt whenever the list
+   is; should its allocation fail, the list is simply walked as before. */
+static void CSkeyIndexSetup (char ***keyIndex,int *keyCount,char *keyNames)
+{
+	int count;
+	char *cp;
+	char **idxPtr;
+
+	CS_free (*keyIndex);
+	*keyIndex = NULL;
+	*keyCount = 0;
+	if (keyNames == NULL) return;
+
+	count = 0;
+	for (cp = keyNames;*cp != '\0';count++)
+	{
+		while (*cp++ != '\0');						/*lint !e722 */
+	}
+	idxPtr = (char **)CS_malc ((size_t)(count + 1) * sizeof (char *));
+	if (idxPtr == NULL) return;
+	count = 0;
+	for (cp = keyNames;*cp != '\0';)
+	{
+		idxPtr [count++] = cp;
+		while (*cp++ != '\0');						/*lint !e722 */
+	}
+	idxPtr [count] = cp;
+	*keyIndex = idxPtr;
+	*keyCount = count;
+}
+
+static char *CSkeyNameAt (char *keyNames,char **keyIndex,int keyCount,int index)
+{
+	int ii;
+	char *cp;
+
+	if (keyIndex != NULL && keyIndex [0] == keyNames)
+	{
+		return keyIndex [(index < keyCount) ? index : keyCount];
+	}
+	cp = keyNames;
+	for (ii = 0;ii < index;ii++)
+	{
+		while (*cp++ != '\0');						/*lint !e722 */
+		if (*cp == '\0') break;
+	}
+	return cp;
+}
+
+/* Returns a copy of an entire key name list as a NULL terminated array of
+   pointers, in a single allocation. */
+static int CSkeyNamesAll (char **nameArray [],char *keyNames,char **keyIndex,int keyCount)
+{
+	int ii;
+	size_t ptrSize;
+	size_t strSize;
+	char **rsltPtr;
+
+	*nameArray = NULL;
+	if (keyNames == NULL) return (-1);
+	if (keyIndex == NULL || keyIndex [0] != keyNames)
+	{
+		CS_erpt (cs_NO_MEM);
+		return (-1);
+	}
+	ptrSize = (size_t)(keyCount + 1) * sizeof (char *);
+	strSize = (size_t)(keyIndex [keyCount] - keyNames) + 1;
+	rsltPtr = (char **)CS_malc (ptrSize + strSize);
+	if (rsltPtr == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		return (-1);
+	}
+	memcpy ((char *)rsltPtr + ptrSize,keyNames,strSize);
+	for (ii = 0;ii < keyCount;ii++)
+	{
+		rsltPtr [ii] = (char *)rsltPtr + ptrSize + (keyIndex [ii] - keyNames);
+	}
+	rsltPtr [keyCount] = NULL;
+	*nameArray = rsltPtr;
+	return keyCount;
+}
+
 int EXP_LVL1 CS_csEnum (int index,char *key_name,int size)
 {
 	extern int cs_Error;
+	extern char **cs_CsKeyIndex;
+	extern int cs_CsKeyCount;
 
 	cs_Register char *cp;
 
-	int ii;
-
 	*key_name = '\0';
 
 	if (index < 0)
@@ -201,11 +287,7 @@ int EXP_LVL1 CS_csEnum (int index,char *key_name,int size)
 
 	/* Locate the index'th entry in the enumeration. */
 
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
+	cp = CSkeyNameAt (cp,cs_CsKeyIndex,cs_CsKeyCount,index);
 
 	/* Return the located result, even if it is the null string. */
 
@@ -269,11 +351,11 @@ int EXP_LVL1 CS_csIsValid (Const char *key_name)
 int EXP_LVL1 CS_dtEnum (int index,char *key_name,int size)
 {
 	extern int cs_Error;
+	extern char **cs_DtKeyIndex;
+	extern int cs_DtKeyCount;
 
 	cs_Register char *cp;
 
-	int ii;
-
 	*key_name = '\0';
 
 	if (index < 0)
@@ -284,11 +366,7 @@ int EXP_LVL1 CS_dtEnum (int index,char *key_name,int size)
 
 	cp = CSdtKeyNames ();
 	if (cp == NULL)	return (-1);
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
+	cp = CSkeyNameAt (cp,cs_DtKeyIndex,cs_DtKeyCount,index);
 	CS_stncp (key_name,cp,size);
 	return (*cp != '\0');
 }
@@ -317,11 +395,11 @@ int EXP_LVL1 CS_dtIsValid (Const char *key_name)
 int EXP_LVL1 CS_elEnum (int index,char *key_name,int size)
 {
 	extern int cs_Error;
+	extern char **cs_ElKeyIndex;
+	extern int cs_ElKeyCount;
 
 	cs_Register char *cp;
 
-	int ii;
-
 	*key_name = '\0';
 
 	if (index < 0)
@@ -332,11 +410,7 @@ int EXP_LVL1 CS_elEnum (int index,char *key_name,int size)
 
 	cp = CSelKeyNames ();
 	if (cp == NULL) return (-1);
-	for (ii = 0;ii < index;ii++)
-	{
-		while (*cp++ != '\0');						/*lint !e722 */
-		if (*cp == '\0') break;
-	}
+	cp = CSkeyNameAt (cp,cs_ElKeyIndex,cs_ElKeyCount,index);
 	CS_stncp (key_name,cp,size);
 	return (*cp != '\0');
 }
@@ -364,14 +438,7 @@ int EXP_LVL1 CS_elIsValid (Const char *key_name)
 
 int EXP_LVL2 CS_csEnumByGroup (int index,Const char *grp_name,struct cs_Csgrplst_ *cs_descr)
 {
-	extern struct cs_Csgrplst_ *cs_CsGrpList;
-
-	static char cur_group [24] = "!!!";
-
-	int ii;
 	int rtnValue;
-	
-	struct cs_Csgrplst_ *ptr;
 
 	rtnValue = 0;					// i.e. false */
 	if (index < 0)
@@ -380,27 +447,9 @@ int EXP_LVL2 CS_csEnumByGroup (int index,Const char *grp_name,struct cs_Csgrplst
 	}
 	else
 	{
-		if (cs_CsGrpList == NULL || CS_stricmp (grp_name,cur_group))
-		{
-			if (cs_CsGrpList != NULL)
-			{
-				CS_csgrpf (cs_CsGrpList);
-				cs_CsGrpList = NULL;
-			}
-			CS_stncp (cur_group,grp_name,sizeof (cur_group));
-			CS_csgrp (cur_group,&cs_CsGrpList);					/*lint !e534 */
-		}
-		if (cs_CsGrpList != NULL)
-		{
-			ptr = cs_CsGrpList;
-			for (ii = 0;ii < index && ptr != NULL;ii++) ptr = ptr->next;
-			if (ptr != NULL)
-			{
-				memcpy (cs_descr,ptr,sizeof (*cs_descr));
-				cs_descr->next = NULL;
-				rtnValue = 1;				/* i.e. TRUE  */
-			}
-		}
+		/* The group index used by CS_csgrp provides the index'th entry
+		   directly. */
+		rtnValue = (CSgrpEnum (grp_name,index,cs_descr) > 0);
 	}
 	return (rtnValue);
 }
@@ -441,6 +490,8 @@ int EXP_LVL1 CS_csGrpEnum (int index,char *grp_name,int name_sz,char *grp_dscr,i
 char * EXP_LVL9 CScsKeyNames (void)
 {
 	extern char *cs_CsKeyNames;
+	extern char **cs_CsKeyIndex;
+	extern int cs_CsKeyCount;
 
 	size_t len;
 	size_t malc_size;
@@ -530,6 +581,7 @@ char * EXP_LVL9 CScsKeyNames (void)
 			used_size += 1;
 			cs_CsKeyNames = (char *)CS_ralc (new_ptr,used_size);
 			if (cs_CsKeyNames == NULL) CS_free (new_ptr);
+			CSkeyIndexSetup (&cs_CsKeyIndex,&cs_CsKeyCount,cs_CsKeyNames);
 		}
 	}
 
@@ -543,6 +595,8 @@ char * EXP_LVL9 CScsKeyNames (void)
 char * EXP_LVL9 CSdtKeyNames (void)
 {
 	extern char *cs_DtKeyNames;
+	extern char **cs_DtKeyIndex;
+	extern int cs_DtKeyCount;
 
 	int st;
 	int crypt;
@@ -614,6 +668,7 @@ char * EXP_LVL9 CSdtKeyNames (void)
 			used_size += 1;
 			cs_DtKeyNames = (char *)CS_ralc (new_ptr,used_size);
 			if (cs_DtKeyNames == NULL) CS_free (new_ptr);
+			CSkeyIndexSetup (&cs_DtKeyIndex,&cs_DtKeyCount,cs_DtKeyNames);
 		}
 	}
 	return (cs_DtKeyNames);
@@ -622,6 +677,8 @@ char * EXP_LVL9 CSdtKeyNames (void)
 char * EXP_LVL9 CSelKeyNames (void)
 {
 	extern char *cs_ElKeyNames;
+	extern char **cs_ElKeyIndex;
+	extern int cs_ElKeyCount;
 
 	int st;
 	int crypt;
@@ -693,11 +750,47 @@ char * EXP_LVL9 CSelKeyNames (void)
 			used_size += 1;
 			cs_ElKeyNames = (char *)CS_ralc (new_ptr,used_size);
 			if (cs_ElKeyNames == NULL) CS_free (new_ptr);
+			CSkeyIndexSetup (&cs_ElKeyIndex,&cs_ElKeyCount,cs_ElKeyNames);
 		}
 	}
 	return (cs_ElKeyNames);
 }
 
+/* Return all of the key names of the indicated dictionary in a single
+   allocation: a NULL terminated array of pointers to the names, in the
+   same order as the enumerators return them.  The whole thing is released
+   with a single CS_free.  Returns the number of names, or -1. */
+int EXP_LVL3 CS_csEnumAll (char **nameArray [])
+{
+	extern char **cs_CsKeyIndex;
+	extern int cs_CsKeyCount;
+
+	char *keyNames;
+
+	keyNames = CScsKeyNames ();
+	return CSkeyNamesAll (nameArray,keyNames,cs_CsKeyIndex,cs_CsKeyCount);
+}
+int EXP_LVL3 CS_dtEnumAll (char **nameArray [])
+{
+	extern char **cs_DtKeyIndex;
+	extern int cs_DtKeyCount;
+
+	char *keyNames;
+
+	keyNames = CSdtKeyNames ();
+	return CSkeyNamesAll (nameArray,keyNames,cs_DtKeyIndex,cs_DtKeyCount);
+}
+int EXP_LVL3 CS_elEnumAll (char **nameArray [])
+{
+	extern char **cs_ElKeyIndex;
+	extern int cs_ElKeyCount;
+
+	char *keyNames;
+
+	keyNames = CSelKeyNames ();
+	return CSkeyNamesAll (nameArray,keyNames,cs_ElKeyIndex,cs_ElKeyCount);
+}
+
 int EXP_LVL1 CS_prjEnum (int index,ulong32_t *prj_flags,char *prj_keynm,int keynm_sz,char *prj_descr,int descr_sz)
 {
 	extern int cs_Error;
@@ -1184,7 +1277,6 @@ double EXP_LVL1 CS_getCurvatureAt (Const char *csKeyName,double lat)
 int EXP_LVL3  CS_prjprm (struct cs_Prjprm_ *result,unsigned short prj_code,int parm_nbr)
 {
 	extern struct cs_Prjprm_ csPrjprm [];
-	extern struct cs_PrjprmMap_ cs_PrjprmMap [];
 
 	int parm_idx;
 
@@ -1193,10 +1285,7 @@ int EXP_LVL3  CS_prjprm (struct cs_Prjprm_ *result,unsigned short prj_code,int p
 
 	char my_temp [256];
 
-	for (mp = cs_PrjprmMap;mp->prj_code != cs_PRJCOD_END;mp += 1)
-	{
-		if (mp->prj_code == prj_code) break;
-	}
+	mp = CS_prjprmMapPtr (prj_code);
 	if (mp->prj_code == cs_PRJCOD_END || parm_nbr < 0 || parm_nbr > 23)
 	{
 		return (-1);
@@ -1248,6 +1337,148 @@ int EXP_LVL3  CS_prjprm (struct cs_Prjprm_ *result,unsigned short prj_code,int p
 	}
 	return (1);
 }
+/**********************************************************************
+**	prjPtr = CS_prjtabPtr (prj_knm);
+**	mapPtr = CS_prjprmMapPtr (prj_code);
+**
+**	Locate the cs_Prjtab entry having the given projection key name, and
+**	the cs_PrjprmMap entry having the given projection code.  In both
+**	cases, a pointer to the terminating entry of the table is returned if
+**	there is no such entry; thus, the results may be tested exactly as
+**	the results of the linear searches which these functions replace.
+**	No error is reported.
+**
+**	Every coordinate system setup and definition check requires these
+**	look ups, so each table is indexed upon first use: an open addressed
+**	hash table of key names for cs_Prjtab, and a simple array indexed by
+**	projection code for cs_PrjprmMap.  Should the indices not be
+**	available, the tables are searched linearly.
+**********************************************************************/
+static int *csPrjSlots = NULL;
+static unsigned csPrjMask = 0U;
+static struct cs_Prjtab_ *csPrjEnd = NULL;
+static struct cs_PrjprmMap_ **csPrmMapIdx = NULL;
+static struct cs_PrjprmMap_ *csPrmMapEnd = NULL;
+static unsigned csPrmMapCount = 0U;
+
+void EXP_LVL7 CS_rlsPrjIndex (void)
+{
+	CS_free (csPrjSlots);
+	CS_free (csPrmMapIdx);
+	csPrjSlots = NULL;
+	csPrjMask = 0U;
+	csPrjEnd = NULL;
+	csPrmMapIdx = NULL;
+	csPrmMapEnd = NULL;
+	csPrmMapCount = 0U;
+}
+
+static int CSprjIndexSetup (void)
+{
+	extern struct cs_Prjtab_ cs_Prjtab [];
+
+	int tblIdx;
+	int hitIdx;
+	unsigned slot;
+	unsigned slotCount;
+
+	if (csPrjSlots != NULL)
+	{
+		return 0;
+	}
+	for (tblIdx = 0;cs_Prjtab [tblIdx].key_nm [0] != '\0';tblIdx += 1);
+	for (slotCount = 64U;slotCount < (unsigned)tblIdx * 2U;slotCount *= 2U);
+	csPrjSlots = (int *)CS_malc (slotCount * sizeof (int));
+	if (csPrjSlots == NULL)
+	{
+		return -1;
+	}
+	memset (csPrjSlots,0,slotCount * sizeof (int));
+	csPrjMask = slotCount - 1U;
+	csPrjEnd = &cs_Prjtab [tblIdx];
+
+	/* Each slot holds the table index plus one, zero marking an empty
+	   slot.  Only the first entry having a given key name is indexed. */
+	for (tblIdx = 0;cs_Prjtab [tblIdx].key_nm [0] != '\0';tblIdx += 1)
+	{
+		slot = CS_strihash (cs_Prjtab [tblIdx].key_nm,NULL) & csPrjMask;
+		for (hitIdx = 0;csPrjSlots [slot] != 0;slot = (slot + 1) & csPrjMask)
+		{
+			if (!CS_stricmp (cs_Prjtab [csPrjSlots [slot] - 1].key_nm,cs_Prjtab [tblIdx].key_nm))
+			{
+				hitIdx = 1;
+				break;
+			}
+		}
+		if (!hitIdx) csPrjSlots [slot] = tblIdx + 1;
+	}
+	return 0;
+}
+
+struct cs_Prjtab_ * EXP_LVL7 CS_prjtabPtr (Const char *prj_knm)
+{
+	extern struct cs_Prjtab_ cs_Prjtab [];
+
+	unsigned slot;
+	struct cs_Prjtab_ *pp;
+
+	if (CSprjIndexSetup () == 0)
+	{
+		for (slot = CS_strihash (prj_knm,NULL) & csPrjMask;csPrjSlots [slot] != 0;slot = (slot + 1) & csPrjMask)
+		{
+			pp = &cs_Prjtab [csPrjSlots [slot] - 1];
+			if (!CS_stricmp (pp->key_nm,prj_knm)) return pp;
+		}
+		return csPrjEnd;
+	}
+	for (pp = cs_Prjtab;pp->key_nm [0] != '\0';pp += 1)
+	{
+		if (!CS_stricmp (pp->key_nm,prj_knm)) break;
+	}
+	return pp;
+}
+
+struct cs_PrjprmMap_ * EXP_LVL7 CS_prjprmMapPtr (unsigned short prj_code)
+{
+	extern struct cs_PrjprmMap_ cs_PrjprmMap [];
+
+	unsigned code;
+	struct cs_PrjprmMap_ *mp;
+
+	if (csPrmMapIdx == NULL)
+	{
+		for (mp = cs_PrjprmMap;mp->prj_code != cs_PRJCOD_END;mp += 1)
+		{
+			if ((unsigned)mp->prj_code >= csPrmMapCount) csPrmMapCount = (unsigned)mp->prj_code + 1U;
+		}
+		csPrmMapIdx = (struct cs_PrjprmMap_ **)CS_malc (csPrmMapCount * sizeof (struct cs_PrjprmMap_ *));
+		if (csPrmMapIdx != NULL)
+		{
+			csPrmMapEnd = mp;
+			for (code = 0U;code < csPrmMapCount;code += 1U) csPrmMapIdx [code] = mp;
+
+			/* Work backwards, so that the first entry for a code prevails. */
+			while (mp != cs_PrjprmMap)
+			{
+				mp -= 1;
+				csPrmMapIdx [mp->prj_code] = mp;
+			}
+		}
+		else
+		{
+			csPrmMapCount = 0U;
+		}
+	}
+	if (csPrmMapIdx != NULL)
+	{
+		return (prj_code < csPrmMapCount) ? csPrmMapIdx [prj_code] : csPrmMapEnd;
+	}
+	for (mp = cs_PrjprmMap;mp->prj_code != cs_PRJCOD_END;mp += 1)
+	{
+		if (mp->prj_code == prj_code) break;
+	}
+	return mp;
+}
 double EXP_LVL3  CS_prmValue (Const struct cs_Csdef_ *csDefPtr,int parm_nbr)
 {
 	extern double cs_Mhuge;
@@ -1595,113 +1826,443 @@ void EXP_LVL3 CS_fillIn (struct cs_Csdef_ *csPtr)
 	return;
 }
 
-int EXP_LVL1 CS_csRangeEnumSetup (double longitude,double latitude)
+/*
+	The CS_csRangeEnumSetup functions use a resident R-tree over the useful
+	ranges of the coordinate system dictionary.  The tree is packed using
+	the Sort-Tile-Recursive method: the boxes of each level are sorted into
+	vertical slices by the longitude of their centers, each slice sorted by
+	latitude, and consecutive runs of csRANGE_FANOUT boxes become the nodes
+	of the next level.  The tree is built on first use and is rebuilt when
+	the size or modification time of the coordinate system dictionary
+	changes.  It is released by
+	CS_rlsRangeIndex, which CS_recvr calls.
+*/
+
+#define csRANGE_FANOUT 16
+
+/* The leaves and the nodes of the tree both start with the box, so that
+   the packing code can deal with either. */
+struct csRangeBox_
 {
-	extern char *cs_CsLlEnum;
+	double ll_min [2];
+	double ll_max [2];
+};
+struct csRangeLeaf_
+{
+	struct csRangeBox_ box;
+	long32_t recNbr;			/* position of the definition in the dictionary */
+	char key_nm [cs_KEYNM_DEF];
+	char group [24];
+};
+struct csRangeNode_
+{
+	struct csRangeBox_ box;
+	long32_t first;				/* first child, in the leaf array if this node
+								   is at the bottom level, else in the node
+								   array. */
+	long32_t count;
+};
+
+static char csRangeDictPath [MAXPATH] = "";
+static cs_Time_ csRangeDictTime = 0;
+static ulong32_t csRangeDictSize = 0UL;
+static struct csRangeLeaf_ *csRangeLeaves = NULL;
+static long32_t csRangeLeafCount = 0L;
+static struct csRangeNode_ *csRangeNodes = NULL;
+static long32_t csRangeBottomCount = 0L;		/* nodes which point at leaves */
+static long32_t csRangeNodeCount = 0L;			/* root is the last node */
+
+static int CScmpRangeX (Const void *pp,Const void *qq)
+{
+	double ppCtr;
+	double qqCtr;
+
+	ppCtr = ((Const struct csRangeBox_ *)pp)->ll_min [0] + ((Const struct csRangeBox_ *)pp)->ll_max [0];
+	qqCtr = ((Const struct csRangeBox_ *)qq)->ll_min [0] + ((Const struct csRangeBox_ *)qq)->ll_max [0];
+	return (ppCtr < qqCtr) ? -1 : ((ppCtr > qqCtr) ? 1 : 0);
+}
+static int CScmpRangeY (Const void *pp,Const void *qq)
+{
+	double ppCtr;
+	double qqCtr;
+
+	ppCtr = ((Const struct csRangeBox_ *)pp)->ll_min [1] + ((Const struct csRangeBox_ *)pp)->ll_max [1];
+	qqCtr = ((Const struct csRangeBox_ *)qq)->ll_min [1] + ((Const struct csRangeBox_ *)qq)->ll_max [1];
+	return (ppCtr < qqCtr) ? -1 : ((ppCtr > qqCtr) ? 1 : 0);
+}
+static int CScmpRangeHit (Const void *pp,Const void *qq)
+{
+	long32_t ppNbr;
+	long32_t qqNbr;
+
+	ppNbr = (*(Const struct csRangeLeaf_ * Const *)pp)->recNbr;
+	qqNbr = (*(Const struct csRangeLeaf_ * Const *)qq)->recNbr;
+	return (ppNbr < qqNbr) ? -1 : ((ppNbr > qqNbr) ? 1 : 0);
+}
+
+/* Orders count boxes, each itemSize bytes long, for packing. */
+static void CSstrSort (void *items,long32_t count,size_t itemSize)
+{
+	long32_t start;
+	long32_t sliceSize;
+	long32_t nodeCount;
+	long32_t sliceCount;
+
+	if (count <= csRANGE_FANOUT) return;
+	nodeCount = (count + csRANGE_FANOUT - 1) / csRANGE_FANOUT;
+	sliceCount = (long32_t)ceil (sqrt ((double)nodeCount));
+	sliceSize = sliceCount * csRANGE_FANOUT;
+	qsort (items,(size_t)count,itemSize,CScmpRangeX);
+	for (start = 0L;start < count;start += sliceSize)
+	{
+		qsort ((char *)items + (size_t)start * itemSize,
+			   (size_t)(((count - start) < sliceSize) ? (count - start) : sliceSize),
+			   itemSize,CScmpRangeY);
+	}
+}
+
+/* Adds a node for each run of csRANGE_FANOUT boxes in items; firstBase is
+   the index of the first item in the array the node will refer to. */
+static void CSstrPack (struct csRangeNode_ *nodes,Const void *items,long32_t count,size_t itemSize,long32_t firstBase)
+{
+	long32_t ii;
+	long32_t jj;
+	Const struct csRangeBox_ *boxPtr;
+
+	for (ii = 0L;ii < count;ii += csRANGE_FANOUT)
+	{
+		nodes->first = firstBase + ii;
+		nodes->count = ((count - ii) < csRANGE_FANOUT) ? (count - ii) : csRANGE_FANOUT;
+		boxPtr = (Const struct csRangeBox_ *)((Const char *)items + (size_t)ii * itemSize);
+		nodes->box = *boxPtr;
+		for (jj = 1L;jj < nodes->count;jj += 1L)
+		{
+			boxPtr = (Const struct csRangeBox_ *)((Const char *)boxPtr + itemSize);
+			if (boxPtr->ll_min [0] < nodes->box.ll_min [0]) nodes->box.ll_min [0] = boxPtr->ll_min [0];
+			if (boxPtr->ll_min [1] < nodes->box.ll_min [1]) nodes->box.ll_min [1] = boxPtr->ll_min [1];
+			if (boxPtr->ll_max [0] > nodes->box.ll_max [0]) nodes->box.ll_max [0] = boxPtr->ll_max [0];
+			if (boxPtr->ll_max [1] > nodes->box.ll_max [1]) nodes->box.ll_max [1] = boxPtr->ll_max [1];
+		}
+		nodes += 1;
+	}
+}
+
+void EXP_LVL7 CS_rlsRangeIndex (void)
+{
+	CS_free (csRangeLeaves);
+	CS_free (csRangeNodes);
+	csRangeLeaves = NULL;
+	csRangeNodes = NULL;
+	csRangeLeafCount = 0L;
+	csRangeBottomCount = 0L;
+	csRangeNodeCount = 0L;
+	csRangeDictPath [0] = '\0';
+	csRangeDictTime = 0;
+	csRangeDictSize = 0UL;
+}
+
+/* Makes sure the tree reflects the current coordinate system dictionary. */
+static int CSrangeIndexSetup (void)
+{
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern char cs_Csname [];
 
 	int st;
-	int result;
-	int count;
 	int crypt;
 
-	size_t len;
-	size_t malc_size;
-	size_t used_size;
+	long32_t recNbr;
+	long32_t leafAlloc;
+	long32_t nodeAlloc;
+	long32_t levelStart;
+	long32_t levelCount;
 
-	char *cp;
-	char *new_ptr;
-	char *tmp_ptr;
+	cs_Time_ dictTime;
+	ulong32_t dictSize;
 	csFILE *strm;
+	struct csRangeLeaf_ *leafPtr;
 
- 	__ALIGNMENT__1				/* Required by some Sun compilers. */
+	__ALIGNMENT__1				/* Required by some Sun compilers. */
 	struct cs_Csdef_ cs_def;
 
+	CS_stcpy (cs_DirP,cs_Csname);
+	dictTime = CS_fileModTime (cs_Dir);
+	dictSize = CS_fileSize (cs_Dir);
+	if (csRangeLeaves != NULL && dictTime == csRangeDictTime && dictSize == csRangeDictSize &&
+		!CS_stricmp (cs_Dir,csRangeDictPath))
+	{
+		return 0;
+	}
+	CS_rlsRangeIndex ();
+
+	/* Collect the useful range of every definition.  A range whose
+	   minimum exceeds its maximum can never contain anything. */
+	strm = CS_csopn (_STRM_BINRD);
+	if (strm == NULL)
+	{
+		return -1;
+	}
+	leafAlloc = 0L;
+	recNbr = 0L;
+	while ((st = CS_csrd (strm,&cs_def,&crypt)) > 0)
+	{
+		if (cs_def.ll_min [0] <= cs_def.ll_max [0] && cs_def.ll_min [1] <= cs_def.ll_max [1])
+		{
+			if (csRangeLeafCount >= leafAlloc)
+			{
+				leafAlloc += 1024L;
+				leafPtr = (struct csRangeLeaf_ *)CS_ralc (csRangeLeaves,(size_t)leafAlloc * sizeof (struct csRangeLeaf_));
+				if (leafPtr == NULL)
+				{
+					CS_erpt (cs_NO_MEM);
+					st = -1;
+					break;
+				}
+				csRangeLeaves = leafPtr;
+			}
+			leafPtr = &csRangeLeaves [csRangeLeafCount++];
+			leafPtr->box.ll_min [0] = cs_def.ll_min [0];
+			leafPtr->box.ll_min [1] = cs_def.ll_min [1];
+			leafPtr->box.ll_max [0] = cs_def.ll_max [0];
+			leafPtr->box.ll_max [1] = cs_def.ll_max [1];
+			leafPtr->recNbr = recNbr;
+			CS_stncp (leafPtr->key_nm,cs_def.key_nm,sizeof (leafPtr->key_nm));
+			CS_stncp (leafPtr->group,cs_def.group,sizeof (leafPtr->group));
+		}
+		recNbr += 1L;
+	}
+	CS_csDictCls (strm);
+	if (st < 0) goto error;
+
+	/* Pack the tree, bottom up. */
+	nodeAlloc = 1L;
+	for (levelCount = csRangeLeafCount;levelCount > 1L;)
+	{
+		levelCount = (levelCount + csRANGE_FANOUT - 1) / csRANGE_FANOUT;
+		nodeAlloc += levelCount;
+	}
+	csRangeNodes = (struct csRangeNode_ *)CS_malc ((size_t)nodeAlloc * sizeof (struct csRangeNode_));
+	if (csRangeNodes == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	if (csRangeLeafCount > 0L)
+	{
+		CSstrSort (csRangeLeaves,csRangeLeafCount,sizeof (struct csRangeLeaf_));
+		CSstrPack (csRangeNodes,csRangeLeaves,csRangeLeafCount,sizeof (struct csRangeLeaf_),0L);
+		csRangeBottomCount = (csRangeLeafCount + csRANGE_FANOUT - 1) / csRANGE_FANOUT;
+		csRangeNodeCount = csRangeBottomCount;
+		levelStart = 0L;
+		levelCount = csRangeBottomCount;
+		while (levelCount > 1L)
+		{
+			CSstrSort (&csRangeNodes [levelStart],levelCount,sizeof (struct csRangeNode_));
+			CSstrPack (&csRangeNodes [csRangeNodeCount],&csRangeNodes [levelStart],levelCount,sizeof (struct csRangeNode_),levelStart);
+			levelStart = csRangeNodeCount;
+			levelCount = (levelCount + csRANGE_FANOUT - 1) / csRANGE_FANOUT;
+			csRangeNodeCount += levelCount;
+		}
+	}
+	CS_stncp (csRangeDictPath,cs_Dir,sizeof (csRangeDictPath));
+	csRangeDictTime = dictTime;
+	csRangeDictSize = dictSize;
+	return 0;
+
+error:
+	CS_rlsRangeIndex ();
+	return -1;
+}
+static int CSrangeContains (Const struct csRangeBox_ *box,Const struct csRangeBox_ *qry)
+{
+	return (box->ll_min [0] <= qry->ll_min [0] && box->ll_min [1] <= qry->ll_min [1] &&
+			box->ll_max [0] >= qry->ll_max [0] && box->ll_max [1] >= qry->ll_max [1]);
+}
+
+/* Adds to hits every leaf below the indicated node whose range contains
+   the query box, returns the new hit count.  A node is the union of its
+   children, so a node which does not contain the query box cannot have a
+   child which does. */
+static long32_t CSrangeSearch (long32_t nodeIdx,Const struct csRangeBox_ *qry,Const struct csRangeLeaf_ **hits,long32_t hitCount)
+{
+	long32_t ii;
+	long32_t last;
+	Const struct csRangeNode_ *nodePtr;
+
+	nodePtr = &csRangeNodes [nodeIdx];
+	if (!CSrangeContains (&nodePtr->box,qry))
+	{
+		return hitCount;
+	}
+	last = nodePtr->first + nodePtr->count;
+	for (ii = nodePtr->first;ii < last;ii += 1L)
+	{
+		if (nodeIdx < csRangeBottomCount)
+		{
+			if (CSrangeContains (&csRangeLeaves [ii].box,qry))
+			{
+				hits [hitCount++] = &csRangeLeaves [ii];
+			}
+		}
+		else
+		{
+			hitCount = CSrangeSearch (ii,qry,hits,hitCount);
+		}
+	}
+	return hitCount;
+}
+
+int EXP_LVL1 CS_csRangeEnumSetup (double longitude,double latitude)
+{
+	double ll [2];
+
+	ll [0] = longitude;
+	ll [1] = latitude;
+	return CS_csRangeEnumSetupEx (ll,ll,NULL,NULL);
+}
+
+/* Sets up the CS_csRangeEnum list to the coordinate systems whose useful
+   range contains the entire box, optionally limited to those in the named
+   group and/or category.  The list is in dictionary order.  Returns the
+   number of coordinate systems in the list, or -1. */
+int EXP_LVL3 CS_csRangeEnumSetupEx (Const double ll_min [2],Const double ll_max [2],Const char *grp_name,Const char *cat_name)
+{
+	extern char *cs_CsLlEnum;
+
+	int result;
+
+	ulong32_t jj;
+	long32_t ii;
+	long32_t hitCount;
+	long32_t keepCount;
+	size_t listSize;
+
+	char *cp;
+	Const struct csRangeLeaf_ **hits;
+	struct cs_Ctdef_ *ctDef;
+	struct csRangeBox_ qry;
+
 	/* We assume we failed until we know different. */
 	result = -1;
-	count = 0;
+	hits = NULL;
+	ctDef = NULL;
 	if (cs_CsLlEnum != NULL)
 	{
 		CS_free (cs_CsLlEnum);
 		cs_CsLlEnum = NULL;
 	}
-	malc_size = 8196;
-	used_size = 0;
-	new_ptr = (char *)CS_malc (malc_size);
-	if (new_ptr == NULL)
+
+	if (CSrangeIndexSetup () != 0)
 	{
-		CS_erpt (cs_NO_MEM);
+		goto error;
 	}
-	else
+	if (cat_name != NULL && *cat_name != '\0')
 	{
-		/* Open the coordinate system dictionary, we're going to look at each definition. */
-		strm = CS_csopn (_STRM_BINRD);
-		if (strm != NULL)
+		ctDef = CSgetCtDef (cat_name);
+		if (ctDef == NULL)
 		{
-			while ((st = CS_csrd (strm,&cs_def,&crypt)) > 0)
-			{
-				/* See if the current entry meets the indeicated criteria. */
-				if (longitude >= cs_def.ll_min [0] && latitude >= cs_def.ll_min [1] &&
-					longitude <= cs_def.ll_max [0] && latitude <= cs_def.ll_max [1])
-				{
-					/* Add the keyname to the list. */
-					len = strlen (cs_def.key_nm);
-					if ((used_size + len + 2) >= malc_size)
-					{
-						malc_size += 2048;
-						tmp_ptr = (char *)CS_ralc (new_ptr,malc_size);
-						if (tmp_ptr == NULL)
-						{
-							st = -1;
-							CS_erpt (cs_NO_MEM);
-							CS_free (new_ptr);
-							new_ptr = NULL;
-							break;
-						}
-						new_ptr = tmp_ptr;
-					}
+			goto error;
+		}
+	}
 
-					/* Add the new item to the list. Must recalculate cp
-					   in case the realloc has moved the list to new memory. */
-					cp = new_ptr + used_size;
-					cp = CS_stcpy (cp,cs_def.key_nm);
-					used_size += len + 1;
+	qry.ll_min [0] = ll_min [0];
+	qry.ll_min [1] = ll_min [1];
+	qry.ll_max [0] = ll_max [0];
+	qry.ll_max [1] = ll_max [1];
+	hitCount = 0L;
+	if (csRangeNodeCount > 0L)
+	{
+		hits = (Const struct csRangeLeaf_ **)CS_malc ((size_t)csRangeLeafCount * sizeof (*hits));
+		if (hits == NULL)
+		{
+			CS_erpt (cs_NO_MEM);
+			goto error;
+		}
+		hitCount = CSrangeSearch (csRangeNodeCount - 1L,&qry,hits,0L);
+	}
 
-					/* Count it. */
-					count += 1;
-				}
+	/* Apply the filters, and return the list to dictionary order. */
+	keepCount = 0L;
+	listSize = 1;
+	for (ii = 0L;ii < hitCount;ii += 1L)
+	{
+		if (grp_name != NULL && *grp_name != '\0' && CS_stricmp (hits [ii]->group,grp_name))
+		{
+			continue;
+		}
+		if (ctDef != NULL)
+		{
+			for (jj = 0UL;jj < ctDef->nameCnt;jj += 1UL)
+			{
+				if (!CS_stricmp (ctDef->csNames [jj].csName,hits [ii]->key_nm)) break;
 			}
-			CS_csDictCls (strm);
-			if (st >= 0)
+			if (jj >= ctDef->nameCnt)
 			{
-				if (new_ptr != NULL)
-				{
-					/* List generated without an error. Make sure the whole list
-					   is properly terminated, and resize down to the minimum
-					   amount of memory necessary. */
-
-					*(new_ptr + used_size) = '\0';
-					used_size += 1;
-					cs_CsLlEnum = (char *)CS_ralc (new_ptr,used_size);
-					if (cs_CsLlEnum != NULL)
-					{
-						/* Success */
-						new_ptr = NULL;
-						result = count;
-					}
-					else
-					{
-						/* Failure */
-						CS_erpt (cs_NO_MEM);
-					}
-				}
+				continue;
 			}
 		}
-		if (new_ptr != NULL)
+		listSize += strlen (hits [ii]->key_nm) + 1;
+		hits [keepCount++] = hits [ii];
+	}
+	if (keepCount > 1L)
+	{
+		qsort (hits,(size_t)keepCount,sizeof (*hits),CScmpRangeHit);
+	}
+
+	/* Produce the list in the form CS_csRangeEnum expects. */
+	cs_CsLlEnum = (char *)CS_malc (listSize);
+	if (cs_CsLlEnum == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	cp = cs_CsLlEnum;
+	for (ii = 0L;ii < keepCount;ii += 1L)
+	{
+		cp = CS_stcpy (cp,hits [ii]->key_nm) + 1;
+	}
+	*cp = '\0';
+	result = (int)keepCount;
+
+error:
+	if (hits != NULL)
+	{
+		CS_free ((void *)hits);
+	}
+	CSrlsCategory (ctDef);
+	return result;
+}
+
+/* Sets up the CS_csRangeEnum list to the coordinate systems whose useful
+   range contains every one of the count points in ll. */
+int EXP_LVL3 CS_csRangeEnumSetupN (Const double ll [][2],int count,Const char *grp_name,Const char *cat_name)
+{
+	extern char *cs_CsLlEnum;
+
+	int ii;
+	double ll_min [2];
+	double ll_max [2];
+
+	if (count <= 0)
+	{
+		if (cs_CsLlEnum != NULL)
 		{
-			CS_free (new_ptr);
+			CS_free (cs_CsLlEnum);
+			cs_CsLlEnum = NULL;
 		}
+		CS_erpt (cs_INV_ARG2);
+		return -1;
 	}
-	return result;
+	ll_min [0] = ll_max [0] = ll [0][0];
+	ll_min [1] = ll_max [1] = ll [0][1];
+	for (ii = 1;ii < count;ii += 1)
+	{
+		if (ll [ii][0] < ll_min [0]) ll_min [0] = ll [ii][0];
+		if (ll [ii][1] < ll_min [1]) ll_min [1] = ll [ii][1];
+		if (ll [ii][0] > ll_max [0]) ll_max [0] = ll [ii][0];
+		if (ll [ii][1] > ll_max [1]) ll_max [1] = ll [ii][1];
+	}
+	return CS_csRangeEnumSetupEx (ll_min,ll_max,grp_name,cat_name);
 }
 
 int EXP_LVL1 CS_csRangeEnum (int index,char *key_name,int size)
@@ -45,7 +45,153 @@
 	The index is designed so that applications should never access the
 	global variables directly; all access is through a small set of simple
 	functions.  Thus, the application should be fairly well insulated from
-	changes in the index. */
+	changes in the index.
+
+	Along with the array, CSgenerateGxIndex builds four chained hash tables
+	over it, keyed (case insensitively) by transformation name, by source
+	datum, by target datum, and by the source/target datum pair.  Entries
+	for which the inverse is supported appear a second time in the datum
+	tables, under the target datum in the source table and so on, flagged
+	as inverse.  The chains are in index order, so that each of the locate
+	functions below produces exactly what a linear search of the array
+	would, but without examining entries with some other key.  The tables
+	occupy a single bucket array (cs_GxHashBuckets, cs_GxHashSize buckets
+	per table) and a single node array (cs_GxHashNodes). */
+
+/* Returns the first node of the chain for the given key in the indicated
+   table, or -1 if the chain is empty (or the tables do not exist). */
+static int CSgxHashChain (int table,Const char* key1,Const char* key2)
+{
+	extern int* cs_GxHashBuckets;
+	extern unsigned cs_GxHashSize;
+
+	unsigned bucket;
+
+	if (cs_GxHashBuckets == NULL)
+	{
+		return -1;
+	}
+	bucket = CS_strihash (key1,key2) & (cs_GxHashSize - 1);
+	return cs_GxHashBuckets [(unsigned)table * cs_GxHashSize + bucket];
+}
+
+/* Adds a node to the front of the appropriate chain. */
+static void CSgxHashAdd (int table,Const char* key1,Const char* key2,unsigned gxIndex,short direction,int nodeNbr)
+{
+	extern int* cs_GxHashBuckets;
+	extern unsigned cs_GxHashSize;
+	extern struct cs_GxHashNode_* cs_GxHashNodes;
+
+	unsigned bucket;
+	int* headPtr;
+	struct cs_GxHashNode_* nodePtr;
+
+	bucket = CS_strihash (key1,key2) & (cs_GxHashSize - 1);
+	headPtr = cs_GxHashBuckets + ((unsigned)table * cs_GxHashSize + bucket);
+	nodePtr = cs_GxHashNodes + nodeNbr;
+	nodePtr->gxIndex = gxIndex;
+	nodePtr->direction = direction;
+	nodePtr->next = *headPtr;
+	*headPtr = nodeNbr;
+}
+
+/* Locates the first entry at or after startAt which converts from srcDtmName
+   to trgDtmName in the indicated direction. */
+static int CSlocateGxPair (unsigned startAt,Const char* srcDtmName,Const char* trgDtmName,short direction)
+{
+	extern struct cs_GxIndex_* cs_GxIndex;
+	extern struct cs_GxHashNode_* cs_GxHashNodes;
+
+	int result;
+	int nodeNbr;
+
+	struct cs_GxIndex_* entry;
+	struct cs_GxHashNode_* nodePtr;
+
+	result = cs_GXIDX_ERROR;
+	if (CS_getGxIndexCount () > 0)
+	{
+		result = cs_GXIDX_NOXFRM;
+		for (nodeNbr = CSgxHashChain (cs_GXHASH_PAIR,srcDtmName,trgDtmName);nodeNbr >= 0;nodeNbr = nodePtr->next)
+		{
+			nodePtr = cs_GxHashNodes + nodeNbr;
+			if (nodePtr->direction != direction || nodePtr->gxIndex < startAt)
+			{
+				continue;
+			}
+			entry = cs_GxIndex + nodePtr->gxIndex;
+			if (direction == cs_DTCDIR_INV)
+			{
+				if (!CS_stricmp (entry->trgDatum,srcDtmName) && !CS_stricmp (entry->srcDatum,trgDtmName))
+				{
+					result = (int)nodePtr->gxIndex;
+					break;
+				}
+			}
+			else if (!CS_stricmp (entry->srcDatum,srcDtmName) && !CS_stricmp (entry->trgDatum,trgDtmName))
+			{
+				result = (int)nodePtr->gxIndex;
+				break;
+			}
+		}
+	}
+	return result;
+}
+
+/* Locates the single entry which converts from (table cs_GXHASH_FROM) or to
+   (table cs_GXHASH_TO) the named datum, in either direction. */
+static int CSlocateGxDatum (int* direction,int table,Const char* dtmName)
+{
+	extern struct cs_GxIndex_* cs_GxIndex;
+	extern struct cs_GxHashNode_* cs_GxHashNodes;
+
+	int result;
+	int nodeNbr;
+	int myDirection;
+
+	Const char* keyPtr;
+	struct cs_GxIndex_* entry;
+	struct cs_GxHashNode_* nodePtr;
+
+	result = cs_GXIDX_ERROR;
+	myDirection = cs_DTCDIR_NONE;
+	if (CS_getGxIndexCount () > 0)
+	{
+		result = cs_GXIDX_NOXFRM;
+		for (nodeNbr = CSgxHashChain (table,dtmName,NULL);nodeNbr >= 0;nodeNbr = nodePtr->next)
+		{
+			nodePtr = cs_GxHashNodes + nodeNbr;
+			entry = cs_GxIndex + nodePtr->gxIndex;
+			if ((table == cs_GXHASH_FROM) == (nodePtr->direction == cs_DTCDIR_FWD))
+			{
+				keyPtr = entry->srcDatum;
+			}
+			else
+			{
+				keyPtr = entry->trgDatum;
+			}
+			if (CS_stricmp (keyPtr,dtmName) != 0)
+			{
+				continue;
+			}
+			if (result == cs_GXIDX_NOXFRM)
+			{
+				result = (int)nodePtr->gxIndex;
+				myDirection = nodePtr->direction;
+			}
+			else
+			{
+				result = cs_GXIDX_DUPXFRM;
+				myDirection = cs_DTCDIR_NONE;
+			}
+		}
+	}
+	if (result >= 0)
+	{
+		*direction = myDirection;
+	}
+	return result;
+}
 
 /* Get a pointer to the index; generates the index if required. */	
 struct cs_GxIndex_* CS_getGxIndexPtr ()
@@ -66,6 +212,9 @@ void CS_releaseGxIndex (void)
 {
 	extern struct cs_GxIndex_* cs_GxIndex;
 	extern unsigned cs_GxIndexCount;
+	extern int* cs_GxHashBuckets;
+	extern unsigned cs_GxHashSize;
+	extern struct cs_GxHashNode_* cs_GxHashNodes;
 
 	if (cs_GxIndex != NULL)
 	{
@@ -73,6 +222,17 @@ void CS_releaseGxIndex (void)
 		cs_GxIndex = NULL;
 	}
 	cs_GxIndexCount = 0;
+	if (cs_GxHashBuckets != NULL)
+	{
+		CS_free (cs_GxHashBuckets);
+		cs_GxHashBuckets = NULL;
+	}
+	if (cs_GxHashNodes != NULL)
+	{
+		CS_free (cs_GxHashNodes);
+		cs_GxHashNodes = NULL;
+	}
+	cs_GxHashSize = 0;
 }
 
 /* Returns the number of entries in the Geodetic Transformation Index.
@@ -109,30 +269,25 @@ Const struct cs_GxIndex_* CS_getGxIndexEntry (unsigned index)
 
 int CS_locateGxByName (Const char* xfrmName)
 {
-	int result;
-	unsigned index;
+	extern struct cs_GxIndex_* cs_GxIndex;
+	extern struct cs_GxHashNode_* cs_GxHashNodes;
 
-	unsigned indexCount;
+	int result;
+	int nodeNbr;
 
-	struct cs_GxIndex_* entry;
-	struct cs_GxIndex_* gxIndex;
+	struct cs_GxHashNode_* nodePtr;
 
 	result = cs_GXIDX_ERROR;
-	gxIndex = CS_getGxIndexPtr ();
-	if (gxIndex != NULL)
+	if (CS_getGxIndexCount () > 0)
 	{
-		indexCount = CS_getGxIndexCount ();
-		if (indexCount > 0)
+		result = cs_GXIDX_NOXFRM;
+		for (nodeNbr = CSgxHashChain (cs_GXHASH_NAME,xfrmName,NULL);nodeNbr >= 0;nodeNbr = nodePtr->next)
 		{
-			result = cs_GXIDX_NOXFRM;
-			for (index = 0;index < indexCount;index += 1)
+			nodePtr = cs_GxHashNodes + nodeNbr;
+			if (!CS_stricmp (cs_GxIndex [nodePtr->gxIndex].xfrmName,xfrmName))
 			{
-				entry = (gxIndex + index);
-				if (!CS_stricmp (entry->xfrmName,xfrmName))
-				{
-					result = (int)index;
-					break;
-				}
+				result = (int)nodePtr->gxIndex;
+				break;
 			}
 		}
 	}
@@ -141,156 +296,15 @@ int CS_locateGxByName (Const char* xfrmName)
 
 int CS_locateGxFromDatum (int* direction,Const char* srcDtmName)
 {
-	int result;
-	int myDirection;
-
-	unsigned index;
-	unsigned indexCount;
-
-	struct cs_GxIndex_* entry;
-	struct cs_GxIndex_* gxIndex;
-
-	result = cs_GXIDX_ERROR;
-	myDirection = cs_DTCDIR_NONE;
-	gxIndex = CS_getGxIndexPtr ();
-	if (gxIndex != NULL)
-	{
-		indexCount = CS_getGxIndexCount ();
-		if (indexCount > 0)
-		{
-			result = cs_GXIDX_NOXFRM;
-			for (index = 0;index < indexCount;index += 1)
-			{
-				entry = (gxIndex + index);
-				if (CS_stricmp (entry->srcDatum,srcDtmName) == 0)
-				{
-					if (result == cs_GXIDX_NOXFRM)
-					{
-						result = index;
-						myDirection = cs_DTCDIR_FWD;
-					}
-					else
-					{
-						result = cs_GXIDX_DUPXFRM;
-						myDirection = cs_DTCDIR_NONE;
-					}
-				}
-				if (entry->inverseSupported &&
-					CS_stricmp (entry->trgDatum,srcDtmName) == 0)
-				{
-					if (result == cs_GXIDX_NOXFRM)
-					{
-						result = index;
-						myDirection = cs_DTCDIR_INV;
-					}
-					else
-					{
-						result = cs_GXIDX_DUPXFRM;
-						myDirection = cs_DTCDIR_NONE;
-					}
-				}
-			}
-		}
-	}
-	if (result >= 0)
-	{
-		*direction = myDirection;
-	}
-	return result;
+	return CSlocateGxDatum (direction,cs_GXHASH_FROM,srcDtmName);
 }
 int CS_locateGxToDatum (int* direction,Const char* trgDtmName)
 {
-	int result;
-	int myDirection;
-
-	unsigned index;
-	unsigned indexCount;
-
-	struct cs_GxIndex_* entry;
-	struct cs_GxIndex_* gxIndex;
-
-	result = cs_GXIDX_ERROR;
-	myDirection = cs_DTCDIR_NONE;
-	gxIndex = CS_getGxIndexPtr ();
-	if (gxIndex != NULL)
-	{
-		indexCount = CS_getGxIndexCount ();
-		if (indexCount > 0)
-		{
-			result = cs_GXIDX_NOXFRM;
-			for (index = 0;index < indexCount;index += 1)
-			{
-				entry = (gxIndex + index);
-				if (CS_stricmp (entry->trgDatum,trgDtmName) == 0)
-				{
-					if (result == cs_GXIDX_NOXFRM)
-					{
-						result = index;
-						myDirection = cs_DTCDIR_FWD;
-					}
-					else
-					{
-						result = cs_GXIDX_DUPXFRM;
-						myDirection = cs_DTCDIR_NONE;
-					}
-				}
-				if (entry->inverseSupported &&
-					CS_stricmp (entry->srcDatum,trgDtmName) == 0)
-				{
-					if (result == cs_GXIDX_NOXFRM)
-					{
-						result = index;
-						myDirection = cs_DTCDIR_INV;
-					}
-					else
-					{
-						result = cs_GXIDX_DUPXFRM;
-						myDirection = cs_DTCDIR_NONE;
-					}
-				}
-			}
-		}
-	}
-	if (result >= 0)
-	{
-		*direction = myDirection;
-	}
-	return result;
+	return CSlocateGxDatum (direction,cs_GXHASH_TO,trgDtmName);
 }
 int CS_locateGxByDatum (unsigned startAt,Const char* srcDtmName,Const char* trgDtmName)
 {
-	int result;
-	int srcMtch;
-	int trgMtch;
-
-	unsigned index;
-	unsigned indexCount;
-
-	struct cs_GxIndex_* entry;
-	struct cs_GxIndex_* gxIndex;
-
-	result = cs_GXIDX_ERROR;
-	gxIndex = CS_getGxIndexPtr ();
-	if (gxIndex != NULL)
-	{
-		indexCount = CS_getGxIndexCount ();
-		if (indexCount > 0)
-		{
-			result = cs_GXIDX_NOXFRM;
-			for (index = startAt;index < indexCount;index += 1)
-			{
-				entry = (gxIndex + index);
-				srcMtch = (CS_stricmp (entry->srcDatum,srcDtmName) == 0);
-				trgMtch = (CS_stricmp (entry->trgDatum,trgDtmName) == 0);
-				if (srcMtch && trgMtch)
-				{
-					result = (int)index;
-					break;
-				}
-			}
-		}
-	}
-	return result;
+	return CSlocateGxPair (startAt,srcDtmName,trgDtmName,cs_DTCDIR_FWD);
 }
 
 /* Select the better suitable geodetic transformation out of two.
@@ -321,8 +335,6 @@ int CS_locateGxByDatum2 (int* direction,Const char* srcDtmName,Const char* trgDt
 	unsigned startAt;
 	unsigned xfrmCount;
 
-	Const struct cs_GxIndex_* gxIdxPtr;
-
 	char errMsg [256];
 
 	/* We haven't found anything yet. */
@@ -384,26 +396,21 @@ int CS_locateGxByDatum2 (int* direction,Const char* srcDtmName,Const char* trgDt
 		xfrmCount = 0;
 		while (result >= 0)
 		{
-			result = CS_locateGxByDatum (startAt,trgDtmName,srcDtmName);
+			/* Only entries which support the inverse are indexed in this
+			   direction. */
+			result = CSlocateGxPair (startAt,srcDtmName,trgDtmName,cs_DTCDIR_INV);
 			if (result >= 0)
 			{
-				/* Since a positive result value indicates that the entry
-				   does indeed exist, the following function cannot fail to
-				   produce a valid pointer. */
-				gxIdxPtr = CS_getGxIndexEntry ((unsigned)result);
-				if (gxIdxPtr->inverseSupported)		/*lint !e613  possible use of null pointer */
+				xfrmCount += 1;
+				if (chosenResult < 0)
+				{
+					chosenResult = result;
+				}
+				else
 				{
-					xfrmCount += 1;
-					if (chosenResult < 0)
-					{
-						chosenResult = result;
-					}
-					else
-					{
-						/* When more than one suitable geodetic transformation is found the best one is selected. */
-						chosenResult = CS_selectAccurateGxIndex((unsigned int)chosenResult,(unsigned int)result);
-						if (chosenResult < 0) goto error;
-					}
+					/* When more than one suitable geodetic transformation is found the best one is selected. */
+					chosenResult = CS_selectAccurateGxIndex((unsigned int)chosenResult,(unsigned int)result);
+					if (chosenResult < 0) goto error;
 				}
 				startAt = (unsigned)result + 1;
 			}
@@ -435,9 +442,14 @@ void CSgenerateGxIndex (void)
 {
 	extern struct cs_GxIndex_* cs_GxIndex;
 	extern unsigned cs_GxIndexCount;
+	extern int* cs_GxHashBuckets;
+	extern unsigned cs_GxHashSize;
+	extern struct cs_GxHashNode_* cs_GxHashNodes;
 
 	int i;
 	int gxCount;
+	int nodeCount;
+	unsigned bucket;
 
 	struct cs_GxIndex_* gxIdxPtr;
 
@@ -486,6 +498,46 @@ void CSgenerateGxIndex (void)
 	gxIdxPtr->accuracy = 0.0;
 	gxIdxPtr->inverseSupported = 0;
 	
+	//build the hash tables; each entry appears once in each table, and once
+	//more in each of the three datum tables if its inverse is supported.
+	//Entries are added in reverse so that each chain ends up in index order.
+	nodeCount = gxCount;
+	for (i = 0; i < gxCount; ++i)
+	{
+		nodeCount += (cs_GxIndex [i].inverseSupported) ? 6 : 3;
+	}
+	cs_GxHashSize = 64;
+	while (cs_GxHashSize < (unsigned)gxCount * 2U)
+	{
+		cs_GxHashSize <<= 1;
+	}
+	cs_GxHashBuckets = (int*)CS_malc (sizeof (int) * cs_GxHashSize * cs_GXHASH_COUNT);
+	cs_GxHashNodes = (struct cs_GxHashNode_*)CS_malc (sizeof (struct cs_GxHashNode_) * (nodeCount + 1));
+	if (NULL == cs_GxHashBuckets || NULL == cs_GxHashNodes)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	for (bucket = 0; bucket < cs_GxHashSize * cs_GXHASH_COUNT; ++bucket)
+	{
+		cs_GxHashBuckets [bucket] = -1;
+	}
+	nodeCount = 0;
+	for (i = gxCount - 1; i >= 0; --i)
+	{
+		gxIdxPtr = cs_GxIndex + i;
+		CSgxHashAdd (cs_GXHASH_NAME,gxIdxPtr->xfrmName,NULL,(unsigned)i,cs_DTCDIR_FWD,nodeCount++);
+		CSgxHashAdd (cs_GXHASH_FROM,gxIdxPtr->srcDatum,NULL,(unsigned)i,cs_DTCDIR_FWD,nodeCount++);
+		CSgxHashAdd (cs_GXHASH_TO,gxIdxPtr->trgDatum,NULL,(unsigned)i,cs_DTCDIR_FWD,nodeCount++);
+		CSgxHashAdd (cs_GXHASH_PAIR,gxIdxPtr->srcDatum,gxIdxPtr->trgDatum,(unsigned)i,cs_DTCDIR_FWD,nodeCount++);
+		if (gxIdxPtr->inverseSupported)
+		{
+			CSgxHashAdd (cs_GXHASH_FROM,gxIdxPtr->trgDatum,NULL,(unsigned)i,cs_DTCDIR_INV,nodeCount++);
+			CSgxHashAdd (cs_GXHASH_TO,gxIdxPtr->srcDatum,NULL,(unsigned)i,cs_DTCDIR_INV,nodeCount++);
+			CSgxHashAdd (cs_GXHASH_PAIR,gxIdxPtr->trgDatum,gxIdxPtr->srcDatum,(unsigned)i,cs_DTCDIR_INV,nodeCount++);
+		}
+	}
+
 	cs_GxIndexCount = (unsigned) gxCount;
 
 	if (NULL != pAllGxDefs)
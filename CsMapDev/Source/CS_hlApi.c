@@ -68,16 +68,18 @@ void EXP_LVL1 CS_fast (int mode)
    This should be verified when resources permit. */
 /*lint -e794  possible use of a null pointer */
 
-int EXP_LVL1 CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3])
-
+/* The body common to CS_cnvrt, CS_cnvrt3D, CS_cnvrtEpsg, and
+   CS_cnvrtEpsg3D.  src_ptr and dst_ptr are the results of the cache
+   lookups; a NULL pointer indicates that the lookup failed, and has
+   reported the error. */
+static int CScnvrtCs (Const char *modl_name,struct cs_Csprm_ *src_ptr,
+											struct cs_Csprm_ *dst_ptr,
+											double coord [3],
+											int threeD)
 {
 	extern int cs_Error;
 	extern csFILE* csDiagnostic;
 
-	static char modl_name [] = "CS_cnvrt";
-
-	struct cs_Csprm_ *src_ptr;
-	struct cs_Csprm_ *dst_ptr;
 	struct cs_Dtcprm_ *dtc_ptr;
 
 	int st;
@@ -89,11 +91,7 @@ int EXP_LVL1 CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3])
 
 	status = 0;
 
-	/* Get a pointer to the two coordinate systems involved. */
-	src_ptr = CSbcclu (src_cs);
-	if (src_ptr == NULL) goto error;
-	dst_ptr = CSbcclu (dst_cs);
-	if (dst_ptr == NULL) goto error;
+	if (src_ptr == NULL || dst_ptr == NULL) goto error;
 
 	/* Get a pointer to the datum conversion required. */
 	dtc_ptr = CSbdclu (src_ptr,dst_ptr,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W);
@@ -101,18 +99,18 @@ int EXP_LVL1 CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3])
 
 	/* Convert the coordinate and return the result to the
 	   user. */
-	st = CS_cs2ll (src_ptr,my_ll,coord);
+	st = threeD ? CS_cs3ll (src_ptr,my_ll,coord) : CS_cs2ll (src_ptr,my_ll,coord);
 	if (st != cs_CNVRT_NRML)
 	{
 		status |= cs_BASIC_SRCRNG;
 	}
-	dt_st = CS_dtcvt (dtc_ptr,my_ll,my_ll);
+	dt_st = threeD ? CS_dtcvt3D (dtc_ptr,my_ll,my_ll) : CS_dtcvt (dtc_ptr,my_ll,my_ll);
 	if (dt_st != 0)
 	{
 		if (dt_st < 0) goto error;
 		status |= cs_BASIC_DTCWRN;
 	}
-	st = CS_ll2cs (dst_ptr,coord,my_ll);
+	st = threeD ? CS_ll3cs (dst_ptr,coord,my_ll) : CS_ll2cs (dst_ptr,coord,my_ll);
 	if (st != cs_CNVRT_NRML)
 	{
 		status |= cs_BASIC_DSTRNG;
@@ -130,6 +128,21 @@ error:
 	return (-cs_Error);
 }
 
+int EXP_LVL1 CS_cnvrt (Const char *src_cs,Const char *dst_cs,double coord [3])
+
+{
+	static char modl_name [] = "CS_cnvrt";
+
+	struct cs_Csprm_ *src_ptr;
+	struct cs_Csprm_ *dst_ptr;
+
+	/* Get a pointer to the two coordinate systems involved. */
+	dst_ptr = NULL;
+	src_ptr = CSbcclu (src_cs);
+	if (src_ptr != NULL) dst_ptr = CSbcclu (dst_cs);
+	return CScnvrtCs (modl_name,src_ptr,dst_ptr,coord,FALSE);
+}
+
 /**********************************************************************
 **	st = CS_cnvrt3D (src_cs,dst_cs,coord);
 **
@@ -145,63 +158,59 @@ error:
 **********************************************************************/
 int EXP_LVL1 CS_cnvrt3D (Const char *src_cs,Const char *dst_cs,double coord [3])
 {
-	extern int cs_Error;
-	extern csFILE* csDiagnostic;
-
 	static char modl_name [] = "CS_cnvrt3D";
 
 	struct cs_Csprm_ *src_ptr;
 	struct cs_Csprm_ *dst_ptr;
-	struct cs_Dtcprm_ *dtc_ptr;
-
-	int st;
-	int status;
-	int dt_st;
-
-	char msgBufr [MAXPATH];
-	double my_ll [3];
-
-	status = 0;
-
 
 	/* Get a pointer to the two coordinate systems involved. */
+	dst_ptr = NULL;
 	src_ptr = CSbcclu (src_cs);
-	if (src_ptr == NULL) goto error;
-	dst_ptr = CSbcclu (dst_cs);
-	if (dst_ptr == NULL) goto error;
+	if (src_ptr != NULL) dst_ptr = CSbcclu (dst_cs);
+	return CScnvrtCs (modl_name,src_ptr,dst_ptr,coord,TRUE);
+}
 
-	/* Get a pointer to the datum conversion required. */
-	dtc_ptr = CSbdclu (src_ptr,dst_ptr,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W);
-	if (dtc_ptr == NULL) goto error;
+/**********************************************************************
+**	st = CS_cnvrtEpsg (srcCode,dstCode,coord);
+**	st = CS_cnvrtEpsg3D (srcCode,dstCode,coord);
+**
+**	long srcCode;				EPSG code of the source coordinate system.
+**	long dstCode;				EPSG code of the destination coordinate system.
+**	double coord [3];			an array of double in which the coordinate
+**			to be converted is supplied, and the
+**			converted result is returned.
+**
+**	Same as CS_cnvrt and CS_cnvrt3D, except that the coordinate systems
+**	are identified by EPSG code.  The code is mapped to a CS-MAP key name
+**	by the name mapper once, the first time it is seen; thereafter the
+**	coordinate system cache is searched by code, so that a repeated
+**	conversion involves no name mapping and no key name comparisons.
+**********************************************************************/
+int EXP_LVL1 CS_cnvrtEpsg (long srcCode,long dstCode,double coord [3])
+{
+	static char modl_name [] = "CS_cnvrtEpsg";
 
-	/* Convert the coordinate and return the result to the user. */
-	st = CS_cs3ll (src_ptr,my_ll,coord);
-	if (st != cs_CNVRT_NRML)
-	{
-		status |= cs_BASIC_SRCRNG;
-	}
-	dt_st = CS_dtcvt3D (dtc_ptr,my_ll,my_ll);
-	if (dt_st != 0)
-	{
-		if (dt_st < 0) goto error;
-		status |= cs_BASIC_DTCWRN;
-	}
-	st = CS_ll3cs (dst_ptr,coord,my_ll);
-	if (st != cs_CNVRT_NRML)
-	{
-		status |= cs_BASIC_DSTRNG;
-	}
+	struct cs_Csprm_ *src_ptr;
+	struct cs_Csprm_ *dst_ptr;
 
-	/* That's it. */
-	return (status);
+	/* Get a pointer to the two coordinate systems involved. */
+	dst_ptr = NULL;
+	src_ptr = CSbccluEpsg (srcCode);
+	if (src_ptr != NULL) dst_ptr = CSbccluEpsg (dstCode);
+	return CScnvrtCs (modl_name,src_ptr,dst_ptr,coord,FALSE);
+}
+int EXP_LVL1 CS_cnvrtEpsg3D (long srcCode,long dstCode,double coord [3])
+{
+	static char modl_name [] = "CS_cnvrtEpsg3D";
 
-error:
-	if (csDiagnostic != 0)
-	{
-		CS_errmsg (msgBufr,sizeof (msgBufr));
-		fprintf (csDiagnostic,"Error detected in %s: %s\n",modl_name,msgBufr);
-	}
-	return (-cs_Error);
+	struct cs_Csprm_ *src_ptr;
+	struct cs_Csprm_ *dst_ptr;
+
+	/* Get a pointer to the two coordinate systems involved. */
+	dst_ptr = NULL;
+	src_ptr = CSbccluEpsg (srcCode);
+	if (src_ptr != NULL) dst_ptr = CSbccluEpsg (dstCode);
+	return CScnvrtCs (modl_name,src_ptr,dst_ptr,coord,TRUE);
 }
 
 /**********************************************************************
@@ -280,6 +289,7 @@ struct cs_Csprm_ * EXP_LVL9 CSbcclu (Const char *cs_name)
 			ch_ptr->next = NULL;
 			ch_ptr->cs_ptr = NULL;
 			ch_ptr->cs_nam [0] = '\0';
+			ch_ptr->epsg = 0L;
 			last_chp = ch_ptr;
 		}
 	}
@@ -320,6 +330,7 @@ struct cs_Csprm_ * EXP_LVL9 CSbcclu (Const char *cs_name)
 				goto error;
 			}
 			(void)CS_stncp (ch_ptr->cs_nam,kyTemp,sizeof (ch_ptr->cs_nam));
+			ch_ptr->epsg = 0L;
 			cs_ptr = ch_ptr->cs_ptr;
 		}
 		else
@@ -332,6 +343,7 @@ struct cs_Csprm_ * EXP_LVL9 CSbcclu (Const char *cs_name)
 			ch_ptr = last_chp;
 			CS_free (ch_ptr->cs_ptr);
 			ch_ptr->cs_nam [0] = '\0';
+			ch_ptr->epsg = 0L;
 			ch_ptr->cs_ptr = CS_csloc (kyTemp);
 			(void)CS_stncp (ch_ptr->cs_nam,kyTemp,sizeof (ch_ptr->cs_nam));
 			cs_ptr = ch_ptr->cs_ptr;
@@ -371,6 +383,76 @@ struct cs_Csprm_ * EXP_LVL9 CSbcclu (Const char *cs_name)
 error:
 	return ((struct cs_Csprm_ *)0);
 }
+/**********************************************************************
+	Same as CSbcclu, but the coordinate system is identified by EPSG
+	code.  Cache entries located by code record the code, so that
+	subsequent references by the same code are resolved by a simple
+	numeric comparison.  Only when the code is not in the cache do we
+	consult the name mapper, which maps the code to a key name with a
+	hashed lookup, and then CSbcclu.
+**********************************************************************/
+struct cs_Csprm_ * EXP_LVL9 CSbccluEpsg (long epsgCode)
+{
+	extern struct csCscach_ *csCscachP;
+	extern char csErrnam [];
+	extern int cs_Error;
+
+	cs_Register struct csCscach_ *ch_ptr;
+
+	struct cs_Csprm_ *cs_ptr;
+	enum EcsMapSt mapSt;
+
+	char kyTemp [cs_KEYNM_DEF + 2];
+
+	/* Anything reported below, the failure to load the name mapper for
+	   example, is more specific than cs_NMMAP_NONBR. */
+	cs_Error = 0;
+	if (epsgCode <= 0L) goto error;
+
+	for (ch_ptr = csCscachP;ch_ptr != NULL;ch_ptr = ch_ptr->next)
+	{
+		if (ch_ptr->cs_ptr == NULL) break;
+		if (ch_ptr->epsg == epsgCode)
+		{
+			/* Make this the most recently accessed entry. */
+			if (ch_ptr != csCscachP)
+			{
+				ch_ptr->prev->next = ch_ptr->next;				/*lint !e613 */
+				if (ch_ptr->next != NULL)
+				{
+					ch_ptr->next->prev = ch_ptr->prev;
+				}
+				ch_ptr->prev = NULL;
+				ch_ptr->next = csCscachP;
+				csCscachP->prev = ch_ptr;
+				csCscachP = ch_ptr;
+			}
+			return (ch_ptr->cs_ptr);
+		}
+	}
+
+	kyTemp [0] = '\0';
+	mapSt = csMapIdToNameC (csMapProjGeoCSys,kyTemp,sizeof (kyTemp),csMapFlvrAutodesk,
+																	csMapFlvrEpsg,
+																	(unsigned long)epsgCode);
+	if (mapSt != csMapOk) goto error;
+
+	cs_ptr = CSbcclu (kyTemp);
+	if (cs_ptr != NULL)
+	{
+		/* CSbcclu leaves the entry it returns at the top of the list. */
+		csCscachP->epsg = epsgCode;
+	}
+	return (cs_ptr);
+
+error:
+	if (cs_Error == 0)
+	{
+		sprintf (csErrnam,"%ld",epsgCode);
+		CS_erpt (cs_NMMAP_NONBR);
+	}
+	return ((struct cs_Csprm_ *)0);
+}
 /**********************************************************************
   The following function returns a list of the coordinate systems
   in the cache.
@@ -693,8 +775,13 @@ void EXP_LVL1 CS_recvr (void)
 	extern char *cs_CsKeyNames;
 	extern char *cs_DtKeyNames;
 	extern char *cs_ElKeyNames;
+	extern char **cs_CsKeyIndex;
+	extern int cs_CsKeyCount;
+	extern char **cs_DtKeyIndex;
+	extern int cs_DtKeyCount;
+	extern char **cs_ElKeyIndex;
+	extern int cs_ElKeyCount;
 	extern char *cs_CsLlEnum;
-	extern struct cs_Csgrplst_ *cs_CsGrpList;
 	extern struct cs_Mgrs_ *cs_MgrsPtr;
 
 	struct csDtcach_ *dtch_ptr;
@@ -770,32 +857,54 @@ void EXP_LVL1 CS_recvr (void)
 	/* Free up any name lists which may be present. */
 
 	CS_releaseGxIndex ();
+	CS_rlsDefIndex ();
+	CS_rlsDictMap ();
+	CS_rlsRangeIndex ();
+	CS_rlsGrpIndex ();
+	CS_rlsPrjIndex ();
+	CS_rlsUnitIndex ();
+	CS_rlsGpIndex ();
+	CS_rlsDtcSnap ();
+	CS_rlsWktCache ();
 
 	if (cs_CsKeyNames != NULL)
 	{
 		CS_free (cs_CsKeyNames);
 		cs_CsKeyNames = NULL;
 	}
+	if (cs_CsKeyIndex != NULL)
+	{
+		CS_free (cs_CsKeyIndex);
+		cs_CsKeyIndex = NULL;
+	}
+	cs_CsKeyCount = 0;
 	if (cs_DtKeyNames != NULL)
 	{
 		CS_free (cs_DtKeyNames);
 		cs_DtKeyNames = NULL;
 	}
+	if (cs_DtKeyIndex != NULL)
+	{
+		CS_free (cs_DtKeyIndex);
+		cs_DtKeyIndex = NULL;
+	}
+	cs_DtKeyCount = 0;
 	if (cs_ElKeyNames != NULL)
 	{
 		CS_free (cs_ElKeyNames);
 		cs_ElKeyNames = NULL;
 	}
+	if (cs_ElKeyIndex != NULL)
+	{
+		CS_free (cs_ElKeyIndex);
+		cs_ElKeyIndex = NULL;
+	}
+	cs_ElKeyCount = 0;
 	if (cs_CsLlEnum != NULL)
 	{
 		CS_free (cs_CsLlEnum);
 		cs_CsLlEnum = NULL;
 	}
-	if (cs_CsGrpList != NULL)
-	{
-		CS_csgrpf (cs_CsGrpList);
-		cs_CsGrpList = NULL;
-	};
 
 	/* Do the high level MGRS stuff. */
 	if (cs_MgrsPtr != NULL)
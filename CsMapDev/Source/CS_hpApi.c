@@ -413,7 +413,6 @@ int EXP_LVL3 CS_cschk (	Const struct cs_Csdef_ *cs_def,unsigned short chk_flg,
 {
 	extern unsigned short cs_ErrSup;	/* Error report suppression
 										   bit map */
-	extern struct cs_Prjtab_ cs_Prjtab [];	/* Projection Table */
 	extern char csErrnam [];		/* Dimensioned at MAXPATH */
 	extern short cs_QuadMin;		/* Minimum acceptable value
 									   for quad. */
@@ -445,13 +444,7 @@ int EXP_LVL3 CS_cschk (	Const struct cs_Csdef_ *cs_def,unsigned short chk_flg,
 	   pointer to the check function, and then check the
 	   projection specific values. */
 
-	for (pp = cs_Prjtab;pp->key_nm [0] != '\0';pp += 1)
-	{
-		if (!CS_stricmp (cs_def->prj_knm,pp->key_nm))
-		{
-			break;
-		}
-	}
+	pp = CS_prjtabPtr (cs_def->prj_knm);
 	if (pp->check == NULL)
 	{
 		/* We have an invalid projection specification. */
@@ -853,7 +846,6 @@ int	EXP_LVL1 CS_isCsPrmReentrant (Const struct cs_Csprm_ *prjConversion)
 int	EXP_LVL1 CS_isCsReentrant (Const char *csys)
 {
 	extern char csErrnam [];				/* Dimensioned at MAXPATH */
-	extern struct cs_Prjtab_ cs_Prjtab [];	/* Projection Table */
 
 	int isReentrant;
 	struct cs_Prjtab_ *pp;
@@ -868,13 +860,7 @@ int	EXP_LVL1 CS_isCsReentrant (Const char *csys)
 		csDefPtr = CS_csdef (csys);
 		if (csDefPtr != NULL)
 		{
-			for (pp = cs_Prjtab;pp->code != cs_PRJCOD_END;pp += 1)
-			{
-				if (!CS_stricmp (csDefPtr->prj_knm,pp->key_nm))
-				{
-					break;
-				}
-			}
+			pp = CS_prjtabPtr (csDefPtr->prj_knm);
 			if (pp->code != cs_PRJCOD_END)
 			{
 				isReentrant = ((pp->flags & cs_PRJFLG_RNTRNT) != 0);
@@ -1155,3 +1155,28 @@ int CScalcNadconFile (struct cs_NadconFile_* thisPtr,double* result,Const double
 	}
 	return cellStatus;
 }
+int CSgatherNadconFile (void* gridFile,double coefs [4],double delta [2],Const double* sourceLL)
+{
+	int cellStatus;
+	struct cs_NadconFile_* thisPtr;
+
+	/* The csGatherBilinearFunc for NADCON files.  CSextractNadconFile does
+	   nothing more than a coverage test when the point is within the cell
+	   used for the previous point. */
+	thisPtr = (struct cs_NadconFile_*)gridFile;
+	cellStatus = CSextractNadconFile (thisPtr,sourceLL);
+	if (cellStatus == 0)
+	{
+		CSgatherGridCell (&thisPtr->currentCell,coefs,delta,sourceLL);
+	}
+	return cellStatus;
+}
+int CScalcNadconFileN (struct cs_NadconFile_* thisPtr,double results [],int status [],
+																		Const double sourceLL [][3],
+																		int count)
+{
+	extern double cs_Mhuge;
+
+	/* Batch version of CScalcNadconFile. */
+	return CSbilinearBatch (thisPtr,CSgatherNadconFile,results,status,sourceLL,count,cs_Mhuge);
+}
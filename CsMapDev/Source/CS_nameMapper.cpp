@@ -50,6 +50,7 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <map>
 #include <algorithm>
 
 // The following table assigns a short name to each of the various
@@ -104,6 +105,110 @@ const TcsGenericId KcsGenericIdNull;
 const wchar_t TcsNameMapper::FirstName [32] = L" ";
 const wchar_t TcsNameMapper::LastName [32] = L"zzzzzzzzzzzzzzzzzzzzzzzzzzzzzzz";
 
+///////////////////////////////////////////////////////////////////////////////
+// TcsNameMapPool  --  Interned string storage for TcsNameMap objects.
+//
+// Strings are copied into large chunks which are never moved or released, so
+// a pointer to an interned string remains valid for the life of the process.
+// A hash table of the interned strings assures that each distinct string is
+// stored only once.  Since the same names are interned again each time the
+// Name Mapper is loaded, the pool does not grow when the Name Mapper is
+// released and reloaded.
+class TcsNameMapPool
+{
+	static const size_t KcsChunkSize = 65536;
+public:
+	TcsNameMapPool (void);
+	~TcsNameMapPool (void);
+	const wchar_t* Intern (const wchar_t* str);
+private:
+	void Grow (void);
+	std::vector<wchar_t*> Chunks;
+	wchar_t* Next;
+	size_t Avail;
+	size_t Count;
+	std::vector<const wchar_t*> Slots;
+};
+TcsNameMapPool::TcsNameMapPool (void) : Chunks (),Next (0),Avail (0),Count (0),Slots ()
+{
+}
+TcsNameMapPool::~TcsNameMapPool (void)
+{
+	std::vector<wchar_t*>::iterator itr;
+
+	for (itr = Chunks.begin ();itr != Chunks.end ();itr++)
+	{
+		delete [] *itr;
+	}
+}
+const wchar_t* TcsNameMapPool::Intern (const wchar_t* str)
+{
+	static const wchar_t emptyString [1] = { L'\0' };
+
+	size_t mask;
+	size_t slot;
+	size_t length;
+	wchar_t* interned;
+
+	if (str == 0 || *str == L'\0')
+	{
+		return emptyString;
+	}
+	if ((Count + 1) * 2 > Slots.size ())
+	{
+		Grow ();
+	}
+	mask = Slots.size () - 1;
+	for (slot = CS_wcsihash (str) & mask;Slots [slot] != 0;slot = (slot + 1) & mask)
+	{
+		if (!wcscmp (Slots [slot],str))
+		{
+			return Slots [slot];
+		}
+	}
+
+	length = wcslen (str) + 1;
+	if (length > Avail)
+	{
+		Avail = (length > KcsChunkSize) ? length : KcsChunkSize;
+		Next = new wchar_t [Avail];
+		Chunks.push_back (Next);
+	}
+	interned = Next;
+	wcscpy (interned,str);
+	Next += length;
+	Avail -= length;
+	Slots [slot] = interned;
+	Count += 1;
+	return interned;
+}
+void TcsNameMapPool::Grow (void)
+{
+	size_t mask;
+	size_t slot;
+	std::vector<const wchar_t*> oldSlots;
+	std::vector<const wchar_t*>::iterator itr;
+
+	oldSlots.swap (Slots);
+	Slots.assign (oldSlots.empty () ? 4096 : oldSlots.size () * 2,static_cast<const wchar_t*>(0));
+	mask = Slots.size () - 1;
+	for (itr = oldSlots.begin ();itr != oldSlots.end ();itr++)
+	{
+		if (*itr != 0)
+		{
+			for (slot = CS_wcsihash (*itr) & mask;Slots [slot] != 0;slot = (slot + 1) & mask);
+			Slots [slot] = *itr;
+		}
+	}
+}
+// The pool is a function static so that it is constructed upon first use,
+// regardless of the order in which static objects are constructed.
+static const wchar_t* CSnameMapIntern (const wchar_t* str)
+{
+	static TcsNameMapPool namePool;
+	return namePool.Intern (str);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // TcsNameMap Object  --  Object used to associate various names for the same
 //						  thing.
@@ -126,7 +231,7 @@ bool TcsNameMap::CsvSort (const TcsNameMap& lhs,const TcsNameMap& rhs)
 				lessThan = (lhs.AliasFlag < rhs.AliasFlag);
 				if (lhs.AliasFlag == rhs.AliasFlag)
 				{
-					int cmpVal = CS_wcsicmp (lhs.Name.c_str (),rhs.Name.c_str ());
+					int cmpVal = CS_wcsicmp (lhs.Name,rhs.Name);
 					lessThan = (cmpVal < 0);
 					if (cmpVal == 0)
 					{
@@ -142,14 +247,14 @@ bool TcsNameMap::CsvSort (const TcsNameMap& lhs,const TcsNameMap& rhs)
 // Construction  /  Destruction  /  Assignment
 TcsNameMap::TcsNameMap () : GenericId (0UL),Type (csMapNone),Flavor     (csMapFlvrNone),
 															 NumericId  (0UL),
-															 Name       (),
+															 Name       (CSnameMapIntern (0)),
 															 DupSort    (0),
 															 AliasFlag  (0),
 															 Flags      (0UL),
 															 User       (0),
 															 Deprecated (0UL),
-															 Remarks    (),
-															 Comments   ()
+															 Remarks    (Name),
+															 Comments   (Name)
 {
 }
 TcsNameMap::TcsNameMap (const TcsGenericId& genericId,EcsMapObjType type,
@@ -161,14 +266,14 @@ TcsNameMap::TcsNameMap (const TcsGenericId& genericId,EcsMapObjType type,
 													  Type       (type),
 													  Flavor     (flavor),
 													  NumericId  (numericId),
-													  Name       (name),
+													  Name       (CSnameMapIntern (name)),
 													  DupSort    (0),
 													  AliasFlag  (0),
 													  Flags      (0UL),
 													  User       (0),
 													  Deprecated (),
-													  Remarks    (),
-													  Comments   ()
+													  Remarks    (CSnameMapIntern (0)),
+													  Comments   (Remarks)
 {
 }
 TcsNameMap::TcsNameMap (EcsMapObjType type,EcsNameFlavor flavor,unsigned long numericId,
@@ -178,14 +283,14 @@ TcsNameMap::TcsNameMap (EcsMapObjType type,EcsNameFlavor flavor,unsigned long nu
 																Type       (type),
 																Flavor     (flavor),
 																NumericId  (numericId),
-																Name       (name),
+																Name       (CSnameMapIntern (name)),
 																DupSort    (0),
 																AliasFlag  (0),
 																Flags      (0UL),
 																User       (0),
 																Deprecated (),
-																Remarks    (),
-																Comments   ()
+																Remarks    (CSnameMapIntern (0)),
+																Comments   (Remarks)
 {
 	if (NumericId != 0)
 	{
@@ -200,14 +305,14 @@ TcsNameMap::TcsNameMap (EcsMapObjType type,EcsNameFlavor flavor,const wchar_t* n
 																Type       (type),
 																Flavor     (flavor),
 																NumericId  (0UL),
-																Name       (name),
+																Name       (CSnameMapIntern (name)),
 																DupSort    (dupSort),
 																AliasFlag  (aliasFlag),
 																Flags      (0UL),
 																User       (0),
 																Deprecated (),
-																Remarks    (),
-																Comments   ()
+																Remarks    (CSnameMapIntern (0)),
+																Comments   (Remarks)
 {
 }														  
 TcsNameMap::TcsNameMap (const TcsNameMap& source) : GenericId  (source.GenericId),
@@ -267,7 +372,7 @@ bool TcsNameMap::operator< (const TcsNameMap& rhs) const
 				
 				// We need a case insensitive comparison, so we can't use the
 				// std::wstring::operator< ().
-				int cmpVal = CS_wcsicmp (Name.c_str (),rhs.Name.c_str ());
+				int cmpVal = CS_wcsicmp (Name,rhs.Name);
 				lessThan = (cmpVal < 0);
 				if (cmpVal == 0)
 				{
@@ -298,8 +403,7 @@ EcsCsvStatus TcsNameMap::ReadFromStream (std::wistream& inStrm,TcsCsvStatus& csv
 
 	// We do not allow for comments as whatever the comment character would
 	// be might end up in a name somewhere.
-	Name.clear ();
-	Remarks.clear ();
+	Name = Remarks = CSnameMapIntern (0);
 
 	status = csvEmptyLine;
 	lineBufr.reserve (1024);
@@ -368,7 +472,7 @@ EcsCsvStatus TcsNameMap::ReadFromStream (std::wistream& inStrm,TcsCsvStatus& csv
 				}
 
 				NumericId = wcstoul (fields [3].c_str (),0,10);
-				Name = fields [4];
+				Name = CSnameMapIntern (fields [4].c_str ());
 				DupSort = static_cast<short>(wcstol (fields [5].c_str (),0,10));
 				AliasFlag = static_cast<short>(wcstol (fields [6].c_str (),0,10));
 
@@ -383,11 +487,11 @@ EcsCsvStatus TcsNameMap::ReadFromStream (std::wistream& inStrm,TcsCsvStatus& csv
 				}
 				if (fldCnt > 9)
 				{
-					Remarks = fields [9];
+					Remarks = CSnameMapIntern (fields [9].c_str ());
 				}
 				if (fldCnt > 10)
 				{
-					Comments = fields [10];
+					Comments = CSnameMapIntern (fields [10].c_str ());
 				}
 			}
 		}
@@ -395,13 +499,92 @@ EcsCsvStatus TcsNameMap::ReadFromStream (std::wistream& inStrm,TcsCsvStatus& csv
 	csvStatus.SetStatus (status);
 	return status;
 }
+// Extracts a name map from the current record of the reader.  The numeric
+// fields are converted directly from the reader's buffer; only the text
+// fields are converted to wide characters, and then only to be interned.
+EcsCsvStatus TcsNameMap::ReadFromReader (TcsCsvReader& reader,TcsCsvStatus& csvStatus)
+{
+	EcsCsvStatus status;
+
+	short fldCnt;
+	short fldIdx;
+	TcsCsvView fields [11];
+	std::wstring wcTemp;
+
+	// The optional fields revert to their defaults if not present.
+	Name = Remarks = Comments = CSnameMapIntern (0);
+	Flags = 0UL;
+	Deprecated = TcsGenericId (0UL);
+
+	fldCnt = reader.FieldCount ();
+	status = reader.RecordStatus ();
+	if (status == csvOk)
+	{
+		if (fldCnt < 7)
+		{
+			status = csvTooFewFields;
+		}
+		else if (fldCnt > 11)
+		{
+			status = csvTooManyFields;
+		}
+	}
+	for (fldIdx = 0;status == csvOk && fldIdx < fldCnt;fldIdx += 1)
+	{
+		status = reader.GetField (fields [fldIdx],fldIdx);
+		if (status == csvOk && fldIdx < 7 && fields [fldIdx].Empty ())
+		{
+			status = csvEmpty;
+		}
+	}
+	if (status == csvOk)
+	{
+		GenericId = TcsGenericId (fields [0].AsULong ());
+		Type = EcsMapObjType (static_cast<int>(fields [1].AsULong ()));
+		if (isdigit (static_cast<unsigned char>(fields [2].FirstChar ())))
+		{
+			Flavor = EcsNameFlavor (static_cast<int>(fields [2].AsULong ()));
+		}
+		else
+		{
+			fields [2].AsWide (wcTemp);
+			Flavor = TcsNameMapper::FlvrNameToNbr (wcTemp.c_str ());
+		}
+		NumericId = fields [3].AsULong ();
+		fields [4].AsWide (wcTemp);
+		Name = CSnameMapIntern (wcTemp.c_str ());
+		DupSort = static_cast<short>(fields [5].AsLong ());
+		AliasFlag = static_cast<short>(fields [6].AsLong ());
+		if (fldCnt > 7)
+		{
+			Flags = fields [7].AsULong ();
+		}
+		if (fldCnt > 8)
+		{
+			Deprecated = TcsGenericId (fields [8].AsULong ());
+		}
+		if (fldCnt > 9)
+		{
+			fields [9].AsWide (wcTemp);
+			Remarks = CSnameMapIntern (wcTemp.c_str ());
+		}
+		if (fldCnt > 10)
+		{
+			fields [10].AsWide (wcTemp);
+			Comments = CSnameMapIntern (wcTemp.c_str ());
+		}
+	}
+	csvStatus.SetLineNbr (reader.GetLineNbr ());
+	csvStatus.SetStatus (status);
+	return status;
+}
 void* TcsNameMap::GetUserValue (void) const
 {
 	return User;
 }
 const wchar_t* TcsNameMap::GetComments (void) const
 {
-	return Comments.c_str ();
+	return Comments;
 }
 void TcsNameMap::GetComments (std::wstring& comments) const
 {
@@ -409,7 +592,7 @@ void TcsNameMap::GetComments (std::wstring& comments) const
 }
 const wchar_t* TcsNameMap::GetRemarks (void) const
 {
-	return Remarks.c_str ();
+	return Remarks;
 }
 void TcsNameMap::GetRemarks (std::wstring& remarks) const
 {
@@ -423,15 +606,15 @@ void* TcsNameMap::SetUserValue (void* userValue)
 }
 void TcsNameMap::SetComments (const wchar_t* comments)
 {
-	Comments = comments;
+	Comments = CSnameMapIntern (comments);
 }
 void TcsNameMap::SetRemarks (const wchar_t* remarks)
 {
-	Remarks = remarks;
+	Remarks = CSnameMapIntern (remarks);
 }
 void TcsNameMap::SetNameId (const wchar_t* newNameId)
 {
-	Name = newNameId;
+	Name = CSnameMapIntern (newNameId);
 }
 void TcsNameMap::SetNumericId (unsigned long newNumericId)
 {
@@ -567,6 +750,257 @@ void TcsNameMapList::Erase (void)
 	NameMapList.clear ();
 }
 //newPage//
+//=========================================================================
+// TcsNameMapIndex  --  Hashed (type, flavor, key) index into the
+//						DefinitionSet of a TcsNameMapper.
+//=========================================================================
+// Construction,  Assignment,  Destruction
+TcsNameMapIndex::TcsNameMapIndex (EcsIndexKey keyType) : KeyType (keyType),
+														 Count   (0),
+														 Slots   (),
+														 Used    ()
+{
+}
+TcsNameMapIndex::~TcsNameMapIndex (void)
+{
+}
+//=========================================================================
+// Public Named Member Functions
+bool TcsNameMapIndex::SameKey (const TcsNameMap& lhs,const TcsNameMap& rhs) const
+{
+	return Matches (lhs,rhs.GetMapClass (),rhs.GetFlavor (),NumberOf (rhs),rhs.GetNamePtr ());
+}
+bool TcsNameMapIndex::Find (iterator& result,const TcsNameMap& nameMap) const
+{
+	bool ok (false);
+	size_t slot;
+
+	if (Count != 0)
+	{
+		slot = Probe (nameMap);
+		if (Used [slot])
+		{
+			result = Slots [slot];
+			ok = true;
+		}
+	}
+	return ok;
+}
+bool TcsNameMapIndex::Find (iterator& result,EcsMapObjType type,EcsNameFlavor flavor,unsigned long number) const
+{
+	bool ok (false);
+	size_t slot;
+
+	if (Count != 0 && KeyType != KeyName)
+	{
+		slot = Probe (type,flavor,number,0);
+		if (Used [slot])
+		{
+			result = Slots [slot];
+			ok = true;
+		}
+	}
+	return ok;
+}
+bool TcsNameMapIndex::Find (iterator& result,EcsMapObjType type,EcsNameFlavor flavor,const wchar_t* name) const
+{
+	bool ok (false);
+	size_t slot;
+
+	if (Count != 0 && KeyType == KeyName && name != 0)
+	{
+		slot = Probe (type,flavor,0UL,name);
+		if (Used [slot])
+		{
+			result = Slots [slot];
+			ok = true;
+		}
+	}
+	return ok;
+}
+// Indexes the set member referenced by itr, unless the index already refers
+// to a member with the same key which precedes it in the set collating
+// sequence.  Thus, the index always refers to the first such member
+// regardless of the order in which members are added.
+void TcsNameMapIndex::Insert (iterator itr)
+{
+	size_t slot;
+
+	if ((Count + 1) * 2 > Slots.size ())
+	{
+		Grow ();
+	}
+	slot = Probe (*itr);
+	if (!Used [slot])
+	{
+		Slots [slot] = itr;
+		Used [slot] = true;
+		Count += 1;
+	}
+	else if (*itr < *Slots [slot])
+	{
+		Slots [slot] = itr;
+	}
+}
+// Removes the entry for the key of the member referenced by itr.  Uses
+// backward shift deletion so that no probe sequence is broken by the
+// vacated slot.
+void TcsNameMapIndex::Remove (iterator itr)
+{
+	size_t mask;
+	size_t slot;
+	size_t next;
+	size_t home;
+
+	if (Count == 0)
+	{
+		return;
+	}
+	slot = Probe (*itr);
+	if (!Used [slot])
+	{
+		return;
+	}
+	mask = Slots.size () - 1;
+	Used [slot] = false;
+	Count -= 1;
+	for (next = (slot + 1) & mask;Used [next];next = (next + 1) & mask)
+	{
+		const TcsNameMap& nameMap = *Slots [next];
+		home = Hash (nameMap.GetMapClass (),nameMap.GetFlavor (),NumberOf (nameMap),nameMap.GetNamePtr ()) & mask;
+		// The entry at next may move into the vacated slot unless its home
+		// slot lies cyclically within (slot, next].
+		if ((slot < next) ? (home <= slot || home > next) : (home <= slot && home > next))
+		{
+			Slots [slot] = Slots [next];
+			Used [slot] = true;
+			Used [next] = false;
+			slot = next;
+		}
+	}
+}
+void TcsNameMapIndex::Rebuild (std::set<TcsNameMap>& definitionSet)
+{
+	iterator itr;
+
+	Slots.clear ();
+	Used.clear ();
+	Count = 0;
+	for (itr = definitionSet.begin ();itr != definitionSet.end ();itr++)
+	{
+		Insert (itr);
+	}
+}
+//=========================================================================
+// Private Support Functions
+//
+// Names are hashed by CS_wcsihash, so that names which CS_wcsicmp considers
+// equal always hash equal.  Numbers are ignored when hashing names, and vice
+// versa.
+unsigned long TcsNameMapIndex::Hash (EcsMapObjType type,EcsNameFlavor flavor,unsigned long number,
+																			 const wchar_t* name)
+{
+	ulong32_t hash;
+
+	hash  = static_cast<ulong32_t>(number);
+	hash ^= (static_cast<ulong32_t>(type) << 24) ^ (static_cast<ulong32_t>(flavor) << 16);
+	if (name != 0)
+	{
+		hash ^= static_cast<ulong32_t>(CS_wcsihash (name));
+	}
+	hash *= 0x9E3779B1UL;
+	hash ^= hash >> 15;
+	return static_cast<unsigned long>(hash);
+}
+unsigned long TcsNameMapIndex::NumberOf (const TcsNameMap& nameMap) const
+{
+	unsigned long number = 0UL;
+
+	if (KeyType == KeyGenericId)
+	{
+		number = static_cast<unsigned long>(nameMap.GetGenericId ());
+	}
+	else if (KeyType == KeyNumericId)
+	{
+		number = nameMap.GetNumericId ();
+	}
+	return number;
+}
+bool TcsNameMapIndex::Matches (const TcsNameMap& nameMap,EcsMapObjType type,EcsNameFlavor flavor,
+																			unsigned long number,
+																			const wchar_t* name) const
+{
+	bool matches;
+
+	matches = (nameMap.GetMapClass () == type && nameMap.GetFlavor () == flavor);
+	if (matches)
+	{
+		if (KeyType == KeyName)
+		{
+			matches = (CS_wcsicmp (nameMap.GetNamePtr (),name) == 0);
+		}
+		else
+		{
+			matches = (NumberOf (nameMap) == number);
+		}
+	}
+	return matches;
+}
+// Returns the slot holding the given key, or the unused slot at which the
+// key would be inserted.  The table is never more than half full, so the
+// loop always terminates.
+size_t TcsNameMapIndex::Probe (EcsMapObjType type,EcsNameFlavor flavor,unsigned long number,
+																	   const wchar_t* name) const
+{
+	size_t mask;
+	size_t slot;
+
+	if (KeyType != KeyName)
+	{
+		name = 0;
+	}
+	mask = Slots.size () - 1;
+	slot = Hash (type,flavor,number,name) & mask;
+	while (Used [slot])
+	{
+		if (Matches (*Slots [slot],type,flavor,number,name))
+		{
+			break;
+		}
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+size_t TcsNameMapIndex::Probe (const TcsNameMap& nameMap) const
+{
+	return Probe (nameMap.GetMapClass (),nameMap.GetFlavor (),NumberOf (nameMap),nameMap.GetNamePtr ());
+}
+void TcsNameMapIndex::Grow (void)
+{
+	size_t idx;
+	size_t slot;
+	size_t newSize;
+	std::vector<iterator> oldSlots;
+	std::vector<bool> oldUsed;
+
+	newSize = Slots.empty () ? 1024 : Slots.size () * 2;
+	oldSlots.swap (Slots);
+	oldUsed.swap (Used);
+	Slots.resize (newSize);
+	Used.assign (newSize,false);
+	Count = 0;
+	for (idx = 0;idx < oldSlots.size ();idx += 1)
+	{
+		if (oldUsed [idx])
+		{
+			slot = Probe (*oldSlots [idx]);
+			Slots [slot] = oldSlots [idx];
+			Used [slot] = true;
+			Count += 1;
+		}
+	}
+}
+//newPage//
 ///////////////////////////////////////////////////////////////////////////////
 // TcsNameMapper  --  A collection of TcsNameMap objects.
 const wchar_t TcsNameMapper::Delimiters [4] = {L',', L'\"', L'\"', L'\0' };
@@ -607,7 +1041,10 @@ bool TcsNameMapper::AnalyzeGenericId (EcsNameFlavor& flavor,unsigned long& flvrI
 // Construction  /  Destruction  /  Assignment
 TcsNameMapper::TcsNameMapper () : RecordDuplicates (false),
 								  DefinitionSet    (),
-								  Duplicates       ()
+								  Duplicates       (),
+								  NumericIdIndex   (TcsNameMapIndex::KeyNumericId),
+								  GenericIdIndex   (TcsNameMapIndex::KeyGenericId),
+								  NameIndex        (TcsNameMapIndex::KeyName)
 {
 
 	InitializeFlavors ();
@@ -615,8 +1052,14 @@ TcsNameMapper::TcsNameMapper () : RecordDuplicates (false),
 }
 TcsNameMapper::TcsNameMapper (const TcsNameMapper& source) : RecordDuplicates (source.RecordDuplicates),
 															 DefinitionSet    (source.DefinitionSet),
-															 Duplicates       (source.Duplicates)
-{
+															 Duplicates       (source.Duplicates),
+															 NumericIdIndex   (TcsNameMapIndex::KeyNumericId),
+															 GenericIdIndex   (TcsNameMapIndex::KeyGenericId),
+															 NameIndex        (TcsNameMapIndex::KeyName)
+{
+	// The indices of the source refer to the members of its set, so we
+	// need to build our own.
+	RebuildIndices ();
 	AdjustDefaultIDs ();
 }
 TcsNameMapper::~TcsNameMapper (void)
@@ -629,6 +1072,7 @@ TcsNameMapper& TcsNameMapper::operator= (const TcsNameMapper& rhs)
 		RecordDuplicates = rhs.RecordDuplicates;
 		DefinitionSet    = rhs.DefinitionSet;
 		Duplicates       = rhs.Duplicates;
+		RebuildIndices ();
 		AdjustDefaultIDs ();
 	}
 	return *this;
@@ -640,7 +1084,7 @@ TcsNameMapper& TcsNameMapper::operator+= (const TcsNameMap& newItem)
 	// We assume that if this fails, it is only because an equivalent
 	// object already exists in the set.  This is an essential element
 	// of the design of this object.
-	DefinitionSet.insert (newItem);		//lint !e534  ignoring return value
+	InsertDefinition (newItem);		//lint !e534  ignoring return value
 	return *this;
 }
 ///////////////////////////////////////////////////////////////////////////
@@ -669,125 +1113,40 @@ EcsCsvStatus TcsNameMapper::ReadFromStream (std::wistream& inStrm)
 	return rtnStatus;
 }
 
+// Reads the Name Mapper from a buffer containing the entire .CSV file.  Any
+// record which does not begin with a digit, such as the label record, is
+// skipped; as is any record which is not a valid name map.
 EcsCsvStatus TcsNameMapper::ReadFromStream (char* pBuffer, size_t const bufferSize)
 {
+	TcsCsvStatus status;
+
 	if (NULL == pBuffer)
 		return csvNoFile;
 
-	EcsCsvStatus csvStatus  = csvOk;
-
-	size_t const lastIndex = bufferSize - 1; // Last index of the stream buffer (file)
-
-	// Temporary line buffer
-	size_t lineBufferLength = 300; // Expected maximum length of a line
-	char* pLineBuffer = (char*) CS_malc (lineBufferLength);
-	if (NULL == pLineBuffer)
-	{
-		CS_erpt(cs_NO_MEM);
-		return csvInternal;
-	}
+	TcsCsvReader reader (Delimiters);
+	reader.Attach (pBuffer,bufferSize);
+	return ReadFromReader (reader,status);
+}
+EcsCsvStatus TcsNameMapper::ReadFromReader (TcsCsvReader& reader,TcsCsvStatus& status)
+{
+	EcsCsvStatus csvStatus;
+	TcsNameMap nextItem;
 
-	size_t lineStart = 0; // Start index of the line
-	bool isEOF = false;
-	size_t i = 0; // Current index in the stream buffer (file)
-	while(i < bufferSize && !isEOF)
+	for (csvStatus = reader.NextRecord ();csvStatus != csvEof && csvStatus != csvNoFile;
+										  csvStatus = reader.NextRecord ())
 	{
-		// Current character from the buffer
-		char const* curChar = &pBuffer[i];
-
-		// Advance [i] to next line breaking character
-		if ('\n' != *curChar && '\r' != *curChar)
+		if (csvStatus != csvOk || !isdigit (static_cast<unsigned char>(reader.GetRecord ().FirstChar ())))
 		{
-			// Pass any non-line breaking character;
-			// [lineStart] we still keep at the line start position
-			if (i != lastIndex)
-			{
-				++i;
-				continue;
-			}
-
-			// Last line. Last line need to be processed. EOF is handled below.
-		}
-
-		// Line length
-		// If the buffer did start with empty lines only, we're getting an 0-size length here
-		size_t lineLength = i - lineStart;
-		
-		// Advance [i] beyond all ine breaking characters (\n & \r)
-		while(i < bufferSize)
-		{
-			curChar = &pBuffer[i];
-			if ('\n' == *curChar || '\r' == *curChar)
-			{
-				++i;
-				continue;
-			}
-
-			break;
-		}
-		// Handle the end of the file
-		if (i >= bufferSize - 1)
-			isEOF = true;
-
-		// Resize the temp line buffer if it is too small
-		if (lineBufferLength < lineLength)
-		{
-			lineBufferLength = lineLength + (1 << 6);
-			char* pReBuffered = (char*) CS_ralc (pLineBuffer, lineBufferLength);
-			if (NULL == pReBuffered)
-			{
-				CS_erpt(cs_NO_MEM); //pLineBuffer still has to be free - see below
-				return csvNoFile;
-			}
-			pLineBuffer = pReBuffered;
-		}
-
-		// Fill up temp line buffer with current line
-		memset(pLineBuffer, '\0', lineBufferLength);
-		memcpy(pLineBuffer, &pBuffer[lineStart], lineLength);
-
-		// Next line starting position
-		lineStart = i; //our next potential start; EOF doesn't matter here
-
-		// Temporary line buffer (wide char)
-		wchar_t wcharBuffer[1 << 10] = { L'\0' };
-		mbstowcs(wcharBuffer, pLineBuffer, lineLength);
-		wcharBuffer[lineLength] = L'\n'; // Add a newline character. This will be needed below in the csv support class.
-
-		// Prepare a line stream
-		std::wstringstream inStrm(wcharBuffer);
-		inStrm.seekg(0);			//lint !e534   ignoring return value
-
-		// Skip the line if it looks like a label line.
-		// A data line need to start with a digit otherwise it is expected to be a label/comment line and we skip
-		if (!isdigit(pLineBuffer[0]))
-		{
-			// Skip the line
-			// Note that [i] and [lineStart] point already to the beginning of the next line, or EOF...
 			continue;
 		}
-
-		// Create name map item (Data of one line)
-		TcsNameMap nextItem;
-		TcsCsvStatus status;
-		// Read the data from the line
-		csvStatus= nextItem.ReadFromStream (inStrm, status);
+		csvStatus = nextItem.ReadFromReader (reader,status);
 		if (csvStatus == csvOk)
 		{
 			// Add new item to mapping collection
 			Add (nextItem);		//lint !e534   ignoring return value
 		}
-		else
-		{
-			continue;
-		}
 	}
-
-	// Free temp line buffer
-	CS_free(pLineBuffer);
-	pLineBuffer = NULL;
-	
-	return csvStatus;
+	return (csvStatus == csvEof) ? csvOk : csvStatus;
 }
 
 EcsCsvStatus TcsNameMapper::ReadFromStream (std::wistream& inStrm,TcsCsvStatus& status)
@@ -829,6 +1188,149 @@ EcsCsvStatus TcsNameMapper::ReadFromStream (std::wistream& inStrm,TcsCsvStatus&
 	}
 	return csvStatus;
 }
+// Rebuilds the DefinitionSet from a compiled image (see TcsNameMapImageHdr).
+// The image is verified in its entirety before anything is changed; false
+// is returned if it is not a valid image for this host.  Since the records
+// are in the collating sequence of the set, each is inserted at the end.
+bool TcsNameMapper::ReadFromImage (const void* image,size_t imageSize)
+{
+	ulong32_t idx;
+	const TcsNameMapImageHdr* hdrPtr;
+	const TcsNameMapImageRec* recPtr;
+	const wchar_t* poolPtr;
+
+	if (image == 0 || imageSize < sizeof (TcsNameMapImageHdr))
+	{
+		return false;
+	}
+	hdrPtr = static_cast<const TcsNameMapImageHdr*>(image);
+	if (hdrPtr->Magic != cs_NMMAPIMG_MAGIC ||
+		hdrPtr->ByteOrder != cs_DICTMAP_ORDER ||
+		hdrPtr->WcharSize != sizeof (wchar_t) ||
+		hdrPtr->RecordSize != sizeof (TcsNameMapImageRec) ||
+		hdrPtr->RecordCount > imageSize / sizeof (TcsNameMapImageRec) ||
+		hdrPtr->PoolSize == 0 ||
+		hdrPtr->PoolSize > imageSize / sizeof (wchar_t) ||
+		imageSize != sizeof (TcsNameMapImageHdr) + hdrPtr->RecordCount * sizeof (TcsNameMapImageRec)
+												 + hdrPtr->PoolSize * sizeof (wchar_t))
+	{
+		return false;
+	}
+	recPtr = reinterpret_cast<const TcsNameMapImageRec*>(hdrPtr + 1);
+	poolPtr = reinterpret_cast<const wchar_t*>(recPtr + hdrPtr->RecordCount);
+	if (poolPtr [hdrPtr->PoolSize - 1] != L'\0')
+	{
+		return false;
+	}
+	for (idx = 0;idx < hdrPtr->RecordCount;idx += 1)
+	{
+		if (recPtr [idx].NameOffset >= hdrPtr->PoolSize ||
+			recPtr [idx].RemarksOffset >= hdrPtr->PoolSize ||
+			recPtr [idx].CommentsOffset >= hdrPtr->PoolSize)
+		{
+			return false;
+		}
+	}
+
+	DefinitionSet.clear ();
+	Duplicates.clear ();
+	for (idx = 0;idx < hdrPtr->RecordCount;idx += 1)
+	{
+		TcsNameMap nextItem (TcsGenericId (recPtr [idx].GenericId),EcsMapObjType (recPtr [idx].Type),
+																   EcsNameFlavor (recPtr [idx].Flavor),
+																   recPtr [idx].NumericId,
+																   poolPtr + recPtr [idx].NameOffset);
+		nextItem.SetDupSort (recPtr [idx].DupSort);
+		nextItem.SetAliasFlag (recPtr [idx].AliasFlag);
+		nextItem.SetFlags (recPtr [idx].Flags);
+		nextItem.SetDeprecated (TcsGenericId (recPtr [idx].Deprecated));
+		if (recPtr [idx].RemarksOffset != 0)
+		{
+			nextItem.SetRemarks (poolPtr + recPtr [idx].RemarksOffset);
+		}
+		if (recPtr [idx].CommentsOffset != 0)
+		{
+			nextItem.SetComments (poolPtr + recPtr [idx].CommentsOffset);
+		}
+		DefinitionSet.insert (DefinitionSet.end (),nextItem);		//lint !e534  ignoring return value
+	}
+	RebuildIndices ();
+	AdjustDefaultIDs ();
+	return true;
+}
+// Adds a string to the image string pool, unless an identical string is
+// already there, and returns its offset.  Offset zero is the empty string.
+static ulong32_t CSnameMapImageString (std::map<std::wstring,ulong32_t>& poolIndex,
+									   std::vector<wchar_t>& pool,
+									   const wchar_t* string)
+{
+	ulong32_t offset = 0UL;
+
+	if (string != 0 && *string != L'\0')
+	{
+		std::pair<std::map<std::wstring,ulong32_t>::iterator,bool> insertStatus;
+		insertStatus = poolIndex.insert (std::make_pair (std::wstring (string),static_cast<ulong32_t>(pool.size ())));
+		if (insertStatus.second)
+		{
+			pool.insert (pool.end (),string,string + wcslen (string) + 1);
+		}
+		offset = insertStatus.first->second;
+	}
+	return offset;
+}
+// Writes the compiled image of this Name Mapper (see TcsNameMapImageHdr),
+// stamped with the size and modification time of the .CSV source.  User
+// values and the duplicate list are not part of the image.
+bool TcsNameMapper::WriteImage (csFILE* outStrm,ulong32_t csvSize,ulong32_t csvTime) const
+{
+	bool ok;
+	const_iterator setItr;
+	TcsNameMapImageHdr header;
+	TcsNameMapImageRec record;
+	std::vector<TcsNameMapImageRec> records;
+	std::vector<wchar_t> pool;
+	std::map<std::wstring,ulong32_t> poolIndex;
+
+	pool.push_back (L'\0');
+	records.reserve (DefinitionSet.size ());
+	for (setItr = DefinitionSet.begin ();setItr != DefinitionSet.end ();setItr++)
+	{
+		memset (&record,0,sizeof (record));
+		record.GenericId      = static_cast<ulong32_t>(setItr->GetGenericId ().GetGenericId ());
+		record.NumericId      = static_cast<ulong32_t>(setItr->GetNumericId ());
+		record.Flags          = static_cast<ulong32_t>(setItr->GetFlags ());
+		record.Deprecated     = static_cast<ulong32_t>(setItr->DeprecatedBy ().GetGenericId ());
+		record.NameOffset     = CSnameMapImageString (poolIndex,pool,setItr->GetNamePtr ());
+		record.RemarksOffset  = CSnameMapImageString (poolIndex,pool,setItr->GetRemarks ());
+		record.CommentsOffset = CSnameMapImageString (poolIndex,pool,setItr->GetComments ());
+		record.Type           = static_cast<short>(setItr->GetMapClass ());
+		record.Flavor         = static_cast<short>(setItr->GetFlavor ());
+		record.DupSort        = setItr->GetDupSort ();
+		record.AliasFlag      = setItr->GetAliasFlag ();
+		records.push_back (record);
+	}
+
+	memset (&header,0,sizeof (header));
+	header.Magic       = cs_NMMAPIMG_MAGIC;
+	header.ByteOrder   = cs_DICTMAP_ORDER;
+	header.WcharSize   = sizeof (wchar_t);
+	header.RecordSize  = sizeof (TcsNameMapImageRec);
+	header.RecordCount = static_cast<ulong32_t>(records.size ());
+	header.PoolSize    = static_cast<ulong32_t>(pool.size ());
+	header.CsvSize     = csvSize;
+	header.CsvTime     = csvTime;
+
+	ok = (CS_fwrite (&header,sizeof (header),1,outStrm) == 1);
+	if (ok && !records.empty ())
+	{
+		ok = (CS_fwrite (&records [0],sizeof (TcsNameMapImageRec),records.size (),outStrm) == records.size ());
+	}
+	if (ok)
+	{
+		ok = (CS_fwrite (&pool [0],sizeof (wchar_t),pool.size (),outStrm) == pool.size ());
+	}
+	return ok;
+}
 bool TcsNameMapper::Add (TcsNameMap& newItem,bool addDupName,const wchar_t* objSrcId)
 {
 	std::pair<iterator,bool> insertStatus;
@@ -842,7 +1344,7 @@ bool TcsNameMapper::Add (TcsNameMap& newItem,bool addDupName,const wchar_t* objS
 		TcsGenericId newGenericId (flavor,newId);
 		newItem.SetGenericId (newGenericId);
 	}
-	insertStatus = DefinitionSet.insert (newItem);
+	insertStatus = InsertDefinition (newItem);
 	
 	// Record all duplicates, even if we eventually add it.
 	if (RecordDuplicates && !insertStatus.second)
@@ -868,14 +1370,14 @@ bool TcsNameMapper::Add (TcsNameMap& newItem,bool addDupName,const wchar_t* objS
 			break;
 		}
 		newItem.SetDupSort (dupSort);
-		insertStatus = DefinitionSet.insert (newItem);
+		insertStatus = InsertDefinition (newItem);
 	}
 	return insertStatus.second;
 }
 bool TcsNameMapper::Add (const TcsNameMap& newItem)
 {
 	std::pair<iterator,bool> insertStatus;
-	insertStatus = DefinitionSet.insert (newItem);
+	insertStatus = InsertDefinition (newItem);
 	return insertStatus.second;
 }
 bool TcsNameMapper::Replace (const TcsNameMap& newItem,const TcsNameMap& oldItem)
@@ -886,9 +1388,9 @@ bool TcsNameMapper::Replace (const TcsNameMap& newItem,const TcsNameMap& oldItem
 	itr = DefinitionSet.find (oldItem);
 	if (itr != DefinitionSet.end ())
 	{
-		DefinitionSet.erase (itr);		//lint !e534   ignoring return value
+		EraseDefinition (itr);
 	}
-	insertStatus = DefinitionSet.insert (newItem);
+	insertStatus = InsertDefinition (newItem);
 	return insertStatus.second;
 }
 // Given a specific system id the systemId parameter, this function will
@@ -988,7 +1490,7 @@ bool TcsNameMapper::AliasExistingName (EcsMapObjType type,EcsNameFlavor flavor,c
 			TcsNameMap newEntry (*itr);
 			
 			// Erase the old entry we are replacing.
-			DefinitionSet.erase (itr);		//lint !e534   ignoring return value
+			EraseDefinition (itr);
 
 			// Modify the two copies as appropriate.
 			oldEntry.SetAliasFlag (1);
@@ -1044,7 +1546,7 @@ bool TcsNameMapper::AliasExistingName (EcsMapObjType type,EcsNameFlavor flavor,u
 			TcsNameMap newEntry (*entryItr);
 			
 			// Erase the old entry we are replacing.
-			DefinitionSet.erase (entryItr);		//lint !e534   ignoring return value
+			EraseDefinition (entryItr);
 
 			// Modify the two copies as appropriate.
 			oldEntry.SetAliasFlag (1);
@@ -1097,7 +1599,7 @@ bool TcsNameMapper::ExtractAndRemove (TcsNameMap& extractedNameMap,EcsMapObjType
 	if (itr != DefinitionSet.end ())
 	{
 		extractedNameMap = *itr;
-		DefinitionSet.erase (itr);		//lint !e534   ignoring return value
+		EraseDefinition (itr);
 		ok = true;
 	}
 	return ok;
@@ -1135,22 +1637,11 @@ TcsGenericId TcsNameMapper::Locate (EcsMapObjType type,EcsNameFlavor flavor,unsi
 const wchar_t* TcsNameMapper::LocateName (EcsMapObjType type,EcsNameFlavor flavor,const TcsGenericId& genericId) const
 {
 	const wchar_t* rtnValue = 0;
-	const_iterator beginItr;
-	const_iterator endItr;
-	const_iterator searchItr;
+	iterator indexItr;
 
-	TcsNameMap beginSearchObj (type,flavor,FirstName,0,0);
-	TcsNameMap endSearchObj (type,flavor,LastName,9999,9999);
-	
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	if (GenericIdIndex.Find (indexItr,type,flavor,static_cast<unsigned long>(genericId)))
 	{
-		if (searchItr->GetGenericId () == genericId)
-		{
-			rtnValue = searchItr->GetNamePtr ();
-			break;
-		}
+		rtnValue = indexItr->GetNamePtr ();
 	}
 	return rtnValue;
 }
@@ -1159,22 +1650,11 @@ const wchar_t* TcsNameMapper::LocateName (EcsMapObjType type,EcsNameFlavor flavo
 unsigned long TcsNameMapper::LocateNumber (EcsMapObjType type,EcsNameFlavor flavor,const TcsGenericId& genericId) const
 {
 	unsigned long rtnValue = 0UL;
-	const_iterator beginItr;
-	const_iterator endItr;
-	const_iterator searchItr;
-	
-	TcsNameMap beginSearchObj (type,flavor,FirstName,0,0);
-	TcsNameMap endSearchObj (type,flavor,LastName,9999,9999);
-	
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	iterator indexItr;
+
+	if (GenericIdIndex.Find (indexItr,type,flavor,static_cast<unsigned long>(genericId)))
 	{
-		if (searchItr->GetGenericId () == genericId)
-		{
-			rtnValue = searchItr->GetNumericId ();
-			break;
-		}
+		rtnValue = indexItr->GetNumericId ();
 	}
 	return rtnValue;
 }
@@ -1352,53 +1832,28 @@ void TcsNameMapper::AdjustDefaultIDs (void)
 // is, we always get the standard name (no aliases).  Since duplicate names
 // are the same, it really doesn't matter which one we get; but we will always
 // get the one with the given generic ID and with DupSort == 0.
+//
+// The NumericIdIndex refers to precisely that record, so the search is a
+// hash lookup rather than a scan of every record of the type and flavor.
 TcsNameMap* TcsNameMapper::LocateNameMap (EcsMapObjType type,EcsNameFlavor flavor,unsigned long id)
 {
 	TcsNameMap *nmMapPtr = 0;
-	iterator beginItr;
-	iterator endItr;
-	iterator searchItr;
-
-	TcsNameMap beginSearchObj (type,flavor,FirstName,0,0);
-	TcsNameMap endSearchObj (type,flavor,LastName,9999,9999);
+	iterator indexItr;
 
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	if (NumericIdIndex.Find (indexItr,type,flavor,id))
 	{
-		if (searchItr->GetNumericId () == id)
-		{
-//			nmMapPtr = &(*searchItr);
-//	Change required to achieve compilation on Linux, gcc 3.2.2
-//  I can't see why the const_cast is necessary.
-			nmMapPtr = const_cast<TcsNameMap*>(&(*searchItr));
-			break;
-		}
+		nmMapPtr = const_cast<TcsNameMap*>(&(*indexItr));
 	}
 	return nmMapPtr;
 }
 const TcsNameMap* TcsNameMapper::LocateNameMap (EcsMapObjType type,EcsNameFlavor flavor,unsigned long id) const
 {
-	TcsNameMap *nmMapPtr = 0;
-	const_iterator beginItr;
-	const_iterator endItr;
-	const_iterator searchItr;
-
-	TcsNameMap beginSearchObj (type,flavor,FirstName,0,0);
-	TcsNameMap endSearchObj (type,flavor,LastName,9999,9999);
+	const TcsNameMap *nmMapPtr = 0;
+	iterator indexItr;
 
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	if (NumericIdIndex.Find (indexItr,type,flavor,id))
 	{
-		if (searchItr->GetNumericId () == id)
-		{
-//			nmMapPtr = &(*searchItr);
-//	Change required to achieve compilation on Linux, gcc 3.2.2
-//  I can't see why the const_cast is necessary.
-			nmMapPtr = const_cast<TcsNameMap*>(&(*searchItr));
-			break;
-		}
+		nmMapPtr = &(*indexItr);
 	}
 	return nmMapPtr;
 }
@@ -1407,49 +1862,81 @@ const TcsNameMap* TcsNameMapper::LocateNameMap (EcsMapObjType type,EcsNameFlavor
 // convenient.
 TcsNameMapper::iterator TcsNameMapper::LocateNameMapItr (EcsMapObjType type,EcsNameFlavor flavor,unsigned long id)
 {
-	iterator beginItr;
-	iterator endItr;
-	iterator searchItr;
 	iterator returnItr;
 
-	returnItr = DefinitionSet.end ();
-	TcsNameMap beginSearchObj (type,flavor,FirstName,0,0);
-	TcsNameMap endSearchObj (type,flavor,LastName,9999,9999);
-
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	if (!NumericIdIndex.Find (returnItr,type,flavor,id))
 	{
-		if (searchItr->GetNumericId () == id)
-		{
-			returnItr = searchItr;
-			break;
-		}
+		returnItr = DefinitionSet.end ();
 	}
 	return returnItr;
 }
 TcsNameMapper::const_iterator TcsNameMapper::LocateNameMapItr (EcsMapObjType type,EcsNameFlavor flavor,unsigned long id) const
 {
-	const_iterator beginItr;
-	const_iterator endItr;
-	const_iterator searchItr;
+	iterator indexItr;
 	const_iterator returnItr;
 
 	returnItr = DefinitionSet.end ();
-	TcsNameMap beginSearchObj (type,flavor,FirstName,0,0);
-	TcsNameMap endSearchObj (type,flavor,LastName,9999,9999);
+	if (NumericIdIndex.Find (indexItr,type,flavor,id))
+	{
+		returnItr = indexItr;
+	}
+	return returnItr;
+}
+///////////////////////////////////////////////////////////////////////////////
+// All insertions into, and erasures from, the DefinitionSet go through the
+// following so that the NumericIdIndex, GenericIdIndex, and NameIndex remain
+// current.
+std::pair<TcsNameMapper::iterator,bool> TcsNameMapper::InsertDefinition (const TcsNameMap& newItem)
+{
+	std::pair<iterator,bool> insertStatus;
 
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	insertStatus = DefinitionSet.insert (newItem);
+	if (insertStatus.second)
+	{
+		NumericIdIndex.Insert (insertStatus.first);
+		GenericIdIndex.Insert (insertStatus.first);
+		NameIndex.Insert (insertStatus.first);
+	}
+	return insertStatus;
+}
+void TcsNameMapper::EraseDefinition (iterator itr)
+{
+	UnindexDefinition (NumericIdIndex,itr);
+	UnindexDefinition (GenericIdIndex,itr);
+	UnindexDefinition (NameIndex,itr);
+	DefinitionSet.erase (itr);		//lint !e534   ignoring return value
+}
+// If the index refers to the member being erased, it must be redirected to
+// the next member of the same type and flavor with the same key, if any.
+// Since the erased member was the first such member, we need only search
+// forward from it.
+void TcsNameMapper::UnindexDefinition (TcsNameMapIndex& index,iterator itr)
+{
+	iterator indexItr;
+	iterator searchItr;
+
+	if (index.Find (indexItr,*itr) && indexItr == itr)
 	{
-		if (searchItr->GetNumericId () == id)
+		index.Remove (itr);
+		for (searchItr = itr,++searchItr;searchItr != DefinitionSet.end ();searchItr++)
 		{
-			returnItr = searchItr;
-			break;
+			if (searchItr->GetMapClass () != itr->GetMapClass () || searchItr->GetFlavor () != itr->GetFlavor ())
+			{
+				break;
+			}
+			if (index.SameKey (*searchItr,*itr))
+			{
+				index.Insert (searchItr);
+				break;
+			}
 		}
 	}
-	return returnItr;
+}
+void TcsNameMapper::RebuildIndices (void)
+{
+	NumericIdIndex.Rebuild (DefinitionSet);
+	GenericIdIndex.Rebuild (DefinitionSet);
+	NameIndex.Rebuild (DefinitionSet);
 }
 ///////////////////////////////////////////////////////////////////////////////
 // Given a name, locate the first member of the std::set of the same type and
@@ -1468,28 +1955,17 @@ TcsNameMapper::const_iterator TcsNameMapper::LocateNameMapItr (EcsMapObjType typ
 // and DupSort.  Should this occur for whatever reason, the correct results
 // will still be produced.  That is, the generic ID of the first item in the
 // std::set collating sequence with the name provided will be returned.
+//
+// The NameIndex refers to precisely that item, and is searched without
+// constructing any search objects, so the lookup allocates nothing.
 TcsNameMap* TcsNameMapper::LocateNameMap (EcsMapObjType type,EcsNameFlavor flavor,const wchar_t* name)
 {
 	TcsNameMap *nmMapPtr = 0;
-	iterator beginItr;
-	iterator endItr;
-	iterator searchItr;
+	iterator indexItr;
 
-	TcsNameMap beginSearchObj (type,flavor,name,0,0);
-	TcsNameMap endSearchObj (type,flavor,name,9999,9999);
-
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	if (NameIndex.Find (indexItr,type,flavor,name))
 	{
-		if (!CS_wcsicmp (searchItr->GetNamePtr (),name))
-		{
-//			nmMapPtr = &(*searchItr);
-//	Change required to achieve compilation on Linux, gcc 3.2.2
-//  I can't see why the const_cast is necessary.
-			nmMapPtr = const_cast<TcsNameMap*>(&(*searchItr));
-			break;
-		}
+		nmMapPtr = const_cast<TcsNameMap*>(&(*indexItr));
 	}
 	return nmMapPtr;
 }
@@ -1498,22 +1974,11 @@ TcsNameMap* TcsNameMapper::LocateNameMap (EcsMapObjType type,EcsNameFlavor flavo
 const TcsNameMap* TcsNameMapper::LocateNameMap (EcsMapObjType type,EcsNameFlavor flavor,const wchar_t* name,short dupSort) const
 {
 	const TcsNameMap *nmMapPtr = 0;
-	const_iterator beginItr;
-	const_iterator endItr;
-	const_iterator searchItr;
-
-	TcsNameMap beginSearchObj (type,flavor,name,0,0);
-	TcsNameMap endSearchObj (type,flavor,name,9999,9999);
+	iterator indexItr;
 
-	beginItr = DefinitionSet.lower_bound (beginSearchObj);
-	endItr   = DefinitionSet.upper_bound (endSearchObj);
-	for (searchItr = beginItr;searchItr != endItr;searchItr++)
+	if (NameIndex.Find (indexItr,type,flavor,name))
 	{
-		if (!CS_wcsicmp (searchItr->GetNamePtr (),name))
-		{
-			nmMapPtr = &(*searchItr);
-			break;
-		}
+		nmMapPtr = &(*indexItr);
 	}
 	return nmMapPtr;
 }
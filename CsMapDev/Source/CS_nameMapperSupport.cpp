@@ -48,16 +48,22 @@
 #include <vector>
 #include <set>
 
+#if _RUN_TIME >= _rt_UNIXPCC
+#	include <sys/mman.h>
+#endif
+
 extern "C" char cs_Dir [];
 extern "C" char* cs_DirP;
 extern "C" char csErrnam [];
 extern "C" const unsigned long KcsNmMapNoNumber = 0UL;
 extern "C" const unsigned long KcsNmInvNumber = 0xFFFFFFFFUL;
 extern "C" char cs_NameMapperName [];
+extern "C" char cs_NameMapperImgName [];
 
 // The following variable is declared static to discourage code outside
 // this module from using the name map object directly.
 static TcsNameMapper* KcsNameMapperPtr = 0;
+static unsigned long KcsNameMapperSerial = 0UL;
 
 EcsMapObjType& operator++ (EcsMapObjType& mapClass)
 {
@@ -201,6 +207,130 @@ enum ErcWktFlavor csCsMapFlvrToWktFlvr (enum EcsNameFlavor csMap)
     return result;
 }
 
+// Loads the Name Mapper from the compiled image in the dictionary directory,
+// if there is one which was produced from the .CSV source as it now is; that
+// is, the size and modification time recorded in the image match those of
+// the .CSV source exactly.  An image with no .CSV source beside it is used
+// as is.  Returns zero, without reporting an error, if there is no such
+// image or it is not usable on this host; the caller then loads the .CSV
+// source.
+static TcsNameMapper* CSnameMapperFromImage (void)
+{
+    TcsNameMapper* rtnValue = 0;
+    void* image = 0;
+    size_t imageSize = 0;
+    bool mapped = false;
+    char imgPath [MAXPATH];
+
+    strcpy (cs_DirP,cs_NameMapperName);
+    cs_Time_ csvTime = CS_fileModTime (cs_Dir);
+    ulong32_t csvSize = CS_fileSize (cs_Dir);
+    strcpy (cs_DirP,cs_NameMapperImgName);
+    CS_stncp (imgPath,cs_Dir,sizeof (imgPath));
+    if (CS_fileModTime (imgPath) == 0)
+    {
+        return rtnValue;
+    }
+    csFILE* pImageFile = CS_fopen (imgPath,_STRM_BINRD);
+    if (pImageFile == NULL)
+    {
+        return rtnValue;
+    }
+    if (0 == CS_fseek (pImageFile,0L,SEEK_END))
+    {
+        long fileSize = CS_ftell (pImageFile);
+        if (fileSize > 0L)
+        {
+            imageSize = (size_t)fileSize;
+#if _RUN_TIME >= _rt_UNIXPCC
+            image = mmap (NULL,imageSize,PROT_READ,MAP_SHARED,_fileno (pImageFile),(off_t)0);
+            if (image == MAP_FAILED)
+            {
+                image = 0;
+            }
+            else
+            {
+                mapped = true;
+            }
+#endif
+            if (image == 0)
+            {
+                // No mapping available, read the whole thing.
+                image = CS_malc (imageSize);
+                if (image != 0 && (CS_fseek (pImageFile,0L,SEEK_SET) != 0 ||
+                                   CS_fread (image,1,imageSize,pImageFile) != imageSize))
+                {
+                    CS_free (image);
+                    image = 0;
+                }
+            }
+        }
+    }
+    CS_fclose (pImageFile);
+    if (image != 0)
+    {
+        const TcsNameMapImageHdr* hdrPtr = static_cast<const TcsNameMapImageHdr*>(image);
+        bool current = (csvTime == 0) ||
+                       (imageSize >= sizeof (TcsNameMapImageHdr) &&
+                        hdrPtr->CsvSize == csvSize &&
+                        hdrPtr->CsvTime == static_cast<ulong32_t>(csvTime));
+        std::auto_ptr<TcsNameMapper> nameMapperPtr (new TcsNameMapper ());
+        if (current && nameMapperPtr->ReadFromImage (image,imageSize))
+        {
+            rtnValue = nameMapperPtr.release ();
+        }
+#if _RUN_TIME >= _rt_UNIXPCC
+        if (mapped)
+        {
+            munmap (image,imageSize);
+        }
+        else
+        {
+            CS_free (image);
+        }
+#else
+        CS_free (image);
+#endif
+    }
+    return rtnValue;
+}
+// Loads the Name Mapper from the .CSV source in the dictionary directory.
+// Returns zero, having reported the error, on failure.
+static TcsNameMapper* CSnameMapperFromCsv (void)
+{
+    TcsNameMapper* rtnValue = 0;
+
+    // The reader maps (or reads) the entire file, and the name maps are
+    // extracted directly from the file image.
+    TcsCsvStatus csvStatus;
+    TcsCsvReader csvReader (TcsNameMapper::Delimiters);
+    strcpy (cs_DirP,cs_NameMapperName);
+    if (csvReader.Open (cs_Dir))
+    {
+        // Create new name mapper instance
+        std::auto_ptr<TcsNameMapper> nameMapperPtr(new TcsNameMapper());
+        EcsCsvStatus status = nameMapperPtr->ReadFromReader (csvReader,csvStatus);
+        if (status == csvOk)
+        {
+            // Assign the name mapper
+            rtnValue = nameMapperPtr.release();
+        }
+        else
+        {
+            // Failed to fill up the name mapper
+            char msgBufr [2048];
+            CS_sprintf (msgBufr,"%s [%lu]",cs_NameMapperName,csvStatus.LineNbr);
+            CS_stncp (csErrnam,msgBufr,MAXPATH);
+            CS_erpt (cs_NMMAP_FAIL2);
+        }
+    }
+    else
+    {
+        CS_stncp (csErrnam,cs_Dir,MAXPATH);
+        CS_erpt (cs_NMMAP_FAIL1);
+    }
+    return rtnValue;
+}
 // Each of the Name mapper API functions calls this function to get a pointer
 // to the name mapping object.  A pointer is returned, rather than a reference,
 // as a null return value indicates that a name mapper object could not be
@@ -213,90 +343,76 @@ TcsNameMapper* cmGetNameMapperPtr (bool release)
         {
             delete KcsNameMapperPtr;
             KcsNameMapperPtr = 0;
+            KcsNameMapperSerial += 1;
         }
     }
     else if (KcsNameMapperPtr == 0)
     {
-        // Load data from name mapper file
-        // Load complete file at once into a memory buffer, then parse the information from there.
-        TcsCsvStatus csvStatus;
-        // Open name mapper file
-        strcpy (cs_DirP,cs_NameMapperName);
-        csFILE* pNameMapperFile = CS_fopen(cs_Dir, "rb");
-        if (NULL != pNameMapperFile)
+        // A current compiled image is much faster to load than the .CSV
+        // source, which remains the source of the image.
+        KcsNameMapperPtr = CSnameMapperFromImage ();
+        if (KcsNameMapperPtr == 0)
         {
-            // Create new name mapper instance
-            std::auto_ptr<TcsNameMapper> nameMapperPtr(new TcsNameMapper());
-            if (0 == CS_fseek(pNameMapperFile, 0, SEEK_END))
-            {
-                // Get name mapper file size
-                long fileSize = CS_ftell(pNameMapperFile);
-                if (fileSize > 0L)
-                {
-                    // Allocate temporary memory buffer for the name mapper file content
-                    char* pBuffer = (char*) CS_malc((size_t)fileSize);
-                    if (NULL != pBuffer)
-                    {
-                        if (0 == CS_fseek(pNameMapperFile, 0, SEEK_SET))
-                        {
-                            // Copy complete name mapper file into the memory
-                            CS_fread(pBuffer, sizeof(char),(size_t)fileSize, pNameMapperFile);		//lint !e534  ignoring return value
-                            if (CS_ferror(pNameMapperFile))
-			                {
-				                CS_erpt (cs_IOERR);
-			                }
-                            else
-                            {
-                                // Close first name mapper file. The content is already in the memory buffer.
-                                CS_fclose(pNameMapperFile);
-                                pNameMapperFile = NULL;
-
-                                // Fill up the name mapper with the in memory name mapper file buffer
-                                EcsCsvStatus status = nameMapperPtr->ReadFromStream (pBuffer,(size_t)fileSize); // Note: Time consuming
-                                if (status == csvOk)
-                                {
-                                    // Assign the name mapper
-                                    KcsNameMapperPtr = nameMapperPtr.release();
-                                }
-                                else
-                                {
-                                    // Failed to fill up the name mapper
-                                    char msgBufr [2048];
-                                    CS_sprintf (msgBufr,"%s [%lu]",cs_NameMapperName,csvStatus.LineNbr);
-                                    CS_stncp (csErrnam,msgBufr,MAXPATH);
-                                    CS_erpt (cs_NMMAP_FAIL2);
-                                }
-                            }
-                        }
-                        // Clean up temporary file buffer
-                        CS_free(pBuffer);
-                        pBuffer = NULL;
-                    }
-                    else
-                    {
-                        CS_erpt(cs_NO_MEM);
-                    }
-                }
-            }
-            // Close name mapper file if it is not already done above
-            if (NULL != pNameMapperFile)
-            {
-                CS_fclose(pNameMapperFile);
-                pNameMapperFile = NULL;
-            }
+            KcsNameMapperPtr = CSnameMapperFromCsv ();
         }
-        else
+        if (KcsNameMapperPtr != 0)
         {
-            CS_stncp (csErrnam,cs_Dir,MAXPATH);
-            CS_erpt (cs_NMMAP_FAIL1);
+            KcsNameMapperSerial += 1;
         }
     }
 	return KcsNameMapperPtr;
 }
+unsigned long cmGetNameMapperSerial (void)
+{
+	return KcsNameMapperSerial;
+}
 void EXP_LVL1 csReleaseNameMapper (void)
 {
 	cmGetNameMapperPtr (true);//lint !e534   ignoring return value
 }
+int EXP_LVL3 csCompileNameMapper (void)
+{
+	int rtnValue = -1;
+	char imgPath [MAXPATH];
+
+	// The stamp is taken before the source is read, so that a source which
+	// changes while being compiled leaves the image stale.
+	strcpy (cs_DirP,cs_NameMapperName);
+	ulong32_t csvTime = static_cast<ulong32_t>(CS_fileModTime (cs_Dir));
+	ulong32_t csvSize = CS_fileSize (cs_Dir);
+	TcsNameMapper* mapperPtr = CSnameMapperFromCsv ();
+	if (mapperPtr != 0)
+	{
+		strcpy (cs_DirP,cs_NameMapperImgName);
+		CS_stncp (imgPath,cs_Dir,sizeof (imgPath));
+		csFILE* pImageFile = CS_fopen (imgPath,_STRM_BINWR);
+		if (pImageFile == NULL)
+		{
+			CS_stncp (csErrnam,imgPath,MAXPATH);
+			CS_erpt (cs_FL_OPEN);
+		}
+		else
+		{
+			bool ok = mapperPtr->WriteImage (pImageFile,csvSize,csvTime);
+			if (CS_fclose (pImageFile) != 0)
+			{
+				ok = false;
+			}
+			if (ok)
+			{
+				rtnValue = 0;
+			}
+			else
+			{
+				CS_remove (imgPath);		//lint !e534   ignoring return value
+				CS_stncp (csErrnam,imgPath,MAXPATH);
+				CS_erpt (cs_IOERR);
+			}
+		}
+		delete mapperPtr;
+	}
+	return rtnValue;
+}
 ///////////////////////////////////////////////////////////////////////////////
 unsigned long csMapNameToId (EcsMapObjType type,EcsNameFlavor trgFlavor,EcsNameFlavor srcFlavor,
 																		const wchar_t* srcName)
@@ -880,19 +996,9 @@ TcsKeyNameMapFile::TcsKeyNameMapFile (const wchar_t* mapFilePath,
     SetObjectName (objectName);
     Status.SetObjectName (objectName);
 
-// Seems gcc 3.2.2 wifstream::open requires an 8 bit character path.  NOT NICE!!!
-char pathBufr [1024];
-wcstombs (pathBufr,mapFilePath,sizeof (pathBufr));
-std::wifstream iStrm (pathBufr,std::ios_base::in);
-//  std::wifstream iStrm (mapFilePath,std::ios_base::in);
-    if (iStrm.is_open ())
-    {
-        ReadFromStream (iStrm,true,Status);		//lint !e534  ignoring return value
-    }
-    else
-    {
-         Status.SetStatus (csvNoFile);
-    }
+    char pathBufr [1024];
+    wcstombs (pathBufr,mapFilePath,sizeof (pathBufr));
+    ReadFromFile (pathBufr,true,Status);		//lint !e534  ignoring return value
     return;
 }
 TcsKeyNameMapFile::TcsKeyNameMapFile (const TcsKeyNameMapFile& source)
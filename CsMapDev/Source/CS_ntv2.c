@@ -1382,6 +1382,136 @@ error:
 }
 /*lint +esym(550,readCnt) */
 
+/* Batch Interpolation Calculator
+
+	Performs the CScalcNTv2 calculation for an array of points.  Since NTv2
+	grid cells are not buffered (see above), CScalcNTv2 fetches and
+	recomputes the cell for every point.  Here, consecutive points which are
+	located in the same sub-grid, and which fall within the cell fetched for
+	a previous point, share that cell.  The sub-grid search is performed for
+	every point so that the overlapping sub-grid issues described above are
+	still honored; a cell is only shared when the sub-grid search selects the
+	same, cacheable, sub-grid.  The interpolation itself is performed by the
+	shared bilinear kernel, a block of points at a time.
+
+	Status values are the same as those returned by CScalcNTv2.  The status
+	array is optional.  The return value is the largest status value
+	encountered, or csGRIDI_ST_SYSTEM if a system error was encountered.  A
+	system error terminates the processing of the batch; the failed point and
+	all remaining points receive a zero delta and the error status. */
+int CScalcNTv2N (struct cs_NTv2_* thisPtr,double deltaLL [][2],int status [],
+															   Const double source [][3],
+															   int count)
+{
+	extern double cs_Zero;				/* 0.0 */
+	extern double cs_LlNoise;			/* 1.0E-12 */
+
+	int idx;
+	int blkIdx;
+	int blkCnt;
+	int ptStatus;
+	int rtnValue;
+	int reuse;
+
+	struct csNTv2SubGrid_ *subPtr;
+	struct csNTv2SubGrid_ *cellSubPtr;
+	Const struct csNTv2GridCell_ *cellPtr;
+
+	double wpLng;
+	double cellDelta [2];
+	double dummy [2];
+
+	int blkPos [csGRIDI_BATCH];
+	double blkDeltaX [csGRIDI_BATCH];
+	double blkDeltaY [csGRIDI_BATCH];
+	double blkLng [csGRIDI_BATCH];
+	double blkLat [csGRIDI_BATCH];
+	double blkLngCoefs [csGRIDI_BATCH][4];
+	double blkLatCoefs [csGRIDI_BATCH][4];
+
+	rtnValue = csGRIDI_ST_OK;
+	cellSubPtr = NULL;
+	for (idx = 0;idx < count;)
+	{
+		for (blkCnt = 0;idx < count && blkCnt < csGRIDI_BATCH;idx += 1)
+		{
+			subPtr = CSlocateSubNTv2 (thisPtr,source [idx]);
+			if (subPtr == NULL)
+			{
+				deltaLL [idx][LNG] = cs_Zero;
+				deltaLL [idx][LAT] = cs_Zero;
+				if (status != NULL) status [idx] = csGRIDI_ST_COVERAGE;
+				if (rtnValue < csGRIDI_ST_COVERAGE) rtnValue = csGRIDI_ST_COVERAGE;
+				continue;
+			}
+
+			/* Can we use the cell we already have?  Note that we compute the
+			   extent of the cell from its southeast corner and its dimensions
+			   and require that the cell not be one of the degenerate "virtual"
+			   cells manufactured for points on the northern or western limits
+			   of a sub-grid. */
+			cellPtr = &thisPtr->longitudeCell;
+			wpLng = -source [idx][LNG];
+			reuse = (thisPtr->CellIsValid && subPtr == cellSubPtr && subPtr->Cacheable);
+			if (reuse)
+			{
+				reuse = (cellPtr->nwCorner [LNG] - cellPtr->seCorner [LNG]) > (cs_LlNoise + cs_LlNoise) &&
+						(cellPtr->nwCorner [LAT] - cellPtr->seCorner [LAT]) > (cs_LlNoise + cs_LlNoise) &&
+						wpLng >= cellPtr->seCorner [LNG] &&
+						wpLng <  cellPtr->seCorner [LNG] + cellPtr->deltaLng &&
+						source [idx][LAT] >= cellPtr->seCorner [LAT] &&
+						source [idx][LAT] <  cellPtr->seCorner [LAT] + cellPtr->deltaLat;
+			}
+			if (!reuse)
+			{
+				/* Have CScalcNTv2 fetch the appropriate cell. */
+				ptStatus = CScalcNTv2 (thisPtr,dummy,source [idx]);
+				if (ptStatus != csGRIDI_ST_OK)
+				{
+					deltaLL [idx][LNG] = cs_Zero;
+					deltaLL [idx][LAT] = cs_Zero;
+					if (status != NULL) status [idx] = ptStatus;
+					cellSubPtr = NULL;
+					if (ptStatus < 0)
+					{
+						for (idx += 1;idx < count;idx += 1)
+						{
+							deltaLL [idx][LNG] = cs_Zero;
+							deltaLL [idx][LAT] = cs_Zero;
+							if (status != NULL) status [idx] = ptStatus;
+						}
+						rtnValue = csGRIDI_ST_SYSTEM;
+						break;
+					}
+					if (rtnValue < ptStatus) rtnValue = ptStatus;
+					continue;
+				}
+				cellSubPtr = subPtr;
+			}
+
+			/* Gather this point into the block. */
+			CSgatherNTv2GridCell (&thisPtr->longitudeCell,blkLngCoefs [blkCnt],cellDelta,source [idx]);
+			CSgatherNTv2GridCell (&thisPtr->latitudeCell,blkLatCoefs [blkCnt],cellDelta,source [idx]);
+			blkDeltaX [blkCnt] = cellDelta [0];
+			blkDeltaY [blkCnt] = cellDelta [1];
+			blkPos [blkCnt] = idx;
+			if (status != NULL) status [idx] = csGRIDI_ST_OK;
+			blkCnt += 1;
+		}
+
+		/* Interpolate the block, and scatter the results. */
+		CSbilinearInterp (blkLng,blkDeltaX,blkDeltaY,blkLngCoefs,blkCnt);
+		CSbilinearInterp (blkLat,blkDeltaX,blkDeltaY,blkLatCoefs,blkCnt);
+		for (blkIdx = 0;blkIdx < blkCnt;blkIdx += 1)
+		{
+			deltaLL [blkPos [blkIdx]][LNG] = blkLng [blkIdx];
+			deltaLL [blkPos [blkIdx]][LAT] = blkLat [blkIdx];
+		}
+		if (rtnValue < 0) break;
+	}
+	return rtnValue;
+}
+
 /* Test function, used to determine if this object covers the provided point.
    If so, the "grid density" of the conversion is returned as a means of
    selecting one grid object over another. */
@@ -1467,27 +1597,30 @@ void CSinitNTv2GridCell (struct csNTv2GridCell_* thisPtr)
 	thisPtr->currentDD = cs_Zero;
 	thisPtr->sourceId [0] = '\0';
 }
+void CSgatherNTv2GridCell (Const struct csNTv2GridCell_* thisPtr,double coefs [4],double delta [2],
+																		 Const double sourceLL [2])
+{
+	/* The NTv2 format uses positive west longitudes.  Thus the reference
+	   corner of the grid cell is the southeast corner of the grid cell. */
+	coefs [0] = thisPtr->currentAA;
+	coefs [1] = thisPtr->currentBB;
+	coefs [2] = thisPtr->currentCC;
+	coefs [3] = thisPtr->currentDD;
+	delta [0] = (-sourceLL [LNG] - thisPtr->seCorner [LNG]) / thisPtr->deltaLng;
+	delta [1] = ( sourceLL [LAT] - thisPtr->seCorner [LAT]) / thisPtr->deltaLat;
+}
 double CScalcNTv2GridCell (Const struct csNTv2GridCell_* thisPtr,Const double sourceLL [2])
 {
-	double myLng, myLat;
-	double gridDeltaLng;
-	double gridDeltaLat;
+	double delta [2];
+	double coefs [1][4];
 	double returnValue;
 
 	/* This function performs the interpolation of the grid cell, and returns
 	   the result.  The algorithm used is the bilinear grid interpolation
-	   algorithm used in  most all grid interpolation techniques.
-
-	   The NTv2 format uses positive west longitudes.  Thus the reference
-	   corner of the grid cell is the southeast corner of the grid cell. */
-	myLng = -sourceLL [LNG];
-	myLat =  sourceLL [LAT];
-	gridDeltaLng  = (myLng - thisPtr->seCorner [LNG]) / thisPtr->deltaLng;
-	gridDeltaLat  = (myLat - thisPtr->seCorner [LAT]) / thisPtr->deltaLat;
-	returnValue = thisPtr->currentAA + 
-				  thisPtr->currentBB * gridDeltaLng +
-				  thisPtr->currentCC * gridDeltaLat +
-				  thisPtr->currentDD * gridDeltaLng * gridDeltaLat;
+	   algorithm used in  most all grid interpolation techniques; which is
+	   performed by the shared kernel. */
+	CSgatherNTv2GridCell (thisPtr,coefs [0],delta,sourceLL);
+	CSbilinearInterp (&returnValue,&delta [0],&delta [1],coefs,1);
 
 	/* Note return value for datum shift grid files is usually in seconds.
 	   However, this varies from application to application.  The units of
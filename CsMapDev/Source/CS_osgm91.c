@@ -47,6 +47,7 @@
 
 struct cs_Osgm91_ *CSnewOsgm91 (const char *filePath,long32_t bufferSize,ulong32_t flags,double density)
 {
+	extern int cs_OsGridInMemory;
 	extern char cs_DirsepC;
 	extern char cs_ExtsepC;
 	extern char csErrnam [];
@@ -87,6 +88,7 @@ struct cs_Osgm91_ *CSnewOsgm91 (const char *filePath,long32_t bufferSize,ulong32
 	__This->recordSize = __This->elementCount * __This->elementSize;
 
 	__This->strm = NULL;
+	__This->inMemory = FALSE;
 	__This->dataBuffer = NULL;
 	__This->bufferSize = 4 * __This->recordSize;
 	if (bufferSize > __This->bufferSize) __This->bufferSize = bufferSize;
@@ -108,6 +110,14 @@ struct cs_Osgm91_ *CSnewOsgm91 (const char *filePath,long32_t bufferSize,ulong32
 	st = CSmkBinaryOsgm91 (__This);
 	if (st != 0) goto error;
 
+	/* Unless the application has disabled it, load the entire node array
+	   now.  All subsequent access to the grid is then a direct index. */
+	if (cs_OsGridInMemory)
+	{
+		st = CSloadOsgm91 (__This);
+		if (st != 0) goto error;
+	}
+
 	/* Initialize the Transverse Mercator portion.  We need this to
 	   convert latitude and longitude to OSGB36 coodinates before
 	   throwing them at the Grid file. */
@@ -191,52 +201,89 @@ double CStestOsgm91 (struct cs_Osgm91_ *__This,const double etrs89 [2])
 	/* Returns zero if not covered, file density if covered. */
 	return CStestCoverage (&(__This->coverage),etrs89);
 }
-/* Note, the following function is also called by the CSinverseOsgm91 function. */
-int CScalcOsgm91 (struct cs_Osgm91_ *__This,double *geoidHgt,const double etrs89 [2])
+/* Reads the entire node array of the binary file into memory.  The UK
+   grids are small enough that this is the sensible thing to do; once loaded,
+   node access is simply an index calculation (see CSnodeOsgm91) and the
+   file is closed.  Returns zero on success, -1 on error (reported). */
+int CSloadOsgm91 (struct cs_Osgm91_ *__This)
 {
-	extern double cs_Mhuge;
 	extern char csErrnam [];
-	extern double cs_Zero;
 
 	long32_t readCount;
 	long32_t checkCount;
 
-	long32_t lngTmp;
-	long32_t checkSeek;
-	long32_t recNbr, eleNbr;
-	long32_t recFirst, recLast;
-	long32_t fposBegin, fposEnd;
-
-	char *chrPtr;
-	float *fltPtr;
+	/* Start with a clean slate. */
+	CSreleaseOsgm91 (__This);
 
-	double tt, uu;
+	readCount = __This->recordCount * __This->recordSize;
+	__This->dataBuffer = CS_malc ((size_t)readCount);
+	if (__This->dataBuffer == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	__This->strm = CS_fopen (__This->binaryPath,_STRM_BINRD);
+	if (__This->strm == NULL)
+	{
+		CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
+		CS_erpt (cs_DTC_FILE);
+		goto error;
+	}
+	checkCount = (long32_t)CS_fread (__This->dataBuffer,1,(size_t)readCount,__This->strm);
+	if (checkCount != readCount)
+	{
+		CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	if (CS_ferror (__This->strm))
+	{
+		CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
+		CS_erpt (cs_IOERR);
+		goto error;
+	}
+	CS_fclose (__This->strm);
+	__This->strm = NULL;
 
-	double xy [3];
+	/* The buffer now covers the entire file. */
+	__This->inMemory = TRUE;
+	__This->bufferSize = readCount;
+	__This->bufferBeginPosition = 0L;
+	__This->bufferEndPosition = readCount;
+	return 0;
 
-	float southWest, southEast;
-	float northWest, northEast;
+error:
+	CSreleaseOsgm91 (__This);
+	return -1;
+}
+/* Returns a pointer to the node at the southwest corner of the cell
+   identified by recNbr and eleNbr, the node at the northwest corner being
+   recordSize bytes further on.  In memory mode, this is a direct index into
+   the node array (which is reloaded if it has been released).  Otherwise,
+   the buffer is refilled from the file as necessary.  Returns NULL on error
+   (reported). */
+float *CSnodeOsgm91 (struct cs_Osgm91_ *__This,long32_t recNbr,long32_t eleNbr)
+{
+	extern char csErrnam [];
 
-	/* First, we compute the cartesian equivalent of the provided geographic
-	   coordinates.  Essentially, we apply the OS British National Grid
-	   Transformation, using the GRS1980 ellipsoid, to produce the necessary
-	   cartesian coordinates. */
-	CStrmerF (&__This->osgb36Trmer,xy,etrs89);				/*lint !e534  ignoring return value */
+	long32_t readCount;
+	long32_t checkCount;
 
-	/* Given the ETRS89 OSGB coordinates, return the translation values necessary to
-	   produce official OSGB36 coordinates.  Returns zero on normal completion, +1 if
-	   ETRS89 coordinates are out of range, -1 for any other error (i.e. call
-	   CS_errmsg for a textual description of the error). */;
+	long32_t lngTmp;
+	long32_t checkSeek;
+	long32_t recFirst, recLast;
+	long32_t fposBegin, fposEnd;
 
-	/* Compute the indices of the grid cells involved. */
-	recNbr = (long32_t)(xy [1] / 2000.0);
-	eleNbr = (long32_t)(xy [0] / 2000.0) - 50;
+	char *chrPtr;
 
-	/* Return now if out of range. */
-	if (recNbr < 0 || recNbr >= __This->recordCount || eleNbr < 0 || eleNbr >= __This->elementCount)
+	if (__This->inMemory)
 	{
-		*geoidHgt = cs_Zero;
-		return 1;
+		if (__This->dataBuffer == NULL)
+		{
+			if (CSloadOsgm91 (__This) != 0) return NULL;
+		}
+		chrPtr = (char *)__This->dataBuffer + recNbr * __This->recordSize + eleNbr * __This->elementSize;
+		return (float *)(chrPtr);								 /*lint !e826*/
 	}
 
 	/* Do we have a buffer?  Could have been released.  Maybe this is the
@@ -333,9 +380,61 @@ int CScalcOsgm91 (struct cs_Osgm91_ *__This,double *geoidHgt,const double etrs89
 		   using it.  Therefore, byte swapping is not an issue. */
 	}
 
-	/* Extract the grid cell. */
 	chrPtr = (char *)__This->dataBuffer + (fposBegin - __This->bufferBeginPosition);
-	fltPtr = (float *)(chrPtr);									 /*lint !e826*/
+	return (float *)(chrPtr);									 /*lint !e826*/
+
+error:
+	return NULL;
+}
+/* Note, the following function is also called by the CSinverseOsgm91 function. */
+int CScalcOsgm91 (struct cs_Osgm91_ *__This,double *geoidHgt,const double etrs89 [2])
+{
+	extern double cs_Mhuge;
+	extern char csErrnam [];
+	extern double cs_Zero;
+
+	long32_t recNbr, eleNbr;
+
+	char *chrPtr;
+	float *fltPtr;
+
+	double tt, uu;
+
+	double xy [3];
+
+	float southWest, southEast;
+	float northWest, northEast;
+
+	/* First, we compute the cartesian equivalent of the provided geographic
+	   coordinates.  Essentially, we apply the OS British National Grid
+	   Transformation, using the GRS1980 ellipsoid, to produce the necessary
+	   cartesian coordinates. */
+	CStrmerF (&__This->osgb36Trmer,xy,etrs89);				/*lint !e534  ignoring return value */
+
+	/* Given the ETRS89 OSGB coordinates, return the translation values necessary to
+	   produce official OSGB36 coordinates.  Returns zero on normal completion, +1 if
+	   ETRS89 coordinates are out of range, -1 for any other error (i.e. call
+	   CS_errmsg for a textual description of the error). */;
+
+	/* Compute the indices of the grid cells involved. */
+	recNbr = (long32_t)(xy [1] / 2000.0);
+	eleNbr = (long32_t)(xy [0] / 2000.0) - 50;
+
+	/* Return now if out of range. */
+	if (recNbr < 0 || recNbr >= (__This->recordCount - 1) ||
+		eleNbr < 0 || eleNbr >= (__This->elementCount - 1))
+	{
+		*geoidHgt = cs_Zero;
+		return 1;
+	}
+
+	/* Get a pointer to the node at the southwest corner of the cell.  This
+	   may require reading data from the file. */
+	fltPtr = CSnodeOsgm91 (__This,recNbr,eleNbr);
+	if (fltPtr == NULL) goto error;
+
+	/* Extract the grid cell. */
+	chrPtr = (char *)(fltPtr);
 	southWest = *fltPtr;
 	southEast = *(fltPtr + 1);
 	chrPtr += __This->recordSize;
@@ -375,6 +474,24 @@ error:
 	*geoidHgt = cs_Mhuge;
 	return -1;
 }
+/* Batch version of the above.  The status of each point is returned in the
+   status array, if not NULL.  The return value is the most severe of the
+   individual status values, a negative value overriding all others. */
+int CScalcOsgm91N (struct cs_Osgm91_ *__This,double geoidHgt [],int status [],const double etrs89 [][3],int count)
+{
+	int idx;
+	int st;
+	int rtnValue;
+
+	rtnValue = 0;
+	for (idx = 0;idx < count;idx += 1)
+	{
+		st = CScalcOsgm91 (__This,&geoidHgt [idx],etrs89 [idx]);
+		if (status != NULL) status [idx] = st;
+		if (st < 0 || (rtnValue >= 0 && st > rtnValue)) rtnValue = st;
+	}
+	return rtnValue;
+}
 /* This function creates a binary version of the Osgm91 file if it doesn't
    exist, or if the date on the binary file is older than that of the
    text file.  Note, that this function uses the path name in the
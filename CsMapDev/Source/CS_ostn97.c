@@ -65,6 +65,7 @@ struct cs_Ostn97_ *cs_Ostn97Ptr = NULL;
 
 struct cs_Ostn97_ *CSnewOstn97 (const char *filePath /* path to the txt file */)
 {
+	extern int cs_OsGridInMemory;
 	extern char cs_DirsepC;
 	extern char cs_ExtsepC;
 	extern char csErrnam [];
@@ -97,6 +98,7 @@ struct cs_Ostn97_ *CSnewOstn97 (const char *filePath /* path to the txt file */)
 	__This->recordSize = __This->elementCount * __This->elementSize;
 
 	__This->strm = NULL;
+	__This->inMemory = FALSE;
 	__This->dataBuffer = NULL;
 	__This->bufferSize = 4 * __This->recordSize;
 	__This->bufferBeginPosition = -1L;
@@ -116,6 +118,14 @@ struct cs_Ostn97_ *CSnewOstn97 (const char *filePath /* path to the txt file */)
 	st = CSmkBinaryOstn97 (__This);
 	if (st != 0) goto error;
 
+	/* Unless the application has disabled it, load the entire node array
+	   now.  All subsequent access to the grid is then a direct index. */
+	if (cs_OsGridInMemory)
+	{
+		st = CSloadOstn97 (__This);
+		if (st != 0) goto error;
+	}
+
 	/* As this module has been modified to operate with binary files
 	   provided with the distribution, thus opening the possibility of
 	   byte order disparities, it is appropriate that a quick simple
@@ -131,7 +141,7 @@ struct cs_Ostn97_ *CSnewOstn97 (const char *filePath /* path to the txt file */)
 	/* That's that. */
 	return __This;
 error:
-	if (__This != NULL) CS_free (__This);
+	CSdeleteOstn97 (__This);
 	return NULL;
 }
 void CSdeleteOstn97 (struct cs_Ostn97_ *__This)
@@ -165,45 +175,89 @@ void CSreleaseOstn97 (struct cs_Ostn97_ *__This)
 	}
 	return;
 }
-/* Note, the following function is also called by the CSinverseOstn97 function. */
-int CSprivateOstn97 (struct cs_Ostn97_ *__This,double result [2],const double etrs89 [2])
+/* Reads the entire node array of the binary file into memory.  The UK
+   grids are small enough that this is the sensible thing to do; once loaded,
+   node access is simply an index calculation (see CSnodeOstn97) and the
+   file is closed.  Returns zero on success, -1 on error (reported). */
+int CSloadOstn97 (struct cs_Ostn97_ *__This)
+{
+	extern char csErrnam [];
+
+	long32_t readCount;
+	long32_t checkCount;
+
+	/* Start with a clean slate. */
+	CSreleaseOstn97 (__This);
+
+	readCount = __This->recordCount * __This->recordSize;
+	__This->dataBuffer = CS_malc ((size_t)readCount);
+	if (__This->dataBuffer == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		goto error;
+	}
+	__This->strm = CS_fopen (__This->binaryPath,_STRM_BINRD);
+	if (__This->strm == NULL)
+	{
+		CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
+		CS_erpt (cs_DTC_FILE);
+		goto error;
+	}
+	checkCount = (long32_t)CS_fread (__This->dataBuffer,1,(size_t)readCount,__This->strm);
+	if (checkCount != readCount)
+	{
+		CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
+		CS_erpt (cs_INV_FILE);
+		goto error;
+	}
+	if (CS_ferror (__This->strm))
+	{
+		CS_stncp (csErrnam,__This->binaryPath,MAXPATH);
+		CS_erpt (cs_IOERR);
+		goto error;
+	}
+	CS_fclose (__This->strm);
+	__This->strm = NULL;
+
+	/* The buffer now covers the entire file. */
+	__This->inMemory = TRUE;
+	__This->bufferSize = readCount;
+	__This->bufferBeginPosition = 0L;
+	__This->bufferEndPosition = readCount;
+	return 0;
+
+error:
+	CSreleaseOstn97 (__This);
+	return -1;
+}
+/* Returns a pointer to the node at the southwest corner of the cell
+   identified by recNbr and eleNbr, the node at the northwest corner being
+   recordSize bytes further on.  In memory mode, this is a direct index into
+   the node array (which is reloaded if it has been released).  Otherwise,
+   the buffer is refilled from the file as necessary.  Returns NULL on error
+   (reported). */
+float *CSnodeOstn97 (struct cs_Ostn97_ *__This,long32_t recNbr,long32_t eleNbr)
 {
-	extern double cs_Mhuge;
 	extern char csErrnam [];
-	extern double cs_Zero;
 
 	long32_t readCount;
 	long32_t checkCount;
 
 	long32_t lngTmp;
 	long32_t checkSeek;
-	long32_t recNbr, eleNbr;
 	long32_t recFirst, recLast;
 	long32_t fposBegin, fposEnd;
 
 	char *chrPtr;
-	float *fltPtr;
-
-	double tt, uu;
-
-	float southWest [2], southEast [2];
-	float northWest [2], northEast [2];
 
-	/* Given the ETRS89 OSGB coordinates, return the translation values necessary to
-	   produce official OSGB36 coordinates.  Returns zero on normal completion, +1 if
-	   ETRS89 coordinates are out of range, -1 for any other error (i.e. call
-	   CS_errmsg for a textual description of the error). */;
-
-	/* Compute the indices of the grid cells involved. */
-	recNbr = (long32_t)etrs89 [1] / 1000;
-	eleNbr = (long32_t)etrs89 [0] / 1000;
-
-	/* Return now if out of range. */
-	if (recNbr < 0 || recNbr >= __This->recordCount ||
-		eleNbr < 0 || eleNbr >= __This->elementCount)
+	if (__This->inMemory)
 	{
-		result [0] = result [1] = cs_Zero;
-		return 1;
+		if (__This->dataBuffer == NULL)
+		{
+			if (CSloadOstn97 (__This) != 0) return NULL;
+		}
+		chrPtr = (char *)__This->dataBuffer + recNbr * __This->recordSize + eleNbr * __This->elementSize;
+		return (float *)(chrPtr);								 /*lint !e826*/
 	}
 
 	/* Do we have a buffer?  Could have been released.  Maybe this is the
@@ -300,9 +354,53 @@ int CSprivateOstn97 (struct cs_Ostn97_ *__This,double result [2],const double et
 		   using it.  Therefore, byte swapping is not an issue. */
 	}
 
-	/* Extract the grid cell. */
 	chrPtr = (char *)__This->dataBuffer + (fposBegin - __This->bufferBeginPosition);
-	fltPtr = (float *)(chrPtr);									 /*lint !e826*/
+	return (float *)(chrPtr);									 /*lint !e826*/
+
+error:
+	return NULL;
+}
+/* Note, the following function is also called by the CSinverseOstn97 function. */
+int CSprivateOstn97 (struct cs_Ostn97_ *__This,double result [2],const double etrs89 [2])
+{
+	extern double cs_Mhuge;
+	extern char csErrnam [];
+	extern double cs_Zero;
+
+	long32_t recNbr, eleNbr;
+
+	char *chrPtr;
+	float *fltPtr;
+
+	double tt, uu;
+
+	float southWest [2], southEast [2];
+	float northWest [2], northEast [2];
+
+	/* Given the ETRS89 OSGB coordinates, return the translation values necessary to
+	   produce official OSGB36 coordinates.  Returns zero on normal completion, +1 if
+	   ETRS89 coordinates are out of range, -1 for any other error (i.e. call
+	   CS_errmsg for a textual description of the error). */;
+
+	/* Compute the indices of the grid cells involved. */
+	recNbr = (long32_t)etrs89 [1] / 1000;
+	eleNbr = (long32_t)etrs89 [0] / 1000;
+
+	/* Return now if out of range. */
+	if (recNbr < 0 || recNbr >= __This->recordCount ||
+		eleNbr < 0 || eleNbr >= __This->elementCount)
+	{
+		result [0] = result [1] = cs_Zero;
+		return 1;
+	}
+
+	/* Get a pointer to the node at the southwest corner of the cell.  This
+	   may require reading data from the file. */
+	fltPtr = CSnodeOstn97 (__This,recNbr,eleNbr);
+	if (fltPtr == NULL) goto error;
+
+	/* Extract the grid cell. */
+	chrPtr = (char *)(fltPtr);
 	southWest [XX] = *fltPtr;
 	southWest [YY] = *(fltPtr + 1);
 	southEast [XX] = *(fltPtr + 2);
@@ -432,6 +530,40 @@ int CSinverseOstn97 (struct cs_Ostn97_ *__This,double etrs89 [2],const double os
 	}
 	return st;
 }
+/* Batch versions of the above.  The status of each point is returned in
+   the status array, if not NULL.  The return value is the most severe of
+   the individual status values, a negative value overriding all others.
+   The source and target arrays may be the same array. */
+int CSforwardOstn97N (struct cs_Ostn97_ *__This,double osgb36 [][2],const double etrs89 [][2],int status [],int count)
+{
+	int idx;
+	int st;
+	int rtnValue;
+
+	rtnValue = 0;
+	for (idx = 0;idx < count;idx += 1)
+	{
+		st = CSforwardOstn97 (__This,osgb36 [idx],etrs89 [idx]);
+		if (status != NULL) status [idx] = st;
+		if (st < 0 || (rtnValue >= 0 && st > rtnValue)) rtnValue = st;
+	}
+	return rtnValue;
+}
+int CSinverseOstn97N (struct cs_Ostn97_ *__This,double etrs89 [][2],const double osgb36 [][2],int status [],int count)
+{
+	int idx;
+	int st;
+	int rtnValue;
+
+	rtnValue = 0;
+	for (idx = 0;idx < count;idx += 1)
+	{
+		st = CSinverseOstn97 (__This,etrs89 [idx],osgb36 [idx]);
+		if (status != NULL) status [idx] = st;
+		if (st < 0 || (rtnValue >= 0 && st > rtnValue)) rtnValue = st;
+	}
+	return rtnValue;
+}
 /* This function creates a binary version of the Ostn97 file if it doesn't
    exist, or if the dat on the binary file is older than that of the
    text file.  Note, that this function uses the path name in the
@@ -29,6 +29,7 @@
 
 #include "cs_map.h"
 //#include <ctype.h>
+#include <wctype.h>
 
 #if ( _OPR_SYSTEM == _os_UNIX )
 # define _cdecl
@@ -1448,6 +1449,46 @@ Const char* EXP_LVL3 CS_stristr (Const char *str1,Const char *str2)
 	}
 	return status ? NULL : str1;
 }
+
+/* Hash of one, or optionally two, strings which is consistent with CS_stricmp;
+   that is, strings which CS_stricmp considers equal produce the same hash.
+   Used by the various in memory dictionary indices. */
+unsigned EXP_LVL7 CS_strihash (Const char *str1,Const char *str2)
+{
+	char cc;
+	unsigned hash;
+
+	hash = 2166136261U;
+	while ((cc = *str1++) != '\0')
+	{
+		if (CS_isupper (cc)) cc = (char)CS_tolower (cc);
+		hash = (hash ^ (unsigned char)cc) * 16777619U;
+	}
+	if (str2 != NULL)
+	{
+		hash = (hash ^ 0xFFU) * 16777619U;
+		while ((cc = *str2++) != '\0')
+		{
+			if (CS_isupper (cc)) cc = (char)CS_tolower (cc);
+			hash = (hash ^ (unsigned char)cc) * 16777619U;
+		}
+	}
+	return hash;
+}
+/* Wide character equivalent of the above, consistent with CS_wcsicmp. */
+unsigned EXP_LVL7 CS_wcsihash (Const wchar_t *str)
+{
+	wint_t wc;
+	unsigned hash;
+
+	hash = 2166136261U;
+	while ((wc = (wint_t)*str++) != L'\0')
+	{
+		if (iswupper (wc)) wc = (wint_t)towlower (wc);
+		hash = (hash ^ (unsigned)wc) * 16777619U;
+	}
+	return hash;
+}
 long32_t EXP_LVL5 CS_degToSec (double degrees)
 {
 	extern double cs_Deg2Sec;
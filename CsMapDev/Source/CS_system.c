@@ -123,6 +123,13 @@ csFILE *CS_fopen(const char *filename, const char *mode)
 	csFILE *result = NULL;
 	char *fixed_filename = (char*) filename;
 
+	/* Files in an open dictionary bundle are served from the bundle, and
+	   are never written. */
+	if (CSbundleHas (filename))
+	{
+		return CSbundleFopen (filename,mode);
+	}
+
 	/* If we are attempting to read from the file, and the file passed
 	 * in does not exist, look for a different file in the same directory
 	 * that has the same filename with a different case.
@@ -204,6 +211,23 @@ csFILE *CS_fopen(const char *filename, const char *mode)
 	}
 	return result;
 }
+#else
+csFILE *CS_fopen(const char *filename, const char *mode)
+{
+	csFILE *result;
+
+	/* Files in an open dictionary bundle are served from the bundle, and
+	   are never written. */
+	if (CSbundleHas (filename))
+	{
+		result = CSbundleFopen (filename,mode);
+	}
+	else
+	{
+		result = (csFILE*) fopen(filename,mode);
+	}
+	return result;
+}
 #endif
 
 #if _RUN_TIME == _rt_MOSXUNIX
@@ -48,6 +48,105 @@
 **********************************************************************/
 extern double (*CS_usrUnitPtr) (short type,Const char *unitName);
 
+/**********************************************************************
+ Unit name index.
+
+ An open addressed hash table of cs_Unittab indices, keyed by unit type
+ and name.  The first half of csUnitSlots indexes the full names, the
+ second half indexes the abbreviations.  Each slot holds the table index
+ plus one, zero marking an empty slot.  Only the first entry in table
+ order having a given key is indexed, thus the index produces exactly
+ what the linear searches it replaces produced.  The index is built upon
+ first use, and is released whenever CS_unitAdd or CS_unitDel modifies
+ the table.
+**********************************************************************/
+static int *csUnitSlots = NULL;
+static unsigned csUnitMask = 0U;
+
+void EXP_LVL7 CS_rlsUnitIndex (void)
+{
+	CS_free (csUnitSlots);
+	csUnitSlots = NULL;
+	csUnitMask = 0U;
+}
+
+static unsigned CSunitHash (short type,Const char *name)
+{
+	return (CS_strihash (name,NULL) ^ ((unsigned)type * 0x9E3779B1U)) & csUnitMask;
+}
+
+/* Returns the cs_Unittab index of the unit of the given type having the
+   given name (abrvFlg == 0) or abbreviation (abrvFlg != 0), else -1. */
+static int CSunitFind (short type,Const char *name,int abrvFlg)
+{
+	extern struct cs_Unittab_ cs_Unittab [];
+
+	int *slots;
+	unsigned slot;
+	struct cs_Unittab_ *tp;
+
+	slots = csUnitSlots + (abrvFlg ? (csUnitMask + 1) : 0);
+	for (slot = CSunitHash (type,name);slots [slot] != 0;slot = (slot + 1) & csUnitMask)
+	{
+		tp = &cs_Unittab [slots [slot] - 1];
+		if (tp->type == type && !CS_stricmp (name,abrvFlg ? tp->abrv : tp->name))
+		{
+			return slots [slot] - 1;
+		}
+	}
+	return -1;
+}
+
+static void CSunitIndexAdd (int tblIdx,int abrvFlg)
+{
+	extern struct cs_Unittab_ cs_Unittab [];
+
+	int *slots;
+	unsigned slot;
+	Const char *name;
+
+	name = abrvFlg ? cs_Unittab [tblIdx].abrv : cs_Unittab [tblIdx].name;
+	if (*name == '\0' || CSunitFind (cs_Unittab [tblIdx].type,name,abrvFlg) >= 0)
+	{
+		return;
+	}
+	slots = csUnitSlots + (abrvFlg ? (csUnitMask + 1) : 0);
+	for (slot = CSunitHash (cs_Unittab [tblIdx].type,name);slots [slot] != 0;slot = (slot + 1) & csUnitMask);
+	slots [slot] = tblIdx + 1;
+}
+
+static int CSunitIndexSetup (void)
+{
+	extern struct cs_Unittab_ cs_Unittab [];
+
+	int tblIdx;
+	unsigned slotCount;
+
+	if (csUnitSlots != NULL)
+	{
+		return 0;
+	}
+
+	/* Size the table so that it is never more than half full. */
+	for (tblIdx = 0;cs_Unittab [tblIdx].type != cs_UTYP_END;tblIdx += 1);
+	for (slotCount = 64U;slotCount < (unsigned)tblIdx * 2U;slotCount *= 2U);
+	csUnitSlots = (int *)CS_malc (slotCount * 2U * sizeof (int));
+	if (csUnitSlots == NULL)
+	{
+		return -1;
+	}
+	memset (csUnitSlots,0,slotCount * 2U * sizeof (int));
+	csUnitMask = slotCount - 1U;
+
+	for (tblIdx = 0;cs_Unittab [tblIdx].type != cs_UTYP_END;tblIdx += 1)
+	{
+		if (cs_Unittab [tblIdx].type == cs_UTYP_OFF) continue;
+		CSunitIndexAdd (tblIdx,0);
+		CSunitIndexAdd (tblIdx,1);
+	}
+	return 0;
+}
+
 /**********************************************************************
 **	value = CS_unitlu (type,name);
 **
@@ -89,6 +188,7 @@ double EXP_LVL1 CS_unitlu (short type,Const char *name)
 
 	Const char *ccp;
 	char *cp;
+	int tblIdx;
 	double usrValue;
 
 	char my_name [cs_KEYNM_DEF];
@@ -128,6 +228,17 @@ double EXP_LVL1 CS_unitlu (short type,Const char *name)
 		CS_stcpy (my_name,&my_name [1]);
 	}
 
+	/* Use the index if we have, or can build, one.  Should memory be
+	   short, the linear searches below produce the same result. */
+
+	if (CSunitIndexSetup () == 0)
+	{
+		tblIdx = CSunitFind (type,my_name,0);
+		if (tblIdx < 0) tblIdx = CSunitFind (type,my_name,1);
+		if (tblIdx < 0) goto error;
+		return (cs_Unittab [tblIdx].factor);
+	}
+
 	/* Look for a match in the type and complete name portion
 	   of the table. */
 
@@ -212,6 +323,7 @@ int EXP_LVL3 CS_unitAdd (struct cs_Unittab_ *unitPtr)
 				CS_stncp (tabPtr->abrv,unitPtr->abrv,sizeof (tabPtr->abrv));
 				tabPtr->system = unitPtr->system;
 				tabPtr->factor = unitPtr->factor;
+				CS_rlsUnitIndex ();
 			}
 		}
 	}
@@ -245,6 +357,7 @@ int EXP_LVL3 CS_unitDel (short type,Const char *name)
 	{
 		/* Mark it as available.  This, essentially, also deletes it. */
 		tabPtr->type = cs_UTYP_OFF;
+		CS_rlsUnitIndex ();
 	}
 	return status;
 }
@@ -63,7 +63,6 @@ extern "C" char csErrnam [MAXPATH];
 
 extern "C" struct cs_Prjprm_ csPrjprm [];
 extern "C" struct cs_Prjtab_ cs_Prjtab [];
-extern "C" struct cs_PrjprmMap_ cs_PrjprmMap [];
 
 extern TrcWktEleTypeMap KrcWktEleTypeMap [];
 extern TrcWktAxisValueMap KrcWktAxisValueMap [];
@@ -78,6 +77,7 @@ extern "C" const struct csKeyNmRed_ csCsReduce [];
 extern "C" csFILE* csDiagnostic;
 
 int CS_wktToCsEx (struct cs_Csdef_ *csDef,struct cs_Dtdef_ *dtDef,struct cs_Eldef_ *elDef,ErcWktFlavor flavor,const char *wellKnownText);
+static int CSwktToCsEx (struct cs_Csdef_ *csDef,struct cs_Dtdef_ *dtDef,struct cs_Eldef_ *elDef,ErcWktFlavor flavor,const char *wellKnownText, int bRunBinaryFallback);
 int CSwellKnownTextKrovak (struct cs_Csdef_* cs_def,struct cs_Eldef_ *el_def,const TrcWktElement* wktElement,
 																			 double primeMeridian,
 																			 double geogcsUnitsFactor,
@@ -335,6 +335,285 @@ int CS_isWkt (const char *wellKnownText)
 	return rtnValue;
 }
 //newPage//
+///////////////////////////////////////////////////////////////////////////////
+// Resolution cache for CS_wktToCsEx.
+//
+// Applications tend to present the same few WKT strings over and over again,
+// and resolving one involves parsing, flavor detection, name mapping, and
+// possibly a search of the entire coordinate system dictionary.  The results
+// of successful resolutions are retained, keyed by a normalized rendition of
+// the WKT string, the flavor, and the binary fallback argument.  The
+// normalization removes insignificant white space and replaces each unquoted
+// number with a canonical rendition of its value, so WKT strings which differ
+// only in formatting share a single entry.  Quoted strings are not altered.
+//
+// At most cs_WktCacheSize entries are retained, the least recently used entry
+// being replaced when the cache is full.  The cache is cleared whenever the
+// dictionary directories change, or a coordinate system, datum, or ellipsoid
+// dictionary file has been modified, and by CS_rlsWktCache and CS_recvr.
+extern "C" int cs_WktCacheSize;
+
+struct TcsWktCacheEntry
+{
+	std::string Text;
+	unsigned long Hash;
+	int Flavor;
+	int Fallback;
+	unsigned long LastUse;
+	struct cs_Csdef_ CsDef;
+	struct cs_Dtdef_ DtDef;
+	struct cs_Eldef_ ElDef;
+};
+class TcsWktCache
+{
+public:
+	static void Normalize (std::string& result,const char* wellKnownText);
+	TcsWktCache (void);
+	const TcsWktCacheEntry* Locate (const std::string& text,int flavor,int fallback);
+	void Insert (const std::string& text,int flavor,int fallback,const struct cs_Csdef_* csDef,
+																  const struct cs_Dtdef_* dtDef,
+																  const struct cs_Eldef_* elDef);
+	void Release (void);
+private:
+	typedef std::multimap<unsigned long,size_t> TcsWktCacheIndex;
+	static bool IsDelimiter (char ch);
+	static unsigned long Hash (const std::string& text,int flavor,int fallback);
+	static void GetStamp (std::string& stamp);
+	std::vector<TcsWktCacheEntry> Entries;
+	TcsWktCacheIndex Index;
+	unsigned long UseCount;
+	std::string Stamp;
+};
+// Produces the normalized form of a WKT string.  Runs of white space are
+// dropped next to a bracket, parenthesis, or comma, and otherwise reduced to
+// a single space.  An unquoted token which is entirely a number is replaced
+// by the value of the number as formatted by "%.17g"; the parser sees the
+// same value either way.
+void TcsWktCache::Normalize (std::string& result,const char* wellKnownText)
+{
+	bool inQuote (false);
+	bool gotSpace (false);
+	bool tokenStart (true);
+	char ch;
+	char *endPtr;
+	const char *cp;
+	double number;
+	char numBufr [64];
+
+	result.clear ();
+	result.reserve (strlen (wellKnownText));
+	for (cp = wellKnownText;(ch = *cp) != '\0';cp++)
+	{
+		if (inQuote)
+		{
+			// A doubled quote within a quoted string toggles twice, and
+			// thus requires no special handling.
+			result += ch;
+			inQuote = (ch != '"');
+			continue;
+		}
+		if (isspace ((unsigned char)ch))
+		{
+			gotSpace = true;
+			continue;
+		}
+		if (gotSpace)
+		{
+			if (!result.empty () && !IsDelimiter (result [result.size () - 1]) && !IsDelimiter (ch))
+			{
+				result += ' ';
+			}
+			gotSpace = false;
+			tokenStart = true;
+		}
+		if (tokenStart && (isdigit ((unsigned char)ch) || ch == '-' || ch == '+' || ch == '.'))
+		{
+			number = strtod (cp,&endPtr);
+			if (endPtr != cp && (*endPtr == '\0' || isspace ((unsigned char)*endPtr) || IsDelimiter (*endPtr)))
+			{
+				sprintf (numBufr,"%.17g",number);
+				result += numBufr;
+				cp = endPtr - 1;
+				tokenStart = false;
+				continue;
+			}
+		}
+		result += ch;
+		inQuote = (ch == '"');
+		tokenStart = IsDelimiter (ch);
+	}
+}
+TcsWktCache::TcsWktCache (void) : Entries  (),
+								  Index    (),
+								  UseCount (0UL),
+								  Stamp    ()
+{
+}
+const TcsWktCacheEntry* TcsWktCache::Locate (const std::string& text,int flavor,int fallback)
+{
+	unsigned long hash;
+	std::string stamp;
+	std::pair<TcsWktCacheIndex::iterator,TcsWktCacheIndex::iterator> range;
+	TcsWktCacheIndex::iterator itr;
+
+	// Verify that the dictionaries are those from which the cached
+	// results were obtained.
+	GetStamp (stamp);
+	if (stamp != Stamp)
+	{
+		Release ();
+		Stamp.swap (stamp);
+	}
+
+	hash = Hash (text,flavor,fallback);
+	range = Index.equal_range (hash);
+	for (itr = range.first;itr != range.second;itr++)
+	{
+		TcsWktCacheEntry& entry = Entries [itr->second];
+		if (entry.Flavor == flavor && entry.Fallback == fallback && entry.Text == text)
+		{
+			entry.LastUse = ++UseCount;
+			return &entry;
+		}
+	}
+	return 0;
+}
+void TcsWktCache::Insert (const std::string& text,int flavor,int fallback,const struct cs_Csdef_* csDef,
+																		  const struct cs_Dtdef_* dtDef,
+																		  const struct cs_Eldef_* elDef)
+{
+	size_t slot;
+	size_t idx;
+	std::pair<TcsWktCacheIndex::iterator,TcsWktCacheIndex::iterator> range;
+	TcsWktCacheIndex::iterator itr;
+
+	if (Entries.size () < static_cast<size_t>(cs_WktCacheSize))
+	{
+		slot = Entries.size ();
+		Entries.resize (slot + 1);
+	}
+	else
+	{
+		// Replace the least recently used entry.
+		slot = 0;
+		for (idx = 1;idx < Entries.size ();idx += 1)
+		{
+			if (Entries [idx].LastUse < Entries [slot].LastUse)
+			{
+				slot = idx;
+			}
+		}
+		range = Index.equal_range (Entries [slot].Hash);
+		for (itr = range.first;itr != range.second;itr++)
+		{
+			if (itr->second == slot)
+			{
+				Index.erase (itr);
+				break;
+			}
+		}
+	}
+	TcsWktCacheEntry& entry = Entries [slot];
+	entry.Text = text;
+	entry.Hash = Hash (text,flavor,fallback);
+	entry.Flavor = flavor;
+	entry.Fallback = fallback;
+	entry.LastUse = ++UseCount;
+	memcpy (&entry.CsDef,csDef,sizeof (entry.CsDef));
+	memcpy (&entry.DtDef,dtDef,sizeof (entry.DtDef));
+	memcpy (&entry.ElDef,elDef,sizeof (entry.ElDef));
+	Index.insert (std::make_pair (entry.Hash,slot));
+}
+void TcsWktCache::Release (void)
+{
+	std::vector<TcsWktCacheEntry>().swap (Entries);
+	Index.clear ();
+	UseCount = 0UL;
+	Stamp.clear ();
+}
+bool TcsWktCache::IsDelimiter (char ch)
+{
+	return (ch == '[' || ch == ']' || ch == '(' || ch == ')' || ch == ',');
+}
+unsigned long TcsWktCache::Hash (const std::string& text,int flavor,int fallback)
+{
+	ulong32_t hash;
+
+	hash  = static_cast<ulong32_t>(CS_strihash (text.c_str (),0));
+	hash ^= (static_cast<ulong32_t>(flavor) << 8) ^ static_cast<ulong32_t>(fallback != 0);
+	return static_cast<unsigned long>(hash * 0x9E3779B1UL);
+}
+// The stamp identifies the dictionaries in use: the system and user
+// directories, and the modification times and sizes of the coordinate system,
+// datum, and ellipsoid dictionaries in each.
+void TcsWktCache::GetStamp (std::string& stamp)
+{
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern char cs_UserDir [];
+	extern char cs_Csname [];
+	extern char cs_Dtname [];
+	extern char cs_Elname [];
+
+	int idx;
+	const char* dictName;
+	char dictPath [MAXPATH];
+	char timeBufr [48];
+
+	stamp.clear ();
+	if (cs_DirP != 0)
+	{
+		stamp.assign (cs_Dir,static_cast<size_t>(cs_DirP - cs_Dir));
+	}
+	stamp += '|';
+	stamp += cs_UserDir;
+	for (idx = 0;idx < 6;idx += 1)
+	{
+		dictName = (idx % 3 == 0) ? cs_Csname : ((idx % 3 == 1) ? cs_Dtname : cs_Elname);
+		dictPath [0] = '\0';
+		if (idx < 3)
+		{
+			if (cs_UserDir [0] != '\0')
+			{
+				CS_stncp (dictPath,cs_UserDir,sizeof (dictPath));
+				CS_stncat (dictPath,dictName,sizeof (dictPath));
+			}
+		}
+		else if (cs_DirP != 0)
+		{
+			CS_stcpy (cs_DirP,dictName);
+			CS_stncp (dictPath,cs_Dir,sizeof (dictPath));
+		}
+		if (dictPath [0] != '\0')
+		{
+			sprintf (timeBufr,"|%ld:%lu",static_cast<long>(CS_fileModTime (dictPath)),
+										 static_cast<unsigned long>(CS_fileSize (dictPath)));
+		}
+		else
+		{
+			CS_stcpy (timeBufr,"|0:0");
+		}
+		stamp += timeBufr;
+	}
+}
+// The cache is a function static so that it is constructed upon first use,
+// regardless of the order in which static objects are constructed.
+static TcsWktCache& CSwktCache (void)
+{
+	static TcsWktCache wktCache;
+	return wktCache;
+}
+/**********************************************************************
+**	CS_rlsWktCache ();
+**
+**	Releases all results retained by the CS_wktToCsEx resolution
+**	cache.
+**********************************************************************/
+void EXP_LVL7 CS_rlsWktCache (void)
+{
+	CSwktCache ().Release ();
+}
+//newPage//
 // This following is an extended version of the original CS_wktToCs function.
 // It is specifically designed to work well with the CS_wktCsDefFunc function.
 // Returns zero on success, -1 on hard failure.  Cause of hard failure will
@@ -359,7 +638,41 @@ int CS_isWkt (const char *wellKnownText)
 // more meaningful error message indicating where the WKT string departs
 // from the flavor specified.
 //
+// Successful results are retained in the resolution cache above, and a WKT
+// string found there is not processed again.  The cache is bypassed while
+// csDiagnostic is active, as the diagnostic output is produced only when a
+// string is processed.
+//
 int CS_wktToCsEx (struct cs_Csdef_ *csDef,struct cs_Dtdef_ *dtDef,struct cs_Eldef_ *elDef,ErcWktFlavor flavor,const char *wellKnownText, int bRunBinaryFallback)
+{
+	int st;
+	int fallback;
+	std::string wktKey;
+	const TcsWktCacheEntry* entryPtr;
+
+	if (cs_WktCacheSize <= 0 || csDiagnostic != 0 || csDef == NULL || dtDef == NULL || elDef == NULL || wellKnownText == NULL)
+	{
+		return CSwktToCsEx (csDef,dtDef,elDef,flavor,wellKnownText,bRunBinaryFallback);
+	}
+
+	fallback = (bRunBinaryFallback != 0);
+	TcsWktCache::Normalize (wktKey,wellKnownText);
+	entryPtr = CSwktCache ().Locate (wktKey,flavor,fallback);
+	if (entryPtr != 0)
+	{
+		memcpy (csDef,&entryPtr->CsDef,sizeof (*csDef));
+		memcpy (dtDef,&entryPtr->DtDef,sizeof (*dtDef));
+		memcpy (elDef,&entryPtr->ElDef,sizeof (*elDef));
+		return 0;
+	}
+	st = CSwktToCsEx (csDef,dtDef,elDef,flavor,wellKnownText,bRunBinaryFallback);
+	if (st == 0)
+	{
+		CSwktCache ().Insert (wktKey,flavor,fallback,csDef,dtDef,elDef);
+	}
+	return st;
+}
+static int CSwktToCsEx (struct cs_Csdef_ *csDef,struct cs_Dtdef_ *dtDef,struct cs_Eldef_ *elDef,ErcWktFlavor flavor,const char *wellKnownText, int bRunBinaryFallback)
 {
 	bool mapNames = true;			// until we know different, we will map WKT names to
 									// CS-MAP names wherever possible.
@@ -1763,10 +2076,7 @@ int CSwktToCs (struct cs_Csdef_ *csDef,struct cs_Dtdef_ *dtDef,struct cs_Eldef_
 		CS_stncp (csDef->prj_knm,pp->key_nm,sizeof (csDef->prj_knm));
 		projFlags = pp->flags;
 
-		for (mp = cs_PrjprmMap;mp->prj_code != cs_PRJCOD_END;mp += 1)
-		{
-			if (mp->prj_code == projCode) break;
-		}
+		mp = CS_prjprmMapPtr (projCode);
 		if (mp->prj_code == cs_PRJCOD_END)
 		{
 			CS_stncp (csErrnam,"CS_wellKnownText.cpp:1",MAXPATH);
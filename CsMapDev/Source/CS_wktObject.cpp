@@ -239,6 +239,280 @@ ErcWktAxisValue rcWktNameToAxisValue (const char *name)
 	return tblPtr->Value;
 }
 //newPage//
+///////////////////////////////////////////////////////////////////////////////
+// TrcWktTokens  --  The element structure of a WKT string, as determined by a
+// single pass over the text.
+//
+// Each element is recorded as a token which carries the offsets of the
+// element, and of its value, within the text; nothing is copied.  Tokens are
+// linked to their first child and next sibling by index, and all tokens are
+// allocated from a single vector.  Elements are recognized exactly as
+// TrcWktElement::ParseWellKnownText recognizes them, except that keywords
+// within quoted strings are ignored.
+//
+// The value of an element, as TrcWktElement has always seen it, is the text
+// between its brackets less its sub-elements, the commas which separated
+// them, and any new line characters outside of quoted strings.  ExtractValue
+// produces this string with a single copy of the relevant text.
+struct TrcWktToken
+{
+	ErcWktEleType Type;
+	size_t EleStrt;				// offset of the first character of the keyword
+	size_t ValueStrt;			// offset of the first character of the value
+	size_t ValueTerm;			// offset of the terminating bracket, or the
+								// length of the text if unterminated
+	size_t FirstChild;
+	size_t NextSibling;
+};
+class TrcWktTokens
+{
+public:
+	static const size_t NoToken;
+	TrcWktTokens (const std::string& text);
+	size_t FirstElement (void) const {return First; };
+	const TrcWktToken& operator[] (size_t index) const {return Tokens [index]; };
+	size_t SiblingCount (size_t index) const;
+	void ExtractValue (std::string& value,size_t index) const;
+private:
+	struct TrcWktLevel
+	{
+		size_t Token;
+		size_t LastChild;
+		char StrtChar;
+		char TermChar;
+		int NestLevel;
+	};
+	void Tokenize (void);
+	const std::string& Text;
+	std::vector<TrcWktToken> Tokens;
+	size_t First;
+};
+const size_t TrcWktTokens::NoToken = static_cast<size_t>(-1);
+TrcWktTokens::TrcWktTokens (const std::string& text) : Text   (text),
+													   Tokens (),
+													   First  (NoToken)
+{
+	Tokenize ();
+}
+size_t TrcWktTokens::SiblingCount (size_t index) const
+{
+	size_t count = 0;
+
+	for (;index != NoToken;index = Tokens [index].NextSibling)
+	{
+		count += 1;
+	}
+	return count;
+}
+void TrcWktTokens::Tokenize (void)
+{
+	bool inQuote = false;
+	char curChar;
+	size_t pos;
+	size_t length;
+	size_t keyWordIdx = 0;
+	size_t keyWordStrt = 0;
+	ErcWktEleType elementType;
+	TrcWktToken newToken;
+	TrcWktLevel newLevel;
+	std::vector<TrcWktLevel> levels;
+	char keyWord [64];
+
+	enum  {	wktScan,
+			wktKeyword,
+			wktBracket
+		  } state;
+
+	// The text of this level is not enclosed in brackets.
+	newLevel.Token = NoToken;
+	newLevel.LastChild = NoToken;
+	newLevel.StrtChar = '\0';
+	newLevel.TermChar = '\0';
+	newLevel.NestLevel = 0;
+	levels.push_back (newLevel);
+
+	state = wktScan;
+	length = Text.length ();
+	Tokens.reserve (length / 16 + 4);
+	for (pos = 0;pos < length;pos += 1)
+	{
+		curChar = Text [pos];
+		TrcWktLevel& level = levels.back ();
+
+		// New line characters are not part of the value of a sub-element.
+		if (curChar == '\n' && !inQuote && levels.size () > 1)
+		{
+			continue;
+		}
+		if (inQuote)
+		{
+			if (curChar == '\"' && (pos + 1) < length && Text [pos + 1] == '\"')
+			{
+				// Escaped quote, maintain state.
+				pos += 1;
+			}
+			else if (curChar == '\"')
+			{
+				inQuote = false;
+			}
+			continue;
+		}
+		if (curChar == '\"')
+		{
+			inQuote = true;
+			state = wktScan;
+			continue;
+		}
+		if (curChar == level.TermChar && level.NestLevel == 1)
+		{
+			// The end of the current element.
+			Tokens [level.Token].ValueTerm = pos;
+			levels.pop_back ();
+			state = wktScan;
+			continue;
+		}
+
+		elementType = rcWktUnknown;
+		switch (state) {
+		case wktScan:
+			if (isupper (curChar))
+			{
+				keyWordIdx = 0;
+				keyWord [keyWordIdx++] = curChar;
+				keyWordStrt = pos;
+				state = wktKeyword;
+			}
+			break;
+
+		case wktKeyword:
+		case wktBracket:
+			if (state == wktKeyword &&
+				(isupper (curChar) || (curChar == '_') || ((keyWordIdx > 0) && isdigit (curChar))))
+			{
+				if (keyWordIdx < 60)
+				{
+					keyWord [keyWordIdx++] = curChar;
+				}
+			}
+			else if (curChar == '(' || curChar == '[')
+			{
+				keyWord [keyWordIdx] = '\0';
+				elementType = rcWktNameToType (keyWord);
+				state = wktScan;
+			}
+			else if (isspace (curChar))
+			{
+				state = wktBracket;
+			}
+			else
+			{
+				state = wktScan;
+			}
+			break;
+		}
+
+		if (elementType != rcWktUnknown)
+		{
+			// The beginning of a sub-element of the current element.
+			newToken.Type = elementType;
+			newToken.EleStrt = keyWordStrt;
+			newToken.ValueStrt = pos + 1;
+			newToken.ValueTerm = length;
+			newToken.FirstChild = NoToken;
+			newToken.NextSibling = NoToken;
+			Tokens.push_back (newToken);
+			if (level.LastChild != NoToken)
+			{
+				Tokens [level.LastChild].NextSibling = Tokens.size () - 1;
+			}
+			else if (level.Token != NoToken)
+			{
+				Tokens [level.Token].FirstChild = Tokens.size () - 1;
+			}
+			else
+			{
+				First = Tokens.size () - 1;
+			}
+			level.LastChild = Tokens.size () - 1;
+
+			newLevel.Token = Tokens.size () - 1;
+			newLevel.LastChild = NoToken;
+			newLevel.StrtChar = curChar;
+			newLevel.TermChar = (curChar == '(') ? ')' : ']';
+			newLevel.NestLevel = 1;
+			levels.push_back (newLevel);		// level is no longer valid
+		}
+		else if (curChar == level.StrtChar)
+		{
+			level.NestLevel += 1;
+		}
+		else if (curChar == level.TermChar)
+		{
+			level.NestLevel -= 1;
+		}
+	}
+}
+// Produces the value of the indicated element; the value of the text as a
+// whole if index is NoToken.  A sub-element is removed along with any white
+// space which precedes it and the comma which follows it; or, if no comma
+// follows it, the comma which precedes it.
+void TrcWktTokens::ExtractValue (std::string& value,size_t index) const
+{
+	bool inQuote = false;
+	bool topLevel;
+	char curChar;
+	size_t pos;
+	size_t strt;
+	size_t term;
+	size_t child;
+
+	topLevel = (index == NoToken);
+	strt = topLevel ? 0 : Tokens [index].ValueStrt;
+	term = topLevel ? Text.length () : Tokens [index].ValueTerm;
+	child = topLevel ? First : Tokens [index].FirstChild;
+
+	value.erase ();
+	value.reserve (term - strt);
+	for (pos = strt;pos < term;pos += 1)
+	{
+		while (child != NoToken && pos == Tokens [child].EleStrt)
+		{
+			while (!value.empty () && isspace (value [value.length () - 1]))
+			{
+				value.erase (value.length () - 1);
+			}
+			pos = Tokens [child].ValueTerm + 1;
+			while (pos < term && isspace (Text [pos]))
+			{
+				pos += 1;
+			}
+			if (pos < term && Text [pos] == ',')
+			{
+				pos += 1;
+			}
+			else if (!value.empty () && value [value.length () - 1] == ',')
+			{
+				value.erase (value.length () - 1);
+			}
+			child = Tokens [child].NextSibling;
+		}
+		if (pos >= term)
+		{
+			break;
+		}
+		curChar = Text [pos];
+		if (curChar == '\"')
+		{
+			inQuote = !inQuote;
+		}
+		else if (curChar == '\n' && !inQuote && !topLevel)
+		{
+			continue;
+		}
+		value += curChar;
+	}
+}
+//newPage//
 class TrcWktElements;
 ///////////////////////////////////////////////////////////////////////////////
 // The TrcWktElement Object
@@ -485,32 +759,29 @@ void TrcWktElement::RemoveChild (const TrcWktElement* toBeRemoved)
 {
 	Children.RemoveChild (toBeRemoved);
 }
+// Parses the sub-elements of this element out of its value, and all of their
+// sub-elements, in a single pass.  The value of this element, and of each
+// sub-element, is left with the sub-elements removed.
 void TrcWktElement::ParseChildren (void)
 {
-	// Extract each sub-element from the value of this element.
-	for (;;)
+	size_t idx;
+	size_t oldCount;
+
+	oldCount = Children.GetCount ();
+	TrcWktTokens tokens (Value);
+	if (tokens.FirstElement () != TrcWktTokens::NoToken)
 	{
-		size_t eleStrt;
-		size_t eleTerm;
-		ErcWktEleType elementType;
 		std::string value;
-		const char *wellKnownText = Value.c_str ();
-		elementType = ParseWellKnownText (value,eleStrt,eleTerm,wellKnownText);
-
-		// We get an unknown back if there were no more sub-elements.
-		if (elementType == rcWktUnknown)
-		{
-			break;
-		}
-	
-		// Add the element we just extracted to out Children list.
-		TrcWktElement newChild (elementType,value);
-		AddChild (newChild);
-		RemoveElementFromString (Value,eleStrt,eleTerm);
+		tokens.ExtractValue (value,TrcWktTokens::NoToken);
+		AddTokenChildren (tokens,tokens.FirstElement ());
+		Value.swap (value);
 	}
 
-	// Now we need to parse the grandchildren.
-	Children.ParseGrandChildren ();
+	// Children which were added by other means may yet need to be parsed.
+	for (idx = 0;idx < oldCount;idx += 1)
+	{
+		Children.GetChild (idx).ParseChildren ();
+	}
 }
 void TrcWktElement::ReconstructValue (void)		// from possibly modified children
 {
@@ -673,6 +944,34 @@ std::string TrcWktElement::ExtractField (size_t fieldNbr,bool trimQuotes) const
 	}
 	return tmpStr;
 }
+// Adds the sibling elements beginning with the indicated token as children of
+// this element, and their children in turn.  The children are constructed in
+// place, the vector being reserved beforehand, so that no element is ever
+// copied and the parent pointers of the grandchildren remain valid.
+void TrcWktElement::AddTokenChildren (const TrcWktTokens& tokens,size_t index)
+{
+	size_t token;
+	size_t childIdx;
+
+	childIdx = Children.GetCount ();
+	Children.Reserve (childIdx + tokens.SiblingCount (index));
+	for (token = index;token != TrcWktTokens::NoToken;token = tokens [token].NextSibling)
+	{
+		TrcWktElement& child = Children.AppendChild (this,ElementType);
+		child.ElementType = tokens [token].Type;
+		tokens.ExtractValue (child.Value,token);
+		TrimWhiteSpace (child.Value);
+		child.CommonConstruct ();
+	}
+	for (token = index;token != TrcWktTokens::NoToken;token = tokens [token].NextSibling)
+	{
+		if (tokens [token].FirstChild != TrcWktTokens::NoToken)
+		{
+			Children.GetChild (childIdx).AddTokenChildren (tokens,tokens [token].FirstChild);
+		}
+		childIdx += 1;
+	}
+}
 void TrcWktElement::DeleteField (size_t fieldNbr)
 {
 	bool inQuote;
@@ -966,34 +1265,6 @@ ErcWktEleType TrcWktElement::ParseWellKnownText (std::string& value,size_t& eleS
 	}
 	return elementType;
 }
-// eleStrt and eleTerm are the index values for the first and last characters
-// to be removed.  We may remove some extra commas and whitespace as indicated
-// by the surrounding data.
-void TrcWktElement::RemoveElementFromString (std::string& value,size_t eleStrt,size_t eleTerm)
-{
-	size_t begIdx = eleStrt;
-	size_t endIdx = eleTerm;
-
-	// Move begIdx back over any leading whitespace in the stuff we are to remove.
-	while (begIdx > 0 && isspace (value [begIdx - 1])) begIdx -= 1;
-
-	// If the thing we are removing is followed by a comma, we always remove that.
-	if ((endIdx+1) < value.length() && value [endIdx + 1] == ',')
-	{
-		endIdx += 1;
-	}
-	else
-	{
-		// Here if the thing we are removing is not followed by a comma.
-		// Remove any comma which might precede the thing we are removing.
-		if (begIdx > 0 && value [begIdx - 1] == ',')
-		{
-			begIdx -= 1;
-			while (begIdx > 0 && isspace (value [begIdx])) begIdx -= 1;
-		}
-	}
-	value.erase (begIdx,(endIdx - begIdx + 1));
-}
 // This function will only look at the children of this element.  Returns the
 // first child so located.
 const TrcWktElement *TrcWktElement::ChildLocate (ErcWktEleType type) const
@@ -1477,6 +1748,25 @@ TrcWktElements& TrcWktElements::AddChild (const TrcWktElement& newChild,
 	newChldRef.SetParentType (parentType);
 	return *this;
 }
+void TrcWktElements::Reserve (size_t count)
+{
+	Elements.reserve (count);
+}
+// Appends a default element and returns a reference to it, so that the new
+// element can be constructed in place.
+TrcWktElement& TrcWktElements::AppendChild (const TrcWktElement* parent,ErcWktEleType parentType)
+{
+	Elements.push_back (TrcWktElement ());
+
+	TrcWktElement& newChldRef = Elements [Elements.size () - 1];
+	newChldRef.SetParent (parent);
+	newChldRef.SetParentType (parentType);
+	return newChldRef;
+}
+TrcWktElement& TrcWktElements::GetChild (size_t index)
+{
+	return Elements [index];
+}
 void TrcWktElements::ParseGrandChildren (void)
 {
 	std::vector<TrcWktElement>::iterator wktItr;
@@ -0,0 +1,588 @@
+/*
+ * Copyright (c) 2008, Autodesk, Inc.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the Autodesk, Inc. nor the names of its
+ *       contributors may be used to endorse or promote products derived
+ *       from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY Autodesk, Inc. ``AS IS'' AND ANY
+ * EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL Autodesk, Inc. OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+// The following list, and the order of their listing, has been optimized for
+// the use of pre-compiled headers.  Some of these files are unreferenced in
+// this module, a small price paid for the efficiency affored by pre-compiled
+// headers.
+
+#include "cs_map.h"
+#include "cs_NameMapper.hpp"
+//  cs_NameMapper.hpp includes cs_CsvFileSupport.hpp
+//  cs_NameMapper.hpp includes csNameMapperSupport.hpp
+#include "cs_WktObject.hpp"
+#include "cs_wkt.h"
+
+#include <float.h>
+
+extern "C" struct cs_Prjtab_ cs_Prjtab [];
+extern "C" struct cs_Prjprm_ csPrjprm [];
+extern "C" struct cs_Datum_ cs_Wgs84Def;
+
+//newPage//
+///////////////////////////////////////////////////////////////////////////////
+// TcsWktWriter  --  The destination of the WKT producers.
+//=========================================================================
+// Construction,  Destruction
+TcsWktWriter::TcsWktWriter (char* bufr,size_t bufrSize) : Target   (Buffer),
+														  Ok       (true),
+														  Length   (0),
+														  Bufr     (bufr),
+														  BufrSize (bufrSize),
+														  Text     (0),
+														  SinkFunc (0),
+														  UserData (0),
+														  Staged   (0)
+{
+	if (Bufr == 0)
+	{
+		BufrSize = 0;
+	}
+	if (BufrSize > 0)
+	{
+		*Bufr = '\0';
+	}
+}
+TcsWktWriter::TcsWktWriter (std::string& text) : Target   (String),
+												 Ok       (true),
+												 Length   (0),
+												 Bufr     (0),
+												 BufrSize (0),
+												 Text     (&text),
+												 SinkFunc (0),
+												 UserData (0),
+												 Staged   (0)
+{
+}
+TcsWktWriter::TcsWktWriter (TcsWktSinkFunc sinkFunc,void* userData) : Target   (Sink),
+																	  Ok       (sinkFunc != 0),
+																	  Length   (0),
+																	  Bufr     (0),
+																	  BufrSize (0),
+																	  Text     (0),
+																	  SinkFunc (sinkFunc),
+																	  UserData (userData),
+																	  Staged   (0)
+{
+}
+TcsWktWriter::~TcsWktWriter (void)
+{
+	Flush ();				//lint !e534   ignoring return value
+}
+//=========================================================================
+// Public Named Member Functions
+bool TcsWktWriter::Fits (size_t length) const
+{
+	bool fits (Ok);
+
+	if (fits && Target == Buffer)
+	{
+		fits = (Length + length) < BufrSize;
+	}
+	return fits;
+}
+void TcsWktWriter::Append (const char* text)
+{
+	Append (text,strlen (text));
+}
+void TcsWktWriter::Append (const char* text,size_t length)
+{
+	size_t avail;
+
+	if (!Ok || length == 0)
+	{
+		return;
+	}
+	switch (Target) {
+	case Buffer:
+		// Same result as CS_stncp: as much as will fit, always null terminated.
+		avail = (BufrSize > 0) ? BufrSize - 1 - Length : 0;
+		if (length > avail)
+		{
+			length = avail;
+			Ok = false;
+		}
+		memcpy (Bufr + Length,text,length);
+		Length += length;
+		if (BufrSize > 0)
+		{
+			Bufr [Length] = '\0';
+		}
+		break;
+	case String:
+		Text->append (text,length);
+		Length += length;
+		break;
+	case Sink:
+		if (Staged + length > KcsStageSize)
+		{
+			if (!Flush ())
+			{
+				return;
+			}
+		}
+		if (length >= KcsStageSize)
+		{
+			// Too large to stage, and the stage is now empty.
+			Ok = ((*SinkFunc)(UserData,text,length) == 0);
+		}
+		else
+		{
+			memcpy (Stage + Staged,text,length);
+			Staged += length;
+		}
+		Length += length;
+		break;
+	}
+}
+void TcsWktWriter::Append (char chr)
+{
+	Append (&chr,1);
+}
+// Equivalent to sprintf (bufr,"%*.*f",width,precision,value), without the
+// cost of the general purpose (and exact) conversion printf uses.  The value
+// is scaled and rounded using extended precision, which produces the correct
+// digits except when the scaled value lies extremely close to a rounding
+// boundary, or is too large to be represented exactly.  Such cases, and
+// non-finite values, are handed to sprintf.
+void TcsWktWriter::AppendFixed (double value,int precision,int width)
+{
+	static const long double KcsPowersOf10 [18] =
+	{
+		1.0E+00L, 1.0E+01L, 1.0E+02L, 1.0E+03L, 1.0E+04L, 1.0E+05L,
+		1.0E+06L, 1.0E+07L, 1.0E+08L, 1.0E+09L, 1.0E+10L, 1.0E+11L,
+		1.0E+12L, 1.0E+13L, 1.0E+14L, 1.0E+15L, 1.0E+16L, 1.0E+17L
+	};
+
+	bool negative;
+	int idx;
+	size_t pos;
+	size_t length;
+	size_t intDigits;
+	unsigned long part;
+	long double scaled;
+	long double whole;
+	long double chunk;
+	long double frac;
+
+	char digits [32];
+	char text [400];
+
+	if (precision < 0)
+	{
+		precision = 0;
+	}
+	if (precision > 40)
+	{
+		precision = 40;
+	}
+	if (width < 0 || width > 40)
+	{
+		width = 0;
+	}
+
+	if (precision < 18 && fabs (value) < 1.0E+18)
+	{
+		negative = (value < 0.0) || (value == 0.0 && (1.0 / value) < 0.0);
+		scaled = static_cast<long double>(fabs (value)) * KcsPowersOf10 [precision];
+		whole = floorl (scaled);
+		frac = scaled - whole;
+		if (fabsl (frac - 0.5L) > (scaled + 1.0L) * LDBL_EPSILON * 4.0L)
+		{
+			if (frac > 0.5L)
+			{
+				whole += 1.0L;
+			}
+
+			// Generate the digits, least significant first, nine at a time.
+			pos = sizeof (digits);
+			while (whole >= 1.0E+09L)
+			{
+				chunk = fmodl (whole,1.0E+09L);
+				whole = (whole - chunk) / 1.0E+09L;
+				part = static_cast<unsigned long>(chunk);
+				for (idx = 0;idx < 9;idx += 1)
+				{
+					digits [--pos] = static_cast<char>('0' + (part % 10UL));
+					part /= 10UL;
+				}
+			}
+			part = static_cast<unsigned long>(whole);
+			do
+			{
+				digits [--pos] = static_cast<char>('0' + (part % 10UL));
+				part /= 10UL;
+			} while (part != 0UL);
+			while ((sizeof (digits) - pos) <= static_cast<size_t>(precision))
+			{
+				digits [--pos] = '0';
+			}
+
+			intDigits = sizeof (digits) - pos - static_cast<size_t>(precision);
+			length = intDigits + (negative ? 1 : 0) + ((precision > 0) ? precision + 1 : 0);
+			idx = 0;
+			while (length < static_cast<size_t>(width))
+			{
+				text [idx++] = ' ';
+				length += 1;
+			}
+			if (negative)
+			{
+				text [idx++] = '-';
+			}
+			memcpy (&text [idx],&digits [pos],intDigits);
+			idx += static_cast<int>(intDigits);
+			if (precision > 0)
+			{
+				text [idx++] = '.';
+				memcpy (&text [idx],&digits [pos + intDigits],static_cast<size_t>(precision));
+				idx += precision;
+			}
+			Append (text,static_cast<size_t>(idx));
+			return;
+		}
+	}
+	length = static_cast<size_t>(sprintf (text,"%*.*f",width,precision,value));
+	Append (text,length);
+}
+bool TcsWktWriter::Flush (void)
+{
+	if (Target == Sink && Staged > 0)
+	{
+		if (Ok)
+		{
+			Ok = ((*SinkFunc)(UserData,Stage,Staged) == 0);
+		}
+		Staged = 0;
+	}
+	return Ok;
+}
+//newPage//
+///////////////////////////////////////////////////////////////////////////////
+// TcsWktLlBaseMap  --  The base geographic system of each datum.
+bool TcsWktKeyNmLess::operator() (const std::string& lhs,const std::string& rhs) const
+{
+	return CS_stricmp (lhs.c_str (),rhs.c_str ()) < 0;
+}
+// The dictionary is searched exactly as CSllCsFromDt searches it; the first
+// suitable geographic system referenced to each datum is retained.
+TcsWktLlBaseMap::TcsWktLlBaseMap (void) : Ok         (false),
+										  Ll84Valid  (false),
+										  BaseNames  ()
+{
+	int st;
+	int crypt;
+
+	csFILE *strm;
+	struct cs_Prjtab_ *pp;
+
+ 	__ALIGNMENT__1		/* Required by some Sun compilers. */
+	struct cs_Csdef_ cs_def;
+
+	Ll84Valid = (CS_csIsValid ("LL84") != 0);
+	strm = CS_csopn (_STRM_BINRD);
+	if (strm != NULL)
+	{
+		while ((st = CS_csrd (strm,&cs_def,&crypt)) > 0)
+		{
+			if (cs_def.dat_knm [0] == '\0')
+			{
+				continue;
+			}
+			for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
+			{
+				if (!CS_stricmp (pp->key_nm,cs_def.prj_knm)) break;
+			}
+			if (*pp->key_nm == '\0' || pp->setup == NULL || pp->code != cs_PRJCOD_UNITY)
+			{
+				continue;
+			}
+			if (cs_def.org_lng != 0.0 || CS_stricmp (cs_def.unit,"DEGREE"))
+			{
+				continue;
+			}
+			BaseNames.insert (std::make_pair (std::string (cs_def.dat_knm),std::string (cs_def.key_nm)));
+		}
+		CS_csDictCls (strm);
+		Ok = (st == 0);
+	}
+}
+const char* TcsWktLlBaseMap::Locate (const char* dtKeyName) const
+{
+	const char* rtnValue = "";
+	std::map<std::string,std::string,TcsWktKeyNmLess>::const_iterator itr;
+
+	if (Ll84Valid && !CS_stricmp (cs_Wgs84Def.key_nm,dtKeyName))
+	{
+		rtnValue = "LL84";
+	}
+	else
+	{
+		itr = BaseNames.find (std::string (dtKeyName));
+		if (itr != BaseNames.end ())
+		{
+			rtnValue = itr->second.c_str ();
+		}
+	}
+	return rtnValue;
+}
+//newPage//
+///////////////////////////////////////////////////////////////////////////////
+// TcsWktNameTables  --  Flavored names used by the WKT producers.
+//
+// Each name is obtained from the name mapper upon first use in each flavor,
+// and retained until the name mapper is reconstructed.
+class TcsWktNameTables
+{
+	static const int KcsFlavorCount = csMapFlvrUnknown + 1;
+	static const int KcsPrjCodeCount = cs_PRMCOD_MAXIDX + 1;
+	static const int KcsWktCodeCount = cs_WKTCOD_SCLRED - cs_WKTCOD_FEAST + 1;
+	static const int KcsDtmCodeCount = cs_WKTCOD_BWSCAL - cs_WKTCOD_DELTAX + 1;
+	static const int KcsParamCount = KcsPrjCodeCount + KcsWktCodeCount + KcsDtmCodeCount;
+public:
+	TcsWktNameTables (void);
+	const char* ParamName (EcsNameFlavor nmFlavor,int paramCode);
+	const char* ProjName (EcsNameFlavor nmFlavor,const char* prjKeyName);
+	const char* DegreeName (EcsNameFlavor nmFlavor);
+private:
+	struct TcsWktName
+	{
+		TcsWktName (void) : Known (false),Mapped (false),Name () {}
+		bool Known;
+		bool Mapped;
+		std::string Name;
+	};
+	static int FlavorIndex (EcsNameFlavor nmFlavor);
+	static int ParamIndex (int paramCode);
+	static const char* ParamDefault (int paramCode);
+	void Refresh (void);
+	unsigned long Serial;
+	int PrjCount;
+	std::vector<TcsWktName> ParamNames;
+	std::vector<TcsWktName> ProjNames;
+	std::vector<TcsWktName> DegreeNames;
+};
+TcsWktNameTables::TcsWktNameTables (void) : Serial      (0UL),
+											PrjCount    (0),
+											ParamNames  (),
+											ProjNames   (),
+											DegreeNames ()
+{
+	const struct cs_Prjtab_ *pp;
+
+	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
+	{
+		PrjCount += 1;
+	}
+	ParamNames.resize (KcsFlavorCount * KcsParamCount);
+	ProjNames.resize (KcsFlavorCount * PrjCount);
+	DegreeNames.resize (KcsFlavorCount);
+}
+const char* TcsWktNameTables::ParamName (EcsNameFlavor nmFlavor,int paramCode)
+{
+	int index;
+	char paramName [128];
+
+	index = ParamIndex (paramCode);
+	if (index < 0)
+	{
+		return 0;
+	}
+	Refresh ();
+	TcsWktName& entry = ParamNames [FlavorIndex (nmFlavor) * KcsParamCount + index];
+	if (!entry.Known)
+	{
+		// The flavored name, the CS-MAP name, or failing all else a generic
+		// name for the parameter.
+		if (csMapIdToNameC (csMapParameterKeyName,paramName,sizeof (paramName),nmFlavor,
+																			   csMapFlvrCsMap,
+																			   static_cast<unsigned long>(paramCode)) != csMapOk &&
+			csMapIdToNameC (csMapParameterKeyName,paramName,sizeof (paramName),csMapFlvrCsMap,
+																			   csMapFlvrCsMap,
+																			   static_cast<unsigned long>(paramCode)) != csMapOk)
+		{
+			CS_stncp (paramName,ParamDefault (paramCode),sizeof (paramName));
+		}
+		paramName [sizeof (paramName) - 1] = '\0';
+		entry.Name = paramName;
+		entry.Mapped = true;
+		entry.Known = true;
+	}
+	return entry.Name.c_str ();
+}
+const char* TcsWktNameTables::ProjName (EcsNameFlavor nmFlavor,const char* prjKeyName)
+{
+	int index;
+	EcsMapSt csMapSt;
+	const struct cs_Prjtab_ *pp;
+
+	char projection [64];
+
+	for (pp = cs_Prjtab;*pp->key_nm != '\0';pp++)
+	{
+		if (!strcmp (pp->key_nm,prjKeyName)) break;
+	}
+	if (*pp->key_nm == '\0')
+	{
+		return 0;
+	}
+	index = static_cast<int>(pp - cs_Prjtab);
+	Refresh ();
+	TcsWktName& entry = ProjNames [FlavorIndex (nmFlavor) * PrjCount + index];
+	if (!entry.Known)
+	{
+		csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),nmFlavor,
+																						   csMapFlvrCsMap,
+																						   prjKeyName);
+		projection [sizeof (projection) - 1] = '\0';
+		entry.Name = projection;
+		entry.Mapped = (csMapSt == csMapOk);
+		entry.Known = true;
+	}
+	return entry.Mapped ? entry.Name.c_str () : 0;
+}
+const char* TcsWktNameTables::DegreeName (EcsNameFlavor nmFlavor)
+{
+	EcsMapSt csMapSt;
+	char unitName [128];
+
+	Refresh ();
+	TcsWktName& entry = DegreeNames [FlavorIndex (nmFlavor)];
+	if (!entry.Known)
+	{
+		csMapSt = csMapNameToNameC (csMapAngularUnitKeyName,unitName,sizeof (unitName),nmFlavor,
+																					   csMapFlvrAutodesk,
+																					   "DEGREE");
+		if (csMapSt != csMapOk)
+		{
+			CS_stncp (unitName,"Degree",sizeof (unitName));
+		}
+		unitName [sizeof (unitName) - 1] = '\0';
+		entry.Name = unitName;
+		entry.Mapped = true;
+		entry.Known = true;
+	}
+	return entry.Name.c_str ();
+}
+int TcsWktNameTables::FlavorIndex (EcsNameFlavor nmFlavor)
+{
+	int index = static_cast<int>(nmFlavor);
+
+	if (index < 0 || index >= KcsFlavorCount)
+	{
+		index = static_cast<int>(csMapFlvrUnknown);
+	}
+	return index;
+}
+int TcsWktNameTables::ParamIndex (int paramCode)
+{
+	int index = -1;
+
+	if (paramCode >= 0 && paramCode <= cs_PRMCOD_MAXIDX)
+	{
+		index = paramCode;
+	}
+	else if (paramCode >= cs_WKTCOD_FEAST && paramCode <= cs_WKTCOD_SCLRED)
+	{
+		index = KcsPrjCodeCount + (paramCode - cs_WKTCOD_FEAST);
+	}
+	else if (paramCode >= cs_WKTCOD_DELTAX && paramCode <= cs_WKTCOD_BWSCAL)
+	{
+		index = KcsPrjCodeCount + KcsWktCodeCount + (paramCode - cs_WKTCOD_DELTAX);
+	}
+	return index;
+}
+const char* TcsWktNameTables::ParamDefault (int paramCode)
+{
+	const char* kCp;
+
+	if (paramCode >= 0 && paramCode <= cs_PRMCOD_MAXIDX)
+	{
+		return csPrjprm [paramCode].label;
+	}
+	switch (paramCode) {
+	case cs_WKTCOD_FEAST:  kCp = "False Easting";    break;
+	case cs_WKTCOD_FNORTH: kCp = "False Northing";   break;
+	case cs_WKTCOD_ORGLNG: kCp = "Origin Longitude"; break;
+	case cs_WKTCOD_ORGLAT: kCp = "Origin Latitude";  break;
+	case cs_WKTCOD_SCLRED: kCp = "Scale Reduction";  break;
+	case cs_WKTCOD_DELTAX: kCp = "Delta X";          break;
+	case cs_WKTCOD_DELTAY: kCp = "Delta Y";          break;
+	case cs_WKTCOD_DELTAZ: kCp = "Delta Z";          break;
+	case cs_WKTCOD_ROTATX: kCp = "X Rotation";       break;
+	case cs_WKTCOD_ROTATY: kCp = "Y Rotation";       break;
+	case cs_WKTCOD_ROTATZ: kCp = "Z Rotation";       break;
+	case cs_WKTCOD_BWSCAL: kCp = "Datum Scale";      break;
+	default:               kCp = "Parameter Value";  break;
+	}
+	return kCp;
+}
+// Constructing (or releasing) the name mapper changes its serial number, at
+// which time all names obtained from the previous name mapper are discarded.
+void TcsWktNameTables::Refresh (void)
+{
+	unsigned long serial;
+	std::vector<TcsWktName>::iterator itr;
+
+	cmGetNameMapperPtr ();				//lint !e534   ignoring return value
+	serial = cmGetNameMapperSerial ();
+	if (serial != Serial)
+	{
+		for (itr = ParamNames.begin ();itr != ParamNames.end ();itr++)
+		{
+			itr->Known = false;
+		}
+		for (itr = ProjNames.begin ();itr != ProjNames.end ();itr++)
+		{
+			itr->Known = false;
+		}
+		for (itr = DegreeNames.begin ();itr != DegreeNames.end ();itr++)
+		{
+			itr->Known = false;
+		}
+		Serial = serial;
+	}
+}
+// The tables are a function static so that they are constructed upon first
+// use, regardless of the order in which static objects are constructed.
+static TcsWktNameTables& CSwktNameTables (void)
+{
+	static TcsWktNameTables nameTables;
+	return nameTables;
+}
+const char* CSwktParamName (EcsNameFlavor nmFlavor,int paramCode)
+{
+	return CSwktNameTables ().ParamName (nmFlavor,paramCode);
+}
+const char* CSwktProjName (EcsNameFlavor nmFlavor,const char* prjKeyName)
+{
+	return CSwktNameTables ().ProjName (nmFlavor,prjKeyName);
+}
+const char* CSwktDegreeName (EcsNameFlavor nmFlavor)
+{
+	return CSwktNameTables ().DegreeName (nmFlavor);
+}
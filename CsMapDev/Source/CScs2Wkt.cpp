@@ -39,7 +39,8 @@
 #include "cs_wkt.h"
 
 bool EXP_LVL3 CSgetParamNm (char* paramName,size_t paramSize,EcsNameFlavor nmFlavor,int paramCode);
-bool EXP_LVL3 CSAddParamValue (char* wktBufr,size_t bufrSize,EcsNameFlavor nmFlavor,int paramCode,double paramValue,unsigned paramFlags);
+bool CSAddParamValue (TcsWktWriter& parmWkt,EcsNameFlavor nmFlavor,int paramCode,double paramValue,unsigned paramFlags);
+static void CSwktProjNameDflt (char* projection,size_t projSize,EcsNameFlavor nmFlavor,const char* prjKeyName,const char* dfltName);
 #define cs_PARAMFLG_UTM 1
 
 extern "C" double cs_Zero;
@@ -131,6 +132,170 @@ int EXP_LVL1 CS_cs2Wkt (char *bufr,size_t bufrSize,const char *csKeyName,int fla
 	return rtnValue;		
 }
 
+/* Same as CS_cs2WktEx, except the WKT is delivered to sinkFunc in one or
+   more pieces rather than being written to a buffer; thus there is no limit
+   on its length.  A non-zero return from sinkFunc terminates the output. */
+int EXP_LVL1 CS_cs2WktSink (int (*sinkFunc)(void *userData,const char *text,size_t length),void *userData,const char *csKeyName,int flavor,unsigned short flags)
+{
+	int rtnValue = -1;
+	struct cs_Dtdef_ *dtDefPtr = 0;
+	struct cs_Eldef_ *elDefPtr = 0;
+	struct cs_Csdef_ *csDefPtr = 0;
+
+	if (sinkFunc != 0)
+	{
+		csDefPtr = CS_csdef (csKeyName);
+		if (csDefPtr != 0)
+		{
+			if (csDefPtr->dat_knm [0] == '\0')
+			{
+				CS_erpt (cs_WKT_NODTREF);
+			}
+			else
+			{
+				dtDefPtr = CS_dtdef (csDefPtr->dat_knm);
+				if (dtDefPtr != 0)
+				{
+					elDefPtr = CS_eldef (dtDefPtr->ell_knm);
+					if (elDefPtr != 0)
+					{
+						TcsWktWriter csWkt (sinkFunc,userData);
+						rtnValue = CScs2WktWrite (csWkt,(ErcWktFlavor)flavor,csDefPtr,dtDefPtr,elDefPtr,flags);
+						csWkt.Flush ();
+						if (rtnValue >= 0 && !csWkt.IsOk ())
+						{
+							rtnValue = -1;
+						}
+						CS_free (elDefPtr);
+						elDefPtr = 0;
+					}
+					CS_free (dtDefPtr);
+					dtDefPtr = 0;
+				}
+			}
+			CS_free (csDefPtr);
+			csDefPtr = 0;
+		}
+	}
+	return rtnValue;
+}
+
+/* Exports every coordinate system in the dictionary, in each of the
+   flavorCount flavors in the flavors array (all flavors from OGC through
+   Autodesk if flavors is null), to exportFunc.  The dictionaries are read
+   once, and the base geographic system of each datum is determined once,
+   rather than for each system and flavor.  Systems which, as with
+   CS_cs2WktEx, do not reference a datum or cannot be expressed in a flavor
+   are skipped.  A non-zero return from exportFunc
+   terminates the export.  Returns the number of WKT strings exported, or
+   -1 if the dictionaries could not be read. */
+long32_t EXP_LVL1 CS_cs2WktAll (int (*exportFunc)(void *userData,const char *csKeyName,int flavor,const char *wktText,size_t length),void *userData,Const int *flavors,int flavorCount,unsigned short flags)
+{
+	static const int allFlavors [] = { wktFlvrOgc,     wktFlvrGeoTiff,  wktFlvrEsri,
+									   wktFlvrOracle,  wktFlvrGeoTools, wktFlvrEpsg,
+									   wktFlvrOracle9, wktFlvrAutodesk };
+
+	int st;
+	int dfIdx;
+	int csIdx;
+	int csCount;
+	int dtCount;
+	int elCount;
+	int flvrIdx;
+	bool stop;
+	long32_t rtnValue;
+
+	struct cs_Csdef_ *csDefs = 0;
+	struct cs_Dtdef_ *dtDefs = 0;
+	struct cs_Eldef_ *elDefs = 0;
+	const struct cs_Dtdef_ *dtDefPtr;
+	const struct cs_Eldef_ *elDefPtr;
+
+	std::string wktText;
+	std::map<std::string,const struct cs_Dtdef_*,TcsWktKeyNmLess> dtMap;
+	std::map<std::string,const struct cs_Eldef_*,TcsWktKeyNmLess> elMap;
+	std::map<std::string,const struct cs_Dtdef_*,TcsWktKeyNmLess>::const_iterator dtItr;
+	std::map<std::string,const struct cs_Eldef_*,TcsWktKeyNmLess>::const_iterator elItr;
+
+	rtnValue = -1L;
+	if (exportFunc == 0 || flavorCount < 0)
+	{
+		CS_stncp (csErrnam,"CS_cs2WktAll:1",MAXPATH);
+		CS_erpt (cs_ISER);
+		goto error;
+	}
+	if (flavors == 0)
+	{
+		flavors = allFlavors;
+		flavorCount = sizeof (allFlavors) / sizeof (allFlavors [0]);
+	}
+
+	csCount = CS_csdefAllEx (&csDefs);
+	if (csCount < 0) goto error;
+	dtCount = CS_dtdefAllEx (&dtDefs);
+	if (dtCount < 0) goto error;
+	elCount = CS_eldefAllEx (&elDefs);
+	if (elCount < 0) goto error;
+
+	/* insert keeps the first of any duplicates, as would a dictionary
+	   search. */
+	for (dfIdx = 0;dfIdx < dtCount;dfIdx += 1)
+	{
+		dtMap.insert (std::make_pair (std::string (dtDefs [dfIdx].key_nm),&dtDefs [dfIdx]));
+	}
+	for (dfIdx = 0;dfIdx < elCount;dfIdx += 1)
+	{
+		elMap.insert (std::make_pair (std::string (elDefs [dfIdx].key_nm),&elDefs [dfIdx]));
+	}
+
+	{
+		TcsWktLlBaseMap baseMap;
+		if (!baseMap.IsOk ()) goto error;
+
+		rtnValue = 0L;
+		stop = false;
+		for (csIdx = 0;csIdx < csCount && !stop;csIdx += 1)
+		{
+			/* Same datum and ellipsoid selection as CS_cs2WktEx; a system
+			   must reference a datum. */
+			dtItr = dtMap.find (csDefs [csIdx].dat_knm);
+			if (csDefs [csIdx].dat_knm [0] == '\0' || dtItr == dtMap.end ())
+			{
+				continue;
+			}
+			dtDefPtr = dtItr->second;
+			elItr = elMap.find (dtDefPtr->ell_knm);
+			if (elItr == elMap.end ())
+			{
+				continue;
+			}
+			elDefPtr = elItr->second;
+
+			for (flvrIdx = 0;flvrIdx < flavorCount && !stop;flvrIdx += 1)
+			{
+				wktText.clear ();
+				TcsWktWriter csWkt (wktText);
+				st = CScs2WktWrite (csWkt,(ErcWktFlavor)flavors [flvrIdx],&csDefs [csIdx],dtDefPtr,elDefPtr,flags,&baseMap);
+				if (st >= 0)
+				{
+					stop = ((*exportFunc)(userData,csDefs [csIdx].key_nm,flavors [flvrIdx],wktText.c_str (),wktText.length ()) != 0);
+					rtnValue += 1L;
+				}
+			}
+		}
+	}
+	CS_free (elDefs);
+	CS_free (dtDefs);
+	CS_free (csDefs);
+	return rtnValue;
+
+error:
+	if (elDefs != 0) CS_free (elDefs);
+	if (dtDefs != 0) CS_free (dtDefs);
+	if (csDefs != 0) CS_free (csDefs);
+	return -1L;
+}
+
 int EXP_LVL3 CScs2Wkt (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavor,const struct cs_Csdef_ *cs_def,const struct cs_Dtdef_ *dt_def,const struct cs_Eldef_ *el_def)
 {
 	int st;
@@ -141,6 +306,24 @@ int EXP_LVL3 CScs2Wkt (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavor,
 	return st;
 }
 int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavor,const struct cs_Csdef_ *cs_def,const struct cs_Dtdef_ *dt_def,const struct cs_Eldef_ *el_def,unsigned short flags)
+{
+	int st;
+
+	TcsWktWriter csWkt (csWktBufr,bufrSize);
+	st = CScs2WktWrite (csWkt,flavor,cs_def,dt_def,el_def,flags);
+	return st;
+}
+/* Writes the WKT of the coordinate system to csWkt.  Everything which may
+   fail is determined before anything is written, so nothing is written if
+   the result is negative.  If baseMap is not null, it is used instead of
+   CSllCsFromDt to determine the base geographic system of a projected
+   system; which saves a search of the dictionary for each projected system
+   written. */
+int CScs2WktWrite (TcsWktWriter& csWkt,enum ErcWktFlavor flavor,const struct cs_Csdef_ *cs_def,
+																const struct cs_Dtdef_ *dt_def,
+																const struct cs_Eldef_ *el_def,
+																unsigned short flags,
+																const TcsWktLlBaseMap* baseMap)
 {
 	int status;
 	int rtnValue;
@@ -159,6 +342,11 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 
 	char *ccPtr;
 	const char *kCp;
+	const char *geoAxis;
+	const char *prjAxis;
+	const char *pmerName;
+	const char *angUnitName;
+	const char *gcsNamePtr;
 	struct cs_Dtdef_ *dtDefPtr;
 	struct cs_Eldef_ *elDefPtr;
 	struct cs_Prjtab_ *prjPtr;
@@ -166,22 +354,19 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 	char refDtmName [64];
 	char baseName [64];
 	char cTemp [128];
+	char linUnitName [128];
 
 	char elpWkt[512];
 	char datmWkt [512];
-	char pmerWkt [512];
-	char geogWkt [512];
 	char parmWkt [512];
-	char unitWkt [128];
-	char projWkt [1024];
-	char geoAxis [1024];
-	char prjAxis [1024];
-	char geoTranWkt [1024];
 	char projection [64];
 	char csysWktName [96];
 	char gcsName [256];
 	char tmpBufr [1024];
 
+	TcsWktWriter datmWriter (datmWkt,sizeof (datmWkt));
+	TcsWktWriter parmWriter (parmWkt,sizeof (parmWkt));
+
 	status = 0;
 	rtnValue = 0;
 	refDtmName [0] = '\0';
@@ -386,29 +571,30 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 	CS_stncp (projection,"LL",sizeof (projection));
 	if (prjPtr->code != cs_PRJCOD_UNITY)
 	{
-		csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),nmFlavor,csMapFlvrCsMap,prjPtr->key_nm);
-		if (csMapSt != csMapOk && prjPtr->code == cs_PRJCOD_LMTAN)
+		kCp = CSwktProjName (nmFlavor,prjPtr->key_nm);
+		if (kCp == 0 && prjPtr->code == cs_PRJCOD_LMTAN)
 		{
 			/* The LMTAN and LMSP1 projections are essentially the same thing.
 			   Since it appears that the requested flavor does not support a
 			   name for this projection, we switch to whatever name the flavor
 			   uses for the LM1SP.  The parameters for these two projections
 			   are the same, */
-			csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),nmFlavor,csMapFlvrCsMap,"LM1SP");
+			kCp = CSwktProjName (nmFlavor,"LM1SP");
 		}
-		if (csMapSt != csMapOk)
+		if (kCp == 0)
 		{
 			/* If none of that worked, try to get the Autodesk name that appears
 			   in the mapping table. */
-			csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),csMapFlvrAutodesk,csMapFlvrCsMap,prjPtr->key_nm);
+			kCp = CSwktProjName (csMapFlvrAutodesk,prjPtr->key_nm);
 		}
-		if (csMapSt != csMapOk)
+		if (kCp == 0)
 		{
 			/* If that didn't work, we bag it. */
 			CS_stncp (csErrnam,prjPtr->key_nm,MAXPATH);
 			CS_erpt (cs_WKT_PRJSUPRT);
 			goto error;
 		}
+		CS_stncp (projection,kCp,sizeof (projection));
 	}
 	/* Projection name is handled. */
 
@@ -432,9 +618,10 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			   use the ellipsoid key name provided in the coordinate system
 			   definition.  If that does not exist (should never happen),
 			   we simply use WGS84. */
+			TcsWktWriter elpWriter (elpWkt,sizeof (elpWkt));
 			if (el_def != 0)
 			{
-				status = CSel2WktEx (elpWkt,sizeof (elpWkt),flavor,el_def,flags);
+				status = CSel2WktWrite (elpWriter,flavor,el_def,flags);
 			}
 			else
 			{
@@ -451,13 +638,15 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 					CS_erpt (cs_NO_REFERNCE);
 					goto error;
 				}
-				status = CSel2WktEx (elpWkt,sizeof (elpWkt),flavor,elDefPtr,flags);
+				status = CSel2WktWrite (elpWriter,flavor,elDefPtr,flags);
 				CS_free (elDefPtr);
 				elDefPtr = 0;
 			}
 			if(status == 0)
 			{
-				sprintf (datmWkt,"DATUM[\"\",%s]",elpWkt);
+				datmWriter.Append ("DATUM[\"\",");
+				datmWriter.Append (elpWkt,elpWriter.GetLength ());
+				datmWriter.Append (']');
 			}
 			else
 			{
@@ -485,8 +674,9 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 				goto error;
 			}
 
-			/* I don't have to locate the ellipsoid, CSdt2WktEx will do that. */
-			status = CSdt2WktEx (datmWkt,sizeof (datmWkt),geoTranWkt,sizeof (geoTranWkt),flavor,dtDefPtr,0,flags);
+			/* I don't have to locate the ellipsoid, CSdt2WktWrite will do that.
+			   The GEOTRAN element is of no interest here. */
+			status = CSdt2WktWrite (&datmWriter,0,flavor,dtDefPtr,0,flags);
 			CS_free (dtDefPtr);
 			dtDefPtr = 0;
 		}
@@ -509,11 +699,11 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 		{
 			CS_stncp (refDtmName,dt_def->key_nm,sizeof (refDtmName));
 		}
-		status = CSdt2WktEx (datmWkt,sizeof (datmWkt),geoTranWkt,sizeof (geoTranWkt),flavor,dt_def,el_def,flags);
+		status = CSdt2WktWrite (&datmWriter,0,flavor,dt_def,el_def,flags);
 	}
 	if (status != 0)
 	{
-		/* CSdt2WktEx will have reported the nature of the error. */
+		/* CSdt2WktWrite will have reported the nature of the error. */
 		goto error;
 	}
 	/* OK!!! We have the WKT form of the DATUM element. */
@@ -521,8 +711,8 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 	/* Deal with the quad/axis situation.  If the quad member of the coordinate
 	   system definition is 0 or 1, the axes are the normal set and we don't
 	   bother with all this stuff.  This is the case 99.999% of the time. */
-	geoAxis [0] = '\0';
-	prjAxis [0] = '\0';
+	geoAxis = "";
+	prjAxis = "";
 	if (cs_def->quad != 0 && cs_def->quad != 1)
 	{
 		if ((prjPtr->flags & cs_PRJFLG_GEOGR) != 0)
@@ -532,28 +722,28 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			default:
 			case 0:
 			case 1:
-				CS_stncp (geoAxis,",AXIS[\"Lon\",EAST],AXIS[\"Lat\",NORTH]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lon\",EAST],AXIS[\"Lat\",NORTH]";
 				break;
 			case 2:
-				CS_stncp (geoAxis,",AXIS[\"Lon\",WEST],AXIS[\"Lat\",NORTH]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lon\",WEST],AXIS[\"Lat\",NORTH]";
 				break;
 			case 3:
-				CS_stncp (geoAxis,",AXIS[\"Lon\",WEST],AXIS[\"Lat\",SOUTH]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lon\",WEST],AXIS[\"Lat\",SOUTH]";
 				break;
 			case 4:
-				CS_stncp (geoAxis,",AXIS[\"Lon\",EAST],AXIS[\"Lat\",SOUTH]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lon\",EAST],AXIS[\"Lat\",SOUTH]";
 				break;
 			case -1:
-				CS_stncp (geoAxis,",AXIS[\"Lat\",NORTH],AXIS[\"Lon\",EAST]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lat\",NORTH],AXIS[\"Lon\",EAST]";
 				break;
 			case -2:
-				CS_stncp (geoAxis,",AXIS[\"Lat\",NORTH],AXIS[\"Lon\",WEST]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lat\",NORTH],AXIS[\"Lon\",WEST]";
 				break;
 			case -3:
-				CS_stncp (geoAxis,",AXIS[\"Lat\",SOUTH],AXIS[\"Lon\",WEST]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lat\",SOUTH],AXIS[\"Lon\",WEST]";
 				break;
 			case -4:
-				CS_stncp (geoAxis,",AXIS[\"Lat\",SOUTH],AXIS[\"Lon\",EAST]",sizeof (prjAxis));
+				geoAxis = ",AXIS[\"Lat\",SOUTH],AXIS[\"Lon\",EAST]";
 				break;
 			}
 		}
@@ -564,28 +754,28 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			default:
 			case 0:
 			case 1:
-				CS_stncp (prjAxis,",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"X\",EAST],AXIS[\"Y\",NORTH]";
 				break;
 			case 2:
-				CS_stncp (prjAxis,",AXIS[\"X\",WEST],AXIS[\"Y\",NORTH]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"X\",WEST],AXIS[\"Y\",NORTH]";
 				break;
 			case 3:
-				CS_stncp (prjAxis,",AXIS[\"X\",WEST],AXIS[\"Y\",SOUTH]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"X\",WEST],AXIS[\"Y\",SOUTH]";
 				break;
 			case 4:
-				CS_stncp (prjAxis,",AXIS[\"X\",EAST],AXIS[\"Y\",SOUTH]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"X\",EAST],AXIS[\"Y\",SOUTH]";
 				break;
 			case -1:
-				CS_stncp (prjAxis,",AXIS[\"Y\",NORTH],AXIS[\"X\",EAST]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"Y\",NORTH],AXIS[\"X\",EAST]";
 				break;
 			case -2:
-				CS_stncp (prjAxis,",AXIS[\"Y\",NORTH],AXIS[\"X\",WEST]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"Y\",NORTH],AXIS[\"X\",WEST]";
 				break;
 			case -3:
-				CS_stncp (prjAxis,",AXIS[\"Y\",SOUTH],AXIS[\"X\",WEST]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"Y\",SOUTH],AXIS[\"X\",WEST]";
 				break;
 			case -4:
-				CS_stncp (prjAxis,",AXIS[\"Y\",SOUTH],AXIS[\"X\",EAST]",sizeof (prjAxis));
+				prjAxis = ",AXIS[\"Y\",SOUTH],AXIS[\"X\",EAST]";
 				break;
 			}
 		}
@@ -609,7 +799,14 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 		   find one, we we need to do some special stuff.
 
 		   Note that this name is not flavored. */
-		CSllCsFromDt (baseName,sizeof baseName,refDtmName);		//lint !e534   ignoring return value
+		if (baseMap != 0)
+		{
+			CS_stncp (baseName,baseMap->Locate (refDtmName),sizeof (baseName));
+		}
+		else
+		{
+			CSllCsFromDt (baseName,sizeof baseName,refDtmName);		//lint !e534   ignoring return value
+		}
 
 		if (baseName[0] == '\0')
 		{
@@ -631,27 +828,12 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 	   of importance to us here.
 	   
 	   First we prepare a default if any of the stuff following it fails. */
-	csMapSt = csMapNameToNameC (csMapAngularUnitKeyName,cTemp,sizeof (cTemp),
-														nmFlavor,
-														csMapFlvrAutodesk,
-														"DEGREE");
-	if (csMapSt != csMapOk)
-	{
-		CS_stncp (cTemp,"Degree",sizeof (cTemp));
-	}
+	angUnitName = CSwktDegreeName (nmFlavor);
 	unitFactor = cs_One;
 
 	/* With the default determined, we proceed to genberate the more
 	   specific, if possible. */
-	if ((prjPtr->flags & cs_PRJFLG_GEOGR) == 0)
-	{
-		// This little bit of redundant nonsense is retained so as to prevent
-		// a regression tester from producing thousands of regression failures.
-		// TODO: A refactoring of all WKT code to remove nonsense like this is
-		// on the proposed schedule; we'll remove it at that time.
-		sprintf (unitWkt,"UNIT[\"%s\",0.017453292519943295]",cTemp);
-	}
-	else
+	if ((prjPtr->flags & cs_PRJFLG_GEOGR) != 0)
 	{
 		/* This is a geographic coordinate system, extract the unit information
 		   from the definition. */
@@ -664,7 +846,7 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 		{
 			CS_stncp (cTemp,cs_def->unit,sizeof (cTemp));
 		}
-		sprintf (unitWkt,"UNIT[\"%s\",%.14f]",cTemp,unitFactor * cs_Degree);
+		angUnitName = cTemp;
 	}
 
 	/* Manufacture the prime meridian.  Produce the default value first in
@@ -672,12 +854,12 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 	   degrees referenced to greenwich.  Thus, the only time we need a
 	   PRIMEM element other than the greenwich default is for a GEOGCS
 	   definition. */
-	CS_stncp (pmerWkt,"PRIMEM[\"Greenwich\",0]",sizeof (pmerWkt));
+	pmerName = 0;
+	primeMer = 0.0;
 	if (((prjPtr->flags & cs_PRJFLG_GEOGR) != 0 || prjPtr->code == cs_PRJCOD_KROVAK) && cs_def->org_lng != 0.0)
 	{
 		int orgLng = (int)cs_def->org_lng;
 		kCp = 0;				// redundant, but it keeps lint happy.
-		primeMer = 0.0;
 		switch (orgLng) {
 		case 0:
 			primeMer = 0.0;
@@ -745,7 +927,7 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			{
 				primeMer /= unitFactor;
 			}
-			sprintf (pmerWkt,"PRIMEM[\"%s\",%18.13f]",kCp,primeMer);
+			pmerName = kCp;
 		}
 	}
 
@@ -754,7 +936,7 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 	   default in case anything goes wrong in the name mapping process.
 	   Note, this is where the null baseName is introduced to the GEOGCS
 	   in the event of a cartographically referenced coordinate system. */
-	sprintf (geogWkt,"GEOGCS[\"%s\",%s,%s,%s%s]",baseName,datmWkt,pmerWkt,unitWkt,geoAxis);
+	gcsNamePtr = baseName;
 
 	if ((flags & cs_WKTFLG_MAPNAMES) != 0)
 	{
@@ -815,24 +997,19 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 		if (csMapSt == csMapOk)
 		{
 			/* If after all that, it appears that the name flavoring worked,
-			   we reproduce the GEOGCS definition string. */
-			sprintf (geogWkt,"GEOGCS[\"%s\",%s,%s,%s%s]",gcsName,datmWkt,pmerWkt,unitWkt,geoAxis);
+			   we use the flavored name in the GEOGCS element. */
+			gcsNamePtr = gcsName;
 		}
 	}
 
-	/* Preparation complete. */
-	if ((prjPtr->flags & cs_PRJFLG_GEOGR) != 0)
-	{
-		/* If this is a geographic coordinate system, we're done. */
-		CS_stncp (csWktBufr,geogWkt,(int)bufrSize);
-	}
-	else
+	/* Preparation of the GEOGCS element complete. */
+	if ((prjPtr->flags & cs_PRJFLG_GEOGR) == 0)
 	{
 		/* We get here only if the coordinate system is of the projected type. */
 
-		/* Do the linear unit for the projWkt. */
+		/* Do the linear unit for the PROJCS element. */
 		unitFactor = CS_unitlu (cs_UTYP_LEN,cs_def->unit);
-		csMapSt = csMapNameToNameC (csMapLinearUnitKeyName,cTemp,sizeof (cTemp),
+		csMapSt = csMapNameToNameC (csMapLinearUnitKeyName,linUnitName,sizeof (linUnitName),
 														   nmFlavor,
 														   csMapFlvrAutodesk,
 														   cs_def->unit);
@@ -842,7 +1019,7 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			{
 				/* Use the CS-MAP name if there is no flavored name in the
 				   name mapper. */
-				CS_stncp (cTemp,cs_def->unit,sizeof (cTemp));
+				CS_stncp (linUnitName,cs_def->unit,sizeof (linUnitName));
 			}
 			else
 			{
@@ -851,10 +1028,9 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 				   unit. */
 				CS_stncp (csErrnam,cs_def->unit,MAXPATH);
 				CS_erpt (cs_WKT_UNITMAP);
-				return -1;
+				goto error;
 			}
 		}
-		sprintf (unitWkt,"UNIT[\"%s\",%.14f]",cTemp,unitFactor);
 
 		/* Build the parameter portion of the WKT PROJCS element.
 		   CSAddParamValue is a bit of a kludge, but it enables all the
@@ -862,7 +1038,6 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 		   a consistent means of producing the appropriate precision for all projection
 		   parameters. */ 
 
-		parmWkt [0] = '\0';
 		paramFlags = 0;
 		if (prjPtr->code == cs_PRJCOD_UTM)
 		{
@@ -873,201 +1048,201 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 		case  cs_PRJCOD_UNITY:
 			/* This is case should never happen.  We leave this is for legacy
 			   purposes.  It was added by the MapGuide folk in 2006. */
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_TRMER:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_ALBER:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_MRCAT:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_MRCATPV:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_AZMED:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			if (cs_def->prj_prm1 != 0.0)
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_YAXISAZ,cs_def->prj_prm1,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_YAXISAZ,cs_def->prj_prm1,paramFlags);
 			}
 			break;
 		case  cs_PRJCOD_PLYCN:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;		
 		case  cs_PRJCOD_MODPC:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_ESTDMER,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NPARALL,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SPARALL,cs_def->prj_prm4,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_ESTDMER,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NPARALL,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SPARALL,cs_def->prj_prm4,paramFlags);
 			break;
 		case  cs_PRJCOD_AZMEA:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			if (cs_def->prj_prm1 != 0.0)
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_YAXISAZ,cs_def->prj_prm1,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_YAXISAZ,cs_def->prj_prm1,paramFlags);
 			}
 			break;
 		case  cs_PRJCOD_EDCNC:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_MILLR:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_MSTRO:
 			// TODO
 			break;
 		case  cs_PRJCOD_NZLND:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_SINUS:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_ORTHO:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_GNOMC:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_EDCYL:
 		case  cs_PRJCOD_EDCYLE:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_VDGRN:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_CSINI:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_ROBIN:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_BONNE:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_EKRT4:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_EKRT6:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_MOLWD:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_HMLSN:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			break;
 		case  cs_PRJCOD_NACYL:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_TACYL:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			break;
 		case  cs_PRJCOD_BPCNC:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_P1LNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_P1LAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_P1LNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_P1LAT,cs_def->prj_prm2,paramFlags);
 			if (cs_def->prj_prm5 <= cs_Zero)
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_P2LNG,cs_def->prj_prm3,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_P2LAT,cs_def->prj_prm4,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_P2LNG,cs_def->prj_prm3,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_P2LAT,cs_def->prj_prm4,paramFlags);
 			}
 			else
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_ADP1P2,cs_def->prj_prm5,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_ADP1P2,cs_def->prj_prm5,paramFlags);
 			}
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_ADSP1,cs_def->prj_prm6,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_ADSP2,cs_def->prj_prm7,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_ADSP1,cs_def->prj_prm6,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_ADSP2,cs_def->prj_prm7,paramFlags);
 			break;
 		case  cs_PRJCOD_PSTRO:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			break;
 		case  cs_PRJCOD_PSTROSL:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_STDCIR,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_STDCIR,cs_def->prj_prm1,paramFlags);
 			
 			/* Kludge time again.  If the flavor is ESRI, we change the projection name based
 			   on the origin latitude.  Sorry about that, but this WKT stuff is maddening. */
@@ -1084,139 +1259,128 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			}
 			break;
 		case  cs_PRJCOD_OSTRO:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			break;
 		case  cs_PRJCOD_SSTRO:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			break;
 		case  cs_PRJCOD_LM1SP:
 		case  cs_PRJCOD_LMTAN:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_LM2SP:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
 			break;
 		case  cs_PRJCOD_LMBLG: 
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
 			break;
 		case  cs_PRJCOD_WCCSL:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GHGT,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm4,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GHGT,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm4,paramFlags);
 			break;
 		case  cs_PRJCOD_WCCST: 
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GHGT,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GHGT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm3,paramFlags);
 			break;
 		case  cs_PRJCOD_MNDOTL: 
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm3,paramFlags);
 			break;
 		case  cs_PRJCOD_MNDOTT: 
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm2,paramFlags);
 			break;
 		case  cs_PRJCOD_SOTRM:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
 			break;
 		case  cs_PRJCOD_UTM:
 			if (flavor == wktFlvrAutodesk)
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_UTMZN,cs_def->prj_prm1,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_HSNS,cs_def->prj_prm2,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_UTMZN,cs_def->prj_prm1,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_HSNS,cs_def->prj_prm2,paramFlags);
 			}
 			else
 			{
 				/* Switch the projection to Transverse Mercator */
-				csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),nmFlavor,csMapFlvrCsMap,"TM");
-				if (csMapSt != csMapOk)
-				{
-					/* If that didn't work, try to get the Autodesk name that
-					   appears in the mapping table. */
-					csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),csMapFlvrAutodesk,csMapFlvrCsMap,"TM");
-					if (csMapSt != csMapOk)
-					{
-						/* If that didn't work, use a default that is rational. */	
-						CS_stncp (projection,"Transverse_Mercator",sizeof (projection));
-					}
-				}
+				CSwktProjNameDflt (projection,sizeof (projection),nmFlavor,"TM","Transverse_Mercator");
 
 				/* Generate the standard UTM zone parameters from the zone and
 				   hemisphere which are in the definition. */
 				tmpDbl = 500000.00 / unitFactor;
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,tmpDbl,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,tmpDbl,paramFlags);
 				tmpDbl = (cs_def->prj_prm2 >= 0.0) ? 0.0 : 10000000.0;
 				tmpDbl /= unitFactor;
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,tmpDbl,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,tmpDbl,paramFlags);
 				tmpDbl = (double)(-183 + (6 * (int)cs_def->prj_prm1)); 				/*lint !e790 */
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,tmpDbl,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,0.9996,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_Zero,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,tmpDbl,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,0.9996,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_Zero,paramFlags);
 			}
 			break;
 		case  cs_PRJCOD_TRMRS:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_KROVAK:
 			if (flavor == wktFlvrAutodesk)
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_POLELNG,cs_def->prj_prm1,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_POLELAT,cs_def->prj_prm2,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_OSTDPLL,cs_def->prj_prm3,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_POLELNG,cs_def->prj_prm1,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_POLELAT,cs_def->prj_prm2,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_OSTDPLL,cs_def->prj_prm3,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			}
 			else
 			{
@@ -1226,20 +1390,20 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 				epsgParm = CSkrovkEpsgParam (e_rad,e_sq,cs_def->org_lng,cs_def->org_lat,cs_def->prj_prm2);
 
 				/* Produce the parameter string. */				
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLAT,cs_def->org_lat,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCAZM,epsgParm,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_OSTDPLL,cs_def->prj_prm3,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLAT,cs_def->org_lat,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCAZM,epsgParm,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_OSTDPLL,cs_def->prj_prm3,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			}
 			break;
 		case  cs_PRJCOD_MRCATK:
 			/* There are flavors of WKT that do not support this variation of the Mercator projection.
 			   In this case, we need to convert the scale reduction factor to a standard parallel
 			   value and output a standard Merctor.  Painful, but true. */
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
 			if (flavor == wktFlvrEsri || flavor == wktFlvrOracle || flavor == wktFlvrOracle9 || flavor == wktFlvrGeoTiff)
 			{
 				/* Compute the value of the standard parallel which produces the same
@@ -1248,59 +1412,48 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 				   the name of the projection back to the standard Mercator. */
 				e_sq = el_def->ecent * el_def->ecent;
 				stdParallel = CSmrcatPhiFromK (e_sq,cs_def->scl_red);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_STDPLL,stdParallel,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_STDPLL,stdParallel,paramFlags);
 
 				/* Switch the projection to Transverse Mercator */
-				csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),nmFlavor,csMapFlvrCsMap,"MRCAT");
-				if (csMapSt != csMapOk)
-				{
-					/* If that didn't work, try to get the Autodesk name that
-					   appears in the mapping table. */
-					csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),csMapFlvrAutodesk,csMapFlvrCsMap,"MRCAT");
-					if (csMapSt != csMapOk)
-					{
-						/* If that didn't work, use a default that is rational. */	
-						CS_stncp (projection,"Mercator",sizeof (projection));
-					}
-				}
+				CSwktProjNameDflt (projection,sizeof (projection),nmFlavor,"MRCAT","Mercator");
 			}
 			else
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			}
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
 			break;
 		case  cs_PRJCOD_KRVK95:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_POLELNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_POLELAT,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_OSTDPLL,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_POLELNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_POLELAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_OSTDPLL,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
 			break;
 		case  cs_PRJCOD_TRMERAF:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFA0,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFB0,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFA1,cs_def->prj_prm4,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFA2,cs_def->prj_prm5,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFB1,cs_def->prj_prm6,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFB2,cs_def->prj_prm7,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFA0,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFB0,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFA1,cs_def->prj_prm4,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFA2,cs_def->prj_prm5,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFB1,cs_def->prj_prm6,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFB2,cs_def->prj_prm7,paramFlags);
 			break;
 		case  cs_PRJCOD_OBQCYL:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NRMLPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NRMLPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
 			break;
 		case  cs_PRJCOD_SYS34:
 			/* Could add some code here for Oracle flavor, as they seem to support this
@@ -1309,113 +1462,113 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			   mapping table to have some way of getting the Oracle projection name
 			   from the name mapper.  Of course, in this case, there would be no
 			   parameters. */
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_DENRGN,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_DENRGN,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_OSTN97:
 			/* Noparameters required; it's all hard coded. */
 			break;
 		case  cs_PRJCOD_AZEDE:
- 			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+ 			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			/* For this variation, which is special to CS-MAP, we always output the
 			   Y Axis Azimuth parameter. */
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_YAXISAZ,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_YAXISAZ,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AELEV,cs_def->prj_prm2,paramFlags);
 			break;
 		case  cs_PRJCOD_OSTN02:
 			/* Noparameters required; it's all hard coded. */
 			break;
 		case  cs_PRJCOD_SYS34_99:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_DENRGN,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_DENRGN,cs_def->prj_prm1,paramFlags);
 			break;
 		case  cs_PRJCOD_TRMRKRG:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_WINKL:
- 			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm1,paramFlags);
+ 			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_STDPLL,cs_def->prj_prm1,paramFlags);
             break;
 		case  cs_PRJCOD_LMBRTAF:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFA0,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFB0,cs_def->prj_prm4,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFA1,cs_def->prj_prm5,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFA2,cs_def->prj_prm6,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFB1,cs_def->prj_prm7,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_AFB2,cs_def->prj_prm8,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_NSTDPLL,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SSTDPLL,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFA0,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFB0,cs_def->prj_prm4,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFA1,cs_def->prj_prm5,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFA2,cs_def->prj_prm6,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFB1,cs_def->prj_prm7,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_AFB2,cs_def->prj_prm8,paramFlags);
 			break;
 		case  cs_PRJCOD_HOM1UV:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCAZM,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCAZM,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLAT,cs_def->prj_prm2,paramFlags);
 			break;
 		case  cs_PRJCOD_HOM1XY:
 		case  cs_PRJCOD_RSKEW:
 		case  cs_PRJCOD_RSKEWC:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCAZM,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCAZM,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLAT,cs_def->prj_prm2,paramFlags);
 			break;
 		case  cs_PRJCOD_RSKEWO:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_SKWAZM,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_SKWAZM,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLAT,cs_def->prj_prm2,paramFlags);
 			break;
 		case  cs_PRJCOD_HOM2UV:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP1LNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP1LAT,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP2LNG,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP2LAT,cs_def->prj_prm4,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP1LNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP1LAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP2LNG,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP2LAT,cs_def->prj_prm4,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_HOM2XY:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP1LNG,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP1LAT,cs_def->prj_prm2,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP2LNG,cs_def->prj_prm3,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCP2LAT,cs_def->prj_prm4,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_def->scl_red,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP1LNG,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP1LAT,cs_def->prj_prm2,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP2LNG,cs_def->prj_prm3,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCP2LAT,cs_def->prj_prm4,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_GAUSSK:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->prj_prm1,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		case  cs_PRJCOD_SWISS:
 			if (flavor == wktFlvrAutodesk || flavor == wktFlvrOgc)
 			{
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
 			}
 			else
 			{
@@ -1425,34 +1578,23 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 				   projection.  Oh well!!!  Job security for you and me.
 				   
 				   First we obtain the flavored name of the RSKEWC projection. */	
-				csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),nmFlavor,csMapFlvrCsMap,"RSKEWC");
-				if (csMapSt != csMapOk)
-				{
-					/* If that didn't work, try to get the Autodesk name that
-					   appears in the mapping table. */
-					csMapSt = csMapNameToNameC (csMapProjectionKeyName,projection,sizeof (projection),csMapFlvrAutodesk,csMapFlvrCsMap,"RSKEWC");
-					if (csMapSt != csMapOk)
-					{
-						/* If that didn't work, use a default that is rational. */	
-						CS_stncp (projection,"Rectified Skew Orthomorphic, Origin & Azimuth at Center",sizeof (projection));
-					}
-				}
+				CSwktProjNameDflt (projection,sizeof (projection),nmFlavor,"RSKEWC","Rectified Skew Orthomorphic, Origin & Azimuth at Center");
 				
 				/* Output the appropriate parameters, using +90.0 as the Azimuth
 				   parameter. */
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_SCLRED,cs_One,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCAZM,cs_K90,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLNG,cs_def->org_lng,paramFlags);
-				CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_GCPLAT,cs_def->org_lat,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_SCLRED,cs_One,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCAZM,cs_K90,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLNG,cs_def->org_lng,paramFlags);
+				CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_GCPLAT,cs_def->org_lat,paramFlags);
 			}
 			break;
 		case  cs_PRJCOD_PCARREE:
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
-			CSAddParamValue (parmWkt,sizeof (parmWkt),nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FEAST,cs_def->x_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_FNORTH,cs_def->y_off,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_PRMCOD_CNTMER,cs_def->org_lng,paramFlags);
+			CSAddParamValue (parmWriter,nmFlavor,cs_WKTCOD_ORGLAT,cs_def->org_lat,paramFlags);
 			break;
 		}												/*lint !e744 */
 
@@ -1480,9 +1622,61 @@ int EXP_LVL3 CScs2WktEx (char *csWktBufr,size_t bufrSize,enum ErcWktFlavor flavo
 			}
 		}
 
-		/* Construct the final string. */
-		sprintf (projWkt,"PROJCS[\"%s\",%s,PROJECTION[\"%s\"]%s,%s%s]",csysWktName,geogWkt,projection,parmWkt,unitWkt,prjAxis);
-		CS_stncp (csWktBufr,projWkt,(int)bufrSize);
+	}
+
+	/* Construct the final string.  Nothing can fail from here on, so this
+	   is the only place where we write to csWkt. */
+	if ((prjPtr->flags & cs_PRJFLG_GEOGR) == 0)
+	{
+		csWkt.Append ("PROJCS[\"");
+		csWkt.Append (csysWktName);
+		csWkt.Append ("\",");
+	}
+	csWkt.Append ("GEOGCS[\"");
+	csWkt.Append (gcsNamePtr);
+	csWkt.Append ("\",");
+	csWkt.Append (datmWkt,datmWriter.GetLength ());
+	if (pmerName == 0)
+	{
+		csWkt.Append (",PRIMEM[\"Greenwich\",0]");
+	}
+	else
+	{
+		csWkt.Append (",PRIMEM[\"");
+		csWkt.Append (pmerName);
+		csWkt.Append ("\",");
+		csWkt.AppendFixed (primeMer,13,18);
+		csWkt.Append (']');
+	}
+	csWkt.Append (",UNIT[\"");
+	csWkt.Append (angUnitName);
+	if ((prjPtr->flags & cs_PRJFLG_GEOGR) == 0)
+	{
+		// This little bit of redundant nonsense is retained so as to prevent
+		// a regression tester from producing thousands of regression failures.
+		csWkt.Append ("\",0.017453292519943295]");
+	}
+	else
+	{
+		csWkt.Append ("\",");
+		csWkt.AppendFixed (unitFactor * cs_Degree,14);
+		csWkt.Append (']');
+	}
+	csWkt.Append (geoAxis);
+	csWkt.Append (']');
+	if ((prjPtr->flags & cs_PRJFLG_GEOGR) == 0)
+	{
+		csWkt.Append (",PROJECTION[\"");
+		csWkt.Append (projection);
+		csWkt.Append ("\"]");
+		csWkt.Append (parmWkt,parmWriter.GetLength ());
+		csWkt.Append (",UNIT[\"");
+		csWkt.Append (linUnitName);
+		csWkt.Append ("\",");
+		csWkt.AppendFixed (unitFactor,14);
+		csWkt.Append (']');
+		csWkt.Append (prjAxis);
+		csWkt.Append (']');
 	}
 	if (dtDefPtr != 0)
 	{
@@ -1507,86 +1701,28 @@ error:
 bool EXP_LVL3 CSgetParamNm (char* paramName,size_t paramSize,EcsNameFlavor nmFlavor,int paramCode)
 {
 	bool ok;
-	EcsMapSt nmSt;
 	const char *kCp;
 
-	ok = (paramCode >= 0 && paramCode <= cs_PRMCOD_MAXIDX) ||
-		 (paramCode >= cs_WKTCOD_FEAST && paramCode <= cs_WKTCOD_SCLRED) ||
-		 (paramCode >= cs_WKTCOD_DELTAX && paramCode <= cs_WKTCOD_BWSCAL);
+	/* CSwktParamName falls back to the CS-MAP name, and then to a name
+	   extracted from the CS-MAP parameter table, all of which is cached. */
+	kCp = CSwktParamName (nmFlavor,paramCode);
+	ok = (kCp != 0);
 	if (ok)
 	{
-		nmSt  = csMapIdToNameC (csMapParameterKeyName,paramName,paramSize,nmFlavor,csMapFlvrCsMap,paramCode);
-		if (nmSt != csMapOk)
-		{
-			/* If that didn't work, we just use the CS-MAP parameter name. */
-			nmSt  = csMapIdToNameC (csMapParameterKeyName,paramName,paramSize,csMapFlvrCsMap,csMapFlvrCsMap,paramCode);
-
-			/* If that didn't work, extract a parameter name from the CS-MAP parameter table. */
-			if (nmSt != csMapOk)
-			{
-				if (paramCode >= 0 && paramCode <= cs_PRMCOD_MAXIDX)
-				{
-					CS_stncp (paramName,csPrjprm[paramCode].label,sizeof (paramSize));
-				}
-				else
-				{
-					switch (paramCode) {
-					case cs_WKTCOD_FEAST:
-						kCp = "False Easting";
-						break;
-					case cs_WKTCOD_FNORTH:
-						kCp = "False Northing";
-						break;
-					case cs_WKTCOD_ORGLNG:
-						kCp = "Origin Longitude";
-						break;
-					case cs_WKTCOD_ORGLAT:
-						kCp = "Origin Latitude";
-						break;
-					case cs_WKTCOD_SCLRED:
-						kCp = "Scale Reduction";
-						break;
-					case cs_WKTCOD_DELTAX:
-						kCp = "Delta X";
-						break;
-					case cs_WKTCOD_DELTAY:
-						kCp = "Delta Y";
-						break;
-					case cs_WKTCOD_DELTAZ:
-						kCp = "Delta Z";
-						break;
-					case cs_WKTCOD_ROTATX:
-						kCp = "X Rotation";
-						break;
-					case cs_WKTCOD_ROTATY:
-						kCp = "Y Rotation";
-						break;
-					case cs_WKTCOD_ROTATZ:
-						kCp = "Z Rotation";
-						break;
-					case cs_WKTCOD_BWSCAL:
-						kCp = "Datum Scale";
-						break;
-					default:
-						kCp = "Parameter Value";
-						break;
-					}
-				}
-			}
-		}
+		CS_stncp (paramName,kCp,(int)paramSize);
 	}
 	return ok;
 }
-bool EXP_LVL3 CSAddParamValue (char* wktBufr,size_t bufrSize,EcsNameFlavor nmFlavor,int paramCode,double paramValue,unsigned paramFlags)
+bool CSAddParamValue (TcsWktWriter& parmWkt,EcsNameFlavor nmFlavor,int paramCode,double paramValue,unsigned paramFlags)
 {
 	bool ok;
-	int avail;
 	int precision;
+	const char *paramName;
 	char lclBufr [256];
-	char paramName [128];
 
 	precision = 6;
-	ok = CSgetParamNm (paramName,sizeof (paramName),nmFlavor,paramCode);
+	paramName = CSwktParamName (nmFlavor,paramCode);
+	ok = (paramName != 0);
 	if (ok)
 	{
 		if (paramCode >= 0 && paramCode <= cs_PRMCOD_MAXIDX)
@@ -1652,13 +1788,36 @@ bool EXP_LVL3 CSAddParamValue (char* wktBufr,size_t bufrSize,EcsNameFlavor nmFla
 		{
 			precision = 14;
 		}
-		sprintf (lclBufr,",PARAMETER[\"%s\",%.*f]",paramName,precision,paramValue);
-		avail = static_cast<int>(bufrSize - strlen (wktBufr)) - 1;
-		ok = avail >= static_cast<int>(strlen (lclBufr));
+		/* The parameter is added in its entirety, or not at all. */
+		TcsWktWriter lclWkt (lclBufr,sizeof (lclBufr));
+		lclWkt.Append (",PARAMETER[\"");
+		lclWkt.Append (paramName);
+		lclWkt.Append ("\",");
+		lclWkt.AppendFixed (paramValue,precision);
+		lclWkt.Append (']');
+		ok = lclWkt.IsOk () && parmWkt.Fits (lclWkt.GetLength ());
+		if (ok)
+		{
+			parmWkt.Append (lclBufr,lclWkt.GetLength ());
+		}
 	}
-	if (ok)
+	return ok;
+}
+/* Copies the nmFlavor name of the projection whose CS-MAP key name is
+   prjKeyName to the projection buffer; failing that the Autodesk name,
+   and failing that dfltName. */
+static void CSwktProjNameDflt (char* projection,size_t projSize,EcsNameFlavor nmFlavor,const char* prjKeyName,const char* dfltName)
+{
+	const char *kCp;
+
+	kCp = CSwktProjName (nmFlavor,prjKeyName);
+	if (kCp == 0)
 	{
-		strcat (wktBufr,lclBufr);
+		kCp = CSwktProjName (csMapFlvrAutodesk,prjKeyName);
+		if (kCp == 0)
+		{
+			kCp = dfltName;
+		}
 	}
-	return ok;
+	CS_stncp (projection,kCp,(int)projSize);
 }
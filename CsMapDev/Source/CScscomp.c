@@ -26,10 +26,6 @@
 */
 
 /*lint -esym(534,CS_atof) */					/* ignore return value */
-/*lint -esym(534,CS_csrd) */					/* ignore return value */
-/*lint -esym(534,CS_cswr) */					/* ignore return value */
-/*lint -esym(534,CS_fseek) */					/* ignore return value */
-/*lint -esym(534,CS_ips) */						/* ignore return value */
 /*lint -esym(534,CS_nampp) */					/* ignore return value */
 /*lint -esym(534,CSerpt) */						/* ignore return value */
 /*lint -esym(534,err_func) */					/* ignore return value */
@@ -86,6 +82,11 @@
 **	cs_CMPLR_TEST  -- Include test coordinate systems in output. Normally,
 **					  these are suppressed.
 **	cs_CMPLR_CRYPT -- Encrypt the output.
+**	cs_CMPLR_MAPPABLE -- Also write the mappable image of the output,
+**					  see CS_dictMap.c.
+**	cs_CMPLR_INCR  -- Incremental compilation, definitions which have not
+**					  changed since the previous incremental compilation
+**					  are not validated again, see CS_cmpTbl.c.
 **********************************************************************/
 
 #if _RUN_TIME == _rt_UNIXPCC || _RUN_TIME == _rt_SUN32 || _RUN_TIME == _rt_SUN64 || _RUN_TIME == _rt_MOSXUNIX || _RUN_TIME == _rt_HPUX
@@ -229,9 +230,8 @@ static double novalue = -1.1E+22;
 static double novalueTest = -1.0E+22;
 static int line_nbr;
 
-int CScsdefwr (	csFILE *outStrm,
+int CScsdefwr (	struct csCmpTbl_ *outTbl,
 				struct cs_Csdef_ *cs_def,
-				int crypt,
 				int warn,
 				csFILE *elStrm,
 				csFILE *dtStrm,
@@ -246,9 +246,6 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 						int (*err_func)(char *)
 					  )
 {																/*lint !e578 */
-#if _MEM_MODEL == _mm_VIRTUAL
-	extern int cs_Sortbs;
-#endif
 	extern struct cs_Prjtab_ cs_Prjtab [];
 	extern struct cs_Grptbl_ cs_CsGrptbl [];
 	extern short cs_QuadMin;
@@ -263,7 +260,6 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 	int test;
 	int warn;
 	int crypt;
-	int dummy;
 	int cancel;
 	int err_cnt;
 
@@ -289,14 +285,10 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 	char err_seg [18];
 	char buff [256];
 	char err_msg [256];
-	char last_nm [48];
 
 	__ALIGNMENT__2		/* For some versions of Sun compiler. */
 	struct cs_Csdef_ cs_def;
-
-#if _MEM_MODEL == _mm_VIRTUAL
-	cs_Sortbs = (512 * 1024);
-#endif
+	struct csCmpTbl_ outTbl;
 
 	demo = ((flags & cs_CMPLR_DEMO) != 0);
 	crypt = ((flags & cs_CMPLR_CRYPT) != 0);
@@ -372,10 +364,13 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 		elStrm = NULL;
 	}
 
-	/* Open the output file and write the magic number.  BINRW creates
-	   a new file with read/write access.  We need read/write as we
-	   will need to dort the result. */
-	outStrm = CS_fopen (outp,_STRM_BINRW);
+	/* The definitions are collected in memory, and written once sorted.
+	   In incremental mode, this also loads the previous output, so it
+	   must be done before the output file is created. */
+	CScmpTblInit (&outTbl,cs_CSDEF_MAGIC,flags,outp,datum,elipsoid);
+
+	/* Open the output file and write the magic number. */
+	outStrm = CS_fopen (outp,_STRM_BINWR);
 	if (outStrm == NULL)
 	{
 		sprintf (err_msg,"Couldn't open %s for output.",outp);
@@ -383,6 +378,7 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 		CS_fclose (inStrm);
 		if (dtStrm != NULL) CS_fclose (dtStrm);
 		if (elStrm != NULL) CS_fclose (elStrm);
+		CScmpTblFree (&outTbl);
 		return (1);
 	}
 
@@ -400,6 +396,7 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 		if (dtStrm != NULL) CS_fclose (dtStrm);
 		if (elStrm != NULL) CS_fclose (elStrm);
 		CS_remove (outp);
+		CScmpTblFinish (&outTbl,outp,FALSE);
 		return (1);
 	}
 
@@ -488,7 +485,7 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 			if (cs_def.key_nm [0] != '\0' &&   /* Skip first.*/
 				(test || CS_stricmp (cs_def.group,"TEST")))
 			{
-				st = CScsdefwr (outStrm,&cs_def,crypt,warn,dtStrm,elStrm,err_func);
+				st = CScsdefwr (&outTbl,&cs_def,warn,dtStrm,elStrm,err_func);
 				if (st >= 0) err_cnt += st;
 				else
 				{
@@ -855,7 +852,7 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 	/* Write out the last coordinate system if not in error. */
 	if (cs_def.key_nm [0] != '\0')
 	{
-		st = CScsdefwr (outStrm,&cs_def,crypt,warn,dtStrm,elStrm,err_func);
+		st = CScsdefwr (&outTbl,&cs_def,warn,dtStrm,elStrm,err_func);
 		if (st >= 0) err_cnt += st;
 		else
 		{
@@ -878,31 +875,36 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 	{
 		CS_fclose (outStrm);
 		CS_remove (outp);
+		CScmpTblFinish (&outTbl,outp,FALSE);
 		return (err_cnt);
 	}
 
-	/* Sort the file. */
-	CS_fseek (outStrm,(long)sizeof (magic),SEEK_SET);
-	CS_ips (outStrm,sizeof (cs_def),(long32_t)0,(CMPFUNC_CAST)CS_cscmp);
+	/* Sort the definitions, see if there are any duplicate names, and
+	   write them to the output file. */
+	err_cnt += CScmpTblWrite (&outTbl,outStrm,crypt,"Key name %s is used more than once.",err_func);
+	CS_fclose (outStrm);
 
-	/* Scan through the sorted file and see if there are any duplicate
-	   names. */
-	CS_fseek (outStrm,(long)sizeof (magic),SEEK_SET);
-	CS_csrd (outStrm,&cs_def,&dummy);
-	CS_stncp (last_nm,cs_def.key_nm,sizeof (last_nm));
-	while (!cancel && CS_csrd (outStrm,&cs_def,&dummy))
+	/* Produce the mappable image if requested, else make sure that
+	   the image of a previous compilation does not linger. */
+	if (err_cnt == 0)
 	{
-		if (!CS_stricmp (cs_def.key_nm,last_nm))
+		if ((flags & cs_CMPLR_MAPPABLE) != 0)
 		{
-			sprintf (err_msg,"Key name %s is used more than once.",last_nm);
-			cancel = (*err_func)(err_msg);
-			err_cnt += 1;
+			if (CSdictMapWrite (outp) != 0)
+			{
+				CS_errmsg (err_msg,sizeof (err_msg));
+				(*err_func)(err_msg);
+				err_cnt += 1;
+			}
+		}
+		else
+		{
+			CSdictMapRemove (outp);
 		}
-		CS_stncp (last_nm,cs_def.key_nm,sizeof (last_nm));
 	}
-	CS_fclose (outStrm);
 
 	/* Delete the ouput if there were errors. */
+	CScmpTblFinish (&outTbl,outp,(err_cnt == 0));
 	if (err_cnt != 0)
 	{
 		CS_remove (outp);
@@ -917,9 +919,8 @@ int EXP_LVL9 CScscomp (	Const char *inpt,
 	definition.
 */
 
-int CScsdefwr (	csFILE *outStrm,
+int CScsdefwr (	struct csCmpTbl_ *outTbl,
 				struct cs_Csdef_ *cs_def,
-				int crypt,
 				int warn,
 				csFILE *dtStrm,
 				csFILE *elStrm,
@@ -957,6 +958,13 @@ int CScsdefwr (	csFILE *outStrm,
 	for (ii = 0;ii < list_sz;ii += 1) err_list [ii] = 0;
 	err_cnt = 0;
 	cancel = FALSE;
+
+	/* An unchanged definition is taken as compiled previously. */
+	if (CScmpTblReuse (outTbl,cs_def))
+	{
+		return (0);
+	}
+
 	if (0!=CS_stricmp(cs_def->prj_knm, "NERTH"))
 	{
 		if (cs_def->dat_knm [0] == '\0' &&
@@ -1198,7 +1206,12 @@ int CScsdefwr (	csFILE *outStrm,
 		if (!CS_stricmp (cs_def->group,"TEST")) cs_def->protect = 4383;
 		cs_def->fill [0] = '\0';
 		cs_def->fill [1] = '\0';
-		CS_cswr (outStrm,cs_def,crypt);
+		if (CScmpTblAdd (outTbl,cs_def) != 0)
+		{
+			CS_errmsg (err_msg,sizeof (err_msg));
+			cancel = (*err_func)(err_msg);
+			err_cnt += 1;
+		}
 	}
 	if (warn && cs_def->desc_nm [0] == '\0')
 	{
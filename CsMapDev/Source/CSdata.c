@@ -81,6 +81,7 @@ wchar_t cs_EnvEndWC = L'}';
 #endif
 /* This is an 8 bit char on both platforms.  Trac Ticket #174. */
 char cs_NameMapperName [MAXPATH] = "NameMapper.csv";
+char cs_NameMapperImgName [MAXPATH] = cs_NMP_IMG_NAME;
 
 /*
 	The following are used in CS_atof and CS_ftoa for the
@@ -206,6 +207,38 @@ int cs_Sortbs = 128 * 1024;
 #else
 int cs_Sortbs = 24 * 1024;
 #endif
+/* Batch conversions of this many points, or more, are candidates for
+   processing in an order which follows the geography of the points rather
+   than the order given (see CSlocalityOrder).  Set to zero to disable. */
+int cs_LocalitySort = 64;
+
+/* When non-zero, the OSTN97, OSTN02, and OSGM91 grid objects load their
+   entire node arrays at construction, rather than buffering a window of
+   the binary file.  These grids are small enough for this to be the
+   default. */
+int cs_OsGridInMemory = 1;
+
+/* Large .byn files are read in tiles of whole records, about this many
+   bytes each, which are decoded once and kept in a least recently used
+   cache of cs_BynTileCount tiles.  Set cs_BynTileBytes to zero to use the
+   original sliding buffer. */
+long32_t cs_BynTileBytes = 65536L;
+int cs_BynTileCount = 16;
+
+/* When non-zero, CS_csdef, CS_dtdef, and CS_eldef satisfy requests from a
+   resident index of the coordinate system, datum, and ellipsoid
+   dictionaries.  Each index is built by reading the user and system
+   dictionary once, and is discarded by any update or deletion made through
+   this library, by a change of dictionary directory, and by CS_recvr.
+   Changes made to the dictionary files by other processes are not seen
+   while an index is resident. */
+int cs_DefIndex = 0;
+
+/* The results of this many successful CS_wktToCsEx conversions are retained,
+   keyed by a normalized rendition of the WKT string, so that a WKT string
+   seen before is resolved without parsing it again.  The cache is discarded
+   when the dictionaries change and by CS_recvr.  Set to zero to disable. */
+int cs_WktCacheSize = 256;
 int cs_Error = 0;
 int cs_Errno = 0;
 int csErrlng = 0;
@@ -236,8 +269,17 @@ int csDtcachI = cs_DTCACH_MAX;
 char *cs_CsKeyNames = NULL;
 char *cs_DtKeyNames = NULL;
 char *cs_ElKeyNames = NULL;
+
+/* Indices of the above lists, rebuilt along with the list; see
+   CSkeyIndexSetup in CS_guiApi.c. */
+char **cs_CsKeyIndex = NULL;
+int cs_CsKeyCount = 0;
+char **cs_DtKeyIndex = NULL;
+int cs_DtKeyCount = 0;
+char **cs_ElKeyIndex = NULL;
+int cs_ElKeyCount = 0;
+
 char *cs_CsLlEnum = NULL;
-struct cs_Csgrplst_ *cs_CsGrpList = NULL;
 
 /* Used for high level MGRS access. */
 struct cs_Mgrs_ *cs_MgrsPtr = NULL;
@@ -255,6 +297,10 @@ char csErrmsg [cs_ERRMSG_SIZE] = "<?>";
 /* The following carries a pointer to the category list. */
 struct cs_Ctdef_* cs_CtDefHead = NULL;
 
+/* The hash index of the category list; built upon first use and released
+   whenever the list is restructured. */
+struct cs_CtIndex_* cs_CtIndexP = NULL;
+
 /**********************************************************************
 	Hook function pointers.  Set to NULL to deativate.
 **********************************************************************/
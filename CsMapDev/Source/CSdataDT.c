@@ -31,6 +31,9 @@
 
 struct cs_GxIndex_* cs_GxIndex = NULL;
 unsigned cs_GxIndexCount = 0;
+int* cs_GxHashBuckets = NULL;
+unsigned cs_GxHashSize = 0;
+struct cs_GxHashNode_* cs_GxHashNodes = NULL;
 
 struct cs_XfrmTab_ cs_XfrmTab [] =
 {
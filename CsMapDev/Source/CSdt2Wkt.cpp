@@ -103,6 +103,22 @@ int EXP_LVL3 CSdt2Wkt (char *datum,size_t datumSize,char *geoTran,size_t geoTran
 	return st;
 }
 int EXP_LVL3 CSdt2WktEx (char *datum,size_t datumSize,char *geoTran,size_t geoTranSize,enum ErcWktFlavor flavor,const struct cs_Dtdef_ *dt_def,const struct cs_Eldef_ *el_def,unsigned short flags)
+{
+	int status;
+
+	if (datum != 0 && datumSize != 0) *datum = '\0';
+	if (geoTran != 0 && geoTranSize != 0) *geoTran = '\0';
+
+	TcsWktWriter dtWkt (datum,datumSize);
+	TcsWktWriter geoTranWkt (geoTran,geoTranSize);
+	status = CSdt2WktWrite ((datumSize > 1) ? &dtWkt : 0,(geoTranSize > 1) ? &geoTranWkt : 0,flavor,dt_def,el_def,flags);
+	return status;
+}
+/* Writes the DATUM element to dtWkt, and the GEOTRAN element to geoTranWkt.
+   Either may be null, in which case that element is not produced at all. */
+int CSdt2WktWrite (TcsWktWriter* dtWkt,TcsWktWriter* geoTranWkt,enum ErcWktFlavor flavor,const struct cs_Dtdef_ *dt_def,
+																						  const struct cs_Eldef_ *el_def,
+																						  unsigned short flags)
 {
 	bool ok;
     bool mapWktNames;
@@ -120,20 +136,16 @@ int EXP_LVL3 CSdt2WktEx (char *datum,size_t datumSize,char *geoTran,size_t geoTr
 	char wktDatumName [96];
 	char gcsDatumName [96];
 	char elWkt [256];
-	char dtWkt [512];
-	char geoCSdatum [512];
 	char geoCSwgs84 [] = "GEOGCS[\"WGS84.LL\",DATUM[\"WGS84\",SPHEROID[\"WGS84\",6378137,298.257223563]],PRIMEM[\"Greenwich\",0],UNIT[\"Degree\",0.017453292519943295]]";
-	char paramsWkt [512];
 	char geoTranName [96];
-	char geoTranWkt [1024];
 	char mappedDtName [96];
-	char prmNameXTr [96];
-	char prmNameYTr [96];
-	char prmNameZTr [96];
-	char prmNameXRot [96];
-	char prmNameYRot [96];
-	char prmNameZRot [96];
-	char prmNameScale [96];
+	const char *prmNameXTr;
+	const char *prmNameYTr;
+	const char *prmNameZTr;
+	const char *prmNameXRot;
+	const char *prmNameYRot;
+	const char *prmNameZRot;
+	const char *prmNameScale;
 
     // Prepare for some sort of parameter error.
    	CS_stcpy (csErrnam,"CSel2WktEx");
@@ -147,15 +159,13 @@ int EXP_LVL3 CSdt2WktEx (char *datum,size_t datumSize,char *geoTran,size_t geoTr
 
     nmFlavor = csWktFlvrToCsMapFlvr (flavor);
     mapWktNames = ((flags & cs_WKTFLG_MAPNAMES) != 0);
-	if (datum != 0 && datumSize != 0) *datum = '\0';
-	if (geoTran != 0 && geoTranSize != 0) *geoTran = '\0';
-	if ((datum == 0 || datumSize <= 1) &&
-	    (geoTran == 0 || geoTranSize <=1))
+	if (dtWkt == 0 && geoTranWkt == 0)
 	{
 	    CS_erpt (cs_INV_ARG1);
 	    return -(cs_Error);
 	}
 
+	TcsWktWriter elWriter (elWkt,sizeof (elWkt));
 	if (el_def == NULL)
 	{
 		elDef = CS_eldef (dt_def->ell_knm);
@@ -164,39 +174,24 @@ int EXP_LVL3 CSdt2WktEx (char *datum,size_t datumSize,char *geoTran,size_t geoTr
     	    CS_erpt (cs_WKT_INCNSIST);
     	    return -(cs_Error);
 		}
-		status = CSel2WktEx (elWkt,sizeof (elWkt),flavor,elDef,flags);
+		status = CSel2WktWrite (elWriter,flavor,elDef,flags);
 		CS_free (elDef);
 		if (status != 0)
 		{
-		    // CSel2WktEx should have reported the reason why.
+		    // CSel2WktWrite should have reported the reason why.
 			return -1;
 		}
 	}
 	else
 	{
-		status = CSel2WktEx (elWkt,sizeof (elWkt),flavor,el_def,flags);
+		status = CSel2WktWrite (elWriter,flavor,el_def,flags);
 		if (status != 0)
 		{
-		    // CSel2WktEx should have reported the reason why.
+		    // CSel2WktWrite should have reported the reason why.
 			return -1;
 		}
 	}
 
-	/* Set up the parameter names consistent with the flavor. */
-	ok  = CSgetParamNm (prmNameXTr,sizeof (prmNameXTr),nmFlavor,cs_WKTCOD_DELTAX);
-	ok |= CSgetParamNm (prmNameYTr,sizeof (prmNameYTr),nmFlavor,cs_WKTCOD_DELTAY);
-	ok |= CSgetParamNm (prmNameZTr,sizeof (prmNameZTr),nmFlavor,cs_WKTCOD_DELTAZ);
-	ok |= CSgetParamNm (prmNameXRot,sizeof (prmNameXRot),nmFlavor,cs_WKTCOD_ROTATX);
-	ok |= CSgetParamNm (prmNameYRot,sizeof (prmNameYRot),nmFlavor,cs_WKTCOD_ROTATY);
-	ok |= CSgetParamNm (prmNameZRot,sizeof (prmNameZRot),nmFlavor,cs_WKTCOD_ROTATZ);
-	ok |= CSgetParamNm (prmNameScale,sizeof (prmNameScale),nmFlavor,cs_WKTCOD_BWSCAL);
-	if (!ok)
-	{
-		CS_stncp (csErrnam,"CS_cs2Wkt:2",MAXPATH);
-		CS_erpt (cs_ISER);
-		return -1;
-	}
-
     if ((flags & cs_WKTFLG_MAPNAMES) == 0
         && (flavor == wktFlvrEsri || flavor == wktFlvrOracle))
     {
@@ -242,8 +237,6 @@ int EXP_LVL3 CSdt2WktEx (char *datum,size_t datumSize,char *geoTran,size_t geoTr
 			}
 		}
 	}
-	sprintf (dtWkt,"DATUM[\"%s\",%s]",wktDatumName,elWkt);
-	sprintf (geoCSdatum,"GEOGCS[\"%s\",%s,PRIMEM[\"Greenwich\",0],UNIT[\"Degree\",0.017453292519943295]]",gcsDatumName,dtWkt);
 
 	/* I suspect that there are different "flavors" of the following.  I'll have to
 	   do some more research before I know what they might be. */
@@ -299,106 +292,143 @@ int EXP_LVL3 CSdt2WktEx (char *datum,size_t datumSize,char *geoTran,size_t geoTr
 		break;
 	}
 
-	if (parmCount == 3)
-	{
-		sprintf (paramsWkt,"METHOD[\"%s\"],PARAMETER[\"%s\",%.4f],PARAMETER[\"%s\",%.4f],PARAMETER[\"%s\",%.4f]",
-															method,
-															prmNameXTr,dt_def->delta_X,
-															prmNameYTr,dt_def->delta_Y,
-															prmNameZTr,dt_def->delta_Z);
-	}
-	else if (parmCount == 7)
-	{
-		sprintf (paramsWkt,"METHOD[\"%s\"],PARAMETER[\"%s\",%.4f],PARAMETER[\"%s\",%.4f],PARAMETER[\"%s\",%.4f],"
-										  "PARAMETER[\"%s\",%.6f],PARAMETER[\"%s\",%.6f],PARAMETER[\"%s\",%.6f],"
-										  "PARAMETER[\"%s\",%.8f]",
-										  method,
-										  prmNameXTr,dt_def->delta_X,
-										  prmNameYTr,dt_def->delta_Y,
-										  prmNameZTr,dt_def->delta_Z,
-										  prmNameXRot,dt_def->rot_X,
-										  prmNameYRot,dt_def->rot_Y,
-										  prmNameZRot,dt_def->rot_Z,
-										  prmNameScale,dt_def->bwscale);
-	}
-	else if (parmCount == -3)
-	{
-		sprintf (paramsWkt,"METHOD[\"%s\"],PARAMETER[\"%s\",%.4f],PARAMETER[\"%s\",%.4f],PARAMETER[\"%s\",%.4f]",
-															method,
-															prmNameXTr,cs_Zero,
-															prmNameYTr,cs_Zero,
-															prmNameZTr,cs_Zero);
-	}
-	else
+	if (geoTranWkt != 0)
 	{
-		sprintf (paramsWkt,"METHOD[\"Unsupport_Method\"]");
-	}
+		/* Set up the parameter names consistent with the flavor. */
+		prmNameXTr   = CSwktParamName (nmFlavor,cs_WKTCOD_DELTAX);
+		prmNameYTr   = CSwktParamName (nmFlavor,cs_WKTCOD_DELTAY);
+		prmNameZTr   = CSwktParamName (nmFlavor,cs_WKTCOD_DELTAZ);
+		prmNameXRot  = CSwktParamName (nmFlavor,cs_WKTCOD_ROTATX);
+		prmNameYRot  = CSwktParamName (nmFlavor,cs_WKTCOD_ROTATY);
+		prmNameZRot  = CSwktParamName (nmFlavor,cs_WKTCOD_ROTATZ);
+		prmNameScale = CSwktParamName (nmFlavor,cs_WKTCOD_BWSCAL);
+		ok = (prmNameXTr  != 0 && prmNameYTr  != 0 && prmNameZTr  != 0 &&
+			  prmNameXRot != 0 && prmNameYRot != 0 && prmNameZRot != 0 && prmNameScale != 0);
+		if (!ok)
+		{
+			CS_stncp (csErrnam,"CS_cs2Wkt:2",MAXPATH);
+			CS_erpt (cs_ISER);
+			return -1;
+		}
 
-    if ((flags & cs_WKTFLG_MAPNAMES) == 0
-        && (flavor == wktFlvrEsri || flavor == wktFlvrOracle))
-    {
-        CS_stncp (geoTranName,dt_def->name,sizeof (geoTranName) - 15); 
-    }
-    else
-    {
-    	CS_stncp (geoTranName,dt_def->key_nm,sizeof (geoTranName) - 15); 
-    }
-    if (mapWktNames)
-    {
-	    csMapSt = csSysNameToNameC (csMapDatumKeyName,mappedDtName,
-                                                      sizeof (mappedDtName),
-                                                      nmFlavor,
-                                                      dt_def->key_nm);
-        if (csMapSt == csMapOk)
-        {
-		    if (flavor == wktFlvrEsri)
-		    {
-		        kCp = mappedDtName;
-		        if (*kCp == 'D' && *(kCp + 1) == '_')
-		        {
-		            kCp += 2;
-		        }
-			    CS_stncp (geoTranName,kCp,sizeof (geoTranName) - 15);
-		    }
-        }
-	}
-	strcat (geoTranName,"_To_WGS_1984");
-	sprintf (geoTranWkt,"GEOTRAN[\"%s\",%s,%s,%s]",geoTranName,geoCSdatum,geoCSwgs84,paramsWkt);
+		if ((flags & cs_WKTFLG_MAPNAMES) == 0
+			&& (flavor == wktFlvrEsri || flavor == wktFlvrOracle))
+		{
+			CS_stncp (geoTranName,dt_def->name,sizeof (geoTranName) - 15); 
+		}
+		else
+		{
+    		CS_stncp (geoTranName,dt_def->key_nm,sizeof (geoTranName) - 15); 
+		}
+		if (mapWktNames)
+		{
+			csMapSt = csSysNameToNameC (csMapDatumKeyName,mappedDtName,
+														  sizeof (mappedDtName),
+														  nmFlavor,
+														  dt_def->key_nm);
+			if (csMapSt == csMapOk)
+			{
+				if (flavor == wktFlvrEsri)
+				{
+					kCp = mappedDtName;
+					if (*kCp == 'D' && *(kCp + 1) == '_')
+					{
+						kCp += 2;
+					}
+					CS_stncp (geoTranName,kCp,sizeof (geoTranName) - 15);
+				}
+			}
+		}
+		strcat (geoTranName,"_To_WGS_1984");
 
-	/* We now redo the datum, this time we'll put the TOQGS84 thing in.
-	   However, it makes no sense to do this unless there are some valid
-	   paremeters. */
-	if (parmCount == 3 || parmCount == 7)
-	{
-		sprintf (dtWkt,"DATUM[\"%s\",%s,TOWGS84[%.4f,%.4f,%.4f,%.6f,%.6f,%.6f,%.8f]]",wktDatumName,elWkt,
-												dt_def->delta_X,dt_def->delta_Y,dt_def->delta_Z,
-												dt_def->rot_X,dt_def->rot_Y,dt_def->rot_Z,dt_def->bwscale);
-	}
-/******************************************************************************
-	Clients have indicated that this feature is rather undesireable; so we
-	comment it out, leaving the code intact, in case anyone has a different
-	opinion.
-		
-	else if (parmCount == -3)
-	{
-		sprintf (dtWkt,"DATUM[\"%s\",%s,TOWGS84[%.4f,%.4f,%.4f,%.6f,%.6f,%.6f,%.8f]]",wktDatumName,elWkt,
-												cs_Zero,cs_Zero,cs_Zero,
-												cs_Zero,cs_Zero,cs_Zero,cs_Zero);
+		/* GEOTRAN["name",GEOGCS["name",DATUM["name",SPHEROID[...]],PRIMEM[...],UNIT[...]],<WGS84 GEOGCS>,METHOD[...],PARAMETER[...]...] */
+		geoTranWkt->Append ("GEOTRAN[\"");
+		geoTranWkt->Append (geoTranName);
+		geoTranWkt->Append ("\",GEOGCS[\"");
+		geoTranWkt->Append (gcsDatumName);
+		geoTranWkt->Append ("\",DATUM[\"");
+		geoTranWkt->Append (wktDatumName);
+		geoTranWkt->Append ("\",");
+		geoTranWkt->Append (elWkt,elWriter.GetLength ());
+		geoTranWkt->Append ("],PRIMEM[\"Greenwich\",0],UNIT[\"Degree\",0.017453292519943295]],");
+		geoTranWkt->Append (geoCSwgs84);
+		geoTranWkt->Append (',');
+		if (parmCount == 3 || parmCount == 7 || parmCount == -3)
+		{
+			geoTranWkt->Append ("METHOD[\"");
+			geoTranWkt->Append (method);
+			geoTranWkt->Append ("\"],PARAMETER[\"");
+			geoTranWkt->Append (prmNameXTr);
+			geoTranWkt->Append ("\",");
+			geoTranWkt->AppendFixed ((parmCount == -3) ? cs_Zero : dt_def->delta_X,4);
+			geoTranWkt->Append ("],PARAMETER[\"");
+			geoTranWkt->Append (prmNameYTr);
+			geoTranWkt->Append ("\",");
+			geoTranWkt->AppendFixed ((parmCount == -3) ? cs_Zero : dt_def->delta_Y,4);
+			geoTranWkt->Append ("],PARAMETER[\"");
+			geoTranWkt->Append (prmNameZTr);
+			geoTranWkt->Append ("\",");
+			geoTranWkt->AppendFixed ((parmCount == -3) ? cs_Zero : dt_def->delta_Z,4);
+			geoTranWkt->Append (']');
+			if (parmCount == 7)
+			{
+				geoTranWkt->Append (",PARAMETER[\"");
+				geoTranWkt->Append (prmNameXRot);
+				geoTranWkt->Append ("\",");
+				geoTranWkt->AppendFixed (dt_def->rot_X,6);
+				geoTranWkt->Append ("],PARAMETER[\"");
+				geoTranWkt->Append (prmNameYRot);
+				geoTranWkt->Append ("\",");
+				geoTranWkt->AppendFixed (dt_def->rot_Y,6);
+				geoTranWkt->Append ("],PARAMETER[\"");
+				geoTranWkt->Append (prmNameZRot);
+				geoTranWkt->Append ("\",");
+				geoTranWkt->AppendFixed (dt_def->rot_Z,6);
+				geoTranWkt->Append ("],PARAMETER[\"");
+				geoTranWkt->Append (prmNameScale);
+				geoTranWkt->Append ("\",");
+				geoTranWkt->AppendFixed (dt_def->bwscale,8);
+				geoTranWkt->Append (']');
+			}
+		}
+		else
+		{
+			geoTranWkt->Append ("METHOD[\"Unsupport_Method\"]");
+		}
+		geoTranWkt->Append (']');
 	}
-******************************************************************************/
-	else
+
+	if (dtWkt != 0)
 	{
-		/* The datum type is one that is unsupported by WKT.  We simply write the
+		/* The TOWGS84 element is included only if there are some valid
+		   parameters.  Clients have indicated that a TOWGS84 element of all
+		   zeros for datums considered equivalent to WGS84 (parmCount == -3)
+		   is rather undesirable, so it is not produced in that case.  If the
+		   datum type is one that is unsupported by WKT, we simply write the
 		   datum definition with the name of the datum. */
-		sprintf (dtWkt,"DATUM[\"%s\",%s]",wktDatumName,elWkt);
-	}	
-	if (datumSize > 1)
-	{
-		CS_stncp (datum,dtWkt,(int)datumSize);
-	}
-	if (geoTranSize > 1)
-	{
-		CS_stncp (geoTran,geoTranWkt,(int)geoTranSize);
+		dtWkt->Append ("DATUM[\"");
+		dtWkt->Append (wktDatumName);
+		dtWkt->Append ("\",");
+		dtWkt->Append (elWkt,elWriter.GetLength ());
+		if (parmCount == 3 || parmCount == 7)
+		{
+			dtWkt->Append (",TOWGS84[");
+			dtWkt->AppendFixed (dt_def->delta_X,4);
+			dtWkt->Append (',');
+			dtWkt->AppendFixed (dt_def->delta_Y,4);
+			dtWkt->Append (',');
+			dtWkt->AppendFixed (dt_def->delta_Z,4);
+			dtWkt->Append (',');
+			dtWkt->AppendFixed (dt_def->rot_X,6);
+			dtWkt->Append (',');
+			dtWkt->AppendFixed (dt_def->rot_Y,6);
+			dtWkt->Append (',');
+			dtWkt->AppendFixed (dt_def->rot_Z,6);
+			dtWkt->Append (',');
+			dtWkt->AppendFixed (dt_def->bwscale,8);
+			dtWkt->Append (']');
+		}
+		dtWkt->Append (']');
 	}
 	return 0;
 }
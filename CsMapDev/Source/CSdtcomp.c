@@ -126,9 +126,8 @@ static double no_value = -1.5E+22;
 static double no_valueTest = -1.0E+22;
 static int line_nbr;
 
-int CSdtdefwr (	csFILE *outStrm,
+int CSdtdefwr (	struct csCmpTbl_ *outTbl,
 				struct cs_Dtdef_ *dtdef,
-				int crypt,
 				int warn,
 				csFILE *elStrm,
 				int (*err_func)(char *mesg)
@@ -160,6 +159,11 @@ int CSdtdefwr (	csFILE *outStrm,
 **	cs_CMPLR_DEMO  -- use demonstration magic numbers.
 **	cs_CMPLR_TEST  -- include test elements in the output.
 **					  Normally, test elements are suppressed.
+**	cs_CMPLR_MAPPABLE -- also write the mappable image of the output,
+**					  see CS_dictMap.c.
+**	cs_CMPLR_INCR  -- incremental compilation, definitions which have not
+**					  changed since the previous incremental compilation
+**					  are not validated again, see CS_cmpTbl.c.
 **
 **	Please excuse the rather crude way this program is written.
 **	It is necessary for this program to work in just about
@@ -178,7 +182,6 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 	int test;
 	int demo;
 	int warn;
-	int dummy;
 	int cancel;
 	int err_cnt;
 	int crypt;
@@ -199,10 +202,10 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 	char err_seg [18];
 	char buff [128];
 	char err_msg [128];
-	char last_name [48];
 
 	__ALIGNMENT__2		/* For some versions of Sun compiler. */
 	struct cs_Dtdef_ dtdef;
+	struct csCmpTbl_ outTbl;
 
 	crypt = ((flags & cs_CMPLR_CRYPT) != 0);
 	demo  = ((flags & cs_CMPLR_DEMO) != 0);
@@ -218,14 +221,19 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 		return (1);
 	}
 
-	/* Open the output file and write the magic number.  BINRW mode
-	   creates a new file with read and write access. */
-	outStrm = CS_fopen (outp,_STRM_BINRW);
+	/* The definitions are collected in memory, and written once sorted.
+	   In incremental mode, this also loads the previous output, so it
+	   must be done before the output file is created. */
+	CScmpTblInit (&outTbl,cs_DTDEF_MAGIC,flags,outp,elipsoid,NULL);
+
+	/* Open the output file and write the magic number. */
+	outStrm = CS_fopen (outp,_STRM_BINWR);
 	if (outStrm == NULL)
 	{
 		sprintf (err_msg,"Couldn't open %s for output.",outp);
 		cancel = (*err_func)(err_msg);
 		CS_fclose (inStrm);
+		CScmpTblFree (&outTbl);
 		return (1);
 	}
 	if (demo) magic = cs_DTDEF_MAGIC;
@@ -239,6 +247,7 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 		CS_fclose (outStrm);
 		CS_remove (outp);										/*lint !e534 */
 		CS_fclose (inStrm);
+		CScmpTblFinish (&outTbl,outp,FALSE);
 		return (1);
 	}
 
@@ -251,6 +260,7 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 			sprintf (err_msg,"Couldn't open %s as an Ellipsoid Dictionary.",elipsoid);
 			cancel = (*err_func)(err_msg);
 			CS_fclose (inStrm);
+			CScmpTblFinish (&outTbl,outp,FALSE);
 			return (1);
 		}
 		rdCnt = CS_fread (&magic,1,sizeof (magic),elStrm);
@@ -263,6 +273,7 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 			cancel = (*err_func)(err_msg);
 			CS_fclose (inStrm);
 			CS_fclose (elStrm);
+			CScmpTblFinish (&outTbl,outp,FALSE);
 			return (1);
 		}
 	}
@@ -292,6 +303,7 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 			CS_fclose (outStrm);
 			if (elStrm != NULL) CS_fclose (elStrm);
 			CS_remove (outp);										/*lint !e534 */
+			CScmpTblFinish (&outTbl,outp,FALSE);
 			return (err_cnt);
 		}
 		line_nbr += 1;
@@ -351,7 +363,7 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 			if (dtdef.key_nm [0] != '\0' &&		/* Skip 1st one. */
 				(test || CS_stricmp (dtdef.group,"TEST")))
 			{
-				st = CSdtdefwr (outStrm,&dtdef,crypt,warn,elStrm,err_func);
+				st = CSdtdefwr (&outTbl,&dtdef,warn,elStrm,err_func);
 				if (st >= 0) err_cnt += st;
 				else
 				{
@@ -538,7 +550,7 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 	/* Write out the last coordinate system if not in error. */
 	if (dtdef.key_nm [0] != '\0' && (test || CS_stricmp (dtdef.group,"TEST")))
 	{
-		st = CSdtdefwr (outStrm,&dtdef,crypt,warn,elStrm,err_func);
+		st = CSdtdefwr (&outTbl,&dtdef,warn,elStrm,err_func);
 		if (st >= 0) err_cnt += st;
 		else
 		{
@@ -551,30 +563,36 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 	{
 		CS_fclose (outStrm);
 		CS_remove (outp);										/*lint !e534 */
+		CScmpTblFinish (&outTbl,outp,FALSE);
 		return (err_cnt);
 	}
 
-	/* Sort the output file. */
-	CS_fseek (outStrm,(long)sizeof (magic),SEEK_SET);
-	CS_ips (outStrm,sizeof (dtdef),0L,(CMPFUNC_CAST)CS_dtcmp);		/*lint !e534 */
+	/* Sort the definitions, verify that there are no duplicates, and
+	   write them to the output file. */
+	err_cnt += CScmpTblWrite (&outTbl,outStrm,crypt,"Datum key name %s appears more than once.",err_func);
+	CS_fclose (outStrm);
 
-	/* Verify that there are no duplicates. */
-	CS_fseek (outStrm,(long)sizeof (magic),0);
-	CS_dtrd (outStrm,&dtdef,&dummy);								/*lint !e534 */
-	CS_stncp (last_name,dtdef.key_nm,sizeof (last_name));
-	while (!cancel && CS_dtrd (outStrm,&dtdef,&dummy) != 0)
+	/* Produce the mappable image if requested, else make sure that
+	   the image of a previous compilation does not linger. */
+	if (err_cnt == 0)
 	{
-		if (!CS_stricmp (dtdef.key_nm,last_name))
+		if ((flags & cs_CMPLR_MAPPABLE) != 0)
 		{
-			sprintf (err_msg,"Datum key name %s appears more than once.",last_name);
-			cancel = (*err_func)(err_msg);
-			err_cnt += 1;
+			if (CSdictMapWrite (outp) != 0)
+			{
+				CS_errmsg (err_msg,sizeof (err_msg));
+				(*err_func)(err_msg);
+				err_cnt += 1;
+			}
+		}
+		else
+		{
+			CSdictMapRemove (outp);
 		}
-		CS_stncp (last_name,dtdef.key_nm,sizeof (last_name));
 	}
-	CS_fclose (outStrm);
 
 	/* Remove the output file if there were errors. */
+	CScmpTblFinish (&outTbl,outp,(err_cnt == 0));
 	if (err_cnt != 0)
 	{
 		CS_remove (outp);										/*lint !e534 */
@@ -582,9 +600,8 @@ int EXP_LVL9 CSdtcomp (	Const char *inpt,
 	return (err_cnt);
 }
 
-int CSdtdefwr (	csFILE *outStrm,
+int CSdtdefwr (	struct csCmpTbl_ *outTbl,
 				struct cs_Dtdef_ *dtdef,
-				int crypt,
 				int warn,
 				csFILE *elStrm,
 				int (*err_func)(char *mesg)
@@ -608,6 +625,12 @@ int CSdtdefwr (	csFILE *outStrm,
 
 	err_cnt = 0;
 	cancel = 0;
+
+	/* An unchanged definition is taken as compiled previously. */
+	if (CScmpTblReuse (outTbl,dtdef))
+	{
+		return (0);
+	}
 	
 	if (dtdef->to84_via == cs_DTCTYP_NONE)
 	{
@@ -802,7 +825,12 @@ int CSdtdefwr (	csFILE *outStrm,
 		if (!CS_stricmp (dtdef->group,"TEST")) dtdef->protect = 4383;
 		dtdef->fill [0] = '\0';
 		dtdef->fill [1] = '\0';
-		CS_dtwr (outStrm,dtdef,crypt);					/*lint !e534 */
+		if (CScmpTblAdd (outTbl,dtdef) != 0)
+		{
+			CS_errmsg (err_msg,sizeof (err_msg));
+			cancel = (*err_func)(err_msg);
+			err_cnt += 1;
+		}
 	}
 	if (warn && dtdef->name [0] == '\0')
 	{
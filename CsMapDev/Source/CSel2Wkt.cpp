@@ -90,15 +90,6 @@ int EXP_LVL3 CSel2Wkt (char *bufr,size_t bufrSize,enum ErcWktFlavor flavor,const
 }
 int EXP_LVL3 CSel2WktEx (char *bufr,size_t bufrSize,enum ErcWktFlavor flavor,const struct cs_Eldef_ *el_def,unsigned short flags)
 { 
-	short mapWktNames;
-	EcsMapSt csMapSt;
-    EcsNameFlavor nmFlavor;
-	Const char* kCp;
-	double rcpFlattening = 0.0;
-
-	char wktEllipsoidName [96];
-	char cTemp [1024];
-
    	CS_stcpy (csErrnam,"CSel2WktEx");
 	if (bufr == 0)
 	{
@@ -111,7 +102,19 @@ int EXP_LVL3 CSel2WktEx (char *bufr,size_t bufrSize,enum ErcWktFlavor flavor,con
 	    return -(cs_Error);
 	}
 
-    *bufr = '\0';
+	TcsWktWriter elWkt (bufr,bufrSize);
+	return CSel2WktWrite (elWkt,flavor,el_def,flags);
+}
+int CSel2WktWrite (TcsWktWriter& elWkt,enum ErcWktFlavor flavor,const struct cs_Eldef_ *el_def,unsigned short flags)
+{ 
+	short mapWktNames;
+	EcsMapSt csMapSt;
+    EcsNameFlavor nmFlavor;
+	Const char* kCp;
+	double rcpFlattening = 0.0;
+
+	char wktEllipsoidName [96];
+
     nmFlavor = csWktFlvrToCsMapFlvr (flavor);
     mapWktNames = ((flags & cs_WKTFLG_MAPNAMES) != 0);
 
@@ -150,7 +153,14 @@ int EXP_LVL3 CSel2WktEx (char *bufr,size_t bufrSize,enum ErcWktFlavor flavor,con
 		    CS_stncp (wktEllipsoidName,el_def->key_nm,sizeof (wktEllipsoidName));
 	    }
 	}
-	sprintf (cTemp,"SPHEROID[\"%s\",%.3f,%.8f]",wktEllipsoidName,el_def->e_rad,rcpFlattening);
-	CS_stncp (bufr,cTemp,(int)bufrSize);
+
+	/* SPHEROID["name",%.3f,%.8f] */
+	elWkt.Append ("SPHEROID[\"");
+	elWkt.Append (wktEllipsoidName);
+	elWkt.Append ("\",");
+	elWkt.AppendFixed (el_def->e_rad,3);
+	elWkt.Append (',');
+	elWkt.AppendFixed (rcpFlattening,8);
+	elWkt.Append (']');
 	return 0;
 }
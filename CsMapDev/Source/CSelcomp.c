@@ -84,6 +84,8 @@ int CSeldefwr (	csFILE *outStrm,
 **	cs_CMPLR_DEMO  -- use DEMO magic numbers.
 **	cs_CMPLR_TEST  -- include test elements in outut.  Normally,
 **					  these are suppressed.
+**	cs_CMPLR_MAPPABLE -- also write the mappable image of the output,
+**					  see CS_dictMap.c.
 **
 **	Please excuse the rather crude nature of this program.  However,
 **	it is necessary for this program to be compiled, linked, and
@@ -348,6 +350,25 @@ int EXP_LVL9 CSelcomp (	Const char *inpt,
 	}
 	CS_fclose (outStrm);
 	
+	/* Produce the mappable image if requested, else make sure that
+	   the image of a previous compilation does not linger. */
+	if (err_cnt == 0)
+	{
+		if ((flags & cs_CMPLR_MAPPABLE) != 0)
+		{
+			if (CSdictMapWrite (outp) != 0)
+			{
+				CS_errmsg (err_msg,sizeof (err_msg));
+				(*err_func)(err_msg);
+				err_cnt += 1;
+			}
+		}
+		else
+		{
+			CSdictMapRemove (outp);
+		}
+	}
+
 	/* If there were any errors, delete the output file and
 	   exit now. */
 	if (err_cnt > 0)
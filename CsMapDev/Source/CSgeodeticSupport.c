@@ -117,22 +117,31 @@ void CSinitGridCell (struct csGridCell_* thisPtr)
 	thisPtr->currentDD = cs_Zero;
 	thisPtr->sourceId [0] = '\0';
 }
+void CSgatherGridCell (struct csGridCell_* thisPtr,double coefs [4],double delta [2],Const double *sourceLL)
+{
+	/* Extracts from the grid cell what the bilinear kernel needs to perform
+	   the interpolation for the provided point: the four coefficients and
+	   the position of the point within the cell normalized to the size of
+	   the cell. */
+	coefs [0] = thisPtr->currentAA;
+	coefs [1] = thisPtr->currentBB;
+	coefs [2] = thisPtr->currentCC;
+	coefs [3] = thisPtr->currentDD;
+	delta [0] = (sourceLL [LNG] - thisPtr->coverage.southWest [LNG]) / thisPtr->deltaLng;
+	delta [1] = (sourceLL [LAT] - thisPtr->coverage.southWest [LAT]) / thisPtr->deltaLat;
+}
 double CScalcGridCell (struct csGridCell_* thisPtr,Const double *sourceLL)
 {
 	/* This function performs the interpolation of the grid cell, and
 	   returns the result.  Type of result depends upon the application.
 	   Calculation algorithm is the same for most all applications. */
 
-	double gridDeltaLng;
-	double gridDeltaLat;
+	double delta [2];
+	double coefs [1][4];
 	double returnValue;
 
-	gridDeltaLng  = (sourceLL [LNG] - thisPtr->coverage.southWest [LNG]) / thisPtr->deltaLng;
-	gridDeltaLat  = (sourceLL [LAT] - thisPtr->coverage.southWest [LAT]) / thisPtr->deltaLat;
-	returnValue = thisPtr->currentAA + 
-				  thisPtr->currentBB * gridDeltaLng +
-				  thisPtr->currentCC * gridDeltaLat +
-				  thisPtr->currentDD * gridDeltaLng * gridDeltaLat;
+	CSgatherGridCell (thisPtr,coefs [0],delta,sourceLL);
+	CSbilinearInterp (&returnValue,&delta [0],&delta [1],coefs,1);
 
 	/* Note return value for datum shift grid files is usually in seconds.
 	   However, this varies from application to application. */
@@ -142,3 +151,410 @@ const char *CSsourceGridCell (struct csGridCell_* thisPtr)
 {
 	return thisPtr->sourceId;
 }
+
+/******************************************************************************
+*******************************************************************************
+**                 Shared  Grid  Interpolation  Kernels                      **
+*******************************************************************************
+******************************************************************************/
+/*
+	All of the grid file formats supported by CS-MAP end up doing one of two
+	calculations: a bilinear interpolation of a four node cell, or (Geoid96,
+	Geoid99, GEOCON, and .byn files) a biquadratic interpolation of a three
+	by three node cell.  The functions in this section are the only place
+	these calculations are actually performed.  The scalar calculators of the
+	various formats, and the batch calculators below, all come through here.
+
+	The kernels operate on arrays; one element per point.  Each point carries
+	its own normalized offsets into its cell and its own copy of the cell
+	data (gathered by the format specific code).  The loops are deliberately
+	simple, free of function calls and branches, so that any reasonable
+	optimizing compiler will vectorize them.  No compiler specific intrinsics
+	are used; portability remains the prime directive.
+
+	For the bilinear kernel, the cell data is the AA, BB, CC, and DD
+	coefficients as computed by CSbilinearCoefs from the four corner nodes.
+	Coefficients are used (as opposed to the raw node values) so that a
+	cell's coefficients are computed once when the cell is fetched, and so
+	that the results produced are identical to those produced by CS-MAP for
+	many, many years.
+
+	For the biquadratic kernel, the nine node values are organized as three
+	rows of three values each; the delta values being the offset, in cell
+	units, from the first node of the first row.  What is north, south, east,
+	and west is up to the format specific code which gathers the nodes.
+*/
+void CSbilinearCoefs (double coefs [4],double refNode,double xNode,double yNode,double xyNode)
+{
+	/* refNode is the node at the reference corner of the cell; xNode is
+	   the node adjacent in the X (i.e. longitude) direction, yNode is the
+	   node adjacent in the Y (i.e. latitude) direction, and xyNode is the
+	   node diagonally opposite the reference corner. */
+	coefs [0] = refNode;
+	coefs [1] = xNode - refNode;
+	coefs [2] = yNode - refNode;
+	coefs [3] = xyNode - xNode - yNode + refNode;
+}
+void CSbilinearInterp (double results [],Const double deltaX [],Const double deltaY [],
+														 Const double coefs [][4],
+														 int count)
+{
+	int idx;
+
+	for (idx = 0;idx < count;idx += 1)
+	{
+		results [idx] = coefs [idx][0] +
+						coefs [idx][1] * deltaX [idx] +
+						coefs [idx][2] * deltaY [idx] +
+						coefs [idx][3] * deltaX [idx] * deltaY [idx];
+	}
+}
+void CSbiquadInterp (double results [],Const double deltaX [],Const double deltaY [],
+													   Const double nodes [][9],
+													   int count)
+{
+	extern double cs_One;
+	extern double cs_Half;
+
+	int idx;
+	double dx, dy;
+	double tmpX, tmpY;
+	double f0, f1, f2;
+
+	/* This is the CSgeoidQterp1 calculation applied to each of the three rows
+	   and then to the three row results, written out in-line.  The order of
+	   the arithmetic is the same as that of the original so as to produce
+	   bit for bit identical results. */
+	for (idx = 0;idx < count;idx += 1)
+	{
+		dx = deltaX [idx];
+		dy = deltaY [idx];
+		tmpX = cs_Half * dx * (dx - cs_One);
+		tmpY = cs_Half * dy * (dy - cs_One);
+
+		f0 = nodes [idx][0] + dx * (nodes [idx][1] - nodes [idx][0]) +
+							  tmpX * ((nodes [idx][2] - nodes [idx][1]) - (nodes [idx][1] - nodes [idx][0]));
+		f1 = nodes [idx][3] + dx * (nodes [idx][4] - nodes [idx][3]) +
+							  tmpX * ((nodes [idx][5] - nodes [idx][4]) - (nodes [idx][4] - nodes [idx][3]));
+		f2 = nodes [idx][6] + dx * (nodes [idx][7] - nodes [idx][6]) +
+							  tmpX * ((nodes [idx][8] - nodes [idx][7]) - (nodes [idx][7] - nodes [idx][6]));
+		results [idx] = f0 + dy * (f1 - f0) + tmpY * ((f2 - f1) - (f1 - f0));
+	}
+}
+/*
+	Batch drivers.  These take an array of points, use the format specific
+	"gather" function provided to fetch the cell data for each point (which
+	is very cheap when the point is covered by the cell used for the previous
+	point), and then apply the appropriate kernel to a block of points at a
+	time.  Points for which the gather function returns a positive status
+	(no coverage, no data, etc.) receive the noData value; a negative status
+	(a system error of some sort) terminates the batch, and that point and all
+	remaining points receive the noData value and the negative status.
+
+	The status array is optional; if provided, it receives the status of
+	each individual point.  Return value is the largest status value
+	encountered, or csGRIDI_ST_SYSTEM if a system error was encountered.
+*/
+int CSbilinearBatch (void* gridFile,csGatherBilinearFunc gather,double results [],
+																int status [],
+																Const double sourceLL [][3],
+																int count,
+																double noData)
+{
+	int idx;
+	int blkIdx;
+	int blkCnt;
+	int ptStatus;
+	int rtnValue;
+
+	int blkPos [csGRIDI_BATCH];
+	double blkDelta [2];
+	double blkDeltaX [csGRIDI_BATCH];
+	double blkDeltaY [csGRIDI_BATCH];
+	double blkResult [csGRIDI_BATCH];
+	double blkCoefs [csGRIDI_BATCH][4];
+
+	rtnValue = csGRIDI_ST_OK;
+	for (idx = 0;idx < count;)
+	{
+		/* Gather a block of points. */
+		for (blkCnt = 0;idx < count && blkCnt < csGRIDI_BATCH;idx += 1)
+		{
+			ptStatus = (*gather)(gridFile,blkCoefs [blkCnt],blkDelta,sourceLL [idx]);
+			if (status != NULL) status [idx] = ptStatus;
+			if (ptStatus < 0)
+			{
+				for (;idx < count;idx += 1)
+				{
+					results [idx] = noData;
+					if (status != NULL) status [idx] = ptStatus;
+				}
+				rtnValue = csGRIDI_ST_SYSTEM;
+				break;
+			}
+			if (ptStatus > 0)
+			{
+				results [idx] = noData;
+				if (ptStatus > rtnValue) rtnValue = ptStatus;
+				continue;
+			}
+			blkDeltaX [blkCnt] = blkDelta [0];
+			blkDeltaY [blkCnt] = blkDelta [1];
+			blkPos [blkCnt] = idx;
+			blkCnt += 1;
+		}
+
+		/* Interpolate the block, and scatter the results back. */
+		CSbilinearInterp (blkResult,blkDeltaX,blkDeltaY,blkCoefs,blkCnt);
+		for (blkIdx = 0;blkIdx < blkCnt;blkIdx += 1)
+		{
+			results [blkPos [blkIdx]] = blkResult [blkIdx];
+		}
+		if (rtnValue < 0) break;
+	}
+	return rtnValue;
+}
+int CSbiquadBatch (void* gridFile,csGatherBiquadFunc gather,double results [],
+															int status [],
+															Const double sourceLL [][3],
+															int count,
+															double noData)
+{
+	int idx;
+	int blkIdx;
+	int blkCnt;
+	int ptStatus;
+	int rtnValue;
+
+	int blkPos [csGRIDI_BATCH];
+	double blkDelta [2];
+	double blkDeltaX [csGRIDI_BATCH];
+	double blkDeltaY [csGRIDI_BATCH];
+	double blkResult [csGRIDI_BATCH];
+	double blkNodes [csGRIDI_BATCH][9];
+
+	rtnValue = csGRIDI_ST_OK;
+	for (idx = 0;idx < count;)
+	{
+		for (blkCnt = 0;idx < count && blkCnt < csGRIDI_BATCH;idx += 1)
+		{
+			ptStatus = (*gather)(gridFile,blkNodes [blkCnt],blkDelta,sourceLL [idx]);
+			if (status != NULL) status [idx] = ptStatus;
+			if (ptStatus < 0)
+			{
+				for (;idx < count;idx += 1)
+				{
+					results [idx] = noData;
+					if (status != NULL) status [idx] = ptStatus;
+				}
+				rtnValue = csGRIDI_ST_SYSTEM;
+				break;
+			}
+			if (ptStatus > 0)
+			{
+				results [idx] = noData;
+				if (ptStatus > rtnValue) rtnValue = ptStatus;
+				continue;
+			}
+			blkDeltaX [blkCnt] = blkDelta [0];
+			blkDeltaY [blkCnt] = blkDelta [1];
+			blkPos [blkCnt] = idx;
+			blkCnt += 1;
+		}
+		CSbiquadInterp (blkResult,blkDeltaX,blkDeltaY,blkNodes,blkCnt);
+		for (blkIdx = 0;blkIdx < blkCnt;blkIdx += 1)
+		{
+			results [blkPos [blkIdx]] = blkResult [blkIdx];
+		}
+		if (rtnValue < 0) break;
+	}
+	return rtnValue;
+}
+
+/******************************************************************************
+*******************************************************************************
+**                Locality Ordering of Batch Grid Lookups                    **
+*******************************************************************************
+******************************************************************************/
+/*
+	All of the grid file objects keep the last cell used (or a window of the
+	file) in memory, so consecutive points which fall in the same area of a
+	grid are processed very quickly.  Points which arrive in some other
+	order (e.g. feature ID order) tend to jump all over the coverage area
+	and defeat all of this.  The functions in this section produce an
+	ordering of a batch of points which follows a Hilbert curve across the
+	bounding box of the batch, so that points which are close to each other
+	geographically are processed consecutively.
+
+	CSlocalityOrder returns zero, and leaves the order array untouched, if
+	the batch is not worth sorting: i.e. it is smaller than cs_LocalitySort
+	or it is already spatially coherent (in which case sorting it would
+	simply waste time).  Otherwise, it returns +1 and order [n] is the index
+	of the point which is to be processed n'th.  Points with a NaN or
+	infinite coordinate have no place on the curve; they are placed at the
+	end of the order, in the order given.  A negative return indicates a
+	memory allocation failure, which has been reported.
+*/
+struct csLocalityKey_
+{
+	ulong32_t key;
+	int invalid;
+	int index;
+};
+static int CScompareLocalityKey (Const void* pp,Const void* qq)
+{
+	Const struct csLocalityKey_* pPtr;
+	Const struct csLocalityKey_* qPtr;
+
+	pPtr = (Const struct csLocalityKey_*)pp;
+	qPtr = (Const struct csLocalityKey_*)qq;
+	if (pPtr->invalid != qPtr->invalid) return pPtr->invalid - qPtr->invalid;
+	if (pPtr->key < qPtr->key) return -1;
+	if (pPtr->key > qPtr->key) return  1;
+	return pPtr->index - qPtr->index;
+}
+/* Returns TRUE if both coordinates of the point are finite, i.e. neither
+   NaN nor infinite. */
+static int CSlocalityValid (Const double ll [3])
+{
+	return !CS_isnan (ll [LNG] - ll [LNG]) && !CS_isnan (ll [LAT] - ll [LAT]);
+}
+/* Quantizes a coordinate to the range 0 thru 0xFFFF.  The comparisons are
+   arranged such that a NaN (the result of an infinite extent, for example)
+   is never converted to an integer. */
+static ulong32_t CSlocalityQuantize (double value,double minValue,double scale)
+{
+	double qq;
+
+	qq = (value - minValue) * scale + 0.5;
+	if (!(qq >= 0.0)) return 0UL;
+	if (!(qq < 65535.0)) return 0xFFFFUL;
+	return (ulong32_t)qq;
+}
+/* Returns the distance along a Hilbert curve of order 16 of the point whose
+   quantized coordinates are given.  Each coordinate is in the range of
+   0 thru 0xFFFF, the result fits in 32 bits. */
+static ulong32_t CShilbertKey (ulong32_t xx,ulong32_t yy)
+{
+	ulong32_t ss;
+	ulong32_t rx;
+	ulong32_t ry;
+	ulong32_t tmp;
+	ulong32_t key;
+
+	key = 0UL;
+	for (ss = 0x8000UL;ss > 0UL;ss >>= 1)
+	{
+		rx = ((xx & ss) != 0UL);
+		ry = ((yy & ss) != 0UL);
+		key += ss * ss * ((3UL * rx) ^ ry);
+		if (ry == 0UL)
+		{
+			if (rx == 1UL)
+			{
+				xx = 0xFFFFUL - xx;
+				yy = 0xFFFFUL - yy;
+			}
+			tmp = xx;
+			xx = yy;
+			yy = tmp;
+		}
+	}
+	return key;
+}
+int CSlocalityOrder (int order [],Const double ll [][3],int count)
+{
+	extern int cs_LocalitySort;
+
+	int idx;
+	int jumps;
+	int valid;
+	int haveLast;
+	ulong32_t xx, yy;
+	ulong32_t lastX, lastY;
+	ulong32_t stepX, stepY;
+	ulong32_t jumpSize;
+	double minLL [2];
+	double maxLL [2];
+	double scale [2];
+	struct csLocalityKey_* keys;
+
+	if (cs_LocalitySort <= 0 || count < cs_LocalitySort)
+	{
+		return 0;
+	}
+
+	/* Get the bounding box of the valid points of the batch. */
+	for (idx = 0;idx < count && !CSlocalityValid (ll [idx]);idx += 1);
+	if (idx >= count)
+	{
+		return 0;
+	}
+	minLL [LNG] = maxLL [LNG] = ll [idx][LNG];
+	minLL [LAT] = maxLL [LAT] = ll [idx][LAT];
+	for (idx += 1;idx < count;idx += 1)
+	{
+		if (!CSlocalityValid (ll [idx])) continue;
+		if (ll [idx][LNG] < minLL [LNG]) minLL [LNG] = ll [idx][LNG];
+		if (ll [idx][LNG] > maxLL [LNG]) maxLL [LNG] = ll [idx][LNG];
+		if (ll [idx][LAT] < minLL [LAT]) minLL [LAT] = ll [idx][LAT];
+		if (ll [idx][LAT] > maxLL [LAT]) maxLL [LAT] = ll [idx][LAT];
+	}
+	if (!(maxLL [LNG] > minLL [LNG]) && !(maxLL [LAT] > minLL [LAT]))
+	{
+		/* All valid points are the same point. */
+		return 0;
+	}
+	scale [LNG] = (maxLL [LNG] > minLL [LNG]) ? 65535.0 / (maxLL [LNG] - minLL [LNG]) : 0.0;
+	scale [LAT] = (maxLL [LAT] > minLL [LAT]) ? 65535.0 / (maxLL [LAT] - minLL [LAT]) : 0.0;
+
+	/* Compute the keys, and at the same time determine how coherent the
+	   batch already is.  Spread evenly over the extent of the batch, the
+	   points would be about 65535 / sqrt (count) key units apart.  A jump
+	   is a step from one point to the next of more than four times that.
+	   If less than one step in eight is a jump, the batch is considered
+	   coherent and we leave it in the order given. */
+	jumpSize = (ulong32_t)(4.0 * 65535.0 / sqrt ((double)count));
+	keys = (struct csLocalityKey_*)CS_malc (sizeof (struct csLocalityKey_) * (size_t)count);
+	if (keys == NULL)
+	{
+		CS_erpt (cs_NO_MEM);
+		return -1;
+	}
+	jumps = 0;
+	haveLast = FALSE;
+	lastX = lastY = 0UL;
+	for (idx = 0;idx < count;idx += 1)
+	{
+		keys [idx].index = idx;
+		valid = CSlocalityValid (ll [idx]);
+		keys [idx].invalid = !valid;
+		keys [idx].key = 0UL;
+		if (!valid) continue;
+		xx = CSlocalityQuantize (ll [idx][LNG],minLL [LNG],scale [LNG]);
+		yy = CSlocalityQuantize (ll [idx][LAT],minLL [LAT],scale [LAT]);
+		if (haveLast)
+		{
+			stepX = (xx > lastX) ? (xx - lastX) : (lastX - xx);
+			stepY = (yy > lastY) ? (yy - lastY) : (lastY - yy);
+			if ((stepX + stepY) > jumpSize) jumps += 1;
+		}
+		haveLast = TRUE;
+		lastX = xx;
+		lastY = yy;
+		keys [idx].key = CShilbertKey (xx,yy);
+	}
+	if (jumps < (count / 8))
+	{
+		CS_free (keys);
+		return 0;
+	}
+
+	qsort (keys,(size_t)count,sizeof (struct csLocalityKey_),CScompareLocalityKey);
+	for (idx = 0;idx < count;idx += 1)
+	{
+		order [idx] = keys [idx].index;
+	}
+	CS_free (keys);
+	return 1;
+}
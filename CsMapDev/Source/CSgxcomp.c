@@ -228,7 +228,7 @@ static struct cs_GxCmpT_ cs_GxFrmtT [] =
 #	pragma warning(pop)
 #endif
 
-int CSgxdefwr (	csFILE *outStrm,
+int CSgxdefwr (	struct csCmpTbl_ *outTbl,
 				struct cs_GeodeticTransform_ *gxdef,
 				int warn,
 				csFILE* dtmStrm,
@@ -253,6 +253,9 @@ int CSgxdefwr (	csFILE *outStrm,
 **	cs_CMPLR_TEST  -- include test elements in output.  Normally,
 **					  these are suppressed.
 **  cs_CMPLR_WARN  -- issue warining messages as appropriate.
+**	cs_CMPLR_INCR  -- incremental compilation, definitions which have not
+**					  changed since the previous incremental compilation
+**					  are not validated again, see CS_cmpTbl.c.
 **
 **	Please excuse the rather crude nature of this program.  However,
 **	it is necessary for this program to be compiled, linked, and
@@ -313,10 +316,10 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 	char err_seg [18];
 	char buff [128];
 	char err_msg [128];
-	char last_name [128];
 
 	__ALIGNMENT__2					/* For some versions of Sun compiler. */
 	struct cs_GeodeticTransform_ gxdef;
+	struct csCmpTbl_ outTbl;
 
 	memset ((void*)&gxdef,0,sizeof (gxdef));
 	currentMethod = 0;
@@ -363,10 +366,14 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 		}
 	}
 
-	/* Open the output file and write the magic number.  BINRW creates a
-	   new file (truncates if necessary) with read write access.  We
-	   need read/write as we will be sorting below. */
-	outStrm = CS_fopen (outp,_STRM_BINRW);
+	/* The definitions are collected in memory, and written once sorted.
+	   In incremental mode, this also loads the previous output, so it
+	   must be done before the output file is created. */
+	CScmpTblInit (&outTbl,cs_GXDEF_MAGIC,flags,outp,datum,NULL);
+
+	/* Open the output file and write the magic number.  BINWR creates a
+	   new file (truncates if necessary). */
+	outStrm = CS_fopen (outp,_STRM_BINWR);
 	if (outStrm == NULL)
 	{
 		sprintf (err_msg,"Couldn't open %s for output.",outp);
@@ -376,6 +383,7 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 		{
 			CS_fclose (dtmStrm);
 		}
+		CScmpTblFree (&outTbl);
 		return (1);
 	}
 
@@ -393,6 +401,7 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 		{
 			CS_fclose (dtmStrm);
 		}
+		CScmpTblFinish (&outTbl,outp,FALSE);
 		return (1);
 	}
 
@@ -411,6 +420,7 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 			{
 				CS_fclose (dtmStrm);
 			}
+			CScmpTblFinish (&outTbl,outp,FALSE);
 			return (err_cnt);
 		}
 		line_nbr += 1;
@@ -475,7 +485,7 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 				CS_gxsep (&gxdef);
 				
 				/* Write it to the dictionary. */
-				st = CSgxdefwr (outStrm,&gxdef,warn,dtmStrm,err_func);
+				st = CSgxdefwr (&outTbl,&gxdef,warn,dtmStrm,err_func);
 				if (st >= 0) err_cnt += st;
 				else
 				{
@@ -915,7 +925,8 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 	/* Write out the last coordinate system if not in error. */
 	if (gxdef.xfrmName [0] != '\0')
 	{
-		st = CSgxdefwr (outStrm,&gxdef,warn,dtmStrm,err_func);
+		CS_gxsep (&gxdef);
+		st = CSgxdefwr (&outTbl,&gxdef,warn,dtmStrm,err_func);
 		if (st >= 0) err_cnt += st;
 		else
 		{
@@ -931,27 +942,13 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 		{
 			CS_fclose (dtmStrm);
 		}
+		CScmpTblFinish (&outTbl,outp,FALSE);
 		return (err_cnt);
 	}
 
-	/* Sort the output file. */
-	CS_fseek (outStrm,(long)sizeof (magic),SEEK_SET);
-	CS_ips (outStrm,sizeof (gxdef),0L,(CMPFUNC_CAST)CS_gxcmp);		/*lint !e534 */
-
-	/* Check for duplicate names. */
-	CS_fseek (outStrm,(long)sizeof (magic),SEEK_SET);
-	CS_gxrd (outStrm,&gxdef);			/*lint !e534  ignoring return value */
-	CS_stncp (last_name,gxdef.xfrmName,sizeof (last_name));
-	while (!cancel && CS_gxrd (outStrm,&gxdef))
-	{
-		if (!CS_stricmp (last_name,gxdef.xfrmName))
-		{
-			sprintf (err_msg,"Geodetic transformation named %s appears more than once.",last_name);
-			cancel = (*err_func)(err_msg);
-			err_cnt += 1;
-		}
-		CS_stncp (last_name,gxdef.xfrmName,sizeof (last_name));
-	}
+	/* Sort the definitions, check for duplicate names, and write them to
+	   the output file. */
+	err_cnt += CScmpTblWrite (&outTbl,outStrm,FALSE,"Geodetic transformation named %s appears more than once.",err_func);
 	CS_fclose (outStrm);
 	if (dtmStrm != NULL)
 	{
@@ -960,6 +957,7 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 
 	/* If there were any errors, delete the output file and
 	   exit now. */
+	CScmpTblFinish (&outTbl,outp,(err_cnt == 0));
 	if (err_cnt > 0)
 	{
 		CS_remove (outp);										/*lint !e534 */
@@ -969,7 +967,7 @@ int EXP_LVL9 CSgxcomp (	Const char *inpt,
 	return (err_cnt);
 }
 
-int CSgxdefwr (	csFILE *outStrm,
+int CSgxdefwr (	struct csCmpTbl_ *outTbl,
 				struct cs_GeodeticTransform_ *gxdef,
 				int warn,
 				csFILE* dtmStrm,
@@ -997,6 +995,12 @@ int CSgxdefwr (	csFILE *outStrm,
 	err_cnt = 0;
 	cancel = FALSE;
 
+	/* An unchanged definition is taken as compiled previously. */
+	if (CScmpTblReuse (outTbl,gxdef))
+	{
+		return (0);
+	}
+
 	/* Check all the other stuff other than the existence of the datums.  We'll
 	   do that below.  This is done as we want to check the datum dictionary
 	   which we just compiled for the names, not the currently active
@@ -1111,7 +1115,7 @@ int CSgxdefwr (	csFILE *outStrm,
 		}
 
 		/* Write this definition to the distionary file. */
-		st = CS_gxwr (outStrm,gxdef);
+		st = CScmpTblAdd (outTbl,gxdef);
 		if (st != 0)
 		{
 			CS_errmsg (err_msg,sizeof (err_msg));
@@ -172,6 +172,9 @@ CSMAP_SRC_CC = 	CS_alber.c \
 	CS_defaults.c \
 	CS_defCmp.c \
 	CS_defCmpEx.c \
+	CS_cmpTbl.c \
+	CS_bundle.c \
+	CS_dictMap.c \
 	CS_dtcalc.c \
 	CS_dtio.c \
 	CS_dtmBridge.c \
@@ -287,7 +290,8 @@ CSMAP_SRC_CPP = csIoUtil.cpp \
 	CS_nameMapper.cpp \
 	CS_nameMapperSupport.cpp \
 	CS_wktObject.cpp \
-	CS_wktObjKonstants.cpp
+	CS_wktObjKonstants.cpp \
+	CS_wktWriter.cpp
 
 # The following combines the two above lists and provides a convenient
 # place in this file to switch between the wildcard generated list and
@@ -53,6 +53,11 @@
 	{ CS_erpt(cs_NO_MEM); } \
 	return defError
 
+//the resident dictionary indices; see [cs_DefIndex]
+static TcsDefinitionIndex<cs_Csdef_> csDefIndex(cs_Csname);
+static TcsDefinitionIndex<cs_Dtdef_> dtDefIndex(cs_Dtname);
+static TcsDefinitionIndex<cs_Eldef_> elDefIndex(cs_Elname);
+
 extern "C"
 {
 
@@ -149,6 +154,11 @@ int CS_csWrite(csFILE *strm, Const struct cs_Csdef_ *cs_def, int crypt)
 int CS_csDelete(struct cs_Csdef_ *cs_def)
 {
 	CS_CHECK_NULL_ARG(cs_def, 1);
+	TcsDefinitionIndexReset<cs_Csdef_> indexReset(csDefIndex);
+	CS_rlsDictMap ();
+	CS_rlsWktCache ();
+	CS_rlsRangeIndex ();
+	CS_rlsGrpIndex ();
 	Q_RETURN(int, -1, (CS_DefinitionDelete<cs_Csdef_, cs_CSDEF_MAGIC, cs_CS_PROT, cs_CS_UPROT>(cs_def, cs_def->key_nm,
 		CS_csopn,
 		CS_csdef2,
@@ -162,6 +172,11 @@ int CS_csDelete(struct cs_Csdef_ *cs_def)
 int CS_csUpdate(struct cs_Csdef_ *cs_def, int)
 {
 	CS_CHECK_NULL_ARG(cs_def, 1);
+	TcsDefinitionIndexReset<cs_Csdef_> indexReset(csDefIndex);
+	CS_rlsDictMap ();
+	CS_rlsWktCache ();
+	CS_rlsRangeIndex ();
+	CS_rlsGrpIndex ();
 	return CS_DefinitionUpdate<cs_Csdef_, cs_CSDEF_MAGIC, cs_CS_PROT, cs_CS_UPROT, cs_Csname>(cs_def, cs_def->key_nm,
 		CS_csopn, NULL, CS_csrd, NULL, CS_cswr, CS_cscmp, NULL);
 }
@@ -172,7 +187,7 @@ struct cs_Csdef_* CS_csDefinition(Const char *csName, char* pszDirPath, int* isU
 	memset(&source, 0x0, sizeof(source));
 	CS_stncp(source.key_nm, csName, sizeof(source.key_nm));
 
-	Q_RETURN(struct cs_Csdef_*, NULL, (DefinitionGet<cs_Csdef_, cs_CS_NOT_FND>(source, source.key_nm, pszDirPath, CS_csopn, NULL, CS_csrd, CS_cscmp, CS_usrCsDefPtr, isUsrDef)));
+	Q_RETURN(struct cs_Csdef_*, NULL, (DefinitionGet<cs_Csdef_, cs_CS_NOT_FND>(source, source.key_nm, pszDirPath, CS_csopn, NULL, CS_csrd, CS_cscmp, CS_usrCsDefPtr, isUsrDef, &csDefIndex)));
 }
 
 int CS_csDefinitionAll(struct cs_Csdef_** pAllDefs[])
@@ -180,6 +195,11 @@ int CS_csDefinitionAll(struct cs_Csdef_** pAllDefs[])
 	Q_RETURN(int, -1, (DefinitionGetAll<cs_Csdef_>(pAllDefs, CS_csopn, NULL, CS_csrd)));
 }
 
+int CS_csDefinitionAllEx(struct cs_Csdef_** pAllDefs)
+{
+	Q_RETURN(int, -1, (DefinitionGetAllEx<cs_Csdef_>(pAllDefs, CS_csopn, NULL, CS_csrd)));
+}
+
 /*************************/
 /* Datum proxy functions */
 /*************************/
@@ -203,6 +223,9 @@ int CS_dtWrite(csFILE *strm, Const struct cs_Dtdef_ *dt_def, int crypt)
 int CS_dtDelete(struct cs_Dtdef_ *dt_def)
 {
 	CS_CHECK_NULL_ARG(dt_def, 1);
+	TcsDefinitionIndexReset<cs_Dtdef_> indexReset(dtDefIndex);
+	CS_rlsDictMap ();
+	CS_rlsWktCache ();
 	Q_RETURN(int, -1, (CS_DefinitionDelete<cs_Dtdef_, cs_DTDEF_MAGIC, cs_DT_PROT, cs_DT_UPROT>(dt_def, dt_def->key_nm,
 		CS_dtopn,
 		CS_dtdef2,
@@ -216,6 +239,9 @@ int CS_dtDelete(struct cs_Dtdef_ *dt_def)
 int CS_dtUpdate(struct cs_Dtdef_ *dt_def, int)
 {
 	CS_CHECK_NULL_ARG(dt_def, 1);
+	TcsDefinitionIndexReset<cs_Dtdef_> indexReset(dtDefIndex);
+	CS_rlsDictMap ();
+	CS_rlsWktCache ();
 	Q_RETURN(int, -1, (CS_DefinitionUpdate<cs_Dtdef_, cs_DTDEF_MAGIC, cs_DT_PROT, cs_DT_UPROT, cs_Dtname>(dt_def, dt_def->key_nm,
 		CS_dtopn, NULL, CS_dtrd, NULL, CS_dtwr, CS_dtcmp, NULL)));
 }
@@ -226,7 +252,7 @@ struct cs_Dtdef_* CS_dtDefinition(Const char *dtName, char* pszDirPath, int* isU
 	memset(&source, 0x0, sizeof(source));
 	CS_stncp(source.key_nm, dtName, sizeof(source.key_nm));
 
-	Q_RETURN(struct cs_Dtdef_*, NULL, (DefinitionGet<cs_Dtdef_, cs_DT_NOT_FND>(source, source.key_nm, pszDirPath, CS_dtopn, NULL, CS_dtrd, CS_dtcmp, CS_usrDtDefPtr, isUsrDef)));
+	Q_RETURN(struct cs_Dtdef_*, NULL, (DefinitionGet<cs_Dtdef_, cs_DT_NOT_FND>(source, source.key_nm, pszDirPath, CS_dtopn, NULL, CS_dtrd, CS_dtcmp, CS_usrDtDefPtr, isUsrDef, &dtDefIndex)));
 }
 
 int CS_dtDefinitionAll(struct cs_Dtdef_** pAllDefs[])
@@ -234,6 +260,11 @@ int CS_dtDefinitionAll(struct cs_Dtdef_** pAllDefs[])
 	Q_RETURN(int, -1, (DefinitionGetAll<cs_Dtdef_>(pAllDefs, CS_dtopn, NULL, CS_dtrd)));
 }
 
+int CS_dtDefinitionAllEx(struct cs_Dtdef_** pAllDefs)
+{
+	Q_RETURN(int, -1, (DefinitionGetAllEx<cs_Dtdef_>(pAllDefs, CS_dtopn, NULL, CS_dtrd)));
+}
+
 /*************************/
 /* Ellipsoid proxy functions */
 /*************************/
@@ -257,6 +288,9 @@ int CS_elWrite(csFILE *strm, Const struct cs_Eldef_ *el_def, int crypt)
 int CS_elDelete(struct cs_Eldef_ *el_def)
 {
 	CS_CHECK_NULL_ARG(el_def, 1);
+	TcsDefinitionIndexReset<cs_Eldef_> indexReset(elDefIndex);
+	CS_rlsDictMap ();
+	CS_rlsWktCache ();
 	Q_RETURN(int, -1, (CS_DefinitionDelete<cs_Eldef_, cs_ELDEF_MAGIC, cs_EL_PROT, cs_EL_UPROT>(el_def, el_def->key_nm, CS_elopn,
 		CS_eldef2,
 		NULL,
@@ -269,6 +303,9 @@ int CS_elDelete(struct cs_Eldef_ *el_def)
 int CS_elUpdate(struct cs_Eldef_ *el_def, int)
 {
 	CS_CHECK_NULL_ARG(el_def, 1);
+	TcsDefinitionIndexReset<cs_Eldef_> indexReset(elDefIndex);
+	CS_rlsDictMap ();
+	CS_rlsWktCache ();
 	Q_RETURN(int, -1, (CS_DefinitionUpdate<cs_Eldef_, cs_ELDEF_MAGIC, cs_EL_PROT, cs_EL_UPROT, cs_Elname>(el_def, el_def->key_nm,
 		CS_elopn, NULL, CS_elrd, NULL, CS_elwr, CS_elcmp, NULL)));
 }
@@ -279,7 +316,7 @@ struct cs_Eldef_* CS_elDefinition(Const char *elName, char* pszDirPath, int* isU
 	memset(&source, 0x0, sizeof(source));
 	CS_stncp(source.key_nm, elName, sizeof(source.key_nm));
 
-	Q_RETURN(struct cs_Eldef_*, NULL, (DefinitionGet<cs_Eldef_, cs_EL_NOT_FND>(source, source.key_nm, pszDirPath, CS_elopn, NULL, CS_elrd, CS_elcmp, CS_usrElDefPtr, isUsrDef)));
+	Q_RETURN(struct cs_Eldef_*, NULL, (DefinitionGet<cs_Eldef_, cs_EL_NOT_FND>(source, source.key_nm, pszDirPath, CS_elopn, NULL, CS_elrd, CS_elcmp, CS_usrElDefPtr, isUsrDef, &elDefIndex)));
 }
 
 int CS_elDefinitionAll(struct cs_Eldef_** pAllDefs[])
@@ -287,6 +324,25 @@ int CS_elDefinitionAll(struct cs_Eldef_** pAllDefs[])
 	Q_RETURN(int, -1, (DefinitionGetAll<cs_Eldef_>(pAllDefs, CS_elopn, NULL, CS_elrd)));
 }
 
+int CS_elDefinitionAllEx(struct cs_Eldef_** pAllDefs)
+{
+	Q_RETURN(int, -1, (DefinitionGetAllEx<cs_Eldef_>(pAllDefs, CS_elopn, NULL, CS_elrd)));
+}
+
+/**********************************************************************
+**	CS_rlsDefIndex ();
+**
+**	Releases the resident coordinate system, datum, and ellipsoid
+**	dictionary indices, if any.  They are rebuilt on next use if
+**	cs_DefIndex is non-zero.
+**********************************************************************/
+void CS_rlsDefIndex (void)
+{
+	csDefIndex.Invalidate();
+	dtDefIndex.Invalidate();
+	elDefIndex.Invalidate();
+}
+
 /*********************************/
 /* Geodetic Path proxy functions */
 /*********************************/
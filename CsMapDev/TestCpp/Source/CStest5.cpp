@@ -58,6 +58,7 @@ static double csTestcoords [10][3] =
 int CStest5 (bool verbose,long32_t duration)
 {
 	int ii;
+	int err_cnt;
 
 	long32_t cvt_cnt;
 	long32_t rate;
@@ -72,16 +73,127 @@ int CStest5 (bool verbose,long32_t duration)
 	double elapsed;				/* In seconds. */
 	double dbls [3];
 
+	err_cnt = 0;
+
+	/* Compare the batched ATS77 polynomial evaluator with the traditional
+	   point at a time evaluator.  We use a synthetic object, of the size
+	   and shape of the real thing, so that no data file is required.  One
+	   point in 97 is beyond the range of the polynomial. */
+	{
+		int idx;
+		int stIdx;
+		int ptCount;
+		int status;
+		double maxDelta;
+		double delta;
+		double perPoint;
+		double batched;
+		struct cs_Ats77_ ats77;
+		double (*atsIn)[3];
+		double (*atsOut)[3];
+		double atsLl [2];
+		double atsRef [2];
+		int *atsStatus;
+		double *coeffs;
+
+		memset (&ats77,0,sizeof (ats77));
+		ats77.direction = ats77DirToAts77;
+		ats77.nf = 10;
+		ats77.controlStations = 400;
+		ats77.oprue = 10.0;
+		ats77.rui2 = 0.05;
+		ats77.localOrigin [0] = 64.0;
+		ats77.localOrigin [1] = 45.5;
+		ats77.dataScale [0] = 1.0;
+		ats77.dataScale [1] = 1.0;
+		ats77.SU = ats77.SV = 1.0;
+		ats77.UO = ats77.VO = 0.0;
+		for (idx = 0;idx < 10;idx += 1)
+		{
+			ats77.ccc [idx].real = 0.5 / (idx + 1);
+			ats77.ccc [idx].img = -0.25 / (idx + 1);
+		}
+		coeffs = (double *)CS_malc (sizeof (double) * 5 * 400);
+		ptCount = 10000;
+		atsIn = (double (*)[3])CS_malc (sizeof (double [3]) * ptCount);
+		atsOut = (double (*)[3])CS_malc (sizeof (double [3]) * ptCount);
+		atsStatus = (int *)CS_malc (sizeof (int) * ptCount);
+		if (coeffs != NULL && atsIn != NULL && atsOut != NULL && atsStatus != NULL)
+		{
+			for (stIdx = 0;stIdx < 400;stIdx += 1)
+			{
+				coeffs [2 * stIdx]       = -1.5 + (double)(stIdx % 20) * 0.15;
+				coeffs [2 * stIdx + 1]   = -2.0 + (double)(stIdx / 20) * 0.2;
+				coeffs [800 + 2 * stIdx]     = 0.01 * (double)(stIdx % 7);
+				coeffs [800 + 2 * stIdx + 1] = -0.01 * (double)(stIdx % 5);
+				coeffs [1600 + stIdx]  = 1.0;
+			}
+			ats77.coeffs = coeffs;
+			for (idx = 0;idx < ptCount;idx += 1)
+			{
+				atsIn [idx][0] = -66.0 + 4.0 * (double)(idx % 100) / 100.0;
+				atsIn [idx][1] =  44.0 + 3.0 * (double)(idx / 100) / 100.0;
+				atsIn [idx][2] = 0.0;
+				if ((idx % 97) == 0) atsIn [idx][0] = -80.0;
+			}
+
+			start = clock ();
+			for (ii = 0;ii < duration + 1;ii += 1)
+			{
+				for (idx = 0;idx < ptCount;idx += 1)
+				{
+					atsLl [0] = atsIn [idx][0];
+					atsLl [1] = atsIn [idx][1];
+					CScalcAts77 (&ats77,atsLl,atsLl);
+				}
+			}
+			done = clock ();
+			perPoint = (double)(done - start) / (double)CLOCKS_PER_SEC;
+
+			start = clock ();
+			for (ii = 0;ii < duration + 1;ii += 1)
+			{
+				CScalcAts77N (&ats77,atsOut,atsStatus,atsIn,ptCount);
+			}
+			done = clock ();
+			batched = (double)(done - start) / (double)CLOCKS_PER_SEC;
+
+			maxDelta = 0.0;
+			for (idx = 0;idx < ptCount;idx += 1)
+			{
+				atsLl [0] = atsIn [idx][0];
+				atsLl [1] = atsIn [idx][1];
+				atsRef [0] = atsRef [1] = 0.0;
+				status = CScalcAts77 (&ats77,atsRef,atsLl);
+				delta = fabs (atsRef [0] - atsOut [idx][0]) + fabs (atsRef [1] - atsOut [idx][1]);
+				if (delta > maxDelta) maxDelta = delta;
+				if (status != atsStatus [idx] || !(delta < 1.0E-10))
+				{
+					printf ("CScalcAts77N result differs from CScalcAts77 at point %d.\n",idx);
+					err_cnt += 1;
+					break;
+				}
+			}
+			printf ("ATS77 polynomial, %d points x %ld: per point %6.2lf seconds, batched %6.2lf seconds.\n",
+							ptCount,(long)(duration + 1),perPoint,batched);
+			printf ("Maximum difference between the two evaluations = %.3e degrees.\n",maxDelta);
+		}
+		if (coeffs != NULL) CS_free (coeffs);
+		if (atsIn != NULL) CS_free (atsIn);
+		if (atsOut != NULL) CS_free (atsOut);
+		if (atsStatus != NULL) CS_free (atsStatus);
+	}
+
 	/* Here to perform a performance test.  For this
 	   we will convert a series of coordinates from
 	   UTM-13 to CO83-C */
 
 	utm13 = CS_csloc ("UTM27-13");
-	if (utm13 == NULL) return (1);
+	if (utm13 == NULL) return (err_cnt + 1);
 	co83c = CS_csloc ("CO83-C");
-	if (co83c == NULL) return (1);
+	if (co83c == NULL) return (err_cnt + 1);
 	dtcptr = CS_dtcsu (utm13,co83c,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_F);
-	if (dtcptr == NULL) return (1);
+	if (dtcptr == NULL) return (err_cnt + 1);
 
 	duration = duration * 10000;
 
@@ -118,5 +230,5 @@ int CStest5 (bool verbose,long32_t duration)
 					cvt_cnt,elapsed);
 	printf ("Effective conversion rate = %ld conversions per second.\n",rate);
 
-	return (0);
+	return (err_cnt);
 }
@@ -27,6 +27,18 @@
 
 #include "csTestCpp.hpp"
 
+#include <sstream>
+#include <algorithm>
+
+#if _RUN_TIME < _rt_UNIXPCC
+#	include <direct.h>
+#	include <sys/utime.h>
+#else
+#	include <sys/stat.h>
+#	include <unistd.h>
+#	include <utime.h>
+#endif
+
 extern "C"
 {
 	extern int cs_Error;
@@ -46,6 +58,20 @@ extern "C"
 	extern int (*CS_usrDtDefPtr)(struct cs_Dtdef_ *ptr,Const char *keyName);
 	extern int (*CS_usrElDefPtr)(struct cs_Eldef_ *ptr,Const char *keyName);
 	extern double (*CS_usrUnitPtr)(short type,Const char *unitName);
+
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+	extern long32_t cs_BynTileBytes;
+	extern int cs_BynTileCount;
+	extern int cs_DefIndex;
+	extern int cs_WktCacheSize;
+	extern short cs_Protect;
+	extern char cs_Unique;
+	extern char cs_Csname [];
+	extern char cs_Dtname [];
+	extern char cs_Elname [];
+	extern char cs_NameMapperName [];
+	extern char cs_NameMapperImgName [];
 }
 
 struct _hTable1
@@ -274,6 +300,157 @@ struct _mgrsTableEx mgrsTableEx [] =
 	{ "",                  cs_MGRS_GRDSQR_UNKNOWN,      0,        0.000,           0.000 }
 };
 
+/* Creates and removes the scratch directories used by tests which must not
+   disturb the contents of the dictionary directory. */
+static int CStestHmkdir (const char* path)
+{
+#if _RUN_TIME < _rt_UNIXPCC
+	return _mkdir (path);
+#else
+	return mkdir (path,0777);
+#endif
+}
+static int CStestHrmdir (const char* path)
+{
+#if _RUN_TIME < _rt_UNIXPCC
+	return _rmdir (path);
+#else
+	return rmdir (path);
+#endif
+}
+/* Builds dir, a directory separator, and name in path; returns zero if the
+   result fits. */
+static int CStestHpath (char* path,size_t size,const char* dir,const char* name)
+{
+	extern char cs_DirsepC;
+
+	size_t length;
+
+	length = strlen (dir);
+	if (length + strlen (name) + 2 > size)
+	{
+		*path = '\0';
+		return -1;
+	}
+	memcpy (path,dir,length);
+	if (length > 0 && dir [length - 1] != cs_DirsepC)
+	{
+		path [length++] = cs_DirsepC;
+	}
+	strcpy (path + length,name);
+	return 0;
+}
+/* Creates the named scratch directory in the dictionary directory, and
+   returns its path, without a trailing separator, in dirPath.  A directory
+   left over from an earlier run is reused. */
+static int CStestHscratch (char* dirPath,size_t size,const char* name)
+{
+	extern char cs_Dir [];
+	extern char *cs_DirP;
+
+	*cs_DirP = '\0';
+	if (CStestHpath (dirPath,size,cs_Dir,name) != 0) return -1;
+	if (CStestHmkdir (dirPath) != 0 && CS_access (dirPath,0) != 0) return -1;
+	return 0;
+}
+/* Copies the first length bytes of srcPath, all of it if length is
+   negative, to trgPath; returns zero on success. */
+static int CStestHcopy (const char* trgPath,const char* srcPath,long length)
+{
+	int st;
+	size_t count;
+	csFILE* srcStrm;
+	csFILE* trgStrm;
+	char bufr [4096];
+
+	srcStrm = CS_fopen (srcPath,_STRM_BINRD);
+	if (srcStrm == NULL) return -1;
+	trgStrm = CS_fopen (trgPath,_STRM_BINWR);
+	if (trgStrm == NULL)
+	{
+		CS_fclose (srcStrm);
+		return -1;
+	}
+	st = 0;
+	while (st == 0 && length != 0L)
+	{
+		count = sizeof (bufr);
+		if (length > 0L && (size_t)length < count) count = (size_t)length;
+		count = CS_fread (bufr,1,count,srcStrm);
+		if (count == 0) break;
+		if (CS_fwrite (bufr,1,count,trgStrm) != count) st = -1;
+		if (length > 0L) length -= (long)count;
+	}
+	if (CS_ferror (srcStrm)) st = -1;
+	CS_fclose (srcStrm);
+	if (CS_fclose (trgStrm) != 0) st = -1;
+	return st;
+}
+static int CStestHsetModTime (const char* path,cs_Time_ modTime)
+{
+#if _RUN_TIME < _rt_UNIXPCC
+	struct _utimbuf times;
+
+	times.actime = times.modtime = modTime;
+	return _utime (path,&times);
+#else
+	struct utimbuf times;
+
+	times.actime = times.modtime = modTime;
+	return utime (path,&times);
+#endif
+}
+
+/* Counts the messages of the dictionary compilers. */
+static int CStestHcmpCount = 0;
+static int CStestHcmpErr (char* mesg)
+{
+	CStestHcmpCount += 1;
+	return 0;
+}
+
+/* Grid gather functions for the batch driver test: the cell has the
+   longitude as its value at every node, points north of 60 degrees have no
+   coverage and a point at 45 degrees north produces a system error. */
+static int CStestHgatherBilinear (void* gridFile,double coefs [4],double delta [2],Const double* sourceLL)
+{
+	if (sourceLL [1] == 45.0) return csGRIDI_ST_SYSTEM;
+	if (sourceLL [1] > 60.0) return csGRIDI_ST_COVERAGE;
+	CSbilinearCoefs (coefs,sourceLL [0],sourceLL [0],sourceLL [0],sourceLL [0]);
+	delta [0] = delta [1] = 0.5;
+	return csGRIDI_ST_OK;
+}
+static int CStestHgatherBiquad (void* gridFile,double nodes [9],double delta [2],Const double* sourceLL)
+{
+	int idx;
+
+	if (sourceLL [1] == 45.0) return csGRIDI_ST_SYSTEM;
+	if (sourceLL [1] > 60.0) return csGRIDI_ST_COVERAGE;
+	for (idx = 0;idx < 9;idx += 1) nodes [idx] = sourceLL [0];
+	delta [0] = delta [1] = 0.5;
+	return csGRIDI_ST_OK;
+}
+
+/* Accumulates the WKT delivered by CS_cs2WktSink. */
+static int CStestHwktSink (void* userData,const char* text,size_t length)
+{
+	static_cast<std::string*>(userData)->append (text,length);
+	return 0;
+}
+/* Counts the WKT strings delivered by CS_cs2WktAll which differ from that
+   produced by CS_cs2WktEx. */
+static int CStestHwktExport (void* userData,const char* csKeyName,int flavor,const char* wktText,size_t length)
+{
+	char wktBufr [2048];
+
+	if (CS_cs2WktEx (wktBufr,sizeof (wktBufr),csKeyName,flavor,cs_WKTFLG_MAPNAMES) < 0 ||
+		strlen (wktBufr) != length || strcmp (wktBufr,wktText))
+	{
+		*static_cast<int*>(userData) += 1;
+	}
+	return 0;
+}
+
 int CStestH (bool verbose,long32_t duration)
 {
 	int err_cnt;
@@ -600,6 +777,2916 @@ int CStestH (bool verbose,long32_t duration)
 	}
 	CS_free (mgrsPtr);
 
+	/* Test the shared grid interpolation kernels against the scalar
+	   calculations they replace. */
+	{
+		int kIdx;
+		double kDelta [2];
+		double kExpected;
+		double kResults [csGRIDI_BATCH];
+		double kDeltaX [csGRIDI_BATCH];
+		double kDeltaY [csGRIDI_BATCH];
+		double kCoefs [csGRIDI_BATCH][4];
+		double kNodes [csGRIDI_BATCH][9];
+
+		for (kIdx = 0;kIdx < csGRIDI_BATCH;kIdx += 1)
+		{
+			kDeltaX [kIdx] = (double)(kIdx % 7) / 6.0;
+			kDeltaY [kIdx] = (double)(kIdx % 11) / 10.0;
+			CSbilinearCoefs (kCoefs [kIdx],1.0 + kIdx,2.5 - kIdx,-3.25 * kIdx,0.125);
+			for (idx = 0;idx < 9;idx += 1)
+			{
+				kNodes [kIdx][idx] = (double)((kIdx * 9 + idx * 5) % 13) - 6.5;
+			}
+		}
+		CSbilinearInterp (kResults,kDeltaX,kDeltaY,kCoefs,csGRIDI_BATCH);
+		for (kIdx = 0;kIdx < csGRIDI_BATCH;kIdx += 1)
+		{
+			kExpected = (1.0 + kIdx) + ((2.5 - kIdx) - (1.0 + kIdx)) * kDeltaX [kIdx] +
+									   ((-3.25 * kIdx) - (1.0 + kIdx)) * kDeltaY [kIdx] +
+									   (0.125 - (2.5 - kIdx) - (-3.25 * kIdx) + (1.0 + kIdx)) * kDeltaX [kIdx] * kDeltaY [kIdx];
+			if (fabs (kResults [kIdx] - kExpected) > 1.0E-12)
+			{
+				printf ("CSbilinearInterp failure at %d.\n",kIdx);
+				err_cnt += 1;
+				break;
+			}
+		}
+		CSbiquadInterp (kResults,kDeltaX,kDeltaY,kNodes,csGRIDI_BATCH);
+		for (kIdx = 0;kIdx < csGRIDI_BATCH;kIdx += 1)
+		{
+			kDelta [0] = kDeltaX [kIdx];
+			kDelta [1] = kDeltaY [kIdx];
+			kExpected = CSgeoidQterp1 (kDelta [1],CSgeoidQterp1 (kDelta [0],kNodes [kIdx][0],kNodes [kIdx][1],kNodes [kIdx][2]),
+												  CSgeoidQterp1 (kDelta [0],kNodes [kIdx][3],kNodes [kIdx][4],kNodes [kIdx][5]),
+												  CSgeoidQterp1 (kDelta [0],kNodes [kIdx][6],kNodes [kIdx][7],kNodes [kIdx][8]));
+			if (fabs (kResults [kIdx] - kExpected) > 1.0E-12)
+			{
+				printf ("CSbiquadInterp failure at %d.\n",kIdx);
+				err_cnt += 1;
+				break;
+			}
+		}
+	}
+
+	/* Test the locality ordering of batch grid lookups.  A raster in row
+	   order is coherent and must be left alone; the same raster shuffled
+	   must produce a permutation of the point indices which is much shorter
+	   to traverse.  Points with NaN coordinates go to the end, in their
+	   original order.  Finally, a scattered batch of datum conversions must
+	   produce exactly what converting the points one at a time produces. */
+	{
+		int kIdx;
+		int kOrdered;
+		int kOrder [256];
+		int kSeen [256];
+		int kStatus [300];
+		double kPathIn;
+		double kPathOut;
+		double kNaN;
+		double kPoints [256][3];
+		double kLLin [300][3];
+		double kLLout [300][3];
+		double kLLref [3];
+		struct cs_Datum_* kSrcDt;
+		struct cs_Datum_* kTrgDt;
+		struct cs_Dtcprm_* kDtcPtr;
+
+		for (kIdx = 0;kIdx < 256;kIdx += 1)
+		{
+			kPoints [kIdx][0] = -105.0 + (kIdx % 16) * 0.01;
+			kPoints [kIdx][1] =   39.0 + (kIdx / 16) * 0.01;
+			kPoints [kIdx][2] = 0.0;
+		}
+		kOrdered = CSlocalityOrder (kOrder,kPoints,256);
+		if (kOrdered != 0)
+		{
+			printf ("CSlocalityOrder failed to detect a coherent batch.\n");
+			err_cnt += 1;
+		}
+
+		/* 37 is relatively prime to 256, so this visits each of the 256
+		   raster points exactly once. */
+		for (kIdx = 0;kIdx < 256;kIdx += 1)
+		{
+			kPoints [kIdx][0] = -105.0 + (((kIdx * 37) % 256) % 16) * 0.01;
+			kPoints [kIdx][1] =   39.0 + (((kIdx * 37) % 256) / 16) * 0.01;
+		}
+		kOrdered = CSlocalityOrder (kOrder,kPoints,256);
+		if (kOrdered != 1)
+		{
+			printf ("CSlocalityOrder failed to order an incoherent batch.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			for (kIdx = 0;kIdx < 256;kIdx += 1) kSeen [kIdx] = 0;
+			for (kIdx = 0;kIdx < 256;kIdx += 1)
+			{
+				if (kOrder [kIdx] >= 0 && kOrder [kIdx] < 256) kSeen [kOrder [kIdx]] += 1;
+			}
+			kPathIn = kPathOut = 0.0;
+			for (kIdx = 1;kIdx < 256;kIdx += 1)
+			{
+				kPathIn += fabs (kPoints [kIdx][0] - kPoints [kIdx - 1][0]) +
+						   fabs (kPoints [kIdx][1] - kPoints [kIdx - 1][1]);
+				if (kSeen [kOrder [kIdx]] != 1 || kSeen [kOrder [kIdx - 1]] != 1) continue;
+				kPathOut += fabs (kPoints [kOrder [kIdx]][0] - kPoints [kOrder [kIdx - 1]][0]) +
+							fabs (kPoints [kOrder [kIdx]][1] - kPoints [kOrder [kIdx - 1]][1]);
+			}
+			for (kIdx = 0;kIdx < 256;kIdx += 1)
+			{
+				if (kSeen [kIdx] != 1) break;
+			}
+			if (kIdx < 256 || kPathOut * 4.0 > kPathIn)
+			{
+				printf ("CSlocalityOrder produced an invalid ordering.\n");
+				err_cnt += 1;
+			}
+		}
+
+		kNaN = sqrt (-1.0);
+		kPoints [3][0] = kNaN;
+		kPoints [100][1] = kNaN;
+		kPoints [200][0] = kPoints [200][1] = kNaN;
+		kOrdered = CSlocalityOrder (kOrder,kPoints,256);
+		if (kOrdered != 1 || kOrder [253] != 3 || kOrder [254] != 100 || kOrder [255] != 200)
+		{
+			printf ("CSlocalityOrder failed to place NaN points last.\n");
+			err_cnt += 1;
+		}
+
+		kSrcDt = CS_dtloc ("NAD27");
+		kTrgDt = CS_dtloc ("NAD83");
+		kDtcPtr = (kSrcDt != NULL && kTrgDt != NULL) ? CSdtcsu (kSrcDt,kTrgDt,cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W) : NULL;
+		if (kDtcPtr != NULL)
+		{
+			/* Scattered over, and somewhat beyond, the conterminous US. */
+			for (kIdx = 0;kIdx < 300;kIdx += 1)
+			{
+				kLLin [kIdx][0] = -128.0 + (double)((kIdx * 97) % 300) * 0.21;
+				kLLin [kIdx][1] =   22.0 + (double)((kIdx * 53) % 300) * 0.09;
+				kLLin [kIdx][2] = 0.0;
+			}
+			CS_dtcvtN (kDtcPtr,kLLin,kLLout,kStatus,300);
+			for (kIdx = 0;kIdx < 300;kIdx += 1)
+			{
+				if (CS_dtcvt (kDtcPtr,kLLin [kIdx],kLLref) != kStatus [kIdx] ||
+					fabs (kLLref [0] - kLLout [kIdx][0]) > 1.0E-12 ||
+					fabs (kLLref [1] - kLLout [kIdx][1]) > 1.0E-12)
+				{
+					printf ("CS_dtcvtN result differs from CS_dtcvt at point %d.\n",kIdx);
+					err_cnt += 1;
+					break;
+				}
+			}
+			CS_dtcls (kDtcPtr);
+		}
+		CS_free (kSrcDt);
+		CS_free (kTrgDt);
+	}
+
+	/* Test the tiled .byn file reader against the original buffered reader
+	   using a small synthetic file, written to a scratch directory.  The
+	   tiles are three records each and
+	   the cache is kept at its minimum size, so the tiles are evicted and
+	   re-read many times over. */
+	{
+		int kIdx;
+		int kRow;
+		int kCol;
+		int kStatus1;
+		int kStatus2;
+		long32_t kTileBytes;
+		int kTileCount;
+		double kLL [3];
+		double kValue1;
+		double kValue2;
+		short kRecord [31];
+		csFILE* kStrm;
+		struct csBynGridFile_* kTiled;
+		struct csBynGridFile_* kBuffered;
+		struct csBynGridFileHdr_ kHdr;
+		char kDir [MAXPATH];
+		char kPath [MAXPATH];
+
+		memset (&kHdr,0,sizeof (kHdr));
+		kHdr.southBoundary = 39L * 3600L;
+		kHdr.northBoundary = 40L * 3600L;
+		kHdr.westBoundary = -106L * 3600L;
+		kHdr.eastBoundary = -105L * 3600L;
+		kHdr.nsSpacing = 120;
+		kHdr.ewSpacing = 120;
+		kHdr.dataType = 1;
+		kHdr.factor = 1000.0;
+		kHdr.sizeOfData = 2;
+		kHdr.byteOrder = (short)(CS_isBigEndian () ? 0 : 1);
+		CS_bswap (&kHdr,cs_BSWP_BynFileHDR);
+
+		kStrm = NULL;
+		if (CStestHscratch (kDir,sizeof (kDir),"CStestH_Byn") == 0 &&
+			CStestHpath (kPath,sizeof (kPath),kDir,"CStestH.byn") == 0)
+		{
+			kStrm = CS_fopen (kPath,_STRM_BINWR);
+		}
+		if (kStrm == NULL)
+		{
+			printf ("Couldn't create the synthetic .byn file.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			CS_fwrite (&kHdr,1,sizeof (kHdr),kStrm);
+			for (kRow = 0;kRow < 31;kRow += 1)
+			{
+				for (kCol = 0;kCol < 31;kCol += 1)
+				{
+					kRecord [kCol] = (short)(((kRow * 37 + kCol * 11) % 1000) - 500);
+				}
+				if (kRow == 17) kRecord [9] = 32767;
+				CS_fwrite (kRecord,sizeof (short),31,kStrm);
+			}
+			CS_fclose (kStrm);
+
+			kTileBytes = cs_BynTileBytes;
+			kTileCount = cs_BynTileCount;
+			cs_BynTileBytes = 3L * 31L * sizeof (short);
+			cs_BynTileCount = 3;
+			kTiled = CSnewBynGridFile (kPath,0L,0UL,0.0);
+			cs_BynTileBytes = 0L;
+			kBuffered = CSnewBynGridFile (kPath,0L,0UL,0.0);
+			cs_BynTileBytes = kTileBytes;
+			cs_BynTileCount = kTileCount;
+
+			if (kTiled == NULL || kBuffered == NULL || kTiled->tileRecords != 3L || kBuffered->tileRecords != 0L)
+			{
+				printf ("Construction of the synthetic .byn file objects failed.\n");
+				err_cnt += 1;
+			}
+			else
+			{
+				for (kIdx = 0;kIdx < 97 * 97;kIdx += 1)
+				{
+					/* Visit the points in a scrambled order, avoiding the
+					   eastern column where the buffered reader is not
+					   defined. */
+					kRow = (kIdx * 53) % 97;
+					kCol = (kIdx / 97 + kIdx * 7) % 97;
+					kLL [0] = -106.0 + (double)kCol * (1.0 - 1.0 / 30.0) / 96.0;
+					kLL [1] =   39.0 + (double)kRow / 96.0;
+					kLL [2] = 0.0;
+					kStatus1 = CScalcBynGridFile (kTiled,&kValue1,kLL);
+					kStatus2 = CScalcBynGridFile (kBuffered,&kValue2,kLL);
+					if (kStatus1 != kStatus2 || kValue1 != kValue2)
+					{
+						printf ("Tiled .byn reader mismatch at %f %f (%d:%f, %d:%f).\n",kLL [0],kLL [1],kStatus1,kValue1,kStatus2,kValue2);
+						err_cnt += 1;
+						break;
+					}
+				}
+			}
+			CSdeleteBynGridFile (kTiled);
+			CSdeleteBynGridFile (kBuffered);
+			remove (kPath);
+		}
+		CStestHrmdir (kDir);
+	}
+
+	/* Test the resident dictionary index.  Definitions fetched through the
+	   index must be identical to those read from the file, key names must
+	   match without regard to case, and deleting and restoring a definition
+	   must be seen immediately. */
+	{
+		short kProtect;
+		char kUnique;
+		struct cs_Csdef_* kFileDef;
+		struct cs_Csdef_* kIndexDef;
+		struct cs_Dtdef_* kDtFile;
+		struct cs_Dtdef_* kDtIndex;
+		struct cs_Eldef_* kElFile;
+		struct cs_Eldef_* kElIndex;
+
+		cs_DefIndex = 0;
+		kFileDef = CS_csdef ("LL84");
+		kDtFile = CS_dtdef ("WGS84");
+		kElFile = CS_eldef ("WGS84");
+		cs_DefIndex = 1;
+		kIndexDef = CS_csdef ("ll84");
+		kDtIndex = CS_dtdef ("wgs84");
+		kElIndex = CS_eldef ("Wgs84");
+		if (kFileDef == NULL || kIndexDef == NULL || memcmp (kFileDef,kIndexDef,sizeof (*kFileDef)) ||
+			kDtFile == NULL || kDtIndex == NULL || memcmp (kDtFile,kDtIndex,sizeof (*kDtFile)) ||
+			kElFile == NULL || kElIndex == NULL || memcmp (kElFile,kElIndex,sizeof (*kElFile)))
+		{
+			printf ("Resident dictionary index returned a different definition.\n");
+			err_cnt += 1;
+		}
+		else if (CS_csdef ("NOT-A-CRS") != NULL || cs_Error != cs_CS_NOT_FND)
+		{
+			printf ("Resident dictionary index found a non-existent definition.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			kProtect = cs_Protect;
+			kUnique = cs_Unique;
+			cs_Protect = -1;
+			cs_Unique = '\0';
+			if (CS_csdel (kFileDef) != 0)
+			{
+				printf ("CS_csdel failed while testing the resident dictionary index.\n");
+				err_cnt += 1;
+			}
+			else
+			{
+				CS_free (kIndexDef);
+				kIndexDef = CS_csdef ("LL84");
+				if (kIndexDef != NULL)
+				{
+					printf ("Resident dictionary index not invalidated by CS_csdel.\n");
+					err_cnt += 1;
+				}
+				if (CS_csupd (kFileDef,FALSE) < 0)
+				{
+					printf ("CS_csupd failed while testing the resident dictionary index.\n");
+					err_cnt += 1;
+				}
+				CS_free (kIndexDef);
+				kIndexDef = CS_csdef ("LL84");
+				if (kIndexDef == NULL)
+				{
+					printf ("Resident dictionary index not invalidated by CS_csupd.\n");
+					err_cnt += 1;
+				}
+			}
+			cs_Protect = kProtect;
+			cs_Unique = kUnique;
+		}
+		cs_DefIndex = 0;
+		CS_rlsDefIndex ();
+		CS_free (kFileDef);
+		CS_free (kIndexDef);
+		CS_free (kDtFile);
+		CS_free (kDtIndex);
+		CS_free (kElFile);
+		CS_free (kElIndex);
+	}
+
+	/* The resident dictionary index must follow a dictionary which is
+	   replaced on disk.  A copy of the coordinate system dictionary, in a
+	   scratch directory, is replaced by one lacking its last definition; the
+	   modification time is restored, so only the size changes. */
+	{
+		int kOk;
+		int kCrypt;
+		cs_Time_ kModTime;
+		ulong32_t kSize;
+		csFILE* kStrm;
+		struct cs_Csdef_* kDefPtr;
+		char kDictDir [MAXPATH];
+		char kDir [MAXPATH];
+		char kPath [MAXPATH];
+		char kTmpPath [MAXPATH];
+		char kSrcPath [MAXPATH];
+		char kKeyName [cs_KEYNM_DEF];
+
+		__ALIGNMENT__1			/* Required by some Sun compilers. */
+		struct cs_Csdef_ kCsDef;
+
+		*cs_DirP = '\0';
+		CS_stncp (kDictDir,cs_Dir,sizeof (kDictDir));
+		kPath [0] = kTmpPath [0] = '\0';
+		kOk = (CStestHscratch (kDir,sizeof (kDir),"CStestH_DefIdx") == 0 &&
+			   CStestHpath (kPath,sizeof (kPath),kDir,cs_Csname) == 0 &&
+			   CStestHpath (kTmpPath,sizeof (kTmpPath),kDir,"CStestH.tmp") == 0 &&
+			   CStestHpath (kSrcPath,sizeof (kSrcPath),kDictDir,cs_Csname) == 0 &&
+			   CStestHcopy (kPath,kSrcPath,-1L) == 0 &&
+			   CS_altdr (kDir) == 0);
+		kKeyName [0] = '\0';
+		if (kOk)
+		{
+			kStrm = CS_csopn (_STRM_BINRD);
+			kOk = (kStrm != NULL);
+			if (kOk)
+			{
+				while (CS_csrd (kStrm,&kCsDef,&kCrypt) > 0)
+				{
+					CS_stncp (kKeyName,kCsDef.key_nm,sizeof (kKeyName));
+				}
+				CS_csDictCls (kStrm);
+			}
+			kOk &= (kKeyName [0] != '\0');
+		}
+		if (!kOk)
+		{
+			printf ("Scratch dictionary for the resident index test could not be prepared.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			cs_DefIndex = 1;
+			kDefPtr = CS_csdef (kKeyName);
+			kOk = (kDefPtr != NULL);
+			CS_free (kDefPtr);
+			kModTime = CS_fileModTime (kPath);
+			kSize = CS_fileSize (kPath);
+			kOk &= (CStestHcopy (kTmpPath,kPath,(long)(kSize - sizeof (struct cs_Csdef_))) == 0);
+			kOk &= (CS_remove (kPath) == 0 && CS_rename (kTmpPath,kPath) == 0);
+			kOk &= (CStestHsetModTime (kPath,kModTime) == 0);
+			if (kOk)
+			{
+				kDefPtr = CS_csdef (kKeyName);
+				kOk = (kDefPtr == NULL);
+				CS_free (kDefPtr);
+			}
+			if (!kOk)
+			{
+				printf ("Resident dictionary index not rebuilt for a replaced dictionary.\n");
+				err_cnt += 1;
+			}
+			cs_DefIndex = 0;
+			CS_rlsDefIndex ();
+		}
+		CS_altdr (kDictDir);
+		CS_remove (kPath);
+		CS_remove (kTmpPath);
+		CStestHrmdir (kDir);
+	}
+
+	/* Test the mappable dictionary images.  Definitions located in the
+	   images must be identical to those read from the dictionaries, and
+	   the images must be in dictionary order.  A user dictionary which has
+	   no image must still override the images of the system dictionary.
+	   The images are produced from copies of the dictionaries in a scratch
+	   directory; an image of a copy which has since been replaced must not
+	   be used, even though its modification time is unchanged. */
+	{
+		extern char cs_UserDir [];
+
+		int mOk;
+		long32_t mCount;
+		long32_t mIdx;
+		cs_Time_ mModTime;
+		ulong32_t mSize;
+		Const struct cs_Csdef_* mCsArray;
+		Const struct cs_Csdef_* mCsMap;
+		Const struct cs_Dtdef_* mDtMap;
+		Const struct cs_Eldef_* mElMap;
+		struct cs_Csdef_* mCsFile;
+		struct cs_Dtdef_* mDtFile;
+		struct cs_Eldef_* mElFile;
+		char mDictDir [MAXPATH];
+		char mDir [MAXPATH];
+		char mCsPath [MAXPATH];
+		char mDtPath [MAXPATH];
+		char mElPath [MAXPATH];
+		char mTmpPath [MAXPATH];
+		char mSrcPath [MAXPATH];
+		char mUsrDir [MAXPATH];
+		char mUsrPath [MAXPATH];
+		char mSaveUsrDir [MAXPATH];
+		cs_magic_t mMagic;
+		csFILE* mStrm;
+		struct cs_Csdef_ mUsrDef [2];
+
+		*cs_DirP = '\0';
+		CS_stncp (mDictDir,cs_Dir,sizeof (mDictDir));
+		mCsPath [0] = mDtPath [0] = mElPath [0] = mTmpPath [0] = '\0';
+		mOk = (CStestHscratch (mDir,sizeof (mDir),"CStestH_Map") == 0 &&
+			   CStestHpath (mCsPath,sizeof (mCsPath),mDir,cs_Csname) == 0 &&
+			   CStestHpath (mDtPath,sizeof (mDtPath),mDir,cs_Dtname) == 0 &&
+			   CStestHpath (mElPath,sizeof (mElPath),mDir,cs_Elname) == 0 &&
+			   CStestHpath (mTmpPath,sizeof (mTmpPath),mDir,"CStestH.tmp") == 0);
+		mOk = mOk && (CStestHpath (mSrcPath,sizeof (mSrcPath),mDictDir,cs_Csname) == 0 &&
+					  CStestHcopy (mCsPath,mSrcPath,-1L) == 0);
+		mOk = mOk && (CStestHpath (mSrcPath,sizeof (mSrcPath),mDictDir,cs_Dtname) == 0 &&
+					  CStestHcopy (mDtPath,mSrcPath,-1L) == 0);
+		mOk = mOk && (CStestHpath (mSrcPath,sizeof (mSrcPath),mDictDir,cs_Elname) == 0 &&
+					  CStestHcopy (mElPath,mSrcPath,-1L) == 0);
+		mOk = mOk && (CS_altdr (mDir) == 0);
+		if (!mOk)
+		{
+			printf ("Scratch dictionaries for the mappable image test could not be prepared.\n");
+			err_cnt += 1;
+		}
+		else if (CSdictMapWrite (mCsPath) != 0 || CSdictMapWrite (mDtPath) != 0 || CSdictMapWrite (mElPath) != 0)
+		{
+			printf ("CSdictMapWrite failed to produce a mappable image.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			mCsFile = CS_csdef ("LL84");
+			mDtFile = CS_dtdef ("WGS84");
+			mElFile = CS_eldef ("WGS84");
+			mCsMap = CS_csdefMap ("ll84");
+			mDtMap = CS_dtdefMap ("wgs84");
+			mElMap = CS_eldefMap ("Wgs84");
+			if (mCsFile == NULL || mCsMap == NULL || memcmp (mCsFile,mCsMap,sizeof (*mCsFile)) ||
+				mDtFile == NULL || mDtMap == NULL || memcmp (mDtFile,mDtMap,sizeof (*mDtFile)) ||
+				mElFile == NULL || mElMap == NULL || memcmp (mElFile,mElMap,sizeof (*mElFile)))
+			{
+				printf ("Mappable dictionary image returned a different definition.\n");
+				err_cnt += 1;
+			}
+			else if (CS_csdefMap ("NOT-A-CRS") != NULL || cs_Error != cs_CS_NOT_FND)
+			{
+				printf ("Mappable dictionary image found a non-existent definition.\n");
+				err_cnt += 1;
+			}
+			mCount = CS_csdefMapAll (&mCsArray,FALSE);
+			if (mCount <= 0L)
+			{
+				printf ("CS_csdefMapAll failed to enumerate the mappable image.\n");
+				err_cnt += 1;
+			}
+			for (mIdx = 1L;mIdx < mCount;mIdx += 1L)
+			{
+				if (CS_stricmp (mCsArray [mIdx - 1].key_nm,mCsArray [mIdx].key_nm) >= 0)
+				{
+					printf ("Mappable dictionary image is not in key name order.\n");
+					err_cnt += 1;
+					break;
+				}
+			}
+			if (CS_csdefMapAll (&mCsArray,TRUE) != 0L)
+			{
+				printf ("CS_csdefMapAll enumerated a non-existent user dictionary.\n");
+				err_cnt += 1;
+			}
+
+			/* A user dictionary, in a scratch directory, with no image. */
+			mUsrPath [0] = '\0';
+			CS_stncp (mSaveUsrDir,cs_UserDir,sizeof (mSaveUsrDir));
+			mStrm = NULL;
+			if (mCsFile != NULL &&
+				CStestHpath (mUsrDir,sizeof (mUsrDir),mDir,"CStestH_Usr") == 0 &&
+				CStestHpath (mUsrPath,sizeof (mUsrPath),mUsrDir,cs_Csname) == 0 &&
+				(CStestHmkdir (mUsrDir) == 0 || CS_access (mUsrDir,0) == 0))
+			{
+				mStrm = CS_fopen (mUsrPath,_STRM_BINWR);
+			}
+			if (mStrm == NULL)
+			{
+				printf ("Could not create a user dictionary to test the mappable images.\n");
+				err_cnt += 1;
+			}
+			else
+			{
+				mUsrDef [0] = *mCsFile;
+				CS_stncp (mUsrDef [0].desc_nm,"CStestH user override",sizeof (mUsrDef [0].desc_nm));
+				mUsrDef [1] = *mCsFile;
+				CS_stncp (mUsrDef [1].key_nm,"LL84-CStestH",sizeof (mUsrDef [1].key_nm));
+				mMagic = cs_CSDEF_MAGIC;
+				CS_bswap (&mMagic,"l");
+				CS_fwrite (&mMagic,1,sizeof (mMagic),mStrm);
+				CS_cswr (mStrm,&mUsrDef [0],FALSE);
+				CS_cswr (mStrm,&mUsrDef [1],FALSE);
+				CS_fclose (mStrm);
+				CS_usrdr (mUsrDir);
+
+				mCsMap = CS_csdefMap ("LL84");
+				if (mCsMap == NULL || strcmp (mCsMap->desc_nm,"CStestH user override") ||
+					CS_csdefMap ("LL84-CStestH") == NULL ||
+					CS_csdefMapAll (&mCsArray,TRUE) != 2L)
+				{
+					printf ("Mappable dictionary lookup failed with a user dictionary which has no image.\n");
+					err_cnt += 1;
+				}
+				if (CS_csdefMapAll (&mCsArray,FALSE) != mCount)
+				{
+					mCount = 0L;
+					printf ("CS_csdefMapAll failed with a user dictionary which has no image.\n");
+					err_cnt += 1;
+				}
+				for (mIdx = 0L;mIdx < mCount;mIdx += 1L)
+				{
+					if (CS_stricmp (mCsArray [mIdx].key_nm,"LL84") && CS_csdefMap (mCsArray [mIdx].key_nm) != &mCsArray [mIdx])
+					{
+						printf ("Mappable dictionary image not used with a user dictionary which has no image.\n");
+						err_cnt += 1;
+						break;
+					}
+				}
+				CS_usrdr (mSaveUsrDir);
+				CS_rlsDictMap ();
+				CS_remove (mUsrPath);
+			}
+			if (mUsrPath [0] != '\0') CStestHrmdir (mUsrDir);
+			CS_free (mCsFile);
+			CS_free (mDtFile);
+			CS_free (mElFile);
+
+			/* Replace the coordinate system dictionary by one lacking its
+			   last definition, keeping its modification time. */
+			CS_rlsDictMap ();
+			mModTime = CS_fileModTime (mCsPath);
+			mSize = CS_fileSize (mCsPath);
+			mOk = (CStestHcopy (mTmpPath,mCsPath,(long)(mSize - sizeof (struct cs_Csdef_))) == 0 &&
+				   CS_remove (mCsPath) == 0 && CS_rename (mTmpPath,mCsPath) == 0 &&
+				   CStestHsetModTime (mCsPath,mModTime) == 0);
+			if (!mOk || CS_csdefMap ("LL84") != NULL || cs_Error != cs_CSDICT)
+			{
+				printf ("Mappable dictionary image used after its dictionary was replaced.\n");
+				err_cnt += 1;
+			}
+		}
+		CS_rlsDictMap ();
+		CS_altdr (mDictDir);
+		if (mTmpPath [0] != '\0')
+		{
+			CSdictMapRemove (mCsPath);
+			CSdictMapRemove (mDtPath);
+			CSdictMapRemove (mElPath);
+			CS_remove (mCsPath);
+			CS_remove (mDtPath);
+			CS_remove (mElPath);
+			CS_remove (mTmpPath);
+		}
+		CStestHrmdir (mDir);
+	}
+
+	/* Test the coordinate system range index.  A dictionary of synthetic
+	   definitions is written to a scratch directory, and the lists produced
+	   by the CS_csRangeEnumSetup functions must be exactly those produced by
+	   examining every definition in it.  The index must also be rebuilt
+	   when the dictionary is replaced, even though its modification time
+	   is unchanged. */
+	{
+		int rIdx;
+		int rPass;
+		int rCount;
+		int rCrypt;
+		int rEnumIdx;
+		int rExpected;
+		ulong32_t rSeed;
+		size_t rLen;
+		cs_Time_ rModTime;
+		cs_magic_t rMagic;
+		csFILE* rStrm;
+		struct cs_Csdef_* rLl84;
+		char rGroup [24];
+		char rSaveDir [MAXPATH];
+		char rDir [MAXPATH];
+		char rDictPath [MAXPATH];
+		char rTmpPath [MAXPATH];
+		char rKeyName [cs_KEYNM_DEF];
+		char rList [32768];
+		char rMyList [32768];
+		struct cs_Csdef_ rCsDef;
+		double rMin [2];
+		double rMax [2];
+		double rPnts [2][2];
+		double rProbe [2];
+
+		rLl84 = CS_csdef ("LL84");
+		*cs_DirP = '\0';
+		CS_stncp (rSaveDir,cs_Dir,sizeof (rSaveDir));
+		rDictPath [0] = rTmpPath [0] = '\0';
+		rProbe [0] = rProbe [1] = 0.0;
+		rStrm = NULL;
+		if (rLl84 != NULL &&
+			CStestHscratch (rDir,sizeof (rDir),"CStestH_Rng") == 0 &&
+			CStestHpath (rDictPath,sizeof (rDictPath),rDir,cs_Csname) == 0 &&
+			CStestHpath (rTmpPath,sizeof (rTmpPath),rDir,"CStestH.tmp") == 0)
+		{
+			rStrm = CS_fopen (rDictPath,_STRM_BINWR);
+		}
+		if (rStrm == NULL)
+		{
+			printf ("Could not create the range index test dictionary.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			rMagic = cs_CSDEF_MAGIC;
+			CS_bswap (&rMagic,"l");
+			CS_fwrite (&rMagic,1,sizeof (rMagic),rStrm);
+			rSeed = 12345UL;
+			for (rIdx = 0;rIdx < 2000;rIdx += 1)
+			{
+				rCsDef = *rLl84;
+				sprintf (rCsDef.key_nm,"RNGT%04d",rIdx);
+				CS_stncp (rCsDef.group,(rIdx & 1) ? "RNGODD" : "RNGEVEN",sizeof (rCsDef.group));
+				rSeed = rSeed * 1103515245UL + 12345UL;
+				rCsDef.ll_min [0] = -180.0 + (double)((rSeed >> 8) % 3400) * 0.1;
+				rSeed = rSeed * 1103515245UL + 12345UL;
+				rCsDef.ll_min [1] = -90.0 + (double)((rSeed >> 8) % 1600) * 0.1;
+				rSeed = rSeed * 1103515245UL + 12345UL;
+				rCsDef.ll_max [0] = rCsDef.ll_min [0] + (double)((rSeed >> 8) % 400) * 0.1;
+				rSeed = rSeed * 1103515245UL + 12345UL;
+				rCsDef.ll_max [1] = rCsDef.ll_min [1] + (double)((rSeed >> 8) % 300) * 0.1;
+				if ((rIdx % 97) == 0) rCsDef.ll_max [0] = rCsDef.ll_min [0] - 1.0;
+				if (rIdx == 1)
+				{
+					rProbe [0] = (rCsDef.ll_min [0] + rCsDef.ll_max [0]) * 0.5;
+					rProbe [1] = (rCsDef.ll_min [1] + rCsDef.ll_max [1]) * 0.5;
+				}
+				CS_cswr (rStrm,&rCsDef,FALSE);
+			}
+			CS_fclose (rStrm);
+			CS_altdr (rDir);
+
+			for (rIdx = 0;rIdx < 200;rIdx += 1)
+			{
+				rSeed = rSeed * 1103515245UL + 12345UL;
+				rMin [0] = -180.0 + (double)((rSeed >> 8) % 3600) * 0.1;
+				rSeed = rSeed * 1103515245UL + 12345UL;
+				rMin [1] = -90.0 + (double)((rSeed >> 8) % 1800) * 0.1;
+				rMax [0] = rMin [0] + (double)(rIdx % 3) * 0.5;
+				rMax [1] = rMin [1] + (double)(rIdx % 5) * 0.25;
+				rGroup [0] = '\0';
+
+				/* The second pass filters on the group of the first
+				   coordinate system the first pass found. */
+				for (rPass = 0;rPass < 2;rPass += 1)
+				{
+					rExpected = 0;
+					rLen = 0;
+					rStrm = CS_csopn (_STRM_BINRD);
+					while (rStrm != NULL && CS_csrd (rStrm,&rCsDef,&rCrypt) > 0)
+					{
+						if (rCsDef.ll_min [0] <= rMin [0] && rCsDef.ll_min [1] <= rMin [1] &&
+							rCsDef.ll_max [0] >= rMax [0] && rCsDef.ll_max [1] >= rMax [1] &&
+							(rPass == 0 || !CS_stricmp (rCsDef.group,rGroup)))
+						{
+							if (rExpected == 0 && rPass == 0) CS_stncp (rGroup,rCsDef.group,sizeof (rGroup));
+							rLen = CS_stcpy (rMyList + rLen,rCsDef.key_nm) - rMyList + 1;
+							rExpected += 1;
+						}
+					}
+					if (rStrm != NULL) CS_csDictCls (rStrm);
+					rMyList [rLen] = '\0';
+
+					if (rMin [0] == rMax [0] && rMin [1] == rMax [1] && rPass == 0)
+					{
+						rCount = CS_csRangeEnumSetup (rMin [0],rMin [1]);
+					}
+					else if ((rIdx & 1) != 0 && rPass == 0)
+					{
+						rPnts [0][0] = rMin [0];
+						rPnts [0][1] = rMax [1];
+						rPnts [1][0] = rMax [0];
+						rPnts [1][1] = rMin [1];
+						rCount = CS_csRangeEnumSetupN (rPnts,2,NULL,NULL);
+					}
+					else
+					{
+						rCount = CS_csRangeEnumSetupEx (rMin,rMax,(rPass == 0) ? NULL : rGroup,NULL);
+					}
+					rLen = 0;
+					for (rEnumIdx = 0;rCount > 0 && CS_csRangeEnum (rEnumIdx,rKeyName,sizeof (rKeyName)) > 0;rEnumIdx += 1)
+					{
+						rLen = CS_stcpy (rList + rLen,rKeyName) - rList + 1;
+					}
+					rList [rLen] = '\0';
+					if (rCount != rExpected || memcmp (rList,rMyList,rLen + 1))
+					{
+						printf ("Range index list differs for query %d, pass %d (%d vs %d).\n",rIdx,rPass,rCount,rExpected);
+						err_cnt += 1;
+						break;
+					}
+					if (rGroup [0] == '\0') break;
+				}
+			}
+
+			/* Replace the dictionary by one with no definitions at all,
+			   keeping its modification time. */
+			rModTime = CS_fileModTime (rDictPath);
+			if (CS_csRangeEnumSetup (rProbe [0],rProbe [1]) <= 0 ||
+				CStestHcopy (rTmpPath,rDictPath,(long)sizeof (rMagic)) != 0 ||
+				CS_remove (rDictPath) != 0 || CS_rename (rTmpPath,rDictPath) != 0 ||
+				CStestHsetModTime (rDictPath,rModTime) != 0 ||
+				CS_csRangeEnumSetup (rProbe [0],rProbe [1]) != 0)
+			{
+				printf ("Range index not rebuilt for a replaced dictionary.\n");
+				err_cnt += 1;
+			}
+			CS_altdr (rSaveDir);
+		}
+		CS_rlsRangeIndex ();
+		CS_free (rLl84);
+		if (rTmpPath [0] != '\0')
+		{
+			CS_remove (rDictPath);
+			CS_remove (rTmpPath);
+			CStestHrmdir (rDir);
+		}
+	}
+
+	/* Test the key name enumeration index and the bulk enumeration
+	   functions.  Every name returned by CS_csEnum must be that found by
+	   walking the key name list, and the bulk functions must return exactly
+	   what their one-at-a-time counterparts return. */
+	{
+		int eIdx;
+		int eCount;
+		int eAllCount;
+		int eStatus;
+		char* eNames;
+		char** eAllNames;
+		struct cs_Dtdef_** eDtPtrs;
+		struct cs_Dtdef_* eDtArray;
+		struct cs_Eldef_** eElPtrs;
+		struct cs_Eldef_* eElArray;
+		char eKeyName [cs_KEYNM_DEF];
+
+		eNames = CScsKeyNames ();
+		eAllCount = CS_csEnumAll (&eAllNames);
+		if (eNames == NULL || eAllCount <= 0)
+		{
+			printf ("CS_csEnumAll failed.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			for (eIdx = 0;eIdx <= eAllCount;eIdx += 1)
+			{
+				eStatus = CS_csEnum (eIdx,eKeyName,sizeof (eKeyName));
+				if (eIdx == eAllCount)
+				{
+					if (eStatus != 0 || eKeyName [0] != '\0' || eAllNames [eIdx] != NULL)
+					{
+						printf ("CS_csEnum did not detect the end of the list.\n");
+						err_cnt += 1;
+					}
+				}
+				else if (eStatus != 1 || strcmp (eKeyName,eNames) || strcmp (eAllNames [eIdx],eNames))
+				{
+					printf ("CS_csEnum/CS_csEnumAll mismatch at index %d.\n",eIdx);
+					err_cnt += 1;
+					break;
+				}
+				else
+				{
+					eNames += strlen (eNames) + 1;
+				}
+			}
+			if (*eNames != '\0')
+			{
+				printf ("CS_csEnumAll returned too few names.\n");
+				err_cnt += 1;
+			}
+			CS_free (eAllNames);
+		}
+
+		eAllCount = CS_dtEnumAll (&eAllNames);
+		eCount = CS_dtdefAll (&eDtPtrs);
+		if (eAllCount != eCount || eCount <= 0 || CS_dtdefAllEx (&eDtArray) != eCount)
+		{
+			printf ("CS_dtEnumAll/CS_dtdefAllEx count mismatch.\n");
+			err_cnt += 1;
+			eCount = 0;
+		}
+		for (eIdx = 0;eIdx < eCount;eIdx += 1)
+		{
+			if (memcmp (eDtPtrs [eIdx],&eDtArray [eIdx],sizeof (struct cs_Dtdef_)) ||
+				CS_dtEnum (eIdx,eKeyName,sizeof (eKeyName)) != 1 || strcmp (eKeyName,eAllNames [eIdx]))
+			{
+				printf ("CS_dtEnumAll/CS_dtdefAllEx mismatch at index %d.\n",eIdx);
+				err_cnt += 1;
+				break;
+			}
+		}
+		if (eCount > 0)
+		{
+			for (eIdx = 0;eIdx < eCount;eIdx += 1) CS_free (eDtPtrs [eIdx]);
+			CS_free (eDtPtrs);
+			CS_free (eDtArray);
+			CS_free (eAllNames);
+		}
+
+		eAllCount = CS_elEnumAll (&eAllNames);
+		eCount = CS_eldefAll (&eElPtrs);
+		if (eAllCount != eCount || eCount <= 0 || CS_eldefAllEx (&eElArray) != eCount)
+		{
+			printf ("CS_elEnumAll/CS_eldefAllEx count mismatch.\n");
+			err_cnt += 1;
+			eCount = 0;
+		}
+		for (eIdx = 0;eIdx < eCount;eIdx += 1)
+		{
+			if (memcmp (eElPtrs [eIdx],&eElArray [eIdx],sizeof (struct cs_Eldef_)) ||
+				CS_elEnum (eIdx,eKeyName,sizeof (eKeyName)) != 1 || strcmp (eKeyName,eAllNames [eIdx]))
+			{
+				printf ("CS_elEnumAll/CS_eldefAllEx mismatch at index %d.\n",eIdx);
+				err_cnt += 1;
+				break;
+			}
+		}
+		if (eCount > 0)
+		{
+			for (eIdx = 0;eIdx < eCount;eIdx += 1) CS_free (eElPtrs [eIdx]);
+			CS_free (eElPtrs);
+			CS_free (eElArray);
+			CS_free (eAllNames);
+		}
+	}
+
+	/* Test the hash tables of the Geodetic Transformation Index.  Each of
+	   the locate functions must produce exactly what a linear search of the
+	   index produces. */
+	{
+		int gIdx;
+		int gJdx;
+		int gResult;
+		int gExpected;
+		int gDirection;
+		int gExpDirection;
+		unsigned gCount;
+		Const struct cs_GxIndex_* gEntry;
+		Const struct cs_GxIndex_* gOther;
+		char gLower [cs_KEYNM_DEF1];
+
+		gCount = CS_getGxIndexCount ();
+		if (gCount == 0 || CS_locateGxByName ("NoSuchTransformation") != cs_GXIDX_NOXFRM)
+		{
+			printf ("Geodetic Transformation Index generation failed.\n");
+			err_cnt += 1;
+			gCount = 0;
+		}
+		for (gIdx = 0;gIdx < (int)gCount;gIdx += 1)
+		{
+			gEntry = CS_getGxIndexEntry ((unsigned)gIdx);
+
+			gExpected = cs_GXIDX_NOXFRM;
+			for (gJdx = 0;gJdx < (int)gCount && gExpected < 0;gJdx += 1)
+			{
+				if (!CS_stricmp (CS_getGxIndexEntry ((unsigned)gJdx)->xfrmName,gEntry->xfrmName)) gExpected = gJdx;
+			}
+			CS_stncp (gLower,gEntry->xfrmName,sizeof (gLower));
+			for (gJdx = 0;gLower [gJdx] != '\0';gJdx += 1) gLower [gJdx] = (char)CS_tolower (gLower [gJdx]);
+			if (CS_locateGxByName (gLower) != gExpected)
+			{
+				printf ("CS_locateGxByName failed on %s.\n",gEntry->xfrmName);
+				err_cnt += 1;
+				break;
+			}
+
+			gExpected = cs_GXIDX_NOXFRM;
+			for (gJdx = gIdx + 1;gJdx < (int)gCount && gExpected < 0;gJdx += 1)
+			{
+				gOther = CS_getGxIndexEntry ((unsigned)gJdx);
+				if (!CS_stricmp (gOther->srcDatum,gEntry->srcDatum) && !CS_stricmp (gOther->trgDatum,gEntry->trgDatum)) gExpected = gJdx;
+			}
+			if (CS_locateGxByDatum ((unsigned)gIdx + 1,gEntry->srcDatum,gEntry->trgDatum) != gExpected)
+			{
+				printf ("CS_locateGxByDatum failed on %s.\n",gEntry->xfrmName);
+				err_cnt += 1;
+				break;
+			}
+
+			/* The source datum and target datum searches. */
+			gExpected = cs_GXIDX_NOXFRM;
+			gExpDirection = cs_DTCDIR_NONE;
+			for (gJdx = 0;gJdx < (int)gCount;gJdx += 1)
+			{
+				gOther = CS_getGxIndexEntry ((unsigned)gJdx);
+				if (!CS_stricmp (gOther->srcDatum,gEntry->srcDatum))
+				{
+					gExpDirection = (gExpected == cs_GXIDX_NOXFRM) ? cs_DTCDIR_FWD : cs_DTCDIR_NONE;
+					gExpected = (gExpected == cs_GXIDX_NOXFRM) ? gJdx : cs_GXIDX_DUPXFRM;
+				}
+				if (gOther->inverseSupported && !CS_stricmp (gOther->trgDatum,gEntry->srcDatum))
+				{
+					gExpDirection = (gExpected == cs_GXIDX_NOXFRM) ? cs_DTCDIR_INV : cs_DTCDIR_NONE;
+					gExpected = (gExpected == cs_GXIDX_NOXFRM) ? gJdx : cs_GXIDX_DUPXFRM;
+				}
+			}
+			gDirection = cs_DTCDIR_NONE;
+			gResult = CS_locateGxFromDatum (&gDirection,gEntry->srcDatum);
+			if (gResult != gExpected || (gResult >= 0 && gDirection != gExpDirection))
+			{
+				printf ("CS_locateGxFromDatum failed on %s.\n",gEntry->srcDatum);
+				err_cnt += 1;
+				break;
+			}
+			gExpected = cs_GXIDX_NOXFRM;
+			gExpDirection = cs_DTCDIR_NONE;
+			for (gJdx = 0;gJdx < (int)gCount;gJdx += 1)
+			{
+				gOther = CS_getGxIndexEntry ((unsigned)gJdx);
+				if (!CS_stricmp (gOther->trgDatum,gEntry->trgDatum))
+				{
+					gExpDirection = (gExpected == cs_GXIDX_NOXFRM) ? cs_DTCDIR_FWD : cs_DTCDIR_NONE;
+					gExpected = (gExpected == cs_GXIDX_NOXFRM) ? gJdx : cs_GXIDX_DUPXFRM;
+				}
+				if (gOther->inverseSupported && !CS_stricmp (gOther->srcDatum,gEntry->trgDatum))
+				{
+					gExpDirection = (gExpected == cs_GXIDX_NOXFRM) ? cs_DTCDIR_INV : cs_DTCDIR_NONE;
+					gExpected = (gExpected == cs_GXIDX_NOXFRM) ? gJdx : cs_GXIDX_DUPXFRM;
+				}
+			}
+			gDirection = cs_DTCDIR_NONE;
+			gResult = CS_locateGxToDatum (&gDirection,gEntry->trgDatum);
+			if (gResult != gExpected || (gResult >= 0 && gDirection != gExpDirection))
+			{
+				printf ("CS_locateGxToDatum failed on %s.\n",gEntry->trgDatum);
+				err_cnt += 1;
+				break;
+			}
+
+			/* The inverse direction of CS_locateGxByDatum2 finds the first
+			   reversible entry, provided no entry converts forward. */
+			gExpected = cs_GXIDX_NOXFRM;
+			for (gJdx = 0;gJdx < (int)gCount && gExpected < 0;gJdx += 1)
+			{
+				gOther = CS_getGxIndexEntry ((unsigned)gJdx);
+				if (!CS_stricmp (gOther->srcDatum,gEntry->trgDatum) && !CS_stricmp (gOther->trgDatum,gEntry->srcDatum)) gExpected = gJdx;
+			}
+			if (gExpected < 0 && gEntry->inverseSupported)
+			{
+				gResult = CS_locateGxByDatum2 (&gDirection,gEntry->trgDatum,gEntry->srcDatum);
+				for (gJdx = 0;gJdx <= gIdx;gJdx += 1)
+				{
+					gOther = CS_getGxIndexEntry ((unsigned)gJdx);
+					if (gOther->inverseSupported && !CS_stricmp (gOther->srcDatum,gEntry->srcDatum) && !CS_stricmp (gOther->trgDatum,gEntry->trgDatum)) break;
+				}
+				if (gResult != gJdx || gDirection != cs_DTCDIR_INV)
+				{
+					printf ("CS_locateGxByDatum2 failed on %s.\n",gEntry->xfrmName);
+					err_cnt += 1;
+					break;
+				}
+			}
+		}
+	}
+
+	/* Test the geodetic path index.  For every path in the dictionary, in
+	   both directions, CS_gpdefEx must return what a search of the
+	   dictionary returns, and the path returned must pass CS_gpchk.  This
+	   is repeated after adding a path, and again after deleting it, to
+	   verify that CS_gpupd and CS_gpdel are seen. */
+	{
+		int pPhase;
+		int pIdx;
+		int pJdx;
+		int pSwap;
+		int pCount;
+		int pExpected;
+		int pExpDirection;
+		int pDirection;
+		short pProtect;
+		char pUnique;
+		Const char* pSrc;
+		Const char* pTrg;
+		struct cs_GeodeticPath_* pDef;
+		struct cs_GeodeticPath_** pAllDefs;
+		__ALIGNMENT__1
+		struct cs_GeodeticPath_ pNewPath;
+
+		memset (&pNewPath,0,sizeof (pNewPath));
+		pProtect = cs_Protect;
+		pUnique = cs_Unique;
+		cs_Protect = -1;
+		cs_Unique = '\0';
+		for (pPhase = 0;pPhase < 3;pPhase += 1)
+		{
+			pCount = CS_gpdefAll (&pAllDefs);
+			if (pCount <= 0)
+			{
+				printf ("CS_gpdefAll failed while testing the geodetic path index.\n");
+				err_cnt += 1;
+				break;
+			}
+			for (pIdx = 0;pIdx < pCount * 2;pIdx += 1)
+			{
+				pSwap = (pIdx >= pCount);
+				pSrc = pSwap ? pAllDefs [pIdx % pCount]->trgDatum : pAllDefs [pIdx % pCount]->srcDatum;
+				pTrg = pSwap ? pAllDefs [pIdx % pCount]->srcDatum : pAllDefs [pIdx % pCount]->trgDatum;
+				pExpected = -1;
+				pExpDirection = cs_DTCDIR_NONE;
+				for (pJdx = 0;pJdx < pCount && pExpected < 0;pJdx += 1)
+				{
+					if (!CS_stricmp (pAllDefs [pJdx]->srcDatum,pSrc) && !CS_stricmp (pAllDefs [pJdx]->trgDatum,pTrg))
+					{
+						pExpected = pJdx;
+						pExpDirection = cs_DTCDIR_FWD;
+					}
+				}
+				for (pJdx = 0;pJdx < pCount && pExpected < 0;pJdx += 1)
+				{
+					if (pAllDefs [pJdx]->reversible &&
+						!CS_stricmp (pAllDefs [pJdx]->srcDatum,pTrg) && !CS_stricmp (pAllDefs [pJdx]->trgDatum,pSrc))
+					{
+						pExpected = pJdx;
+						pExpDirection = cs_DTCDIR_INV;
+					}
+				}
+				pDef = CS_gpdefEx (&pDirection,pSrc,pTrg);
+				if ((pDef == NULL) != (pExpected < 0) ||
+					(pDef != NULL && (pDirection != pExpDirection || memcmp (pDef,pAllDefs [pExpected],sizeof (*pDef)) ||
+									  CS_gpchk (pDef,0,NULL,0) != 0)))
+				{
+					printf ("CS_gpdefEx mismatch for %s to %s (phase %d).\n",pSrc,pTrg,pPhase);
+					err_cnt += 1;
+					pIdx = pCount * 2;
+				}
+				CS_free (pDef);
+			}
+
+			/* The first phase adds a path between two datums for which no
+			   path currently exists; the second deletes it again. */
+			if (pPhase == 0)
+			{
+				memcpy (&pNewPath,pAllDefs [0],sizeof (pNewPath));
+				CS_stncp (pNewPath.pathName,"GPIDXTEST",sizeof (pNewPath.pathName));
+				for (pIdx = 1;pIdx < pCount;pIdx += 1)
+				{
+					CS_stncp (pNewPath.trgDatum,pAllDefs [pIdx]->trgDatum,sizeof (pNewPath.trgDatum));
+					if (!CS_stricmp (pNewPath.srcDatum,pNewPath.trgDatum)) continue;
+					pDef = CS_gpdefEx (&pDirection,pNewPath.srcDatum,pNewPath.trgDatum);
+					if (pDef == NULL) break;
+					CS_free (pDef);
+				}
+			}
+			for (pIdx = 0;pIdx < pCount;pIdx += 1) CS_free (pAllDefs [pIdx]);
+			CS_free (pAllDefs);
+			if ((pPhase == 0 && CS_gpupd (&pNewPath) < 0) ||
+				(pPhase == 1 && CS_gpdel (&pNewPath) != 0))
+			{
+				printf ("CS_gpupd/CS_gpdel failed while testing the geodetic path index.\n");
+				err_cnt += 1;
+				break;
+			}
+		}
+		cs_Protect = pProtect;
+		cs_Unique = pUnique;
+	}
+
+	/* Test the datum conversion snapshot.  Conversions set up from a
+	   snapshot which was written and then loaded again must consist of
+	   exactly the transformations which were resolved originally.  The
+	   snapshot, written to a scratch directory, must not be used once a
+	   user Datum dictionary has been replaced, even though its modification
+	   time is unchanged. */
+	{
+		extern char cs_UserDir [];
+
+		int sIdx;
+		int sJdx;
+		int sPass;
+		int sCount;
+		int sPairs;
+		int sLoaded;
+		int sExpected;
+		cs_Time_ sModTime;
+		cs_magic_t sMagic;
+		csFILE* sStrm;
+		struct cs_Dtdef_* sDtDef;
+		unsigned sGxIdx;
+		unsigned sGxCount;
+		Const struct cs_GxIndex_* sGxPtr;
+		struct cs_Datum_* sDatums [8][2];
+		struct cs_Dtcprm_* sDtcPtr;
+		char sDir [MAXPATH];
+		char sSnapPath [MAXPATH];
+		char sUsrPath [MAXPATH];
+		char sSaveUsrDir [MAXPATH];
+		char sXfrmNames [8][csPATH_MAXXFRM][cs_KEYNM_DEF1];
+		short sDirections [8][csPATH_MAXXFRM];
+		short sXfrmCounts [8];
+
+		sSnapPath [0] = sUsrPath [0] = '\0';
+		if (CStestHscratch (sDir,sizeof (sDir),"CStestH_Snap") != 0 ||
+			CStestHpath (sSnapPath,sizeof (sSnapPath),sDir,"DtcSnap.tmp") != 0 ||
+			CStestHpath (sUsrPath,sizeof (sUsrPath),sDir,cs_Dtname) != 0)
+		{
+			sSnapPath [0] = sUsrPath [0] = '\0';
+			printf ("Scratch directory for the datum conversion snapshot test could not be created.\n");
+			err_cnt += 1;
+		}
+		CS_stncp (sSaveUsrDir,cs_UserDir,sizeof (sSaveUsrDir));
+
+		/* Build a few pairs of datums for which conversions can be set up
+		   without any grid files; conversion to WGS84 and via WGS84. */
+		sPairs = 0;
+		sGxCount = CS_getGxIndexCount ();
+		for (sGxIdx = 0;sGxIdx < sGxCount && sPairs < 8;sGxIdx += 1)
+		{
+			sGxPtr = CS_getGxIndexEntry (sGxIdx);
+			if ((sGxPtr->methodCode & cs_DTCPRMTYP_MASK) != cs_DTCPRMTYP_GEOCTR ||
+				CS_stricmp (sGxPtr->trgDatum,"WGS84") ||
+				CS_locateGxByDatum (0,sGxPtr->srcDatum,"WGS84") != (int)sGxIdx)
+			{
+				continue;
+			}
+			sDatums [sPairs][0] = CS_dtloc (sGxPtr->srcDatum);
+			sDatums [sPairs][1] = CS_dtloc ((sPairs & 1) ? sDatums [sPairs - 1][0]->key_nm : "WGS84");
+			if (sDatums [sPairs][0] == NULL || sDatums [sPairs][1] == NULL)
+			{
+				CS_free (sDatums [sPairs][0]);
+				CS_free (sDatums [sPairs][1]);
+				continue;
+			}
+			sPairs += 1;
+		}
+
+		/* Pass zero resolves the conversions and records them, pass one
+		   uses the snapshot written at the end of pass zero.  Pass two adds
+		   an empty user Datum dictionary, which invalidates the snapshot,
+		   and records the conversions again; pass three uses that snapshot.
+		   Pass four replaces the user dictionary by one which is not
+		   empty. */
+		sCount = 0;
+		sStrm = NULL;
+		for (sPass = 0;sPass < 5 && sPairs > 0 && sSnapPath [0] != '\0';sPass += 1)
+		{
+			if (sPass == 2 || sPass == 4)
+			{
+				sModTime = CS_fileModTime (sUsrPath);
+				sDtDef = (sPass == 4) ? CS_dtdef ("WGS84") : NULL;
+				sStrm = (sPass == 4 && sDtDef == NULL) ? NULL : CS_fopen (sUsrPath,_STRM_BINWR);
+				if (sStrm != NULL)
+				{
+					sMagic = cs_DTDEF_MAGIC;
+					CS_bswap (&sMagic,"l");
+					CS_fwrite (&sMagic,1,sizeof (sMagic),sStrm);
+					if (sDtDef != NULL)
+					{
+						CS_stncp (sDtDef->key_nm,"CStestH-DT",sizeof (sDtDef->key_nm));
+						CS_dtwr (sStrm,sDtDef,FALSE);
+					}
+					CS_fclose (sStrm);
+				}
+				CS_free (sDtDef);
+				if (sStrm == NULL || (sPass == 4 && CStestHsetModTime (sUsrPath,sModTime) != 0))
+				{
+					printf ("Could not create a user dictionary to test the datum conversion snapshot.\n");
+					err_cnt += 1;
+					break;
+				}
+				CS_usrdr (sDir);
+			}
+			sExpected = (sPass == 1 || sPass == 3) ? sCount : 0;
+			sLoaded = CS_dtcSnapOpen (sSnapPath);
+			if (sLoaded != sExpected)
+			{
+				printf ("CS_dtcSnapOpen loaded %d conversions, expected %d (pass %d).\n",sLoaded,sExpected,sPass);
+				err_cnt += 1;
+				break;
+			}
+			for (sIdx = 0;sIdx < sPairs;sIdx += 1)
+			{
+				sDtcPtr = CSdtcsu (sDatums [sIdx][0],sDatums [sIdx][1],cs_DTCFLG_DAT_F,cs_DTCFLG_BLK_W);
+				if (sDtcPtr == NULL)
+				{
+					if (sPass == 0) sXfrmCounts [sIdx] = -1;
+					continue;
+				}
+				if (sPass == 2)
+				{
+					/* Already recorded by pass zero. */
+				}
+				else if (sPass == 0)
+				{
+					sCount += (sDtcPtr->xfrmCount > 0);
+					sXfrmCounts [sIdx] = sDtcPtr->xfrmCount;
+					for (sJdx = 0;sJdx < sDtcPtr->xfrmCount;sJdx += 1)
+					{
+						CS_stncp (sXfrmNames [sIdx][sJdx],sDtcPtr->xforms [sJdx]->gxDef.xfrmName,cs_KEYNM_DEF1);
+						sDirections [sIdx][sJdx] = sDtcPtr->xforms [sJdx]->userDirection;
+					}
+				}
+				else
+				{
+					for (sJdx = 0;sJdx < sDtcPtr->xfrmCount;sJdx += 1)
+					{
+						if (strcmp (sXfrmNames [sIdx][sJdx],sDtcPtr->xforms [sJdx]->gxDef.xfrmName) ||
+							sDirections [sIdx][sJdx] != sDtcPtr->xforms [sJdx]->userDirection)
+						{
+							break;
+						}
+					}
+					if (sDtcPtr->xfrmCount != sXfrmCounts [sIdx] || sJdx != sDtcPtr->xfrmCount)
+					{
+						printf ("Datum conversion snapshot mismatch for %s to %s.\n",sDatums [sIdx][0]->key_nm,sDatums [sIdx][1]->key_nm);
+						err_cnt += 1;
+					}
+				}
+				CS_dtcls (sDtcPtr);
+			}
+			if ((sPass == 0 || sPass == 2) && (sCount == 0 || CS_dtcSnapSave () != 0))
+			{
+				printf ("CS_dtcSnapSave failed (%d conversions).\n",sCount);
+				err_cnt += 1;
+				break;
+			}
+		}
+		CS_dtcSnapOpen (NULL);
+		CS_usrdr (sSaveUsrDir);
+		if (sSnapPath [0] != '\0')
+		{
+			CS_remove (sSnapPath);
+			CS_remove (sUsrPath);
+			CStestHrmdir (sDir);
+		}
+		for (sIdx = 0;sIdx < sPairs;sIdx += 1)
+		{
+			CS_free (sDatums [sIdx][0]);
+			CS_free (sDatums [sIdx][1]);
+		}
+	}
+
+	/* Test incremental compilation.  The output of an incremental
+	   compilation must be identical to that of a full compilation of the
+	   same source, and definitions which have not changed are not
+	   validated again; which the validation warnings reveal.  The source,
+	   produced from datums.asc, and the compiled output are written to a
+	   scratch directory.  Distributions without the dictionary sources
+	   skip the test. */
+	{
+		int iIdx;
+		int iPass;
+		int iErrCnt;
+		int iWarnCnt [3];
+		long iSize [2];
+		char* iImage [2];
+		csFILE* iStrm;
+		csFILE* iSrcStrm;
+		char iDir [MAXPATH];
+		char iSrcPath [MAXPATH];
+		char iAscPath [MAXPATH];
+		char iElPath [MAXPATH];
+		char iOutPath [MAXPATH];
+		char iFullPath [MAXPATH];
+		char iHashPath [MAXPATH];
+		char iLine [256];
+
+		CS_stcpy (cs_DirP,"datums.asc");
+		CS_stncp (iSrcPath,cs_Dir,sizeof (iSrcPath));
+		CS_stcpy (cs_DirP,cs_Elname);
+		CS_stncp (iElPath,cs_Dir,sizeof (iElPath));
+		iAscPath [0] = '\0';
+		iPass = 0;
+		if (CS_access (iSrcPath,4) != 0)
+		{
+			printf ("datums.asc not present, incremental compilation test skipped.\n");
+			iPass = 3;
+		}
+		else if (CStestHscratch (iDir,sizeof (iDir),"CStestH_Incr") != 0 ||
+				 CStestHpath (iAscPath,sizeof (iAscPath),iDir,"CStestH_Dt.asc") != 0 ||
+				 CStestHpath (iOutPath,sizeof (iOutPath),iDir,"CStestH_Dt.CSD") != 0 ||
+				 CStestHpath (iFullPath,sizeof (iFullPath),iDir,"CStestH_Df.CSD") != 0 ||
+				 CStestHpath (iHashPath,sizeof (iHashPath),iDir,"CStestH_Dt.CSH") != 0)
+		{
+			iAscPath [0] = '\0';
+			printf ("Scratch directory for the incremental compilation test could not be created.\n");
+			err_cnt += 1;
+			iPass = 3;
+		}
+
+		/* Pass zero compiles with no previous output, pass one compiles
+		   the same source again, pass two after a change to the last
+		   definition.  The last definition has neither description nor
+		   source, so validating it produces warnings. */
+		for (;iPass < 3;iPass += 1)
+		{
+			iSrcStrm = CS_fopen (iSrcPath,_STRM_TXTRD);
+			iStrm = CS_fopen (iAscPath,_STRM_TXTWR);
+			if (iSrcStrm == NULL || iStrm == NULL)
+			{
+				if (iSrcStrm != NULL) CS_fclose (iSrcStrm);
+				if (iStrm != NULL) CS_fclose (iStrm);
+				printf ("Could not produce the incremental compilation test source.\n");
+				err_cnt += 1;
+				break;
+			}
+			while (CS_fgets (iLine,sizeof (iLine),iSrcStrm) != NULL)
+			{
+				CS_fputs (iLine,iStrm);
+			}
+			CS_fclose (iSrcStrm);
+			sprintf (iLine,"\nDT_NAME: CStestH-Incr\n    ELLIPSOID: WGS84\n          USE: GEOCENTRIC\n      DELTA_X: %d.0\n      DELTA_Y: 2.0\n      DELTA_Z: 3.0\n",(iPass == 2) ? 4 : 1);
+			CS_fputs (iLine,iStrm);
+			CS_fclose (iStrm);
+
+			CStestHcmpCount = 0;
+			iErrCnt = CSdtcomp (iAscPath,iOutPath,cs_CMPLR_WARN | cs_CMPLR_INCR,iElPath,CStestHcmpErr);
+			iWarnCnt [iPass] = CStestHcmpCount;
+			iErrCnt += CSdtcomp (iAscPath,iFullPath,0,iElPath,CStestHcmpErr);
+			if (iErrCnt != 0)
+			{
+				printf ("Incremental compilation test, pass %d, reported %d errors.\n",iPass,iErrCnt);
+				err_cnt += 1;
+				break;
+			}
+
+			iImage [0] = iImage [1] = NULL;
+			for (iIdx = 0;iIdx < 2;iIdx += 1)
+			{
+				iSize [iIdx] = -1L;
+				iStrm = CS_fopen ((iIdx == 0) ? iOutPath : iFullPath,_STRM_BINRD);
+				if (iStrm == NULL) continue;
+				CS_fseek (iStrm,0L,SEEK_END);
+				iSize [iIdx] = CS_ftell (iStrm);
+				CS_fseek (iStrm,0L,SEEK_SET);
+				iImage [iIdx] = (char *)CS_malc ((size_t)iSize [iIdx] + 1);
+				if (iImage [iIdx] != NULL)
+				{
+					CS_fread (iImage [iIdx],1,(size_t)iSize [iIdx],iStrm);
+				}
+				CS_fclose (iStrm);
+			}
+			if (iImage [0] == NULL || iImage [1] == NULL || iSize [0] != iSize [1] ||
+				memcmp (iImage [0],iImage [1],(size_t)iSize [0]))
+			{
+				printf ("Incremental compilation, pass %d, differs from a full compilation.\n",iPass);
+				err_cnt += 1;
+			}
+			CS_free (iImage [0]);
+			CS_free (iImage [1]);
+		}
+		if (iAscPath [0] != '\0')
+		{
+			if (iPass == 3 && (iWarnCnt [1] >= iWarnCnt [0] || iWarnCnt [2] <= iWarnCnt [1]))
+			{
+				printf ("Incremental compilation validated %d, %d, %d times.\n",iWarnCnt [0],iWarnCnt [1],iWarnCnt [2]);
+				err_cnt += 1;
+			}
+			CS_remove (iAscPath);
+			CS_remove (iOutPath);
+			CS_remove (iFullPath);
+			CS_remove (iHashPath);
+			CStestHrmdir (iDir);
+		}
+	}
+
+	/* Test the dictionary bundle.  The bundle is written to, and opened
+	   from, a scratch directory which has no dictionaries of its own;
+	   definitions must be identical to those read from the dictionary
+	   directory.  A grid file bundled with a dictionary must produce the
+	   same values as the file on the disk. */
+	{
+		int bIdx;
+		int bOk;
+		int bStatus [2];
+		double bValue [2];
+		double bLL [3];
+		short bRecord [3];
+		csFILE* bStrm;
+		struct csBynGridFile_* bGrid;
+		struct csBynGridFileHdr_ bHdr;
+		struct cs_Csdef_* bCsDef [2];
+		struct cs_Dtdef_* bDtDef [2];
+		struct cs_Eldef_* bElDef [2];
+		const char* bNames [3];
+		char bDictDir [MAXPATH];
+		char bDir [MAXPATH];
+		char bPath [MAXPATH];
+		char bMbrPath [MAXPATH];
+		char bGridPath [MAXPATH];
+		char bSrcPath [MAXPATH];
+
+		*cs_DirP = '\0';
+		CS_stncp (bDictDir,cs_Dir,sizeof (bDictDir));
+		bPath [0] = bMbrPath [0] = bGridPath [0] = '\0';
+		bOk = (CStestHscratch (bDir,sizeof (bDir),"CStestH_Bnd") == 0 &&
+			   CStestHpath (bPath,sizeof (bPath),bDir,"CStestH.CSB") == 0 &&
+			   CStestHpath (bMbrPath,sizeof (bMbrPath),bDir,cs_Csname) == 0 &&
+			   CStestHpath (bGridPath,sizeof (bGridPath),bDir,"CStestH.byn") == 0);
+
+		memset (bCsDef,0,sizeof (bCsDef));
+		memset (bDtDef,0,sizeof (bDtDef));
+		memset (bElDef,0,sizeof (bElDef));
+		if (!bOk || CS_bundleWrite (bPath,bDictDir,NULL) != 0)
+		{
+			printf ("CS_bundleWrite failed to produce a dictionary bundle.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			for (bIdx = 0;bIdx < 2;bIdx += 1)
+			{
+				if (bIdx == 1 && CS_bundleOpen (bPath) != 0)
+				{
+					printf ("CS_bundleOpen failed to open the dictionary bundle.\n");
+					err_cnt += 1;
+					break;
+				}
+				bCsDef [bIdx] = CS_csdef ("UTM83-13");
+				bDtDef [bIdx] = CS_dtdef ("NAD27");
+				bElDef [bIdx] = CS_eldef ("CLRK66");
+			}
+			if (bIdx == 2)
+			{
+				bOk &= (bCsDef [0] != NULL && bCsDef [1] != NULL && !memcmp (bCsDef [0],bCsDef [1],sizeof (*bCsDef [0])) &&
+					   bDtDef [0] != NULL && bDtDef [1] != NULL && !memcmp (bDtDef [0],bDtDef [1],sizeof (*bDtDef [0])) &&
+					   bElDef [0] != NULL && bElDef [1] != NULL && !memcmp (bElDef [0],bElDef [1],sizeof (*bElDef [0])));
+				if (!bOk)
+				{
+					printf ("Dictionary bundle returned a different definition.\n");
+					err_cnt += 1;
+				}
+				CS_stcpy (cs_DirP,cs_Csname);
+				if (CS_access (cs_Dir,0) != 0 || CS_access (cs_Dir,2) == 0 || CS_fileModTime (cs_Dir) == 0)
+				{
+					printf ("Dictionary bundle member is not a read only file.\n");
+					err_cnt += 1;
+				}
+
+				/* Opening a member for writing, or for update, must fail;
+				   the open must not be redirected to a file on disk. */
+				bStrm = CS_fopen (cs_Dir,_STRM_BINWR);
+				if (bStrm == NULL) bStrm = CS_fopen (cs_Dir,_STRM_BINUP);
+				if (bStrm != NULL)
+				{
+					printf ("Dictionary bundle member was opened for writing.\n");
+					err_cnt += 1;
+					CS_fclose (bStrm);
+				}
+			}
+			for (bIdx = 0;bIdx < 2;bIdx += 1)
+			{
+				CS_free (bCsDef [bIdx]);
+				CS_free (bDtDef [bIdx]);
+				CS_free (bElDef [bIdx]);
+			}
+		}
+		CS_bundleOpen (NULL);
+		CS_altdr (bDictDir);
+		CS_remove (bPath);
+
+		/* Nothing may have been written beside the bundle. */
+		if (bMbrPath [0] != '\0' && CS_access (bMbrPath,0) == 0)
+		{
+			printf ("Dictionary bundle member was written to the disk.\n");
+			err_cnt += 1;
+			CS_remove (bMbrPath);
+		}
+
+		/* A small grid file, with a copy of the coordinate system
+		   dictionary, is bundled and then removed from the disk.  The
+		   bundled grid file is read through a stream which has no file
+		   descriptor. */
+		memset (&bHdr,0,sizeof (bHdr));
+		bHdr.southBoundary = 39L * 3600L;
+		bHdr.northBoundary = 40L * 3600L;
+		bHdr.westBoundary = -106L * 3600L;
+		bHdr.eastBoundary = -105L * 3600L;
+		bHdr.nsSpacing = 1800;
+		bHdr.ewSpacing = 1800;
+		bHdr.dataType = 1;
+		bHdr.factor = 1000.0;
+		bHdr.sizeOfData = 2;
+		bHdr.byteOrder = (short)(CS_isBigEndian () ? 0 : 1);
+		CS_bswap (&bHdr,cs_BSWP_BynFileHDR);
+
+		bLL [0] = -105.3;
+		bLL [1] = 39.8;
+		bLL [2] = 0.0;
+		bStatus [0] = bStatus [1] = -1;
+		bValue [0] = 0.0;
+		bValue [1] = 1.0;
+		bStrm = (!bOk || CStestHpath (bSrcPath,sizeof (bSrcPath),bDictDir,cs_Csname) != 0 ||
+						 CStestHcopy (bMbrPath,bSrcPath,-1L) != 0) ? NULL : CS_fopen (bGridPath,_STRM_BINWR);
+		if (bStrm != NULL)
+		{
+			CS_fwrite (&bHdr,1,sizeof (bHdr),bStrm);
+			for (bIdx = 0;bIdx < 9;bIdx += 1)
+			{
+				bRecord [bIdx % 3] = (short)(bIdx * 125 - 500);
+				if ((bIdx % 3) == 2) CS_fwrite (bRecord,sizeof (short),3,bStrm);
+			}
+			CS_fclose (bStrm);
+			bGrid = CSnewBynGridFile (bGridPath,0L,0UL,0.0);
+			if (bGrid != NULL) bStatus [0] = CScalcBynGridFile (bGrid,&bValue [0],bLL);
+			CSdeleteBynGridFile (bGrid);
+
+			bNames [0] = cs_Csname;
+			bNames [1] = "CStestH.byn";
+			bNames [2] = NULL;
+			if (CS_bundleWrite (bPath,bDir,bNames) == 0 &&
+				CS_remove (bGridPath) == 0 && CS_remove (bMbrPath) == 0 &&
+				CS_bundleOpen (bPath) == 0)
+			{
+				bGrid = CSnewBynGridFile (bGridPath,0L,0UL,0.0);
+				if (bGrid != NULL) bStatus [1] = CScalcBynGridFile (bGrid,&bValue [1],bLL);
+				CSdeleteBynGridFile (bGrid);
+			}
+			CS_bundleOpen (NULL);
+			CS_altdr (bDictDir);
+		}
+		if (bOk && (bStatus [0] != 0 || bStatus [1] != 0 || bValue [0] != bValue [1]))
+		{
+			printf ("Bundled grid file produced %d:%f, expected %d:%f.\n",bStatus [1],bValue [1],bStatus [0],bValue [0]);
+			err_cnt += 1;
+		}
+		if (bPath [0] != '\0')
+		{
+			CS_remove (bPath);
+			CS_remove (bMbrPath);
+			CS_remove (bGridPath);
+			CStestHrmdir (bDir);
+		}
+	}
+
+	/* Test the compiled Name Mapper.  The Name Mapper loaded from the
+	   compiled image must be identical to that loaded from the .CSV
+	   source, and a damaged image must be rejected.  The image is compiled
+	   from a copy of the .CSV source in a scratch directory; once that copy
+	   has been replaced, the image must no longer be used, even though the
+	   modification time of the copy is unchanged. */
+	{
+		int nIdx;
+		int nOk;
+		long nSize;
+		cs_Time_ nModTime;
+		char* nImage;
+		csFILE* nStrm;
+		TcsNameMapper* nMapperPtr;
+		std::wostringstream nCsv [4];
+		char nDictDir [MAXPATH];
+		char nDir [MAXPATH];
+		char nImgPath [MAXPATH];
+		char nCsvPath [MAXPATH];
+		char nCsPath [MAXPATH];
+		char nTmpPath [MAXPATH];
+		char nSrcPath [MAXPATH];
+
+		*cs_DirP = '\0';
+		CS_stncp (nDictDir,cs_Dir,sizeof (nDictDir));
+		nTmpPath [0] = '\0';
+		nOk = (CStestHscratch (nDir,sizeof (nDir),"CStestH_NmMap") == 0 &&
+			   CStestHpath (nImgPath,sizeof (nImgPath),nDir,cs_NameMapperImgName) == 0 &&
+			   CStestHpath (nCsvPath,sizeof (nCsvPath),nDir,cs_NameMapperName) == 0 &&
+			   CStestHpath (nCsPath,sizeof (nCsPath),nDir,cs_Csname) == 0 &&
+			   CStestHpath (nTmpPath,sizeof (nTmpPath),nDir,"CStestH.tmp") == 0);
+		nOk = nOk && (CStestHpath (nSrcPath,sizeof (nSrcPath),nDictDir,cs_Csname) == 0 &&
+					  CStestHcopy (nCsPath,nSrcPath,-1L) == 0);
+		nOk = nOk && (CStestHpath (nSrcPath,sizeof (nSrcPath),nDictDir,cs_NameMapperName) == 0 &&
+					  CStestHcopy (nCsvPath,nSrcPath,-1L) == 0);
+		nOk = nOk && (CS_altdr (nDir) == 0);
+		if (!nOk)
+		{
+			printf ("Scratch directory for the compiled Name Mapper test could not be prepared.\n");
+			err_cnt += 1;
+		}
+		for (nIdx = 0;nOk && nIdx < 2;nIdx += 1)
+		{
+			if (nIdx == 1 && csCompileNameMapper () != 0)
+			{
+				printf ("csCompileNameMapper failed to compile the Name Mapper.\n");
+				err_cnt += 1;
+				break;
+			}
+			csReleaseNameMapper ();
+			nMapperPtr = cmGetNameMapperPtr ();
+			if (nMapperPtr == 0)
+			{
+				printf ("Name Mapper failed to load.\n");
+				err_cnt += 1;
+				break;
+			}
+			nMapperPtr->WriteAsCsv (nCsv [nIdx]);
+		}
+		if (nIdx == 2)
+		{
+			nImage = 0;
+			nSize = -1L;
+			nStrm = CS_fopen (nImgPath,_STRM_BINRD);
+			if (nStrm != NULL)
+			{
+				CS_fseek (nStrm,0L,SEEK_END);
+				nSize = CS_ftell (nStrm);
+				CS_fseek (nStrm,0L,SEEK_SET);
+				nImage = (char *)CS_malc ((size_t)nSize);
+				if (nImage != 0 && CS_fread (nImage,1,(size_t)nSize,nStrm) != (size_t)nSize)
+				{
+					CS_free (nImage);
+					nImage = 0;
+				}
+				CS_fclose (nStrm);
+			}
+			TcsNameMapper nImgMapper;
+			if (nImage == 0 || !nImgMapper.ReadFromImage (nImage,(size_t)nSize))
+			{
+				printf ("Compiled Name Mapper image could not be read.\n");
+				err_cnt += 1;
+			}
+			else
+			{
+				nImgMapper.WriteAsCsv (nCsv [2]);
+				if (nCsv [0].str () != nCsv [1].str () || nCsv [0].str () != nCsv [2].str ())
+				{
+					printf ("Compiled Name Mapper differs from the .CSV source.\n");
+					err_cnt += 1;
+				}
+				((TcsNameMapImageRec *)(nImage + sizeof (TcsNameMapImageHdr)))->NameOffset = 0xFFFFFFFFUL;
+				if (nImgMapper.ReadFromImage (nImage,(size_t)nSize - 1) ||
+					nImgMapper.ReadFromImage (nImage,(size_t)nSize))
+				{
+					printf ("Damaged Name Mapper image was accepted.\n");
+					err_cnt += 1;
+				}
+			}
+			CS_free (nImage);
+
+			/* Replace the .CSV source by one lacking its last line. */
+			nImage = 0;
+			nSize = -1L;
+			nStrm = CS_fopen (nCsvPath,_STRM_BINRD);
+			if (nStrm != NULL)
+			{
+				CS_fseek (nStrm,0L,SEEK_END);
+				nSize = CS_ftell (nStrm);
+				CS_fseek (nStrm,0L,SEEK_SET);
+				nImage = (char *)CS_malc ((size_t)nSize);
+				if (nImage != 0 && CS_fread (nImage,1,(size_t)nSize,nStrm) != (size_t)nSize)
+				{
+					CS_free (nImage);
+					nImage = 0;
+				}
+				CS_fclose (nStrm);
+			}
+			for (nSize -= 2L;nImage != 0 && nSize > 0L && nImage [nSize] != '\n';nSize -= 1L);
+			nOk = (nImage != 0 && nSize > 0L);
+			CS_free (nImage);
+			nModTime = CS_fileModTime (nCsvPath);
+			nOk = nOk && (CStestHcopy (nTmpPath,nCsvPath,nSize + 1L) == 0 &&
+						  CS_remove (nCsvPath) == 0 && CS_rename (nTmpPath,nCsvPath) == 0 &&
+						  CStestHsetModTime (nCsvPath,nModTime) == 0);
+			csReleaseNameMapper ();
+			nMapperPtr = nOk ? cmGetNameMapperPtr () : 0;
+			if (nMapperPtr != 0)
+			{
+				nMapperPtr->WriteAsCsv (nCsv [3]);
+			}
+			if (nMapperPtr == 0 || nCsv [3].str () == nCsv [0].str ())
+			{
+				printf ("Compiled Name Mapper used after its .CSV source was replaced.\n");
+				err_cnt += 1;
+			}
+		}
+		csReleaseNameMapper ();
+		CS_altdr (nDictDir);
+		if (nTmpPath [0] != '\0')
+		{
+			CS_remove (nImgPath);
+			CS_remove (nCsvPath);
+			CS_remove (nCsPath);
+			CS_remove (nTmpPath);
+			CStestHrmdir (nDir);
+		}
+	}
+
+	/* Test the hashed numeric ID index of the Name Mapper, and the EPSG
+	   code conversion entry points which rely upon it.  The index must
+	   always produce the first entry, in collating sequence, having the
+	   requested number; regardless of how the entries came and went. */
+	{
+		int hIdx;
+		int hSt [2];
+		unsigned hCount;
+		unsigned long hId;
+		TcsGenericId hGenId;
+		TcsNameMap hExtracted;
+		double hXyz [2][3];
+		char hNames [2][MAXPATH];
+		const TcsNameMapper* hMapperPtr;
+
+		hMapperPtr = cmGetNameMapperPtr ();
+		if (hMapperPtr == 0)
+		{
+			printf ("Name Mapper failed to load.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			TcsNameMapper hMapper (*hMapperPtr);
+			hCount = 0;
+			hMapper.LocateIdByIdx (csMapProjectedCSysKeyName,csMapFlvrEpsg,0xFFFFFFFF,&hCount);
+			for (hIdx = 0;hIdx < (int)hCount;hIdx += 1)
+			{
+				hId = hMapper.LocateIdByIdx (csMapProjectedCSysKeyName,csMapFlvrEpsg,(unsigned)hIdx);
+				hGenId = hMapper.Locate (csMapProjectedCSysKeyName,csMapFlvrEpsg,hId);
+				if (hGenId.IsNotKnown () || hGenId != hMapperPtr->Locate (csMapProjectedCSysKeyName,csMapFlvrEpsg,hId))
+				{
+					printf ("Name Mapper copy failed to locate EPSG projected system %lu.\n",hId);
+					err_cnt += 1;
+					break;
+				}
+			}
+
+			TcsGenericId hGenIdB (csMapFlvrAnon13,1UL);
+			TcsGenericId hGenIdA (csMapFlvrAnon13,2UL);
+			TcsNameMap hMapB (hGenIdB,csMapProjectedCSysKeyName,csMapFlvrAnon13,7777777UL,L"CStestH-B");
+			TcsNameMap hMapA (hGenIdA,csMapProjectedCSysKeyName,csMapFlvrAnon13,7777777UL,L"CStestH-A");
+			TcsNameMap hMapC (hGenIdB,csMapProjectedCSysKeyName,csMapFlvrAnon13,7777778UL,L"CStestH-B");
+			hMapper.Add (hMapB);
+			hSt [0] = (hMapper.Locate (csMapProjectedCSysKeyName,csMapFlvrAnon13,7777777UL) == hGenIdB);
+			hMapper.Add (hMapA);
+			hSt [0] &= (hMapper.Locate (csMapProjectedCSysKeyName,csMapFlvrAnon13,7777777UL) == hGenIdA);
+			hMapper.ExtractAndRemove (hExtracted,csMapProjectedCSysKeyName,csMapFlvrAnon13,L"CStestH-A");
+			hSt [0] &= (hMapper.Locate (csMapProjectedCSysKeyName,csMapFlvrAnon13,7777777UL) == hGenIdB);
+			hMapper.Replace (hMapC,hMapB);
+			hSt [0] &= hMapper.Locate (csMapProjectedCSysKeyName,csMapFlvrAnon13,7777777UL).IsNotKnown ();
+			hSt [0] &= (hMapper.Locate (csMapProjectedCSysKeyName,csMapFlvrAnon13,7777778UL) == hGenIdB);
+			hSt [0] &= (hMapper.LocateName (csMapProjectedCSysKeyName,csMapFlvrAnon13,hGenIdB) != 0);
+			if (!hSt [0])
+			{
+				printf ("Name Mapper numeric ID index is not maintained by Add/Replace/ExtractAndRemove.\n");
+				err_cnt += 1;
+			}
+		}
+
+		for (hIdx = 0;hIdx < 3;hIdx += 1)
+		{
+			hXyz [0][0] = hXyz [1][0] = 500000.0;
+			hXyz [0][1] = hXyz [1][1] = 4400000.0;
+			hXyz [0][2] = hXyz [1][2] = 0.0;
+			hSt [0] = CS_cnvrt ("UTM83-13","LL27",hXyz [0]);
+			hSt [1] = CS_cnvrtEpsg (26913L,4267L,hXyz [1]);
+			if (hSt [0] != hSt [1] || hXyz [0][0] != hXyz [1][0] || hXyz [0][1] != hXyz [1][1])
+			{
+				printf ("CS_cnvrtEpsg result differs from CS_cnvrt.\n");
+				err_cnt += 1;
+				break;
+			}
+		}
+		if (CS_cnvrtEpsg (1L,4267L,hXyz [1]) >= 0)
+		{
+			printf ("CS_cnvrtEpsg accepted an unknown EPSG code.\n");
+			err_cnt += 1;
+		}
+
+		/* A name mapper which cannot be loaded must be reported as such,
+		   not as an unknown EPSG code.  32614 is not in the cache. */
+		CS_stncp (hNames [0],cs_NameMapperName,MAXPATH);
+		CS_stncp (hNames [1],cs_NameMapperImgName,MAXPATH);
+		CS_stncp (cs_NameMapperName,"CStestH_None.csv",MAXPATH);
+		CS_stncp (cs_NameMapperImgName,"CStestH_None.nmp",MAXPATH);
+		csReleaseNameMapper ();
+		hSt [0] = CS_cnvrtEpsg (32614L,4267L,hXyz [1]);
+		CS_stncp (cs_NameMapperName,hNames [0],MAXPATH);
+		CS_stncp (cs_NameMapperImgName,hNames [1],MAXPATH);
+		csReleaseNameMapper ();
+		if (hSt [0] != -cs_NMMAP_INIT)
+		{
+			printf ("CS_cnvrtEpsg did not report the name mapper failure.\n");
+			err_cnt += 1;
+		}
+	}
+
+	/* Test the Name Mapper name index and string interning.  Names must be
+	   located without regard to case, aliases must be located, the index
+	   must follow the changes made by the maintenance functions, and equal
+	   names must share storage. */
+	{
+		int nmIdx;
+		int nmOk;
+		unsigned nmCount;
+		const wchar_t* nmNamePtr;
+		std::wstring nmUpper;
+		TcsNameMap nmExtracted;
+		const TcsNameMapper* nmMapperPtr;
+
+		nmMapperPtr = cmGetNameMapperPtr ();
+		if (nmMapperPtr == 0)
+		{
+			printf ("Name Mapper failed to load.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			nmCount = 0;
+			nmMapperPtr->LocateNameByIdx (csMapProjectedCSysKeyName,csMapFlvrEsri,0xFFFFFFFF,&nmCount);
+			for (nmIdx = 0;nmIdx < (int)nmCount;nmIdx += 1)
+			{
+				nmNamePtr = nmMapperPtr->LocateNameByIdx (csMapProjectedCSysKeyName,csMapFlvrEsri,(unsigned)nmIdx);
+				nmUpper = nmNamePtr;
+				std::transform (nmUpper.begin (),nmUpper.end (),nmUpper.begin (),towupper);
+				if (nmMapperPtr->Locate (csMapProjectedCSysKeyName,csMapFlvrEsri,nmNamePtr).IsNotKnown () ||
+					nmMapperPtr->Locate (csMapProjectedCSysKeyName,csMapFlvrEsri,nmUpper.c_str ()) !=
+					nmMapperPtr->Locate (csMapProjectedCSysKeyName,csMapFlvrEsri,nmNamePtr))
+				{
+					printf ("Name Mapper failed to locate ESRI name %ls regardless of case.\n",nmNamePtr);
+					err_cnt += 1;
+					break;
+				}
+			}
+
+			TcsNameMapper nmMapper (*nmMapperPtr);
+			TcsGenericId nmGenId (csMapFlvrAnon13,3UL);
+			TcsNameMap nmMap (nmGenId,csMapGeographicCSysKeyName,csMapFlvrAnon13,7777779UL,L"CStestH-Name");
+			std::wstring nmCopy (L"CStestH-Name");
+			TcsNameMap nmSame (csMapGeographicCSysKeyName,csMapFlvrAnon13,nmCopy.c_str ());
+			nmOk = (nmMap.GetNamePtr () == nmSame.GetNamePtr ());
+			nmMapper.Add (nmMap);
+			nmOk &= (nmMapper.Locate (csMapGeographicCSysKeyName,csMapFlvrAnon13,L"cstesth-NAME") == nmGenId);
+			nmMapper.AliasExistingName (csMapGeographicCSysKeyName,csMapFlvrAnon13,L"CStestH-Name",L"CStestH-NewName");
+			nmOk &= (nmMapper.Locate (csMapGeographicCSysKeyName,csMapFlvrAnon13,L"CSTESTH-NAME") == nmGenId);
+			nmOk &= (nmMapper.Locate (csMapGeographicCSysKeyName,csMapFlvrAnon13,L"cstesth-newname") == nmGenId);
+			nmNamePtr = nmMapper.LocateName (csMapGeographicCSysKeyName,csMapFlvrAnon13,nmGenId);
+			nmOk &= (nmNamePtr != 0 && !wcscmp (nmNamePtr,L"CStestH-NewName"));
+			nmMapper.ExtractAndRemove (nmExtracted,csMapGeographicCSysKeyName,csMapFlvrAnon13,L"CStestH-Name",1);
+			nmOk &= nmMapper.Locate (csMapGeographicCSysKeyName,csMapFlvrAnon13,L"CStestH-Name").IsNotKnown ();
+			nmOk &= (nmMapper.Locate (csMapGeographicCSysKeyName,csMapFlvrAnon13,L"CStestH-NewName") == nmGenId);
+			if (!nmOk)
+			{
+				printf ("Name Mapper name index or string interning failed.\n");
+				err_cnt += 1;
+			}
+		}
+	}
+
+	/* Test the zero copy CSV reader.  The records and fields it produces
+	   must be those produced by csGetCsvRecord and csCsvFieldParse, the
+	   columnar table must agree with the reader, and the Name Mapper
+	   loaded through the reader must be the same as that loaded a line
+	   at a time through the wide character stream functions. */
+	{
+		int rOk;
+		short rFldIdx;
+		short rFldCnt;
+		unsigned rRecNbr;
+		EcsCsvStatus rOldSt;
+		EcsCsvStatus rNewSt;
+		std::wstring rOldRec;
+		std::wstring rNewFld;
+		std::wstring rWide;
+		std::vector<std::wstring> rOldFlds;
+		TcsCsvView rView;
+		TcsCsvStatus rCsvStatus;
+		const char* rSample = "\"Code\",\"Name\",Remarks\r\n"
+							  "1, \"a,b\" ,plain\r\n"
+							  "2,\"say \"\"hi\"\"\",\"two\r\nlines\"\r\n"
+							  "3,,\n"
+							  "\n"
+							  "4,\"x\" y,z\n"
+							  "5,\"open\n";
+
+		rWide.assign (rSample,rSample + strlen (rSample));
+		std::wistringstream rStrm (rWide);
+		TcsCsvReader rReader;
+		rReader.Attach (rSample,strlen (rSample));
+		rOk = 1;
+		for (;;)
+		{
+			rOldSt = csGetCsvRecord (rOldRec,rStrm);
+			rNewSt = rReader.NextRecord ();
+			if (rOldSt == csvEof || rOldSt == csvEarlyEof)
+			{
+				/* The last record ends in a quote. */
+				rOk &= (rNewSt == csvEndInQuote);
+				rOk &= (rReader.NextRecord () == csvEof);
+				break;
+			}
+			if (rNewSt != rOldSt)
+			{
+				rOk = 0;
+				break;
+			}
+			if (rOldSt != csvOk)
+			{
+				continue;
+			}
+			rOldSt = csCsvFieldParse (rOldFlds,rOldRec);
+			rFldCnt = rReader.FieldCount ();
+			if (rOldSt != rReader.RecordStatus ())
+			{
+				rOk = 0;
+				break;
+			}
+			if (rOldSt != csvOk)
+			{
+				continue;
+			}
+			rOk &= (rFldCnt == (short)rOldFlds.size ());
+			for (rFldIdx = 0;rOk && rFldIdx < rFldCnt;rFldIdx += 1)
+			{
+				rOk &= (rReader.GetField (rNewFld,rFldIdx) == csvOk && rNewFld == rOldFlds [rFldIdx]);
+			}
+		}
+		if (!rOk)
+		{
+			printf ("TcsCsvReader records or fields differ from csGetCsvRecord/csCsvFieldParse.\n");
+			err_cnt += 1;
+		}
+
+		/* Fields split on demand; UTF-8 and Latin-1 conversion. */
+		rReader.Attach ("\xC3\xA9t\xE9,2,3",8);
+		rOk  = (rReader.NextRecord () == csvOk);
+		rOk &= (rReader.GetField (rNewFld,1) == csvOk && rNewFld == L"2");
+		rOk &= (rReader.GetField (rView,7) == csvInvFieldNbr);
+		rOk &= (rReader.GetField (rNewFld,0) == csvOk && rNewFld == L"\x00E9t\x00E9");
+		rOk &= (rReader.FieldCount () == 3);
+		rOk &= (rReader.NextRecord () == csvEof);
+		if (!rOk)
+		{
+			printf ("TcsCsvReader field access or character conversion failed.\n");
+			err_cnt += 1;
+		}
+
+		/* The columnar table. */
+		TcsCsvTable rTable;
+		rReader.Attach (rSample,strlen (rSample) - 18);
+		rOk  = rTable.Load (rReader,true,rCsvStatus,true);
+		rOk &= (rTable.RecordCount () == 3 && rTable.FieldCount () == 3);
+		rOk &= (rTable.GetFldNbr (L"name") == 1);
+		rOk &= (rTable.GetField (rNewFld,0,1) && rNewFld == L"a,b");
+		rOk &= (rTable.GetField (rNewFld,1,1) && rNewFld == L"say \"hi\"");
+		rOk &= (rTable.GetField (rNewFld,1,2) && rNewFld == L"two\nlines");
+		rOk &= (rTable.GetView (2,2).Empty () && rTable.GetView (2,0).IsEqual ("3"));
+		for (rRecNbr = 0;rRecNbr < rTable.RecordCount ();rRecNbr += 1)
+		{
+			rOk &= (rTable.GetColumn (0)[rRecNbr].AsULong () == rRecNbr + 1);
+		}
+		if (!rOk)
+		{
+			printf ("TcsCsvTable failed to load the sample CSV data.\n");
+			err_cnt += 1;
+		}
+
+		/* The Name Mapper, loaded both ways. */
+		char rNmPath [MAXPATH];
+		CS_stcpy (cs_DirP,"NameMapper.csv");
+		CS_stncp (rNmPath,cs_Dir,sizeof (rNmPath));
+		std::string rLine;
+		TcsNameMap rNameMap;
+		TcsNameMapper rMapperA;
+		TcsNameMapper rMapperB;
+		std::ifstream rNmStrm (rNmPath,std::ios_base::in);
+		rOk = rNmStrm.is_open ();
+		while (std::getline (rNmStrm,rLine))
+		{
+			/* One line at a time through the stream functions, skipping
+			   what does not begin with a digit and what does not parse. */
+			if (rLine.empty () || !isdigit ((unsigned char)rLine [0]))
+			{
+				continue;
+			}
+			rWide.assign (rLine.begin (),rLine.end ());
+			rWide += L'\n';
+			std::wistringstream rLineStrm (rWide);
+			if (rNameMap.ReadFromStream (rLineStrm) == csvOk)
+			{
+				rMapperA.Add (rNameMap);
+			}
+		}
+		TcsCsvReader rNmReader (TcsNameMapper::Delimiters);
+		rOk &= rNmReader.Open (rNmPath);
+		rOk &= (rMapperB.ReadFromReader (rNmReader,rCsvStatus) == csvOk);
+		if (rOk)
+		{
+			std::wostringstream rCsvA;
+			std::wostringstream rCsvB;
+			rMapperA.WriteAsCsv (rCsvA);
+			rMapperB.WriteAsCsv (rCsvB);
+			rOk = (rCsvA.str () == rCsvB.str () && rCsvA.str ().length () > 100000);
+		}
+		if (!rOk)
+		{
+			printf ("Name Mapper loaded by TcsCsvReader differs from that loaded by stream.\n");
+			err_cnt += 1;
+		}
+	}
+
+	/* Test the TcsEpsgDataSetV6 indices and snapshot.  A small synthetic
+	   EPSG data set is written to a scratch folder and loaded four times:
+	   from the .CSV files without a snapshot folder, which must not write a
+	   snapshot; from the .CSV files, writing the snapshot; from the
+	   snapshot; and from the .CSV files again after one of them has changed
+	   size, but not modification time.  Lookups by code, and by foreign key,
+	   must produce the same results as a linear search in all cases. */
+	{
+		int eIdx;
+		int eOk;
+		int eLoad;
+		unsigned eRecNbr;
+		unsigned eLinNbr;
+		cs_Time_ eModTime;
+		csFILE* eStrm;
+		const TcsEpsgTblMap* eTblPtr;
+		const TcsEpsgTable* eTable;
+		std::wstring eField;
+		std::wstring eParams;
+		wchar_t eFolder [MAXPATH];
+		char eDir [MAXPATH];
+		char eCsvPath [MAXPATH];
+		char eUomPath [MAXPATH];
+		char eSnapPath [MAXPATH];
+		char eTblName [128];
+		char eFileName [132];
+
+		static const char* eLoadName [4] = { "no snapshot", ".CSV", "snapshot", "changed .CSV" };
+
+		/* Coordinate_Operation Parameter Value records; deliberately not in
+		   order. */
+		static const unsigned long eParmValue [][3] =
+		{
+			{ 1002UL, 9603UL, 8606UL },
+			{ 1001UL, 9603UL, 8605UL },
+			{ 1002UL, 9603UL, 8605UL },
+			{ 1003UL, 9606UL, 8608UL },
+			{ 1001UL, 9603UL, 8607UL },
+			{ 1002UL, 9603UL, 8607UL },
+			{ 1001UL, 9603UL, 8606UL },
+		};
+
+		eUomPath [0] = eSnapPath [0] = '\0';
+		eOk = (CStestHscratch (eDir,sizeof (eDir),"CStestH_Epsg") == 0);
+		mbstowcs (eFolder,eDir,wcCount (eFolder));
+		for (eTblPtr = KcsEpsgTblMap;eOk && eTblPtr->TableId != epsgTblUnknown;++eTblPtr)
+		{
+			wcstombs (eTblName,eTblPtr->TableName,sizeof (eTblName));
+			CS_stncp (eFileName,eTblName,sizeof (eFileName));
+			CS_stncat (eFileName,".csv",sizeof (eFileName));
+			if (CStestHpath (eCsvPath,sizeof (eCsvPath),eDir,eFileName) != 0)
+			{
+				eOk = FALSE;
+				break;
+			}
+			if (eTblPtr->TableId == epsgTblUnitOfMeasure)
+			{
+				CS_stncp (eUomPath,eCsvPath,sizeof (eUomPath));
+			}
+			eStrm = CS_fopen (eCsvPath,_STRM_TXTWR);
+			if (eStrm == NULL)
+			{
+				eOk = FALSE;
+				break;
+			}
+			for (eIdx = 0;eIdx < eTblPtr->FieldCount;eIdx += 1)
+			{
+				fprintf (eStrm,"%sFIELD_%d",(eIdx == 0) ? "" : ",",eIdx);
+			}
+			fprintf (eStrm,"\n");
+			if (eTblPtr->TableId == epsgTblParameterValue)
+			{
+				for (eIdx = 0;eIdx < (int)(sizeof (eParmValue) / sizeof (eParmValue [0]));eIdx += 1)
+				{
+					fprintf (eStrm,"%lu,%lu,%lu,1.5,,9001\n",eParmValue [eIdx][0],eParmValue [eIdx][1],eParmValue [eIdx][2]);
+				}
+			}
+			else if (eTblPtr->TableId == epsgTblOperationPath)
+			{
+				fprintf (eStrm,"5002,1003,1\n5001,1002,2\n5001,1001,1\n");
+			}
+			else if (eTblPtr->TableId == epsgTblUnitOfMeasure)
+			{
+				fprintf (eStrm,"9102,degree,angle,9101,3.14159265358979,180,,,,,,FALSE\n");
+				fprintf (eStrm,"9001,metre,length,9001,1,1,,,,,,FALSE\n");
+				fprintf (eStrm,"9101,radian,angle,9101,1,1,,,,,,FALSE\n");
+			}
+			else if (eTblPtr->TableId == epsgTblVersionHistory)
+			{
+				fprintf (eStrm,"1,2000-01-01,7.9,Test,,\n2,2001-01-01,8.99,Test,,\n");
+			}
+			CS_fclose (eStrm);
+		}
+		wcstombs (eFileName,TcsEpsgDataSetV6::SnapshotName,sizeof (eFileName));
+		eFileName [sizeof (eFileName) - 1] = '\0';
+		if (eOk && CStestHpath (eSnapPath,sizeof (eSnapPath),eDir,eFileName) != 0)
+		{
+			eOk = FALSE;
+		}
+		if (!eOk)
+		{
+			printf ("EPSG data set scratch folder could not be prepared.\n");
+			err_cnt += 1;
+		}
+
+		for (eLoad = 0;eOk && eLoad < 4;eLoad += 1)
+		{
+			if (eLoad == 3)
+			{
+				/* Add a record to the Unit of Measure table, and restore its
+				   modification time. */
+				eModTime = CS_fileModTime (eUomPath);
+				eStrm = CS_fopen (eUomPath,_STRM_TXTUP);
+				eOk = (eStrm != NULL);
+				if (eOk)
+				{
+					CS_fseek (eStrm,0L,SEEK_END);
+					fprintf (eStrm,"9103,arc-minute,angle,9101,3.14159265358979,10800,,,,,,FALSE\n");
+					CS_fclose (eStrm);
+					eOk = (CStestHsetModTime (eUomPath,eModTime) == 0);
+				}
+			}
+			TcsEpsgDataSetV6 eDataSet (eFolder,0,(eLoad == 0) ? 0 : eFolder);
+			eOk &= eDataSet.IsOk () && !wcscmp (eDataSet.GetRevisionLevel (),L"8.99");
+			if (eOk && eLoad < 2)
+			{
+				eOk = ((CS_fileModTime (eSnapPath) != 0) == (eLoad == 1));
+			}
+			if (eOk)
+			{
+				eTable = eDataSet.GetTablePtr (epsgTblUnitOfMeasure);
+				eRecNbr = eTable->LocateRecordByEpsgCode (TcsEpsgCode (9102UL));
+				eOk = eTable->GetField (eField,eRecNbr,epsgFldUnitOfMeasName) && (eField == L"degree");
+				eRecNbr = eTable->LocateRecordByEpsgCode (TcsEpsgCode (9103UL));
+				eOk &= ((eRecNbr != TcsEpsgTable::GetInvalidRecordNbr ()) == (eLoad == 3));
+			}
+			if (eOk)
+			{
+				/* The parameters of each operation, by way of the foreign key
+				   index and by way of a linear search. */
+				eTable = eDataSet.GetTablePtr (epsgTblParameterValue);
+				eParams.clear ();
+				for (eIdx = 1001;eIdx <= 1004;eIdx += 1)
+				{
+					std::wstring eCodeStr (TcsEpsgCode ((unsigned long)eIdx).AsWstring ());
+					eRecNbr = eTable->EpsgLocateFirst (epsgFldCoordOpCode,TcsEpsgCode ((unsigned long)eIdx));
+					eLinNbr = eTable->EpsgLocateFirst (epsgFldCoordOpCode,eCodeStr.c_str (),false);
+					while (eOk && eRecNbr != TcsEpsgTable::GetInvalidRecordNbr ())
+					{
+						eOk = (eRecNbr == eLinNbr) && eTable->GetField (eField,eRecNbr,epsgFldParameterCode);
+						eParams += eField + L";";
+						eRecNbr = eTable->EpsgLocateNext (eRecNbr,epsgFldCoordOpCode,TcsEpsgCode ((unsigned long)eIdx));
+						eLinNbr = eTable->EpsgLocateNext (eLinNbr,epsgFldCoordOpCode,eCodeStr.c_str (),false);
+					}
+					eOk &= (eLinNbr == TcsEpsgTable::GetInvalidRecordNbr ());
+				}
+				eOk &= (eParams == L"8605;8606;8607;8605;8606;8607;8608;");
+			}
+			if (eOk)
+			{
+				eTable = eDataSet.GetTablePtr (epsgTblOperationPath);
+				eRecNbr = eTable->EpsgLocateFirst (epsgFldConcatOperationCode,TcsEpsgCode (5001UL));
+				eOk = eTable->GetField (eField,eRecNbr,epsgFldSingleOperationCode) && (eField == L"1001");
+				eRecNbr = eTable->EpsgLocateNext (eRecNbr,epsgFldConcatOperationCode,TcsEpsgCode (5001UL));
+				eOk &= eTable->GetField (eField,eRecNbr,epsgFldSingleOperationCode) && (eField == L"1002");
+				eRecNbr = eTable->EpsgLocateNext (eRecNbr,epsgFldConcatOperationCode,TcsEpsgCode (5001UL));
+				eOk &= (eRecNbr == TcsEpsgTable::GetInvalidRecordNbr ());
+			}
+			if (!eOk)
+			{
+				printf ("EPSG data set %s load or lookup failed.\n",eLoadName [eLoad]);
+				err_cnt += 1;
+			}
+		}
+
+		for (eTblPtr = KcsEpsgTblMap;eDir [0] != '\0' && eTblPtr->TableId != epsgTblUnknown;++eTblPtr)
+		{
+			wcstombs (eTblName,eTblPtr->TableName,sizeof (eTblName));
+			CS_stncp (eFileName,eTblName,sizeof (eFileName));
+			CS_stncat (eFileName,".csv",sizeof (eFileName));
+			if (CStestHpath (eCsvPath,sizeof (eCsvPath),eDir,eFileName) == 0)
+			{
+				CS_remove (eCsvPath);
+			}
+		}
+		if (eSnapPath [0] != '\0') CS_remove (eSnapPath);
+		CStestHrmdir (eDir);
+	}
+
+	/* Test the WKT element parser.  Sub-elements are located at any depth,
+	   using either form of bracket, regardless of white space and new lines;
+	   but not within quoted strings.  The values of the elements must be
+	   what remains after the sub-elements are removed. */
+	{
+		int wOk;
+		size_t wIndex;
+		const TrcWktElement* wGeogCS;
+		const TrcWktElement* wSpheroid;
+		const TrcWktElement* wParameter;
+
+		TrcWktElement wElement ("PROJCS[\"UTM, \"\"UNIT[1]\"\"\",\n"
+								"  GEOGCS [\"G (UNIT[2])\" , DATUM (\"D\",SPHEROID[\"S\",6378137.0,298.257]) ,\n"
+								"          PRIMEM[\"Greenwich\",0],UNIT[\"Degree\",0.0174532925199433]],\n"
+								"  PROJECTION[\"Transverse_Mercator\"],\n"
+								"  PARAMETER[\"False_Easting\",500000.0],PARAMETER[\"Scale_Factor\",0.9996],\n"
+								"  UNIT[\"Meter\",1.0],AUTHORITY[\"EPSG\",\"32611\"]]");
+		wElement.ParseChildren ();
+		wGeogCS = wElement.ChildLocate (rcWktGeogCS);
+		wSpheroid = wElement.ChildSearch (rcWktSpheroid);
+		wIndex = 0;
+		wElement.ChildLocate (rcWktParameter,wIndex);
+		wParameter = wElement.ChildLocate (rcWktParameter,wIndex);
+		wOk  = (wElement.GetElementType () == rcWktProjCS);
+		wOk &= !strcmp (wElement.GetElementNameC (),"UTM, \"\"UNIT[1]\"\"");
+		wOk &= wElement.GetCompleteValue ().empty ();
+		wOk &= (wElement.GetParameterCount () == 2);
+		wOk &= (wGeogCS != 0 && !strcmp (wGeogCS->GetElementNameC (),"G (UNIT[2])") && wGeogCS->GetCompleteValue ().empty ());
+		wOk &= (wSpheroid != 0 && wSpheroid->GetFieldDouble (1) == 298.257);
+		wOk &= (wSpheroid != 0 && wSpheroid->GetCompleteValue () == "6378137.0,298.257");
+		wOk &= (wParameter != 0 && !strcmp (wParameter->GetElementNameC (),"Scale_Factor") && wParameter->GetFieldDouble (0) == 0.9996);
+		wOk &= (wElement.ProduceWkt () ==
+					"PROJCS[\"UTM, \"\"UNIT[1]\"\"\","
+					"GEOGCS[\"G (UNIT[2])\",DATUM[\"D\",SPHEROID[\"S\",6378137.0,298.257]],"
+					"PRIMEM[\"Greenwich\",0],UNIT[\"Degree\",0.0174532925199433]],"
+					"PROJECTION[\"Transverse_Mercator\"],"
+					"PARAMETER[\"False_Easting\",500000.0],PARAMETER[\"Scale_Factor\",0.9996],"
+					"UNIT[\"Meter\",1.0],AUTHORITY[\"EPSG\",\"32611\"]]");
+		if (!wOk)
+		{
+			printf ("WKT element parser produced an unexpected element tree.\n");
+			err_cnt += 1;
+		}
+	}
+
+	/* Test the CS_wktToCsEx resolution cache.  A WKT string which differs
+	   only in formatting from one already resolved must produce the same
+	   result, whether from the cache or not; one which differs in value
+	   must not be confused with it. */
+	{
+		int wIdx;
+		int wOk;
+		int wCacheSize;
+		int wSt [5];
+		char wWkt [3][2048];
+		char* wPtr;
+		struct cs_Csdef_ wCsDef [5];
+		struct cs_Dtdef_ wDtDef [5];
+		struct cs_Eldef_ wElDef [5];
+
+		wOk = (CS_cs2Wkt (wWkt [0],sizeof (wWkt [0]),"UTM83-13",wktFlvrEsri) == 0);
+		wPtr = strstr (wWkt [0],"500000.000");
+
+		/* Reformatting at most doubles the length of the WKT. */
+		if (!wOk || wPtr == NULL || strlen (wWkt [0]) * 2 + 16 > sizeof (wWkt [1]))
+		{
+			printf ("CS_cs2Wkt failed to produce the WKT for the resolution cache test.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			/* wWkt [1] is reformatted, wWkt [2] has a different false easting. */
+			*wPtr = '\0';
+			CS_stncp (wWkt [2],wWkt [0],sizeof (wWkt [2]));
+			CS_stncat (wWkt [2],"500001.000",sizeof (wWkt [2]));
+			CS_stncat (wWkt [2],wPtr + 10,sizeof (wWkt [2]));
+			CS_stncp (wWkt [1]," ",sizeof (wWkt [1]));
+			CS_stncat (wWkt [1],wWkt [0],sizeof (wWkt [1]));
+			CS_stncat (wWkt [1],"+5.0E+05\r\n\t",sizeof (wWkt [1]));
+			CS_stncat (wWkt [1],wPtr + 10,sizeof (wWkt [1]));
+			*wPtr = '5';
+			for (wPtr = wWkt [1];(wPtr = strchr (wPtr,',')) != NULL;wPtr += 2)
+			{
+				memmove (wPtr + 2,wPtr + 1,strlen (wPtr + 1) + 1);
+				wPtr [1] = ' ';
+			}
+			memset (wCsDef,0,sizeof (wCsDef));
+			memset (wDtDef,0,sizeof (wDtDef));
+			memset (wElDef,0,sizeof (wElDef));
+			wCacheSize = cs_WktCacheSize;
+			for (wIdx = 0;wIdx < 5;wIdx += 1)
+			{
+				if (wIdx == 3) CS_rlsWktCache ();
+				if (wIdx == 4) cs_WktCacheSize = 0;
+				wSt [wIdx] = CS_wktToCsEx (&wCsDef [wIdx],&wDtDef [wIdx],&wElDef [wIdx],wktFlvrEsri,wWkt [(wIdx == 4) ? 1 : wIdx % 3],0);
+				wOk &= (wSt [wIdx] == 0);
+			}
+			cs_WktCacheSize = wCacheSize;
+			for (wIdx = 1;wIdx < 5;wIdx += 1)
+			{
+				if (wIdx == 2) continue;
+				wOk &= !memcmp (&wCsDef [0],&wCsDef [wIdx],sizeof (wCsDef [0]));
+				wOk &= !memcmp (&wDtDef [0],&wDtDef [wIdx],sizeof (wDtDef [0]));
+				wOk &= !memcmp (&wElDef [0],&wElDef [wIdx],sizeof (wElDef [0]));
+			}
+			wOk &= (wCsDef [0].x_off == 500000.0 && wCsDef [2].x_off == 500001.0);
+			if (!wOk)
+			{
+				printf ("CS_wktToCsEx resolution cache produced an inconsistent result.\n");
+				err_cnt += 1;
+			}
+		}
+	}
+
+	/* Test the WKT writer.  Output delivered to a sink, and by the bulk
+	   export, must be identical to that written to a buffer; and the fixed
+	   point formatting of the writer must be identical to that of sprintf,
+	   including the rounding of ties and the sign of zero. */
+	{
+		int wxIdx;
+		int wxOk;
+		int wxSt [2];
+		int wxMismatch;
+		long32_t wxCount;
+		char wxWkt [2048];
+		char wxFixed [2][96];
+		std::string wxText;
+
+		static const double wxValues [] = { 0.125, -0.0001, 1.0E+17, 180.0, -0.0, 2.5, 1.0E+25, 0.1, 6378137.0, 0.375, 3.5 };
+		static const int wxPrecision [] = {     2,       3,       1,    14,    3,   0,       2,  17,         3,     2,   0 };
+
+		wxOk = TRUE;
+		for (wxIdx = wktFlvrOgc;wxIdx <= wktFlvrAutodesk;wxIdx += 1)
+		{
+			wxText.clear ();
+			wxSt [0] = CS_cs2WktEx (wxWkt,sizeof (wxWkt),"UTM83-13",wxIdx,cs_WKTFLG_MAPNAMES);
+			wxSt [1] = CS_cs2WktSink (CStestHwktSink,&wxText,"UTM83-13",wxIdx,cs_WKTFLG_MAPNAMES);
+			wxOk &= (wxSt [0] == wxSt [1] && wxText == wxWkt);
+		}
+		wxMismatch = 0;
+		wxCount = CS_cs2WktAll (CStestHwktExport,&wxMismatch,NULL,0,cs_WKTFLG_MAPNAMES);
+		wxOk &= (wxCount >= 4L && wxMismatch == 0);
+		if (!wxOk)
+		{
+			printf ("CS_cs2WktSink or CS_cs2WktAll output differs from that of CS_cs2WktEx.\n");
+			err_cnt += 1;
+		}
+
+		for (wxIdx = 0;wxIdx < (int)(sizeof (wxPrecision) / sizeof (wxPrecision [0]));wxIdx += 1)
+		{
+			TcsWktWriter wxWriter (wxFixed [0],sizeof (wxFixed [0]));
+			wxWriter.AppendFixed (wxValues [wxIdx],wxPrecision [wxIdx],(wxIdx & 1) ? 18 : 0);
+			sprintf (wxFixed [1],"%*.*f",(wxIdx & 1) ? 18 : 0,wxPrecision [wxIdx],wxValues [wxIdx]);
+			if (strcmp (wxFixed [0],wxFixed [1]))
+			{
+				printf ("TcsWktWriter::AppendFixed produced %s, sprintf produced %s.\n",wxFixed [0],wxFixed [1]);
+				err_cnt += 1;
+			}
+		}
+	}
+
+	/* Test the category index.  Category and item lookups must agree with
+	   a linear search of the category list, the categories containing an
+	   item must be produced in list order, and the index must follow the
+	   changes made by the item maintenance functions. */
+	{
+		int ctOk;
+		int ctLinear;
+		int ctCount;
+		unsigned ctCatIdx;
+		unsigned ctCatIdx2;
+		unsigned ctItmIdx;
+		unsigned ctItmIdx2;
+		unsigned ctNameCnt;
+		Const char* ctNamePtr;
+		char ctCatName [2][cs_CATDEF_CATNMSZ];
+		char ctItmName [cs_KEYNM_DEF];
+		char ctNewName [cs_KEYNM_DEF];
+
+		ctOk = TRUE;
+		for (ctCatIdx = 0;ctOk && (ctNamePtr = CS_getCatName (ctCatIdx)) != 0;ctCatIdx += 1)
+		{
+			CS_stncp (ctCatName [0],ctNamePtr,sizeof (ctCatName [0]));
+			ctNameCnt = (unsigned)CS_getItmNameCount (ctCatName [0]);
+			for (ctItmIdx = 0;ctOk && ctItmIdx < ctNameCnt;ctItmIdx += 1)
+			{
+				CS_stncp (ctItmName,CS_getItmName (ctCatName [0],ctItmIdx),sizeof (ctItmName));
+				for (ctItmIdx2 = 0;CS_stricmp (CS_getItmName (ctCatName [0],ctItmIdx2),ctItmName);ctItmIdx2 += 1);
+				ctOk = (CS_getItmIdx (ctCatName [0],ctItmName) == (int)ctItmIdx2);
+			}
+
+			// Every category must be listed as containing its first item.
+			if (ctOk && ctNameCnt > 0)
+			{
+				CS_stncp (ctItmName,CS_getItmName (ctCatName [0],0),sizeof (ctItmName));
+				ctCount = 0;
+				for (ctCatIdx2 = 0;(ctNamePtr = CS_getCatName (ctCatIdx2)) != 0;ctCatIdx2 += 1)
+				{
+					ctNameCnt = (unsigned)CS_getItmNameCount (ctNamePtr);
+					for (ctItmIdx2 = 0;ctItmIdx2 < ctNameCnt;ctItmIdx2 += 1)
+					{
+						if (!CS_stricmp (CS_getItmName (ctNamePtr,ctItmIdx2),ctItmName))
+						{
+							ctNamePtr = CS_getItmCatName (ctItmName,(unsigned)ctCount);
+							ctOk &= (ctNamePtr != 0 && !strcmp (ctNamePtr,CS_getCatName (ctCatIdx2)));
+							ctCount += 1;
+							break;
+						}
+					}
+				}
+				ctOk &= (CS_getItmCatCount (ctItmName) == ctCount && CS_getItmCatName (ctItmName,(unsigned)ctCount) == 0);
+			}
+		}
+		if (!ctOk || ctCatIdx == 0)
+		{
+			printf ("Category index lookup differs from a linear search of category %s.\n",ctCatName [0]);
+			err_cnt += 1;
+		}
+
+		ctLinear = 0;
+		for (ctCatIdx = 0;(ctNamePtr = CS_getCatName (ctCatIdx)) != 0;ctCatIdx += 1)
+		{
+			if (CS_getItmIdx (ctNamePtr,"ll84") >= 0)
+			{
+				ctLinear += 1;
+			}
+		}
+		if (CS_getItmCatCount ("LL84") != ctLinear || ctLinear == 0)
+		{
+			printf ("CS_getItmCatCount failed to count the categories containing LL84.\n");
+			err_cnt += 1;
+		}
+
+		if (CS_getCatName (1) != 0)
+		{
+			CS_stncp (ctCatName [0],CS_getCatName (0),sizeof (ctCatName [0]));
+			CS_stncp (ctCatName [1],CS_getCatName (1),sizeof (ctCatName [1]));
+			ctNameCnt = (unsigned)CS_getItmNameCount (ctCatName [0]);
+
+			CS_stncp (ctNewName,"CStestH-A",sizeof (ctNewName));
+			ctOk = (CSaddItmName (ctCatName [0],ctNewName) == 0);
+			CS_stncp (ctNewName,"CStestH-B",sizeof (ctNewName));
+			ctOk &= (CSaddItmName (ctCatName [0],ctNewName) == 0);
+			CS_stncp (ctNewName,"CStestH-B",sizeof (ctNewName));
+			ctOk &= (CSaddItmName (ctCatName [1],ctNewName) == 0);
+			ctOk &= (CS_getItmIdx (ctCatName [0],"cstesth-a") == (int)ctNameCnt);
+			ctOk &= (CS_getItmIdx (ctCatName [0],"CSTESTH-B") == (int)ctNameCnt + 1);
+			ctOk &= (CS_getItmCatCount ("CStestH-A") == 1);
+			ctOk &= (CS_getItmCatCount ("CStestH-B") == 2);
+			ctNamePtr = CS_getItmCatName ("CStestH-B",0);
+			ctOk &= (ctNamePtr != 0 && !strcmp (ctNamePtr,ctCatName [0]));
+			ctNamePtr = CS_getItmCatName ("CStestH-B",1);
+			ctOk &= (ctNamePtr != 0 && !strcmp (ctNamePtr,ctCatName [1]));
+
+			ctOk &= (CSrplItmName (ctCatName [0],ctNameCnt,"CStestH-C") == 0);
+			ctOk &= (CS_getItmIdx (ctCatName [0],"CStestH-A") < 0);
+			ctOk &= (CS_getItmIdx (ctCatName [0],"CStestH-C") == (int)ctNameCnt);
+			ctOk &= (CS_getItmCatCount ("CStestH-A") == 0);
+			ctOk &= (CS_getItmCatCount ("CStestH-C") == 1);
+
+			ctOk &= (CSrmvItmName (ctCatName [0],ctNameCnt) == 0);
+			ctOk &= (CS_getItmIdx (ctCatName [0],"CStestH-C") < 0);
+			ctOk &= (CS_getItmIdx (ctCatName [0],"CStestH-B") == (int)ctNameCnt);
+			ctOk &= (CS_getItmCatCount ("CStestH-C") == 0);
+			ctOk &= (CSrmvItmName (ctCatName [1],(unsigned)CS_getItmNameCount (ctCatName [1]) - 1) == 0);
+			ctOk &= (CS_getItmCatCount ("CStestH-B") == 1);
+			ctNamePtr = CS_getItmCatName ("CStestH-B",0);
+			ctOk &= (ctNamePtr != 0 && !strcmp (ctNamePtr,ctCatName [0]));
+			ctOk &= (CSrmvItmName (ctCatName [0],ctNameCnt) == 0);
+			ctOk &= (CS_getItmCatCount ("CStestH-B") == 0);
+			ctOk &= (CS_getItmNameCount (ctCatName [0]) == (int)ctNameCnt);
+			if (!ctOk)
+			{
+				printf ("Category index is not maintained by CSaddItmName/CSrplItmName/CSrmvItmName.\n");
+				err_cnt += 1;
+			}
+		}
+		CSrlsCategories ();
+	}
+
+	/* Test the coordinate system group index, using a copy of the
+	   coordinate system dictionary in a scratch directory.  The listing of
+	   each group must agree with a scan of the dictionary, must be a single
+	   array, and CS_csEnumByGroup must produce the same entries.  The index
+	   must be invalidated by CS_csdel and CS_csupd; CS_csEnumByGroup does
+	   not check the dictionary for changes within an enumeration, so a
+	   stale index produces the wrong second entry.  The index must also be
+	   rebuilt when the dictionary is replaced, even though its modification
+	   time is unchanged. */
+	{
+		extern struct cs_Grptbl_ cs_CsGrptbl [];
+
+		int gOk;
+		int gIdx;
+		int gCount;
+		int gCrypt;
+		short gProtect;
+		char gUnique;
+		csFILE *gStrm;
+		struct cs_Grptbl_ *gTblPtr;
+		struct cs_Csgrplst_ *gList;
+		struct cs_Csdef_ *gDelDef;
+		struct cs_Csgrplst_ gItem;
+		char gKeys [3][cs_KEYNM_DEF];
+
+		cs_Time_ gModTime;
+		char gDictDir [MAXPATH];
+		char gDir [MAXPATH];
+		char gPath [MAXPATH];
+		char gDtPath [MAXPATH];
+		char gElPath [MAXPATH];
+		char gTmpPath [MAXPATH];
+		char gSrcPath [MAXPATH];
+
+		__ALIGNMENT__1			/* Required by some Sun compilers. */
+		struct cs_Csdef_ gCsDef;
+
+		*cs_DirP = '\0';
+		CS_stncp (gDictDir,cs_Dir,sizeof (gDictDir));
+		gTmpPath [0] = '\0';
+		gOk = (CStestHscratch (gDir,sizeof (gDir),"CStestH_Grp") == 0 &&
+			   CStestHpath (gPath,sizeof (gPath),gDir,cs_Csname) == 0 &&
+			   CStestHpath (gDtPath,sizeof (gDtPath),gDir,cs_Dtname) == 0 &&
+			   CStestHpath (gElPath,sizeof (gElPath),gDir,cs_Elname) == 0 &&
+			   CStestHpath (gTmpPath,sizeof (gTmpPath),gDir,"CStestH.tmp") == 0);
+
+		/* CS_csupd validates the datum of the definition. */
+		gOk = gOk && (CStestHpath (gSrcPath,sizeof (gSrcPath),gDictDir,cs_Csname) == 0 &&
+					  CStestHcopy (gPath,gSrcPath,-1L) == 0);
+		gOk = gOk && (CStestHpath (gSrcPath,sizeof (gSrcPath),gDictDir,cs_Dtname) == 0 &&
+					  CStestHcopy (gDtPath,gSrcPath,-1L) == 0);
+		gOk = gOk && (CStestHpath (gSrcPath,sizeof (gSrcPath),gDictDir,cs_Elname) == 0 &&
+					  CStestHcopy (gElPath,gSrcPath,-1L) == 0);
+		gOk = gOk && (CS_altdr (gDir) == 0);
+		if (!gOk)
+		{
+			printf ("Scratch dictionary for the group index test could not be prepared.\n");
+			err_cnt += 1;
+		}
+		else
+		{
+			gOk = TRUE;
+			for (gTblPtr = cs_CsGrptbl;gOk && gTblPtr->group [0] != '\0';gTblPtr += 1)
+			{
+				gCount = CS_csgrp (gTblPtr->group,&gList);
+				gIdx = 0;
+				gStrm = CS_csopn (_STRM_BINRD);
+				gOk = (gCount >= 0 && gStrm != NULL);
+				while (gOk && CS_csrd (gStrm,&gCsDef,&gCrypt) > 0)
+				{
+					if (CS_stricmp (gCsDef.group,gTblPtr->group)) continue;
+					gOk = (gIdx < gCount);
+					if (gOk)
+					{
+						gOk = !CS_stricmp (gList [gIdx].key_nm,gCsDef.key_nm);
+						gOk &= (gList [gIdx].next == ((gIdx + 1 < gCount) ? &gList [gIdx + 1] : NULL));
+						gOk &= (CS_csEnumByGroup (gIdx,gTblPtr->group,&gItem) == 1);
+						gOk &= (gItem.next == NULL && !strcmp (gItem.key_nm,gList [gIdx].key_nm) &&
+														!strcmp (gItem.unit,gList [gIdx].unit) &&
+														!strcmp (gItem.ref_to,gList [gIdx].ref_to));
+					}
+					gIdx += 1;
+				}
+				if (gStrm != NULL) CS_csDictCls (gStrm);
+				gOk &= (gIdx == gCount && CS_csEnumByGroup (gCount,gTblPtr->group,&gItem) == 0);
+				CS_csgrpf (gList);
+			}
+			if (!gOk)
+			{
+				printf ("CS_csgrp/CS_csEnumByGroup listing of group %s differs from the dictionary.\n",(gTblPtr - 1)->group);
+				err_cnt += 1;
+			}
+			if (CS_csgrp ("CStestH-NoGroup",&gList) != -1 || gList != NULL || CS_csEnumByGroup (0,"CStestH-NoGroup",&gItem) != 0)
+			{
+				printf ("CS_csgrp accepted an unknown group key.\n");
+				err_cnt += 1;
+			}
+
+			/* Delete the first member of a group of at least three, and put it
+			   back again. */
+			gDelDef = NULL;
+			for (gTblPtr = cs_CsGrptbl;gTblPtr->group [0] != '\0';gTblPtr += 1)
+			{
+				for (gIdx = 0;gIdx < 3 && CS_csEnumByGroup (gIdx,gTblPtr->group,&gItem) == 1;gIdx += 1)
+				{
+					CS_stncp (gKeys [gIdx],gItem.key_nm,sizeof (gKeys [gIdx]));
+				}
+				if (gIdx == 3)
+				{
+					gDelDef = CS_csdef (gKeys [0]);
+					break;
+				}
+			}
+			if (gDelDef == NULL)
+			{
+				printf ("No group suitable for testing the group index invalidation.\n");
+				err_cnt += 1;
+			}
+			else
+			{
+				gProtect = cs_Protect;
+				gUnique = cs_Unique;
+				cs_Protect = -1;
+				cs_Unique = '\0';
+				gOk = (CS_csEnumByGroup (0,gTblPtr->group,&gItem) == 1);
+				gOk &= (CS_csdel (gDelDef) == 0);
+				gOk &= (CS_csEnumByGroup (1,gTblPtr->group,&gItem) == 1 && !strcmp (gItem.key_nm,gKeys [2]));
+				if (!gOk)
+				{
+					printf ("Group index not invalidated by CS_csdel.\n");
+					err_cnt += 1;
+				}
+				gOk = (CS_csEnumByGroup (0,gTblPtr->group,&gItem) == 1);
+				gOk &= (CS_csupd (gDelDef,FALSE) >= 0);
+				gOk &= (CS_csEnumByGroup (1,gTblPtr->group,&gItem) == 1 && !strcmp (gItem.key_nm,gKeys [1]));
+				if (!gOk)
+				{
+					printf ("Group index not invalidated by CS_csupd.\n");
+					err_cnt += 1;
+				}
+
+				/* Replace the dictionary by one with no definitions at all,
+				   keeping its modification time. */
+				gList = NULL;
+				gModTime = CS_fileModTime (gPath);
+				gOk = (CStestHcopy (gTmpPath,gPath,(long)sizeof (cs_magic_t)) == 0 &&
+					   CS_remove (gPath) == 0 && CS_rename (gTmpPath,gPath) == 0 &&
+					   CStestHsetModTime (gPath,gModTime) == 0);
+				gOk = gOk && (CS_csgrp (gTblPtr->group,&gList) == 0);
+				if (!gOk)
+				{
+					printf ("Group index not rebuilt for a replaced dictionary.\n");
+					err_cnt += 1;
+				}
+				CS_csgrpf (gList);
+				cs_Protect = gProtect;
+				cs_Unique = gUnique;
+				CS_free (gDelDef);
+			}
+		}
+		CS_altdr (gDictDir);
+		CS_rlsGrpIndex ();
+		if (gTmpPath [0] != '\0')
+		{
+			CS_remove (gPath);
+			CS_remove (gDtPath);
+			CS_remove (gElPath);
+			CS_remove (gTmpPath);
+			CStestHrmdir (gDir);
+		}
+	}
+
+	/* Test the unit and projection table indices.  Each look up must
+	   produce exactly what a linear search of the table produces,
+	   regardless of case, and the unit index must follow the changes
+	   made by CS_unitAdd and CS_unitDel. */
+	{
+		extern struct cs_Unittab_ cs_Unittab [];
+		extern struct cs_Prjtab_ cs_Prjtab [];
+		extern struct cs_PrjprmMap_ cs_PrjprmMap [];
+
+		int pxOk;
+		int pxAbrv;
+		char *pxCp;
+		double pxFactor;
+		unsigned short pxCode;
+		struct cs_Unittab_ *pxUnit;
+		struct cs_Unittab_ *pxRef;
+		struct cs_Prjtab_ *pxPrj;
+		struct cs_Prjtab_ *pxPrjRef;
+		struct cs_PrjprmMap_ *pxMap;
+		struct cs_Unittab_ pxNewUnit;
+		char pxName [cs_KEYNM_DEF];
+
+		pxOk = TRUE;
+		for (pxPrj = cs_Prjtab;pxOk && pxPrj->key_nm [0] != '\0';pxPrj += 1)
+		{
+			CS_stncp (pxName,pxPrj->key_nm,sizeof (pxName));
+			for (pxCp = pxName;*pxCp != '\0';pxCp += 1) *pxCp = (char)tolower (*pxCp);
+			for (pxPrjRef = cs_Prjtab;CS_stricmp (pxPrjRef->key_nm,pxName);pxPrjRef += 1);
+			pxOk = (CS_prjtabPtr (pxPrj->key_nm) == pxPrjRef && CS_prjtabPtr (pxName) == pxPrjRef);
+		}
+		pxOk &= (CS_prjtabPtr ("CStestH-NoProj")->key_nm [0] == '\0' && CS_prjtabPtr ("")->setup == NULL);
+		for (pxCode = 0;pxOk && pxCode < 1024;pxCode += 1)
+		{
+			for (pxMap = cs_PrjprmMap;pxMap->prj_code != cs_PRJCOD_END && pxMap->prj_code != pxCode;pxMap += 1);
+			pxOk = (CS_prjprmMapPtr (pxCode) == pxMap);
+		}
+		if (!pxOk)
+		{
+			printf ("CS_prjtabPtr/CS_prjprmMapPtr result differs from a search of the table.\n");
+			err_cnt += 1;
+		}
+
+		pxOk = TRUE;
+		for (pxUnit = cs_Unittab;pxOk && pxUnit->type != cs_UTYP_END;pxUnit += 1)
+		{
+			if (pxUnit->type == cs_UTYP_OFF) continue;
+			for (pxAbrv = 0;pxAbrv < 2;pxAbrv += 1)
+			{
+				CS_stncp (pxName,pxAbrv ? pxUnit->abrv : pxUnit->name,sizeof (pxName));
+				if (pxName [0] == '\0') continue;
+				for (pxCp = pxName;*pxCp != '\0';pxCp += 1) *pxCp = (char)tolower (*pxCp);
+				for (pxRef = cs_Unittab;pxRef->type != cs_UTYP_END;pxRef += 1)
+				{
+					if (pxRef->type == pxUnit->type && !CS_stricmp (pxRef->name,pxName)) break;
+				}
+				if (pxRef->type == cs_UTYP_END)
+				{
+					for (pxRef = cs_Unittab;pxRef->type != cs_UTYP_END;pxRef += 1)
+					{
+						if (pxRef->type == pxUnit->type && !CS_stricmp (pxRef->abrv,pxName)) break;
+					}
+				}
+				pxFactor = (pxRef->type == cs_UTYP_END) ? 0.0 : pxRef->factor;
+				pxOk &= (CS_unitlu (pxUnit->type,pxName) == pxFactor);
+			}
+		}
+		memset (&pxNewUnit,0,sizeof (pxNewUnit));
+		pxNewUnit.type = cs_UTYP_LEN;
+		CS_stncp (pxNewUnit.name,"CStestH-Unit",sizeof (pxNewUnit.name));
+		CS_stncp (pxNewUnit.pluralName,"CStestH-Units",sizeof (pxNewUnit.pluralName));
+		CS_stncp (pxNewUnit.abrv,"CStHu",sizeof (pxNewUnit.abrv));
+		pxNewUnit.factor = 1234.5;
+		pxOk &= (CS_unitlu (cs_UTYP_LEN,"CStestH-Unit") == 0.0);
+		pxOk &= (CS_unitAdd (&pxNewUnit) == 0);
+		pxOk &= (CS_unitlu (cs_UTYP_LEN,"cstesth-unit") == 1234.5 && CS_unitlu (cs_UTYP_LEN,"CSTHU") == 1234.5);
+		pxOk &= (CS_unitlu (cs_UTYP_ANG,"CStestH-Unit") == 0.0);
+		pxOk &= (CS_unitDel (cs_UTYP_LEN,"CStestH-Unit") == 0);
+		pxOk &= (CS_unitlu (cs_UTYP_LEN,"CStestH-Unit") == 0.0 && CS_unitlu (cs_UTYP_LEN,"CStHu") == 0.0);
+		pxOk &= (CS_unitlu (cs_UTYP_LEN," [Meter] ") == CS_unitlu (cs_UTYP_LEN,"METER"));
+		if (!pxOk)
+		{
+			printf ("CS_unitlu result differs from a search of the unit table, or is not maintained by CS_unitAdd/CS_unitDel.\n");
+			err_cnt += 1;
+		}
+	}
+
+	/* Test the batch grid interpolation functions.  Every point of a batch
+	   must produce exactly what the single point function produces; a system
+	   error must be reported for the failed point and all which follow it. */
+	{
+		extern char cs_DirsepC;
+
+		int gbOk;
+		int gbIdx;
+		int gbPass;
+		int gbStatus;
+		int gbRtn;
+		struct cs_NTv2_* gbNTv2;
+		double gbDelta [2];
+		double gbHgt;
+		int gbStat [64];
+		double gbResult [64];
+		double gbDeltas [64][2];
+		double gbLL [64][3];
+
+		/* Points 0 through 9 are on the same latitude; point 10 has no
+		   coverage and point 12 produces a system error. */
+		for (gbIdx = 0;gbIdx < 16;gbIdx += 1)
+		{
+			gbLL [gbIdx][0] = 10.0 + (double)gbIdx;
+			gbLL [gbIdx][1] = (gbIdx == 10) ? 61.0 : ((gbIdx == 12) ? 45.0 : 50.0);
+			gbLL [gbIdx][2] = 0.0;
+		}
+		for (gbPass = 0;gbPass < 2;gbPass += 1)
+		{
+			for (gbIdx = 0;gbIdx < 16;gbIdx += 1) gbStat [gbIdx] = 99;
+			if (gbPass == 0)
+			{
+				gbRtn = CSbilinearBatch (0,CStestHgatherBilinear,gbResult,gbStat,(Const double (*)[3])gbLL,16,-1.0);
+			}
+			else
+			{
+				gbRtn = CSbiquadBatch (0,CStestHgatherBiquad,gbResult,gbStat,(Const double (*)[3])gbLL,16,-1.0);
+			}
+			gbOk = (gbRtn == csGRIDI_ST_SYSTEM);
+			for (gbIdx = 0;gbIdx < 16;gbIdx += 1)
+			{
+				if (gbIdx < 10 || gbIdx == 11)
+				{
+					gbOk &= (gbStat [gbIdx] == csGRIDI_ST_OK && fabs (gbResult [gbIdx] - gbLL [gbIdx][0]) < 1.0E-12);
+				}
+				else if (gbIdx == 10)
+				{
+					gbOk &= (gbStat [gbIdx] == csGRIDI_ST_COVERAGE && gbResult [gbIdx] == -1.0);
+				}
+				else
+				{
+					gbOk &= (gbStat [gbIdx] == csGRIDI_ST_SYSTEM && gbResult [gbIdx] == -1.0);
+				}
+			}
+			if (!gbOk)
+			{
+				printf ("%s did not report the status of each point.\n",(gbPass == 0) ? "CSbilinearBatch" : "CSbiquadBatch");
+				err_cnt += 1;
+			}
+		}
+
+		/* A scattered set of points, some of which are outside the coverage
+		   of the grid file. */
+		for (gbIdx = 0;gbIdx < 64;gbIdx += 1)
+		{
+			gbLL [gbIdx][0] = 5.0 + (double)((gbIdx * 37) % 64) * 0.17;
+			gbLL [gbIdx][1] = 46.0 + (double)((gbIdx * 11) % 64) * 0.15;
+			gbLL [gbIdx][2] = 0.0;
+		}
+		CS_stcpy (cs_DirP,"Germany");
+		sprintf (cs_DirP + strlen (cs_DirP),"%cBETA2007.gsb",cs_DirsepC);
+		gbNTv2 = (CS_access (cs_Dir,4) == 0) ? CSnewNTv2 (cs_Dir,0L,0UL,0.0) : NULL;
+		CS_stcpy (cs_DirP,"");
+		if (gbNTv2 != NULL)
+		{
+			gbRtn = CScalcNTv2N (gbNTv2,gbDeltas,gbStat,(Const double (*)[3])gbLL,64);
+			gbOk = (gbRtn >= 0);
+			for (gbIdx = 0;gbOk && gbIdx < 64;gbIdx += 1)
+			{
+				gbStatus = CScalcNTv2 (gbNTv2,gbDelta,gbLL [gbIdx]);
+				gbOk = (gbStatus == gbStat [gbIdx]);
+				if (gbOk && gbStatus == 0)
+				{
+					gbOk = fabs (gbDelta [0] - gbDeltas [gbIdx][0]) < 1.0E-12 &&
+						   fabs (gbDelta [1] - gbDeltas [gbIdx][1]) < 1.0E-12;
+				}
+			}
+			if (!gbOk)
+			{
+				printf ("CScalcNTv2N result differs from CScalcNTv2 at point %d.\n",gbIdx - 1);
+				err_cnt += 1;
+			}
+			CSdeleteNTv2 (gbNTv2);
+		}
+
+		for (gbIdx = 0;gbIdx < 64;gbIdx += 1)
+		{
+			gbLL [gbIdx][0] = -158.0 + (double)((gbIdx * 37) % 64) * 1.5;
+			gbLL [gbIdx][1] = 18.0 + (double)((gbIdx * 11) % 64) * 0.5;
+		}
+		CS_geoidHgtN ((Const double (*)[3])gbLL,gbResult,gbStat,64);
+		gbOk = TRUE;
+		for (gbIdx = 0;gbOk && gbIdx < 64;gbIdx += 1)
+		{
+			gbStatus = CS_geoidHgt (gbLL [gbIdx],&gbHgt);
+			gbOk = (gbStatus == gbStat [gbIdx]);
+			if (gbOk && gbStatus == 0)
+			{
+				gbOk = fabs (gbHgt - gbResult [gbIdx]) < 1.0E-9;
+			}
+		}
+		if (!gbOk)
+		{
+			printf ("CS_geoidHgtN result differs from CS_geoidHgt at point %d.\n",gbIdx - 1);
+			err_cnt += 1;
+		}
+	}
+
 #ifdef __SKIP__
 	/* Test the Geoid height functions. */
 	testLatLng [0] = -105.123456789;